@@ -20,9 +20,15 @@
 #include <zsv/utils/mem.h>
 #include <zsv/utils/string.h>
 #include <zsv/utils/os.h>
+#include <zsv/utils/coltype.h>
 
 #include <yajl_helper/yajl_helper.h>
 
+#ifndef ZSV_NO_PARALLEL
+#include <pthread.h>
+#include "utils/chunk.h"
+#endif
+
 #define ZSV_2DB_DEFAULT_TABLE_NAME "mytable"
 
 enum zsv_2db_action {
@@ -65,6 +71,29 @@ struct zsv_2db_options {
 
 typedef struct zsv_2db_data *zsv_2db_handle;
 
+#ifndef ZSV_NO_PARALLEL
+#define ZSV_2DB_PARALLEL_MIN_BYTES (1024 * 1024 * 2)
+
+/**
+ * Parallel CSV ingest: chunk 0 is inserted directly into the output db by the
+ * main thread; each other chunk is parsed by a worker thread into its own
+ * staging db (<output>.tmp.<n>), and the stages are then appended to the output
+ * table in chunk order so that rowids follow input order
+ */
+struct zsv_2db_chunk {
+  struct zsv_chunk chunk;
+  size_t rows_inserted;
+  int status;
+  char *stage_fn;
+  struct zsv_2db_data *data; // shared, read-only while workers run
+};
+
+struct zsv_2db_parallel_data {
+  struct zsv_chunk_runner runner;
+  struct zsv_2db_chunk *chunks;
+};
+#endif
+
 struct zsv_2db_data {
   struct zsv_2db_options opts;
 
@@ -99,11 +128,25 @@ struct zsv_2db_data {
 
   } json_parser;
 
+  // CSV input with --infer-types: enum zsv_coltype of each column, else NULL
+  unsigned char *coltypes;
+  size_t coltype_count;
+
   size_t rows_processed;
   size_t row_insert_attempts;
   size_t rows_inserted;
 #define ZSV_2DB_MSG_BATCH_SIZE 10000 // number of rows between each console update (if verbose)
 
+#ifndef ZSV_NO_PARALLEL
+  const char *input_path;
+  struct zsv_opts *csv_opts; // template for worker parsers
+  unsigned int num_chunks;
+  struct zsv_2db_parallel_data *pdata;
+  size_t end_offset_limit; // where chunk 0 (main thread) should stop
+  size_t next_row_start;   // where chunk 0 actually ended
+  char cancelled;
+#endif
+
   int err;
 };
 
@@ -185,6 +228,7 @@ static void zsv_2db_delete(zsv_2db_handle data) {
   zsv_2db_ix_free(&data->json_parser.current_index);
 
   free(data->json_parser.row_values);
+  free(data->coltypes);
 
   yajl_helper_delete(data->json_parser.yh);
 
@@ -281,6 +325,7 @@ static sqlite3_str *build_create_table_statement(sqlite3 *db, const char *tname,
     sqlite3_str_appendf(pStr, "\"%w\"", colnames[i]);
 
     const char *datatype = datatypes ? datatypes[i] : NULL;
+    char datatype_specified = datatype != NULL;
     if (!datatype || !(!strcmp("int", datatype) || !strcmp("integer", datatype) || !strcmp("real", datatype) ||
                        !strcmp("text", datatype))) {
       if (datatype)
@@ -296,7 +341,8 @@ static sqlite3_str *build_create_table_statement(sqlite3 *db, const char *tname,
           err = 1;
         } else
           sqlite3_str_appendf(pStr, " %s collate %s", datatype, collate);
-      }
+      } else if (datatype_specified)
+        sqlite3_str_appendf(pStr, " %s", datatype);
     }
   }
   if (err) {
@@ -344,16 +390,17 @@ static sqlite3_stmt *create_insert_statement(sqlite3 *db, const char *tname, uns
   return insert_stmt;
 }
 
-// return error
-static int zsv_2db_set_insert_stmt(struct zsv_2db_data *data) {
+// zsv_2db_create_table: create the table defined by data's columns in db and
+// prepare its insert statement. Used for the output db and for parallel-ingest
+// staging dbs, so that both always have identical schemas. Return error
+static int zsv_2db_create_table(struct zsv_2db_data *data, sqlite3 *db, sqlite3_stmt **insert_stmt) {
   int err = 0;
-  if (!data->json_parser.col_count) {
-    fprintf(stderr, "insert statement called with no columns to insert");
+  const char **colnames = calloc(data->json_parser.col_count, sizeof(*colnames));
+  const char **datatypes = calloc(data->json_parser.col_count, sizeof(*datatypes));
+  const char **collates = calloc(data->json_parser.col_count, sizeof(*collates));
+  if (!colnames || !datatypes || !collates)
     err = 1;
-  } else {
-    const char **colnames = calloc(data->json_parser.col_count, sizeof(*colnames));
-    const char **datatypes = calloc(data->json_parser.col_count, sizeof(*datatypes));
-    const char **collates = calloc(data->json_parser.col_count, sizeof(*collates));
+  else {
     unsigned int i = 0;
     for (struct zsv_2db_column *e = data->json_parser.columns; e; e = e->next, i++) {
       colnames[i] = e->name;
@@ -366,31 +413,55 @@ static int zsv_2db_set_insert_stmt(struct zsv_2db_data *data) {
     // to ZSV_2DB_DEFAULT_TABLE_NAME; create_insert_statement does not).
     const char *tname = data->opts.table_name ? data->opts.table_name : ZSV_2DB_DEFAULT_TABLE_NAME;
     sqlite3_str *create_sql =
-      build_create_table_statement(data->db, tname, colnames, datatypes, collates, data->json_parser.col_count);
+      build_create_table_statement(db, tname, colnames, datatypes, collates, data->json_parser.col_count);
     if (!create_sql)
       err = 1;
     else {
-      if (!(err = zsv_2db_sqlite3_exec_2db(data->db, sqlite3_str_value(create_sql))) &&
-          !(data->json_parser.insert_stmt = create_insert_statement(data->db, tname, data->json_parser.col_count))) {
+      if (!(err = zsv_2db_sqlite3_exec_2db(db, sqlite3_str_value(create_sql))) &&
+          !(*insert_stmt = create_insert_statement(db, tname, data->json_parser.col_count)))
         err = 1;
-        zsv_2db_start_transaction(data);
-      } else
-        data->json_parser.stmt_colcount = data->json_parser.col_count;
       sqlite3_free(sqlite3_str_finish(create_sql));
     }
+  }
+  free(colnames);
+  free(datatypes);
+  free(collates);
+  return err;
+}
 
-    free(colnames);
-    free(datatypes);
-    free(collates);
+// return error
+static int zsv_2db_set_insert_stmt(struct zsv_2db_data *data) {
+  int err = 0;
+  if (!data->json_parser.col_count) {
+    fprintf(stderr, "insert statement called with no columns to insert");
+    err = 1;
+  } else if (!(err = zsv_2db_create_table(data, data->db, &data->json_parser.insert_stmt))) {
+    data->json_parser.stmt_colcount = data->json_parser.col_count;
+    zsv_2db_start_transaction(data);
   }
   return err;
 }
 
+// zsv_2db_bind_value: bind a non-empty value as an integer or real if its
+// column was inferred as such and the value parses strictly; otherwise as text
+static void zsv_2db_bind_value(sqlite3_stmt *stmt, int ix, const unsigned char *s, size_t len, unsigned char coltype) {
+  int64_t i64;
+  double dbl;
+  if (coltype == zsv_coltype_integer && zsv_parse_int64(s, len, &i64))
+    sqlite3_bind_int64(stmt, ix, i64);
+  else if (coltype != zsv_coltype_text && zsv_parse_double(s, len, &dbl))
+    sqlite3_bind_double(stmt, ix, dbl);
+  else
+    sqlite3_bind_text(stmt, ix, (const char *)s, (int)len, SQLITE_STATIC);
+}
+
 /*
   add_local_db_row(): return sqlite3 error, or 0 on ok
+  coltypes: optional array of enum zsv_coltype, one per value
 */
 static int zsv_2db_insert_row_values(sqlite3_stmt *stmt, unsigned stmt_colcount, char const *const *const values,
-                                     unsigned int values_count) {
+                                     unsigned int values_count, const unsigned char *coltypes,
+                                     size_t coltype_count) {
   if (!stmt)
     return -1;
 
@@ -402,7 +473,8 @@ static int zsv_2db_insert_row_values(sqlite3_stmt *stmt, unsigned stmt_colcount,
   for (unsigned int i = 0; i < values_count; i++) {
     const char *val = values[i];
     if (val && *val)
-      sqlite3_bind_text(stmt, (int)i + 1, val, (int)strlen(val), SQLITE_STATIC);
+      zsv_2db_bind_value(stmt, (int)i + 1, (const unsigned char *)val, strlen(val),
+                         i < coltype_count ? coltypes[i] : zsv_coltype_text);
     else
       // don't use sqlite3_bind_null, else x = ? will fail if value is ""/null
       sqlite3_bind_text(stmt, (int)i + 1, "", 0, SQLITE_STATIC);
@@ -438,7 +510,8 @@ static int zsv_2db_insert_row(struct zsv_2db_data *data) {
         return 0;
       int rc =
         zsv_2db_insert_row_values(data->json_parser.insert_stmt, data->json_parser.stmt_colcount,
-                                  (char const *const *const)data->json_parser.row_values, data->json_parser.col_count);
+                                  (char const *const *const)data->json_parser.row_values, data->json_parser.col_count,
+                                  data->coltypes, data->coltype_count);
       data->row_insert_attempts++;
       if (!rc) {
         data->rows_inserted++;
@@ -607,8 +680,8 @@ static int json_process_value(yajl_helper_t yh, struct json_value *value) {
  * state: the first row registers columns (header), subsequent rows are inserted
  * as data. Drives the same DB-side helpers as the JSON path (DRY).
  *
- * Future work (out of scope, see SPEC): type inference (all columns are TEXT),
- * CSV-driven index creation, --append, and multi-table import.
+ * Future work (out of scope, see SPEC): CSV-driven index creation, --append,
+ * and multi-table import.
  */
 static void zsv_2db_csv_row(void *ctx) {
   struct zsv_2db_data *data = ctx;
@@ -654,6 +727,9 @@ static void zsv_2db_csv_row(void *ctx) {
         }
       }
 
+      if (i < data->coltype_count && data->coltypes[i] != zsv_coltype_text)
+        col.datatype = strdup(zsv_coltype_name(data->coltypes[i]));
+
       if (!zsv_2db_append_column(data, &col)) {
         zsv_2db_column_free(&col);
         data->err = 1;
@@ -684,6 +760,255 @@ static void zsv_2db_csv_row(void *ctx) {
   }
 }
 
+#ifndef ZSV_NO_PARALLEL
+/* parallel csv ingest */
+
+struct zsv_2db_stage_ctx {
+  struct zsv_2db_chunk *chunk;
+  zsv_parser parser;
+  sqlite3 *db;
+  sqlite3_stmt *insert_stmt;
+  unsigned int col_count;
+  size_t limit_len;
+  int cancelled;
+};
+
+static void zsv_2db_parallel_data_delete(struct zsv_2db_parallel_data *pd) {
+  if (pd) {
+    for (unsigned int i = 0; pd->chunks && i < pd->runner.chunk_count; i++) {
+      if (pd->chunks[i].stage_fn) {
+        unlink(pd->chunks[i].stage_fn);
+        free(pd->chunks[i].stage_fn);
+      }
+    }
+    zsv_chunks_free(&pd->runner);
+    free(pd->chunks);
+    free(pd);
+  }
+}
+
+static void *zsv_2db_process_chunk(void *arg);
+
+static struct zsv_2db_parallel_data *zsv_2db_parallel_data_new(struct zsv_2db_data *data, unsigned int count) {
+  struct zsv_2db_parallel_data *pd = calloc(1, sizeof(*pd));
+  if (!pd)
+    return NULL;
+  pd->runner.chunk_count = count;
+  if (!(pd->chunks = calloc(count, sizeof(*pd->chunks)))) {
+    zsv_2db_parallel_data_delete(pd);
+    return NULL;
+  }
+  for (unsigned int i = 0; i < count; i++)
+    pd->chunks[i].data = data;
+  pd->runner.chunks = pd->chunks;
+  pd->runner.chunk_size = sizeof(*pd->chunks);
+  pd->runner.process = zsv_2db_process_chunk;
+  return pd;
+}
+
+// zsv_2db_stage_insert: bind the current row's cells directly from the parser
+// buffer (no copy) with the same semantics as zsv_2db_csv_row(): missing cells
+// bind as "", extra cells are ignored and rows without any data are skipped
+static void zsv_2db_stage_insert(struct zsv_2db_stage_ctx *w) {
+  size_t cell_count = zsv_cell_count(w->parser);
+  char have_row_data = 0;
+  if (cell_count > w->col_count)
+    cell_count = w->col_count;
+  for (size_t i = 0; i < cell_count; i++) {
+    struct zsv_cell cell = zsv_get_cell(w->parser, i);
+    if (cell.str && cell.len) {
+      zsv_2db_bind_value(w->insert_stmt, (int)i + 1, cell.str, cell.len,
+                         i < w->chunk->data->coltype_count ? w->chunk->data->coltypes[i] : zsv_coltype_text);
+      have_row_data = 1;
+    } else
+      sqlite3_bind_text(w->insert_stmt, (int)i + 1, "", 0, SQLITE_STATIC);
+  }
+  if (!have_row_data)
+    return;
+  for (size_t i = cell_count; i < w->col_count; i++)
+    sqlite3_bind_text(w->insert_stmt, (int)i + 1, "", 0, SQLITE_STATIC);
+
+  int rc = sqlite3_step(w->insert_stmt);
+  if (rc == SQLITE_DONE)
+    w->chunk->rows_inserted++;
+  else if (!w->chunk->status) {
+    fprintf(stderr, "Unable to insert: %s\n", sqlite3_errstr(rc));
+    w->chunk->status = 1;
+  }
+  sqlite3_reset(w->insert_stmt);
+}
+
+static void zsv_2db_stage_row_done(void *ctx) {
+  struct zsv_2db_stage_ctx *w = ctx;
+  // absolute offset of the start of the next row
+  w->chunk->chunk.actual_next_row_start =
+    w->chunk->chunk.start_offset + zsv_cum_scanned_length(w->parser) - zsv_row_length_raw_bytes(w->parser);
+  zsv_abort(w->parser);
+  w->cancelled = 1;
+}
+
+static void zsv_2db_stage_row(void *ctx) {
+  struct zsv_2db_stage_ctx *w = ctx;
+  zsv_2db_stage_insert(w);
+  if (UNLIKELY(zsv_cum_scanned_length(w->parser) >= w->limit_len))
+    zsv_set_row_handler(w->parser, zsv_2db_stage_row_done);
+}
+
+static int zsv_2db_stage_open(struct zsv_2db_stage_ctx *w) {
+  struct zsv_2db_chunk *c = w->chunk;
+  if (!c->stage_fn && asprintf(&c->stage_fn, "%s.%u", c->data->db_fn_tmp, c->chunk.id) == -1) {
+    c->stage_fn = NULL;
+    return 1;
+  }
+  unlink(c->stage_fn); // in case we are re-running due to incorrect chunk start
+  if (sqlite3_open_v2(c->stage_fn, &w->db, SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE, NULL) != SQLITE_OK) {
+    fprintf(stderr, "Unable to open db at %s: %s\n", c->stage_fn, w->db ? sqlite3_errmsg(w->db) : "");
+    return 1;
+  }
+  sqlite3_exec(w->db, "PRAGMA synchronous = OFF", NULL, NULL, NULL);
+  sqlite3_exec(w->db, "PRAGMA journal_mode = OFF", NULL, NULL, NULL);
+  if (zsv_2db_create_table(c->data, w->db, &w->insert_stmt))
+    return 1;
+  w->col_count = c->data->json_parser.col_count;
+  return zsv_2db_sqlite3_exec_2db(w->db, "BEGIN TRANSACTION");
+}
+
+static void *zsv_2db_process_chunk(void *arg) {
+  struct zsv_2db_chunk *c = arg;
+  c->rows_inserted = 0;
+  c->status = 0;
+  if (c->chunk.start_offset >= c->chunk.end_offset) {
+    c->chunk.actual_next_row_start = c->chunk.start_offset;
+    if (c->stage_fn) { // discard any prior run
+      unlink(c->stage_fn);
+      free(c->stage_fn);
+      c->stage_fn = NULL;
+    }
+    return NULL;
+  }
+
+  struct zsv_2db_stage_ctx w = {0};
+  w.chunk = c;
+  w.limit_len = c->chunk.end_offset - c->chunk.start_offset;
+
+  FILE *f = NULL;
+  if (zsv_2db_stage_open(&w) || !(f = fopen(c->data->input_path, "rb")) ||
+      fseeko(f, (off_t)c->chunk.start_offset, SEEK_SET) != 0)
+    c->status = 1;
+  else {
+    struct zsv_opts opts;
+    zsv_chunk_opts(&opts, c->data->csv_opts, NULL, NULL, f);
+    opts.row_handler = zsv_2db_stage_row;
+    opts.ctx = &w;
+    if (!(w.parser = zsv_new(&opts)))
+      c->status = 1;
+    else {
+      enum zsv_status status = zsv_status_ok;
+      while (status == zsv_status_ok && !w.cancelled)
+        status = zsv_parse_more(w.parser);
+      if (!w.cancelled) { // reached eof
+        zsv_finish(w.parser);
+        c->chunk.actual_next_row_start = c->chunk.start_offset + zsv_cum_scanned_length(w.parser);
+      }
+      zsv_delete(w.parser);
+    }
+  }
+  if (f)
+    fclose(f);
+  if (w.insert_stmt)
+    sqlite3_finalize(w.insert_stmt);
+  if (w.db) {
+    if (!c->status && zsv_2db_sqlite3_exec_2db(w.db, "COMMIT"))
+      c->status = 1;
+    sqlite3_close(w.db);
+  }
+  return NULL;
+}
+
+static void zsv_2db_csv_row_parallel_done(void *ctx) {
+  struct zsv_2db_data *data = ctx;
+  data->next_row_start = zsv_cum_scanned_length(data->csv_parser) - zsv_row_length_raw_bytes(data->csv_parser);
+  zsv_abort(data->csv_parser);
+  data->cancelled = 1;
+}
+
+static void zsv_2db_csv_row_parallel(void *ctx) {
+  struct zsv_2db_data *data = ctx;
+  zsv_2db_csv_row(ctx);
+  if (UNLIKELY(zsv_cum_scanned_length(data->csv_parser) >= data->end_offset_limit))
+    zsv_set_row_handler(data->csv_parser, zsv_2db_csv_row_parallel_done);
+}
+
+// zsv_2db_csv_header_parallel: process the header row, then split the rest of
+// the input into chunks and start a worker for each chunk after the first
+static void zsv_2db_csv_header_parallel(void *ctx) {
+  struct zsv_2db_data *data = ctx;
+  zsv_2db_csv_row(ctx);
+  zsv_set_row_handler(data->csv_parser, zsv_2db_csv_row);
+  if (data->err)
+    return;
+
+  if (!(data->pdata = zsv_2db_parallel_data_new(data, data->num_chunks)))
+    fprintf(stderr, "Out of memory!\n");
+  else if (zsv_chunks_start(&data->pdata->runner, data->input_path, ZSV_2DB_PARALLEL_MIN_BYTES,
+                            zsv_cum_scanned_length(data->csv_parser), data->csv_opts) == 0) {
+    data->end_offset_limit = data->pdata->chunks[0].chunk.end_offset;
+    zsv_set_row_handler(data->csv_parser, zsv_2db_csv_row_parallel);
+  } else { // too small to split; run serially
+    zsv_2db_parallel_data_delete(data->pdata);
+    data->pdata = NULL;
+  }
+}
+
+// zsv_2db_merge_stage: append a staging table to the output table. Return error
+static int zsv_2db_merge_stage(struct zsv_2db_data *data, struct zsv_2db_chunk *c) {
+  const char *tname = data->opts.table_name ? data->opts.table_name : ZSV_2DB_DEFAULT_TABLE_NAME;
+  int err = 1;
+  char *sql = sqlite3_mprintf("ATTACH DATABASE %Q AS zsv_2db_stage", c->stage_fn);
+  if (sql && !zsv_2db_sqlite3_exec_2db(data->db, sql)) {
+    sqlite3_free(sql);
+    sql = sqlite3_mprintf("INSERT INTO main.\"%w\" SELECT * FROM zsv_2db_stage.\"%w\" ORDER BY rowid", tname, tname);
+    if (sql && !(err = zsv_2db_sqlite3_exec_2db(data->db, sql)))
+      data->rows_inserted += (size_t)sqlite3_changes(data->db);
+    zsv_2db_sqlite3_exec_2db(data->db, "DETACH DATABASE zsv_2db_stage");
+  }
+  sqlite3_free(sql);
+  return err;
+}
+
+// zsv_2db_parallel_finish: wait for all workers, reprocess any chunk whose
+// guessed start was wrong, and merge stages in order. Return error
+static int zsv_2db_parallel_finish(struct zsv_2db_data *data) {
+  struct zsv_2db_parallel_data *pd = data->pdata;
+  int err = data->err;
+  if (!data->cancelled) // chunk 0 reached eof
+    data->next_row_start = zsv_cum_scanned_length(data->csv_parser);
+
+  size_t prev_end = data->next_row_start;
+  for (unsigned int i = 1; i < pd->runner.chunk_count; i++) {
+    struct zsv_2db_chunk *c = zsv_chunks_next(&pd->runner, i, &prev_end);
+    if (c->status)
+      err = 1;
+  }
+
+  if (!err) {
+    zsv_2db_end_transaction(data); // ATTACH is not permitted within a transaction
+    for (unsigned int i = 1; !err && i < pd->runner.chunk_count; i++) {
+      struct zsv_2db_chunk *c = &pd->chunks[i];
+      if (c->stage_fn && c->rows_inserted) {
+        err = zsv_2db_merge_stage(data, c);
+        if (!err && data->csv_opts->verbose)
+          fprintf(stderr, "%zu rows inserted\n", data->rows_inserted);
+      }
+    }
+  }
+
+  zsv_2db_parallel_data_delete(pd);
+  data->pdata = NULL;
+  return err;
+}
+#endif
+
 /* api functions */
 
 // exportable
@@ -793,7 +1118,8 @@ int ZSV_MAIN_FUNC(ZSV_COMMAND)(int argc, const char *argv[], struct zsv_opts *zs
   FILE *f_in = NULL;
   const char *input_path = NULL; // NULL => stdin
   int err = 0;
-  char force_csv = 0, force_json = 0;
+  char force_csv = 0, force_json = 0, infer_types = 0;
+  unsigned int num_chunks = 0;
   struct zsv_2db_options opts = {0};
   opts.verbose = zsv_get_default_opts().verbose;
 
@@ -813,13 +1139,19 @@ int ZSV_MAIN_FUNC(ZSV_COMMAND)(int argc, const char *argv[], struct zsv_opts *zs
     "  --from-json          : treat input as JSON (overrides extension detection)",
     "  --table <name>       : table name (default: " ZSV_2DB_DEFAULT_TABLE_NAME ")",
     "  --overwrite          : overwrite existing database",
+    "  --infer-types        : for CSV file input, create columns whose sampled values",
+    "                         are all integers (or numbers) as INTEGER (or REAL)",
+#ifndef ZSV_NO_PARALLEL
+    "  -j,--jobs <n>        : number of parallel threads to use for CSV file input",
+    "  --parallel           : use all available cores for CSV file input",
+#endif
     // TO DO:
     // --sql to output sql statements
     // --append: append to existing db
     // --index <name>:<cols> to create indexes for CSV input
     "",
     "CSV input: the first row is used as column names; every column is created",
-    "as TEXT. Standard zsv parsing options (-t/--tab, --delimiter, -q, etc.) apply.",
+    "as TEXT unless --infer-types is used. Standard zsv parsing options (-t/--tab, --delimiter, -q, etc.) apply.",
     "Empty header cells are named column_<n>; duplicate names are de-duped (_2, _3).",
     "",
     "JSON input: must conform to the schema at",
@@ -856,6 +1188,21 @@ int ZSV_MAIN_FUNC(ZSV_COMMAND)(int argc, const char *argv[], struct zsv_opts *zs
       force_csv = 1;
     } else if (!strcmp(argv[i], "--from-json")) {
       force_json = 1;
+    } else if (!strcmp(argv[i], "--infer-types")) {
+      infer_types = 1;
+#ifndef ZSV_NO_PARALLEL
+    } else if (!strcmp(argv[i], "-j") || !strcmp(argv[i], "--jobs")) {
+      if (++i >= argc || atoi(argv[i]) <= 0)
+        fprintf(stderr, "%s option requires a positive number\n", argv[i - 1]), err = 1;
+      else
+        num_chunks = (unsigned)atoi(argv[i]);
+    } else if (!strcmp(argv[i], "--parallel")) {
+      num_chunks = zsv_get_number_of_cores();
+      if (num_chunks < 2) {
+        fprintf(stderr, "Warning: --parallel specified but only one core found; using -j 4 instead\n");
+        num_chunks = 4;
+      }
+#endif
     } else if (!strcmp(argv[i], "--table")) {
       if (++i >= argc)
         fprintf(stderr, "%s option requires a filename value\n", argv[i - 1]), err = 1;
@@ -917,6 +1264,25 @@ int ZSV_MAIN_FUNC(ZSV_COMMAND)(int argc, const char *argv[], struct zsv_opts *zs
     }
   }
 
+  if (!err && infer_types) {
+    if (is_json)
+      fprintf(stderr, "--infer-types is only supported for CSV input\n"), err = 1;
+    else if (!input_path)
+      fprintf(stderr, "--infer-types requires a file input\n"), err = 1;
+  }
+
+#ifndef ZSV_NO_PARALLEL
+  if (!err && num_chunks > 1) {
+    if (is_json)
+      fprintf(stderr, "Parallel processing is only supported for CSV input\n"), err = 1;
+    else {
+      enum zsv_chunk_status chstat = zsv_chunkable(input_path, zsv_opts);
+      if (chstat != zsv_chunk_status_ok)
+        fprintf(stderr, "%s\n", zsv_chunk_status_str(chstat)), err = 1;
+    }
+  }
+#endif
+
   if (!err) {
     zsv_2db_handle data = zsv_2db_new(&opts, is_json);
     if (!data)
@@ -954,8 +1320,21 @@ int ZSV_MAIN_FUNC(ZSV_COMMAND)(int argc, const char *argv[], struct zsv_opts *zs
       zsv_opts->stream = f_in;
       zsv_opts->row_handler = zsv_2db_csv_row;
       zsv_opts->ctx = data;
-      if (zsv_new_with_properties(zsv_opts, custom_prop_handler, input_path, &data->csv_parser) != zsv_status_ok ||
-          !data->csv_parser) {
+#ifndef ZSV_NO_PARALLEL
+      if (num_chunks > 1) {
+        data->input_path = input_path;
+        data->csv_opts = zsv_opts;
+        data->num_chunks = num_chunks;
+        zsv_opts->row_handler = zsv_2db_csv_header_parallel;
+      }
+#endif
+      if (infer_types && zsv_coltypes_get(input_path, zsv_opts, custom_prop_handler, 1, &data->coltypes,
+                                          &data->coltype_count) != zsv_status_ok) {
+        fprintf(stderr, "Unable to infer column types\n");
+        err = 1;
+      } else if (zsv_new_with_properties(zsv_opts, custom_prop_handler, input_path, &data->csv_parser) !=
+                   zsv_status_ok ||
+                 !data->csv_parser) {
         fprintf(stderr, "Unable to initialize CSV parser\n");
         err = 1;
       } else {
@@ -964,6 +1343,14 @@ int ZSV_MAIN_FUNC(ZSV_COMMAND)(int argc, const char *argv[], struct zsv_opts *zs
           ;
         if (st == zsv_status_no_more_input)
           zsv_finish(data->csv_parser); // flush a final row that lacks a trailing newline
+#ifndef ZSV_NO_PARALLEL
+        if (data->pdata) {
+          if (st == zsv_status_cancelled && data->cancelled)
+            st = zsv_status_no_more_input; // chunk 0 stopped at its boundary
+          if (zsv_2db_parallel_finish(data))
+            data->err = 1;
+        }
+#endif
         zsv_delete(data->csv_parser);
         data->csv_parser = NULL;
         if (st != zsv_status_no_more_input || zsv_2db_err(data) || zsv_2db_finish(data))
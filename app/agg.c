@@ -0,0 +1,291 @@
+/*
+ * Copyright (C) 2021 Liquidaty and zsv contributors. All rights reserved.
+ *
+ * This file is part of zsv/lib, distributed under the MIT license as defined at
+ * https://opensource.org/licenses/MIT
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "external/sqlite3/sqlite3.h"
+
+#define ZSV_COMMAND agg
+#include "zsv_command.h"
+
+#include <zsv/utils/writer.h>
+#include <zsv/utils/mem.h>
+#include <zsv/utils/string.h>
+#include <zsv/utils/arg.h>
+#include <zsv/utils/os.h>
+
+#define ZSV_SQL_AGG_NO_PARSER
+#include "sql_agg.c"
+#include "utils/column.h"
+
+const char *zsv_agg_usage_msg[] = {
+  ZSV_USAGE_PROG " " APPNAME ": group rows and aggregate column values",
+  "",
+  "Usage: " ZSV_USAGE_PROG " " APPNAME " [options] [filename]",
+  "",
+  "Outputs one row per distinct combination of group-by values, in key order, with the",
+  "group-by columns followed by the aggregates in the order given. Results are the same",
+  "as for the equivalent `" ZSV_USAGE_PROG " sql` query, e.g. for `-g a --sum x`:",
+  "  select a, sum(x) from data group by a",
+  "",
+  "Options:",
+  "  -g,--group-by <col>[,<col>...]: group by the given column(s), each of which may be a",
+  "                                 column name (case-insensitive) or #N for the Nth",
+  "                                 column (1-based). May be repeated",
+  "  --count                       : count rows",
+  "  --count-distinct <col>        : count distinct values",
+  "  --sum <col>                   : sum of values (as numbers)",
+  "  --avg <col>                   : average of values (as numbers)",
+  "  --min <col>                   : minimum value (compared as text)",
+  "  --max <col>                   : maximum value (compared as text)",
+  "                                  if no aggregate is given, --count is assumed",
+  "  -o,--output <filename>        : output file",
+  "  -b                            : output with BOM",
+  "  --max-memory <MB>             : memory limit before spilling groups to temporary",
+  "                                  files (default: 1024)",
+#ifndef ZSV_NO_PARALLEL
+  "  -j,--jobs <n>                 : number of threads used to read the input",
+  "  --parallel                    : use all available cores",
+#endif
+  NULL,
+};
+
+static int zsv_agg_usage(void) {
+  zsv_print_usage(zsv_agg_usage_msg);
+  return 0;
+}
+
+struct zsv_agg_data {
+  struct zsv_sql_agg_query q;
+  const char **colnames; // per output column: the column argument, or NULL for count(*)
+  zsv_csv_writer writer;
+};
+
+// add an output column; for a group by column, the column is also added to the keys
+static int zsv_agg_add(struct zsv_agg_data *data, enum zsv_sql_agg_fn fn, const char *colname) {
+  struct zsv_sql_agg_query *q = &data->q;
+  struct zsv_sql_agg_col *out = realloc(q->out, (q->out_count + 1) * sizeof(*out));
+  if (out)
+    q->out = out;
+  const char **colnames = realloc(data->colnames, (q->out_count + 1) * sizeof(*colnames));
+  if (colnames)
+    data->colnames = colnames;
+  if (!out || !colnames)
+    return 1;
+  struct zsv_sql_agg_col c = {0};
+  c.fn = fn;
+  if (fn == zsv_sql_agg_fn_key) {
+    unsigned int *keys = realloc(q->keys, (q->key_count + 1) * sizeof(*keys));
+    if (!keys)
+      return 1;
+    q->keys = keys;
+    c.key_ix = q->key_count++;
+  }
+  q->out[q->out_count] = c;
+  data->colnames[q->out_count++] = colname;
+  return 0;
+}
+
+// resolve the column arguments against the header row, and write the output header
+static int zsv_agg_header(void *ctx, zsv_parser parser) {
+  static const char *labels[] = {
+    [zsv_sql_agg_fn_sum] = "sum", [zsv_sql_agg_fn_avg] = "avg", [zsv_sql_agg_fn_min] = "min",
+    [zsv_sql_agg_fn_max] = "max", [zsv_sql_agg_fn_count_distinct] = "count(distinct",
+  };
+  struct zsv_agg_data *data = ctx;
+  struct zsv_sql_agg_query *q = &data->q;
+  for (unsigned int i = 0; i < q->out_count; i++) {
+    struct zsv_sql_agg_col *c = &q->out[i];
+    if (c->fn == zsv_sql_agg_fn_count_star) {
+      zsv_writer_cell_s(data->writer, i == 0, (const unsigned char *)"count(*)", 1);
+      continue;
+    }
+    size_t col;
+    if (zsv_find_column(parser, data->colnames[i], &col)) {
+      fprintf(stderr, "Column not found: %s\n", data->colnames[i]);
+      return 1;
+    }
+    c->col = (unsigned int)col;
+    struct zsv_cell name = zsv_get_cell(parser, c->col);
+    if (c->fn == zsv_sql_agg_fn_key) {
+      q->keys[c->key_ix] = c->col;
+      zsv_writer_cell(data->writer, i == 0, name.str, name.len, 1);
+      continue;
+    }
+    // label as sqlite would, e.g. sum(x) or count(distinct x)
+    const char *label = labels[c->fn];
+    size_t label_len = strlen(label);
+    unsigned char *s = malloc(label_len + 1 + name.len + 1);
+    if (!s) {
+      fprintf(stderr, "Out of memory!\n");
+      return 1;
+    }
+    memcpy(s, label, label_len);
+    if (c->fn == zsv_sql_agg_fn_count_distinct)
+      s[label_len++] = ' ';
+    else
+      s[label_len++] = '(';
+    if (name.len)
+      memcpy(s + label_len, name.str, name.len);
+    s[label_len + name.len] = ')';
+    zsv_writer_cell(data->writer, i == 0, s, label_len + name.len + 1, 1);
+    free(s);
+  }
+  return 0;
+}
+
+int ZSV_MAIN_FUNC(ZSV_COMMAND)(int argc, const char *argv[], struct zsv_opts *opts,
+                               struct zsv_prop_handler *custom_prop_handler) {
+  if (argc > 1 && (!strcmp(argv[1], "-h") || !strcmp(argv[1], "--help")))
+    return zsv_agg_usage();
+
+  int err = 0;
+  const char *input_path = NULL;
+  unsigned int num_chunks = 1;
+  struct zsv_csv_writer_options writer_opts = zsv_writer_get_default_opts();
+  struct zsv_sql_agg_run_opts run_opts = {0};
+  struct zsv_agg_data data = {0};
+  struct zsv_agg_data aggs = {0}; // aggregates, which follow the group by columns
+  char *group_by = NULL;          // copies of -g arguments, split at commas
+  size_t group_by_len = 0;
+  writer_opts.stream = stdout;
+
+  for (int arg_i = 1; !err && arg_i < argc; arg_i++) {
+    const char *arg = argv[arg_i];
+    enum zsv_sql_agg_fn fn = zsv_sql_agg_fn_key;
+    if (!strcmp(arg, "--count"))
+      err = zsv_agg_add(&aggs, zsv_sql_agg_fn_count_star, NULL);
+    else if (!strcmp(arg, "--count-distinct"))
+      fn = zsv_sql_agg_fn_count_distinct;
+    else if (!strcmp(arg, "--sum"))
+      fn = zsv_sql_agg_fn_sum;
+    else if (!strcmp(arg, "--avg"))
+      fn = zsv_sql_agg_fn_avg;
+    else if (!strcmp(arg, "--min"))
+      fn = zsv_sql_agg_fn_min;
+    else if (!strcmp(arg, "--max"))
+      fn = zsv_sql_agg_fn_max;
+    else if (!strcmp(arg, "-g") || !strcmp(arg, "--group-by")) {
+      if (++arg_i >= argc || !*argv[arg_i]) {
+        fprintf(stderr, "%s option requires a column name\n", arg);
+        err = 1;
+      } else {
+        // keep each argument as its own nul-terminated block; commas are replaced below
+        size_t len = strlen(argv[arg_i]) + 1;
+        char *tmp = realloc(group_by, group_by_len + len + 1);
+        if (!tmp)
+          err = 1;
+        else {
+          group_by = tmp;
+          memcpy(group_by + group_by_len, argv[arg_i], len);
+          group_by_len += len;
+          group_by[group_by_len] = '\0';
+        }
+      }
+    } else if (!strcmp(arg, "-b"))
+      writer_opts.with_bom = 1;
+    else if (!strcmp(arg, "-o") || !strcmp(arg, "--output")) {
+      if (++arg_i >= argc) {
+        fprintf(stderr, "%s option requires a filename\n", arg);
+        err = 1;
+      } else if (writer_opts.stream != stdout) {
+        fprintf(stderr, "Output may not be specified more than once\n");
+        err = 1;
+      } else if (!(writer_opts.stream = fopen(argv[arg_i], "wb"))) {
+        writer_opts.stream = stdout;
+        fprintf(stderr, "Unable to open file for writing: %s\n", argv[arg_i]);
+        err = 1;
+      }
+    } else if (!strcmp(arg, "--max-memory")) {
+      if (++arg_i >= argc || atoi(argv[arg_i]) <= 0) {
+        fprintf(stderr, "%s option requires a positive number of MB\n", arg);
+        err = 1;
+      } else
+        run_opts.max_memory = (size_t)atoi(argv[arg_i]) * 1024 * 1024;
+#ifndef ZSV_NO_PARALLEL
+    } else if (!strcmp(arg, "-j") || !strcmp(arg, "--jobs")) {
+      if (++arg_i >= argc || atoi(argv[arg_i]) <= 0) {
+        fprintf(stderr, "%s option requires a positive number\n", arg);
+        err = 1;
+      } else
+        num_chunks = (unsigned int)atoi(argv[arg_i]);
+    } else if (!strcmp(arg, "--parallel")) {
+      num_chunks = zsv_get_number_of_cores();
+      if (num_chunks < 2) {
+        fprintf(stderr, "Warning: --parallel specified but only one core found; using -j 4 instead\n");
+        num_chunks = 4;
+      }
+#endif
+    } else if (zsv_arg_is_option(arg)) {
+      fprintf(stderr, "Unrecognized option: %s\n", arg);
+      err = 1;
+    } else if (input_path) {
+      fprintf(stderr, "Input may not be specified more than once\n");
+      err = 1;
+    } else
+      input_path = arg;
+
+    if (!err && fn != zsv_sql_agg_fn_key) {
+      if (++arg_i >= argc || !*argv[arg_i]) {
+        fprintf(stderr, "%s option requires a column name\n", arg);
+        err = 1;
+      } else
+        err = zsv_agg_add(&aggs, fn, argv[arg_i]);
+    }
+  }
+
+  // output columns: group by columns, then aggregates
+  for (char *s = group_by; !err && s && *s; s += strlen(s) + 1) {
+    for (char *comma; (comma = strchr(s, ',')); s = comma + 1) {
+      *comma = '\0';
+      err = err || zsv_agg_add(&data, zsv_sql_agg_fn_key, s);
+    }
+    err = err || zsv_agg_add(&data, zsv_sql_agg_fn_key, s);
+  }
+  if (!err && !aggs.q.out_count)
+    err = zsv_agg_add(&aggs, zsv_sql_agg_fn_count_star, NULL);
+  for (unsigned int i = 0; !err && i < aggs.q.out_count; i++)
+    err = zsv_agg_add(&data, aggs.q.out[i].fn, aggs.colnames[i]);
+
+  if (input_path && !strcmp(input_path, "-"))
+    input_path = NULL;
+#ifdef NO_STDIN
+  if (!err && !input_path) {
+    fprintf(stderr, "Please specify an input file\n");
+    err = 1;
+  }
+#endif
+  if (!err && num_chunks > 1) {
+    enum zsv_chunk_status stat = zsv_chunkable(input_path, opts);
+    if (stat != zsv_chunk_status_ok) {
+      if (opts->verbose)
+        fprintf(stderr, "Not running in parallel: %s\n", zsv_chunk_status_str(stat));
+      num_chunks = 1;
+    }
+  }
+
+  if (!err && !(data.writer = zsv_writer_new(&writer_opts))) {
+    fprintf(stderr, "Out of memory!\n");
+    err = 1;
+  }
+  if (!err) {
+    run_opts.header = zsv_agg_header;
+    run_opts.header_ctx = &data;
+    err = zsv_sql_agg_run(&data.q, input_path, num_chunks, &run_opts, opts, custom_prop_handler, data.writer);
+  }
+
+  zsv_writer_delete(data.writer);
+  if (writer_opts.stream && writer_opts.stream != stdout)
+    fclose(writer_opts.stream);
+  zsv_sql_agg_query_clear(&data.q);
+  zsv_sql_agg_query_clear(&aggs.q);
+  free(data.colnames);
+  free(aggs.colnames);
+  free(group_by);
+  return err;
+}
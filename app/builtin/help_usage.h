@@ -89,6 +89,13 @@ static const struct zsv_help_command commands[] = {
 #endif
   {"2tsv", "convert to tab-delimited text"},
   {"stack", "stack tables vertically, aligning columns with common names"},
+  {"sort", "sort rows by one or more columns"},
+  {"agg", "group rows and aggregate column values"},
+  {"dedup", "remove duplicate rows"},
+  {"split", "split rows into several files"},
+  {"sample", "output a random sample of rows"},
+  {"index", "build or remove a key index"},
+  {"lookup", "output rows with the given key values"},
   {"paste", "horizontally paste two tables together: given inputs X, Y, ... of N rows"},
   {"compare", "compare two or more tables and output differences"},
   {"overwrite", "save, modify or apply overwrites"},
@@ -91,6 +91,13 @@ ZSV_MAIN_DECL(serialize);
 ZSV_MAIN_DECL(flatten);
 ZSV_MAIN_DECL(pretty);
 ZSV_MAIN_DECL(stack);
+ZSV_MAIN_DECL(sort);
+ZSV_MAIN_DECL(agg);
+ZSV_MAIN_DECL(dedup);
+ZSV_MAIN_DECL(split);
+ZSV_MAIN_DECL(sample);
+ZSV_MAIN_DECL(index);
+ZSV_MAIN_DECL(lookup);
 ZSV_MAIN_DECL(desc);
 ZSV_MAIN_DECL(sql);
 ZSV_MAIN_DECL(2db);
@@ -143,6 +150,13 @@ struct builtin_cmd builtin_cmds[] = {
   CLI_BUILTIN_COMMAND(flatten),
   CLI_BUILTIN_COMMAND(pretty),
   CLI_BUILTIN_COMMAND(stack),
+  CLI_BUILTIN_COMMAND(sort),
+  CLI_BUILTIN_COMMAND(agg),
+  CLI_BUILTIN_COMMAND(dedup),
+  CLI_BUILTIN_COMMAND(split),
+  CLI_BUILTIN_COMMAND(sample),
+  CLI_BUILTIN_COMMAND(index),
+  CLI_BUILTIN_COMMAND(lookup),
   CLI_BUILTIN_COMMAND(desc),
   CLI_BUILTIN_COMMAND(sql),
   CLI_BUILTIN_COMMAND(2db),
@@ -19,13 +19,12 @@
 #include <json2toon.h>
 #endif
 
-#include <sqlite3.h>
-extern sqlite3_module CsvModule;
-
 #include <zsv/utils/compiler.h>
 #include <zsv/utils/mem.h>
 #include <zsv/utils/string.h>
 #include <zsv/utils/writer.h>
+#include <zsv/utils/os.h>
+#include <zsv/utils/file-mem.h>
 #ifndef ZSV_NO_TOON
 #include <zsv/utils/output.h>
 #endif
@@ -39,6 +38,7 @@ extern sqlite3_module CsvModule;
 #include "compare_unique_colname.c"
 #include "compare_added_column.c"
 #include "compare_sort.c"
+#include "compare_hash.c"
 #include "utils/column_range.h"
 
 #define ZSV_COMPARE_OUTPUT_TYPE_JSON 'j'
@@ -195,8 +195,34 @@ static void zsv_compare_output_property_name(struct zsv_compare_data *data, int
   }
 }
 
+#define ZSV_COMPARE_RECORD_ROW_START 'r'
+#define ZSV_COMPARE_RECORD_ROW_END 'e'
+#define ZSV_COMPARE_RECORD_STRN 's'
+
+/**
+ * Record an output call, when writer.record is set. A string is recorded as op, a flags byte
+ * (1 = new row, 2 = quoted, 4 = NULL), its length and its bytes
+ */
+static void zsv_compare_record(struct zsv_compare_data *data, char op, const unsigned char *s, size_t len, int new_row,
+                               int quoted) {
+  struct zsv_memfile *record = data->writer.record;
+  char ok = zsv_memfile_write(&op, 1, 1, record) == 1;
+  if (ok && op == ZSV_COMPARE_RECORD_STRN) {
+    unsigned char flags = (new_row ? 1 : 0) | (quoted ? 2 : 0) | (s ? 0 : 4);
+    ok = zsv_memfile_write(&flags, 1, 1, record) == 1 &&
+         zsv_memfile_write(&len, 1, sizeof(len), record) == sizeof(len) &&
+         (!s || !len || zsv_memfile_write(s, 1, len, record) == len);
+  }
+  if (!ok)
+    data->status = zsv_compare_status_error;
+}
+
 static void zsv_compare_output_strn(struct zsv_compare_data *data, const unsigned char *s, size_t len, int new_row,
                                     int quoted) {
+  if (data->writer.record) {
+    zsv_compare_record(data, ZSV_COMPARE_RECORD_STRN, s, len, new_row, quoted);
+    return;
+  }
   if (data->writer.type == ZSV_COMPARE_OUTPUT_TYPE_JSON) {
     if (data->writer.object && s == NULL) {
       zsv_compare_output_property_name(data, new_row, 1);
@@ -249,6 +275,10 @@ static void zsv_compare_allocate_properties(struct zsv_compare_data *data, unsig
 }
 
 static void zsv_compare_json_row_start(struct zsv_compare_data *data) {
+  if (data->writer.record) {
+    zsv_compare_record(data, ZSV_COMPARE_RECORD_ROW_START, NULL, 0, 0, 0);
+    return;
+  }
   if (data->writer.object)
     cw_start_object(data);
   else
@@ -256,12 +286,18 @@ static void zsv_compare_json_row_start(struct zsv_compare_data *data) {
 }
 
 static void zsv_compare_json_row_end(struct zsv_compare_data *data) {
+  if (data->writer.record) {
+    zsv_compare_record(data, ZSV_COMPARE_RECORD_ROW_END, NULL, 0, 0, 0);
+    return;
+  }
   if (data->writer.object)
     cw_end_object(data);
   else
     cw_end_array(data);
 }
 
+static int zsv_compare_keys_only(const struct zsv_compare_input *x, const struct zsv_compare_input *y);
+
 static void zsv_compare_output_tuple(struct zsv_compare_data *data, struct zsv_compare_input *key_input,
                                      const unsigned char *colname,
                                      struct zsv_cell *values, // in original input order
@@ -285,6 +321,9 @@ static void zsv_compare_output_tuple(struct zsv_compare_data *data, struct zsv_c
     if (!ac->input) {
       if (data->writer.type != ZSV_COMPARE_OUTPUT_TYPE_JSON)
         zsv_compare_output_str(data, NULL, ZSV_WRITER_SAME_ROW, 0);
+    } else if (ac->input->done || !ac->input->row_loaded || zsv_compare_keys_only(ac->input, key_input)) {
+      // the source input does not have this row
+      zsv_compare_output_str(data, NULL, ZSV_WRITER_SAME_ROW, 0);
     } else {
       struct zsv_cell c = data->get_cell(ac->input, ac->col_ix);
       zsv_compare_output_strn(data, c.str, c.len, ZSV_WRITER_SAME_ROW, c.quoted);
@@ -436,16 +475,12 @@ static void zsv_compare_print_row(struct zsv_compare_data *data,
 static void zsv_compare_input_free(struct zsv_compare_input *input) {
   zsv_delete(input->parser);
   zsv_compare_unique_colnames_delete(&input->colnames);
-  if (input->added)
-    sqlite3_zsv_list_remove(input->path);
   free(input->out2in);
   if (input->stream)
     fclose(input->stream);
   free(input->output_colnames);
   free(input->keys);
-  if (input->sort_stmt) {
-    sqlite3_finalize(input->sort_stmt);
-  }
+  zsv_compare_sorted_free(input);
 }
 
 static enum zsv_compare_status zsv_compare_set_inputs(struct zsv_compare_data *data, unsigned input_count) {
@@ -654,15 +689,10 @@ static void zsv_compare_set_sorted_callbacks(struct zsv_compare_data *data) {
 }
 
 static enum zsv_compare_status zsv_compare_init_sorted(struct zsv_compare_data *data) {
-  int rc;
-  // to do: use sql_internal.h interface
-  const char *db_url = data->sort_in_memory ? "file::memory:" : "";
-  if ((rc = sqlite3_open_v2(db_url, &data->sort_db, SQLITE_OPEN_URI | SQLITE_OPEN_READWRITE, NULL)) == SQLITE_OK &&
-      data->sort_db && (rc = sqlite3_create_module(data->sort_db, "csv", &CsvModule, 0) == SQLITE_OK)) {
-    zsv_compare_set_sorted_callbacks(data);
-    return zsv_compare_status_ok;
-  }
-  return zsv_compare_status_error;
+  zsv_compare_set_sorted_callbacks(data);
+  if (data->hash)
+    data->input_init = input_init_hashed;
+  return zsv_compare_status_ok;
 }
 
 static void zsv_compare_data_free(struct zsv_compare_data *data) {
@@ -702,11 +732,6 @@ static void zsv_compare_data_free(struct zsv_compare_data *data) {
     free(data->writer.properties.names[i]);
   free(data->writer.properties.names);
 
-  if (data->sort) {
-    if (data->sort_db)
-      sqlite3_close(data->sort_db);
-  }
-
   zsv_compare_added_column_delete(data->added_columns);
 
   zsv_compare_unique_colnames_delete(&data->output_colnames);
@@ -761,6 +786,17 @@ static enum zsv_compare_status zsv_compare_advance(struct zsv_compare_data *data
   return got ? zsv_compare_status_ok : zsv_compare_status_no_more_input;
 }
 
+// same as zsv_strincmp(), but without allocating when both values are ascii
+static int zsv_compare_key_cmp(const unsigned char *s1, size_t len1, const unsigned char *s2, size_t len2) {
+  for (size_t i = 0; i < len1; i++)
+    if (s1[i] & 0x80)
+      return zsv_strincmp(s1, len1, s2, len2);
+  for (size_t i = 0; i < len2; i++)
+    if (s2[i] & 0x80)
+      return zsv_strincmp(s1, len1, s2, len2);
+  return zsv_strincmp_ascii(s1, len1, s2, len2);
+}
+
 static int zsv_compare_keys_only(const struct zsv_compare_input *x, const struct zsv_compare_input *y) {
   if (!x->row_loaded && !y->row_loaded)
     return 0;
@@ -774,7 +810,7 @@ static int zsv_compare_keys_only(const struct zsv_compare_input *x, const struct
     // for multibyte input, the input must be also sorted lexicographically
     // to avoid potential mismatches
     // see e.g. https://stackoverflow.com/questions/4611302/sorting-utf-8-strings
-    cmp = zsv_strincmp(x->keys[i].value.str, x->keys[i].value.len, y->keys[i].value.str, y->keys[i].value.len);
+    cmp = zsv_compare_key_cmp(x->keys[i].value.str, x->keys[i].value.len, y->keys[i].value.str, y->keys[i].value.len);
 
   if (cmp == 0 && x->key_count != y->key_count)
     return (x->key_count < y->key_count) ? -1 : 1;
@@ -836,6 +872,10 @@ static enum zsv_compare_status zsv_compare_next(struct zsv_compare_data *data) {
   return zsv_compare_status_ok;
 }
 
+#ifndef ZSV_NO_PARALLEL
+#include "compare_parallel.c"
+#endif
+
 /* Help topics for `zsv help compare <topic>` (see compare_help.c). */
 #include "compare_help.c"
 
@@ -852,8 +892,14 @@ static int compare_usage(void) {
     "                       will use the [first input] source",
     "                       cannot be combined with --redline",
     "  --sort             : sort on keys before comparing",
-    "  --sort-in-memory   : for sorting,  use in-memory instead of temporary db",
-    "                       (see https://www.sqlite.org/inmemorydb.html)",
+    "  --sort-in-memory   : sort without using temporary files",
+    "  --hash             : match keys using a hash table, without requiring sorted",
+    "                       input; only differing rows are sorted and compared",
+    "  --max-memory <MB>  : memory limit for --sort and --hash (default: 1024)",
+#ifndef ZSV_NO_PARALLEL
+    "  -j,--jobs <n>      : number of threads used to sort, or to compare sorted inputs",
+    "  --parallel         : sort or compare using all available cores",
+#endif
     "  --tolerance <value>: ignore differences where both values are numeric",
     "                       strings with values differing by less than the given",
     "                       amount e.g. --tolerance 0.01 will ignore differences",
@@ -899,12 +945,23 @@ static int compare_usage(void) {
     "  is not required for each input to contain the same population of row keys.",
     "  (Use --require-all-inputs to ignore rows whose key is missing from any input.)",
     "",
-    "  The --sort option uses sqlite3 (unindexed) sort and is intended to be a",
-    "  convenience rather than performance feature. If you need high performance",
-    "  sorting, other solutions, such as a multi-threaded parallel sort, are likely",
-    "  superior. For handling quoted data, `2tsv` can be used to convert to a delimited",
-    "  format without quotes, that can be directly parsed with common UNIX utilities",
-    "  (such as `sort`), and `select --unescape` can be used to convert back",
+    "  The --sort option sorts each input in memory, spilling to temporary files if",
+    "  an input exceeds 1GB, in the same way as the `sort` command. Keys are sorted",
+    "  case-insensitively and without leading or trailing whitespace, which is the",
+    "  order in which they are matched",
+    "",
+    "  The --hash option does not require sorted input. The first input's keys are",
+    "  loaded into a hash table, together with a hash of each row's content, and the",
+    "  other inputs are then matched against it; only the rows that are not identical",
+    "  in every input are then sorted and compared. Output is the same as with --sort,",
+    "  except that --redline is not supported. If the hash table exceeds the memory",
+    "  limit, keys are processed in partitions, each of which re-reads the inputs",
+    "",
+    "  With -j or --parallel, sorted inputs are compared in key ranges on separate",
+    "  threads: key boundaries are sampled from the first input, and each input is",
+    "  split at those keys by binary search. Output is the same as when comparing on",
+    "  a single thread. If any input turns out not to be sorted, the inputs are",
+    "  instead compared on a single thread",
     "",
     "  In --redline mode, the `generated_at` timestamp honors the",
     "  SOURCE_DATE_EPOCH environment variable (UNIX epoch seconds) so that output",
@@ -1011,6 +1068,31 @@ int ZSV_MAIN_FUNC(ZSV_COMMAND)(int argc, const char *argv[], struct zsv_opts *op
       }
     } else if (!strcmp(arg, "--sort")) {
       data->sort = 1;
+    } else if (!strcmp(arg, "--sort-in-memory")) {
+      data->sort = 1;
+      data->sort_in_memory = 1;
+    } else if (!strcmp(arg, "--hash")) {
+      data->hash = 1;
+    } else if (!strcmp(arg, "--max-memory")) {
+      const char *next_arg = zsv_next_arg(++arg_i, argc, argv, &err);
+      if (next_arg && atoi(next_arg) <= 0)
+        fprintf(stderr, "%s option requires a positive number of MB\n", arg), err = 1;
+      else if (next_arg)
+        data->max_memory = (size_t)atoi(next_arg) * 1024 * 1024;
+#ifndef ZSV_NO_PARALLEL
+    } else if (!strcmp(arg, "-j") || !strcmp(arg, "--jobs")) {
+      const char *next_arg = zsv_next_arg(++arg_i, argc, argv, &err);
+      if (next_arg && atoi(next_arg) <= 0)
+        fprintf(stderr, "%s option requires a positive number\n", arg), err = 1;
+      else if (next_arg)
+        data->threads = (unsigned int)atoi(next_arg);
+    } else if (!strcmp(arg, "--parallel")) {
+      data->threads = zsv_get_number_of_cores();
+      if (data->threads < 2) {
+        fprintf(stderr, "Warning: --parallel specified but only one core found; using -j 4 instead\n");
+        data->threads = 4;
+      }
+#endif
     } else if (!strcmp(arg, "--exit-code") || !strcmp(arg, "-e")) {
       data->return_count = 1;
     } else if (!strcmp(arg, "--json")) {
@@ -1102,24 +1184,27 @@ int ZSV_MAIN_FUNC(ZSV_COMMAND)(int argc, const char *argv[], struct zsv_opts *op
     err = 1;
   }
 
-  struct zsv_opts original_default_opts;
-  struct zsv_prop_handler original_default_custom_prop_handler;
+  if (data->hash) {
+    if (data->sort) {
+      fprintf(stderr, "Error: --hash cannot be combined with --sort\n");
+      data->status = zsv_compare_status_error;
+    } else if (data->writer.type == ZSV_COMPARE_OUTPUT_TYPE_JSON_REDLINE) {
+      // redline summarizes every row and cell compared, including identical ones
+      fprintf(stderr, "Error: --hash is not supported with --redline\n");
+      data->status = zsv_compare_status_error;
+    } else if (!data->key_count) {
+      fprintf(stderr, "Error: --hash requires one or more keys\n");
+      data->status = zsv_compare_status_error;
+    } else if (data->status == zsv_compare_status_ok)
+      data->status = zsv_compare_init_sorted(data);
+  }
+
   if (data->sort) {
     if (!data->key_count) {
       fprintf(stderr, "Error: --sort requires one or more keys\n");
       data->status = zsv_compare_status_error;
-    } else {
-      original_default_opts = zsv_get_default_opts();
-      zsv_set_default_opts(*opts);
-
-      if (custom_prop_handler) {
-        original_default_custom_prop_handler = zsv_get_default_custom_prop_handler();
-        zsv_set_default_custom_prop_handler(*custom_prop_handler);
-      }
-
-      if (data->status == zsv_compare_status_ok)
-        data->status = zsv_compare_init_sorted(data);
-    }
+    } else if (data->status == zsv_compare_status_ok)
+      data->status = zsv_compare_init_sorted(data);
   }
 
   char *colrange_label1 = NULL;
@@ -1129,8 +1214,8 @@ int ZSV_MAIN_FUNC(ZSV_COMMAND)(int argc, const char *argv[], struct zsv_opts *op
     if (input_count != 1) {
       fprintf(stderr, "Error: --columns requires exactly one input file\n");
       err = 1;
-    } else if (data->sort) {
-      fprintf(stderr, "Error: --sort is not supported with --columns\n");
+    } else if (data->sort || data->hash) {
+      fprintf(stderr, "Error: --sort and --hash are not supported with --columns\n");
       err = 1;
     } else {
       struct zsv_column_range cr1, cr2;
@@ -1201,6 +1286,8 @@ int ZSV_MAIN_FUNC(ZSV_COMMAND)(int argc, const char *argv[], struct zsv_opts *op
         input->path = input_filenames[ix];
         data->status = data->input_init(data, input, opts, custom_prop_handler);
       }
+      if (data->hash && data->status == zsv_compare_status_ok)
+        data->status = zsv_compare_hash_load(data, opts, custom_prop_handler);
     }
   }
 
@@ -1345,7 +1432,12 @@ int ZSV_MAIN_FUNC(ZSV_COMMAND)(int argc, const char *argv[], struct zsv_opts *op
     }
 
     // next, compare each row
-    while (data->status == zsv_compare_status_ok && zsv_compare_next(data) == zsv_compare_status_ok)
+    char done = 0;
+#ifndef ZSV_NO_PARALLEL
+    if (data->status == zsv_compare_status_ok && data->threads > 1)
+      done = zsv_compare_parallel(data, opts, custom_prop_handler);
+#endif
+    while (!done && data->status == zsv_compare_status_ok && zsv_compare_next(data) == zsv_compare_status_ok)
       ;
     if (started)
       data->output_end(data);
@@ -1353,12 +1445,6 @@ int ZSV_MAIN_FUNC(ZSV_COMMAND)(int argc, const char *argv[], struct zsv_opts *op
 
   err = data->status == zsv_compare_status_ok ? 0 : 1;
 
-  if (data->sort) {
-    zsv_set_default_opts(original_default_opts); // restore default options
-    if (custom_prop_handler)
-      zsv_set_default_custom_prop_handler(original_default_custom_prop_handler);
-  }
-
   if (data->return_count) {
     if (err)
       err = -1;
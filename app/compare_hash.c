@@ -0,0 +1,353 @@
+/**
+ * Hash-based keyed compare (--hash), for inputs that are not sorted by key
+ *
+ * Rows are matched on their key plus the occurrence of that key within the input, which is how
+ * the sorted compare pairs rows with duplicate keys. Each row also gets a 64-bit content hash,
+ * computed from its (column name, trimmed value) pairs so that it does not depend on column
+ * order, and to which empty values do not contribute (a missing column compares as empty).
+ *
+ * The first input's rows are loaded into a hash table of key -> content hashes, and the other
+ * inputs are then streamed and probed against it. Each input is then read a second time, and
+ * only rows whose key is not present in every input, or whose content differs from the first
+ * input's, are added to the input's sorter, from which the regular sorted compare outputs the
+ * differences. Rows that are identical in every input are never stored or compared cell by cell.
+ *
+ * If the table would exceed the memory limit, rows are processed in partitions by key hash,
+ * reading the inputs once more for each partition
+ */
+
+#include "utils/hash.h"
+
+#define ZSV_COMPARE_HASH_MAX_PARTITIONS 256
+
+struct zsv_compare_hash_occ {
+  uint64_t content_hash;
+  uint32_t next;        // index + 1 of the next occurrence of the same key, or 0
+  uint32_t equal_count; // number of other inputs whose matching row has the same content hash
+};
+
+// the value of each key in the table's set
+struct zsv_compare_hash_key {
+  uint32_t head;   // index + 1 of the first occurrence
+  uint32_t tail;   // index + 1 of the last occurrence
+  uint32_t cursor; // index + 1 of the next occurrence to match in the current input, or 0
+};
+
+struct zsv_compare_hash_table {
+  zsv_hash_set keys;
+
+  struct zsv_compare_hash_occ *occs;
+  size_t occ_count;
+  size_t occ_capacity;
+};
+
+struct zsv_compare_hash_ctx {
+  struct zsv_compare_data *data;
+  struct zsv_opts *opts;
+  struct zsv_prop_handler *custom_prop_handler;
+  size_t max_memory;
+
+  uint64_t **name_hashes; // [input][column]
+
+  unsigned char *key;
+  size_t key_len;
+  size_t key_capacity;
+};
+
+static int zsv_compare_hash_key_append(struct zsv_compare_hash_ctx *ctx, const unsigned char *s, size_t len) {
+  if (ctx->key_len + len + 4 > ctx->key_capacity) {
+    size_t cap = ctx->key_capacity ? ctx->key_capacity : 256;
+    while (cap < ctx->key_len + len + 4)
+      cap *= 2;
+    unsigned char *k = realloc(ctx->key, cap);
+    if (!k)
+      return 1;
+    ctx->key = k;
+    ctx->key_capacity = cap;
+  }
+  uint32_t len32 = (uint32_t)len;
+  memcpy(ctx->key + ctx->key_len, &len32, 4);
+  ctx->key_len += 4;
+  if (len)
+    memcpy(ctx->key + ctx->key_len, s, len);
+  ctx->key_len += len;
+  return 0;
+}
+
+// build the key of the parser's current row: each key cell, trimmed and lowercased as zsv_strincmp() compares it
+static int zsv_compare_hash_row_key(struct zsv_compare_hash_ctx *ctx, struct zsv_compare_input *input) {
+  size_t cell_count = zsv_cell_count(input->parser);
+  ctx->key_len = 0;
+  for (unsigned k = 0; k < input->key_count; k++) {
+    size_t col = input->sorted.keys[k].col;
+    struct zsv_cell c = col < cell_count ? zsv_get_cell_trimmed(input->parser, col) : (struct zsv_cell){0};
+    size_t i;
+    for (i = 0; i < c.len && c.str[i] < 128 && (c.str[i] < 'A' || c.str[i] > 'Z'); i++)
+      ;
+    if (i == c.len) {
+      if (zsv_compare_hash_key_append(ctx, c.str, c.len))
+        return 1;
+    } else {
+      size_t len = c.len;
+      unsigned char *lc = zsv_strtolowercase(c.str, &len);
+      int rc = !lc || zsv_compare_hash_key_append(ctx, lc, len);
+      free(lc);
+      if (rc)
+        return 1;
+    }
+  }
+  return 0;
+}
+
+static uint64_t zsv_compare_hash_row_content(struct zsv_compare_hash_ctx *ctx, struct zsv_compare_input *input) {
+  size_t cell_count = zsv_cell_count(input->parser);
+  if (cell_count > input->sorted.header_count)
+    cell_count = input->sorted.header_count;
+  const uint64_t *name_hashes = ctx->name_hashes[input->index];
+  uint64_t h = 0;
+  for (size_t j = 0; j < cell_count; j++) {
+    struct zsv_cell c = zsv_get_cell_trimmed(input->parser, j);
+    if (c.len)
+      h += zsv_hash_mix(name_hashes[j] ^ zsv_hash(c.str, c.len));
+  }
+  return h;
+}
+
+// hash each column name, lowercased and with its instance number, as zsv_compare_unique_colname_add() matches them
+static enum zsv_compare_status zsv_compare_hash_names(struct zsv_compare_hash_ctx *ctx,
+                                                      struct zsv_compare_input *input) {
+  unsigned count = input->sorted.header_count;
+  uint64_t *hashes = calloc(count ? count : 1, sizeof(*hashes));
+  uint64_t *names = calloc(count ? count : 1, sizeof(*names));
+  if (!hashes || !names) {
+    free(hashes);
+    free(names);
+    return zsv_compare_status_memory;
+  }
+  for (unsigned j = 0; j < count; j++) {
+    size_t len = input->sorted.header[j].len;
+    unsigned char *lc = zsv_strtolowercase(input->sorted.header[j].str, &len);
+    if (!lc) {
+      free(hashes);
+      free(names);
+      return zsv_compare_status_memory;
+    }
+    names[j] = zsv_hash(lc, len);
+    free(lc);
+    uint64_t instance = 0;
+    for (unsigned i = 0; i < j; i++)
+      if (names[i] == names[j])
+        instance++;
+    hashes[j] = zsv_hash_mix(names[j] + instance);
+  }
+  free(names);
+  ctx->name_hashes[input->index] = hashes;
+  return zsv_compare_status_ok;
+}
+
+static void zsv_compare_hash_table_free(struct zsv_compare_hash_table *t) {
+  zsv_hash_set_delete(t->keys);
+  free(t->occs);
+  memset(t, 0, sizeof(*t));
+}
+
+static size_t zsv_compare_hash_bytes(const struct zsv_compare_hash_table *t) {
+  return (t->keys ? zsv_hash_set_bytes(t->keys) : 0) + t->occ_capacity * sizeof(*t->occs);
+}
+
+static struct zsv_compare_hash_key *zsv_compare_hash_find(struct zsv_compare_hash_table *t, uint64_t hash,
+                                                          const unsigned char *key, size_t key_len) {
+  size_t ix = t->keys ? zsv_hash_set_find(t->keys, hash, key, key_len) : ZSV_HASH_SET_NONE;
+  return ix == ZSV_HASH_SET_NONE ? NULL : zsv_hash_set_value(t->keys, ix);
+}
+
+static int zsv_compare_hash_add(struct zsv_compare_hash_table *t, uint64_t hash, const unsigned char *key,
+                                size_t key_len, uint64_t content_hash) {
+  if (!t->keys && !(t->keys = zsv_hash_set_new(sizeof(struct zsv_compare_hash_key))))
+    return 1;
+  if (t->occ_count == t->occ_capacity) {
+    size_t cap = t->occ_capacity ? t->occ_capacity * 2 : 1024;
+    struct zsv_compare_hash_occ *occs = realloc(t->occs, cap * sizeof(*occs));
+    if (!occs)
+      return 1;
+    t->occs = occs;
+    t->occ_capacity = cap;
+  }
+  if (t->occ_count >= UINT32_MAX)
+    return 1;
+  char added = 0;
+  size_t ix = zsv_hash_set_add(t->keys, hash, key, key_len, &added);
+  if (ix == ZSV_HASH_SET_NONE)
+    return 1;
+  struct zsv_compare_hash_occ *occ = &t->occs[t->occ_count++];
+  occ->content_hash = content_hash;
+  occ->next = 0;
+  occ->equal_count = 0;
+
+  struct zsv_compare_hash_key *e = zsv_hash_set_value(t->keys, ix);
+  if (added)
+    e->head = (uint32_t)t->occ_count;
+  else
+    t->occs[e->tail - 1].next = (uint32_t)t->occ_count;
+  e->tail = (uint32_t)t->occ_count;
+  return 0;
+}
+
+static void zsv_compare_hash_reset_cursors(struct zsv_compare_hash_table *t) {
+  for (size_t i = 0, n = t->keys ? zsv_hash_set_count(t->keys) : 0; i < n; i++) {
+    struct zsv_compare_hash_key *e = zsv_hash_set_value(t->keys, i);
+    e->cursor = e->head;
+  }
+}
+
+/**
+ * Match the current row to the next unmatched occurrence of its key in the first input. Returns NULL
+ * if the key is not in the first input or all of its occurrences have already been matched
+ */
+static struct zsv_compare_hash_occ *zsv_compare_hash_match(struct zsv_compare_hash_table *t, uint64_t hash,
+                                                           const unsigned char *key, size_t key_len) {
+  struct zsv_compare_hash_key *e = zsv_compare_hash_find(t, hash, key, key_len);
+  if (!e || !e->cursor)
+    return NULL;
+  struct zsv_compare_hash_occ *occ = &t->occs[e->cursor - 1];
+  e->cursor = occ->next;
+  return occ;
+}
+
+// partitions are selected by the high bits of the key hash; the table uses the low bits
+static inline int zsv_compare_hash_in_partition(uint64_t hash, size_t partitions, size_t partition) {
+  return (size_t)((hash >> 32) % partitions) == partition;
+}
+
+struct zsv_compare_hash_keep_ctx {
+  struct zsv_compare_hash_ctx *ctx;
+  struct zsv_compare_hash_table *t;
+  size_t partitions;
+  size_t partition;
+};
+
+// keep the rows of the partition that do not match an identical row in every input
+static int zsv_compare_hash_keep(void *arg, struct zsv_compare_input *input) {
+  struct zsv_compare_hash_keep_ctx *keep = arg;
+  struct zsv_compare_hash_ctx *ctx = keep->ctx;
+  if (zsv_compare_hash_row_key(ctx, input))
+    return -1;
+  uint64_t hash = zsv_hash(ctx->key, ctx->key_len);
+  if (!zsv_compare_hash_in_partition(hash, keep->partitions, keep->partition))
+    return 0;
+  struct zsv_compare_hash_occ *occ = zsv_compare_hash_match(keep->t, hash, ctx->key, ctx->key_len);
+  return !occ || occ->equal_count + 1 < ctx->data->input_count;
+}
+
+static enum zsv_compare_status zsv_compare_hash_partition(struct zsv_compare_hash_ctx *ctx, size_t partitions,
+                                                          size_t partition) {
+  struct zsv_compare_data *data = ctx->data;
+  struct zsv_compare_hash_table t = {0};
+  enum zsv_compare_status stat = zsv_compare_status_ok;
+  char split = 0;
+
+  // load the first input
+  struct zsv_compare_input *input = &data->inputs[0];
+  if ((stat = zsv_compare_sort_open_parser(input, ctx->opts, ctx->custom_prop_handler)) == zsv_compare_status_ok) {
+    while (stat == zsv_compare_status_ok && zsv_next_row(input->parser) == zsv_status_row) {
+      if (zsv_compare_hash_row_key(ctx, input)) {
+        stat = zsv_compare_status_memory;
+        break;
+      }
+      uint64_t hash = zsv_hash(ctx->key, ctx->key_len);
+      if (!zsv_compare_hash_in_partition(hash, partitions, partition))
+        continue;
+      if (zsv_compare_hash_add(&t, hash, ctx->key, ctx->key_len, zsv_compare_hash_row_content(ctx, input)))
+        stat = zsv_compare_status_memory;
+      else if (zsv_compare_hash_bytes(&t) > ctx->max_memory && partitions < ZSV_COMPARE_HASH_MAX_PARTITIONS) {
+        split = 1;
+        break;
+      }
+    }
+  }
+  zsv_compare_sort_close_parser(input);
+
+  if (split) {
+    zsv_compare_hash_table_free(&t);
+    if (ctx->opts->verbose)
+      fprintf(stderr, "compare --hash: splitting partition %zu of %zu\n", partition + 1, partitions);
+    stat = zsv_compare_hash_partition(ctx, partitions * 2, partition);
+    if (stat == zsv_compare_status_ok)
+      stat = zsv_compare_hash_partition(ctx, partitions * 2, partition + partitions);
+    return stat;
+  }
+
+  // probe with every other input
+  for (unsigned i = 1; stat == zsv_compare_status_ok && i < data->input_count; i++) {
+    input = &data->inputs[i];
+    zsv_compare_hash_reset_cursors(&t);
+    if ((stat = zsv_compare_sort_open_parser(input, ctx->opts, ctx->custom_prop_handler)) != zsv_compare_status_ok)
+      break;
+    while (zsv_next_row(input->parser) == zsv_status_row) {
+      if (zsv_compare_hash_row_key(ctx, input)) {
+        stat = zsv_compare_status_memory;
+        break;
+      }
+      uint64_t hash = zsv_hash(ctx->key, ctx->key_len);
+      if (!zsv_compare_hash_in_partition(hash, partitions, partition))
+        continue;
+      struct zsv_compare_hash_occ *occ = zsv_compare_hash_match(&t, hash, ctx->key, ctx->key_len);
+      if (occ && occ->content_hash == zsv_compare_hash_row_content(ctx, input))
+        occ->equal_count++;
+    }
+    zsv_compare_sort_close_parser(input);
+  }
+
+  // read each input again, keeping only the rows that are not identical in every input
+  struct zsv_compare_hash_keep_ctx keep = {ctx, &t, partitions, partition};
+  for (unsigned i = 0; stat == zsv_compare_status_ok && i < data->input_count; i++) {
+    zsv_compare_hash_reset_cursors(&t);
+    stat = zsv_compare_sort_load(&data->inputs[i], ctx->opts, ctx->custom_prop_handler, zsv_compare_hash_keep, &keep);
+  }
+
+  zsv_compare_hash_table_free(&t);
+  return stat;
+}
+
+static enum zsv_compare_status input_init_hashed(struct zsv_compare_data *data, struct zsv_compare_input *input,
+                                                 struct zsv_opts *opts, struct zsv_prop_handler *custom_prop_handler) {
+  // rows are loaded by zsv_compare_hash_load() once all inputs have been initialized
+  enum zsv_compare_status stat = zsv_compare_sort_open(data, input, opts, custom_prop_handler);
+  zsv_compare_sort_close_parser(input);
+  return stat;
+}
+
+static enum zsv_compare_status zsv_compare_hash_load(struct zsv_compare_data *data, struct zsv_opts *opts,
+                                                     struct zsv_prop_handler *custom_prop_handler) {
+  struct zsv_compare_hash_ctx ctx = {
+    .data = data,
+    .opts = opts,
+    .custom_prop_handler = custom_prop_handler,
+    .max_memory = data->max_memory ? data->max_memory : (size_t)ZSV_SORT_DEFAULT_MAX_MEMORY_MB * 1024 * 1024,
+  };
+  enum zsv_compare_status stat = zsv_compare_status_ok;
+  char keys_found = 1;
+  for (unsigned i = 0; i < data->input_count; i++)
+    if (!data->inputs[i].sorted.keys_found)
+      keys_found = 0;
+
+  // if any key is missing, the error is reported after initialization
+  if (keys_found) {
+    if (!(ctx.name_hashes = calloc(data->input_count, sizeof(*ctx.name_hashes))))
+      stat = zsv_compare_status_memory;
+    for (unsigned i = 0; stat == zsv_compare_status_ok && i < data->input_count; i++)
+      stat = zsv_compare_hash_names(&ctx, &data->inputs[i]);
+    if (stat == zsv_compare_status_ok)
+      stat = zsv_compare_hash_partition(&ctx, 1, 0);
+  }
+
+  for (unsigned i = 0; stat == zsv_compare_status_ok && i < data->input_count; i++)
+    stat = zsv_compare_sort_start(&data->inputs[i], opts, custom_prop_handler);
+
+  if (ctx.name_hashes)
+    for (unsigned i = 0; i < data->input_count; i++)
+      free(ctx.name_hashes[i]);
+  free(ctx.name_hashes);
+  free(ctx.key);
+  return stat;
+}
@@ -3,7 +3,7 @@
 
 #include <stdio.h>
 #include <sglib.h>
-#include <sqlite3.h>
+#include "utils/sort.h"
 
 typedef struct zsv_compare_unique_colname {
   struct zsv_compare_unique_colname *next; // retain order via linked list
@@ -49,16 +49,27 @@ struct zsv_compare_input {
   unsigned key_count;
   struct zsv_compare_input_key *keys;
 
-  sqlite3_stmt *sort_stmt;
+  struct {
+    zsv_sorter sorter; // holds the key, offset and length of each data row, when --sort option was specified
+    struct zsv_sort_key *keys;
+    unsigned char keys_found;
+    struct zsv_cell *header;
+    unsigned header_count;
+    unsigned char *header_buff;
+    uint64_t row_left;         // bytes of the current row not yet read from stream
+    unsigned char eol_left;    // bytes of the line end that follows it not yet passed to the parser
+    unsigned char read_failed; // the sorter or stream failed while rows were being read
+  } sorted;
 
   unsigned col_range_start; // 0-based starting column for column-range mode
   unsigned col_range_count; // number of columns in range (0 = use all)
 
+  struct zsv_compare_partition *partition; // key range read by this input, when comparing in parallel
+
   unsigned char row_loaded : 1;
   unsigned char missing : 1;
   unsigned char done : 1;
-  unsigned char added : 1;
-  unsigned char _ : 4;
+  unsigned char _ : 5;
 };
 
 struct zsv_compare_key {
@@ -121,7 +132,8 @@ struct zsv_compare_data {
   int (*parse_opt)(struct zsv_compare_data *data, const char *arg, int *arg_ip, int argc, const char *argv[],
                    int *errp);
 
-  sqlite3 *sort_db; // used when --sort option was specified
+  unsigned int threads; // -j: threads used to sort (--sort), or to compare sorted inputs in key ranges
+  size_t max_memory;    // bytes; 0 = default
 
   struct {
     double value;    /* bumped via nextafterf for comparison */
@@ -155,8 +167,9 @@ struct zsv_compare_data {
 #endif
     unsigned char _ : 2;
 
-    const char *output_path; // -o <file>: destination for the --redline rendered document
-    FILE *tmp;               // temp file holding the redline JSON while --redline renders it
+    const char *output_path;    // -o <file>: destination for the --redline rendered document
+    FILE *tmp;                  // temp file holding the redline JSON while --redline renders it
+    struct zsv_memfile *record; // if set, output is recorded here instead of written, to be replayed later
 #ifndef ZSV_NO_TOON
     json2toon_t *j2t; // --redline + TOON: handle.jsw feeds this, which emits TOON to stdout
 #endif
@@ -166,11 +179,12 @@ struct zsv_compare_data {
 
   unsigned char sort : 1;
   unsigned char sort_in_memory : 1;
+  unsigned char hash : 1; // --hash: match keys via a hash table, and sort only the rows that differ
   unsigned char print_key_col_names : 1;
   unsigned char return_count : 1;
   unsigned char
     require_all_inputs : 1; // --require-all-inputs/--intersect: ignore rows whose key is absent from any input
-  unsigned char _ : 3;
+  unsigned char _ : 2;
 };
 
 #endif
@@ -0,0 +1,503 @@
+/**
+ * To compare sorted inputs in parallel, key boundaries are sampled from the first input, and every
+ * input is split at each boundary by binary search over its row offsets. Each key range is then
+ * compared by a worker with its own parsers, using the same compare loop as the serial path, and
+ * its output is recorded (or, in redline mode, collected) so that it can be replayed in key order.
+ *
+ * A split offset only needs to precede the first row of its key range, so the worker that reads
+ * a range skips any rows before its starting key. Once all workers are done, the ranges are
+ * verified to be contiguous: for each input, the row at which a range ended must be the row at
+ * which the next range started. If that check fails, or if any input is found not to be sorted,
+ * the parallel results are discarded and the inputs are compared serially
+ */
+
+#include <pthread.h>
+#include <sys/stat.h>
+#include "utils/chunk.h"
+
+#define ZSV_COMPARE_PARALLEL_MIN_BYTES (2 * 1024 * 1024)
+#define ZSV_COMPARE_PARALLEL_SEARCH_STOP (64 * 1024)     // stop searching for a split once within this many bytes
+#define ZSV_COMPARE_PARALLEL_RECORD_BUFF (8 * 1024 * 1024) // in-memory size of each worker's recorded output
+
+// a copy of a row's key values
+struct zsv_compare_partition_keys {
+  struct zsv_cell *cells;
+  unsigned char *buff;
+  size_t buff_size;
+};
+
+struct zsv_compare_partition {
+  const struct zsv_compare_partition_keys *start_keys; // NULL for the first range
+  const struct zsv_compare_partition_keys *end_keys;   // NULL for the last range
+  zsv_file_pos offset;                                 // where this input's parser starts
+  zsv_file_pos first_row;                              // offset of the first row in range, or -1 if none
+  zsv_file_pos end_row;                                // offset of the first row after the range, or -1 if none
+  struct zsv_compare_partition_keys prev;              // keys of the last row returned
+  struct zsv_cell *cells;                              // keys of the row being checked
+  unsigned char started : 1;
+  unsigned char invalid : 1; // input is not sorted within this range, or its keys could not be saved
+  unsigned char _ : 6;
+};
+
+struct zsv_compare_parallel_worker {
+  struct zsv_compare_data data;
+  struct zsv_compare_partition *partitions; // one per input
+  struct zsv_compare_added_column *added_columns;
+  pthread_t thread;
+  unsigned char thread_started : 1;
+  unsigned char _ : 7;
+};
+
+static int zsv_compare_partition_keys_set(struct zsv_compare_partition_keys *k, const struct zsv_cell *cells,
+                                          unsigned key_count) {
+  size_t len = 0;
+  for (unsigned i = 0; i < key_count; i++)
+    len += cells[i].len;
+  if (!k->cells && !(k->cells = calloc(key_count, sizeof(*k->cells))))
+    return 1;
+  if (len > k->buff_size) {
+    unsigned char *buff = realloc(k->buff, len);
+    if (!buff)
+      return 1;
+    k->buff = buff;
+    k->buff_size = len;
+  }
+  unsigned char *p = k->buff;
+  for (unsigned i = 0; i < key_count; i++) {
+    k->cells[i] = cells[i];
+    k->cells[i].str = p;
+    if (cells[i].len)
+      memcpy(p, cells[i].str, cells[i].len);
+    p += cells[i].len;
+  }
+  return 0;
+}
+
+static void zsv_compare_partition_keys_free(struct zsv_compare_partition_keys *k) {
+  free(k->cells);
+  free(k->buff);
+}
+
+// compare key values in the same way as zsv_compare_keys_only()
+static int zsv_compare_partition_keys_cmp(const struct zsv_cell *x, const struct zsv_cell *y, unsigned key_count) {
+  int cmp = 0;
+  for (unsigned i = 0; !cmp && i < key_count; i++)
+    cmp = zsv_compare_key_cmp(x[i].str, x[i].len, y[i].str, y[i].len);
+  return cmp;
+}
+
+static void zsv_compare_partition_get_keys(struct zsv_compare_input *input, zsv_parser parser, struct zsv_cell *cells) {
+  for (unsigned i = 0; i < input->key_count; i++)
+    cells[i] = zsv_get_cell_trimmed(parser, input->keys[i].col_ix);
+}
+
+/**
+ * next_row callback for a worker input: return only rows whose keys are within the input's partition,
+ * and check that they are sorted
+ */
+static enum zsv_status zsv_compare_next_partition_row(struct zsv_compare_input *input) {
+  struct zsv_compare_partition *p = input->partition;
+  struct zsv_cell *cells = p->cells;
+  enum zsv_status stat;
+  while ((stat = zsv_next_row(input->parser)) == zsv_status_row) {
+    zsv_file_pos row_start =
+      p->offset + (zsv_file_pos)(zsv_cum_scanned_length(input->parser) - zsv_row_length_raw_bytes(input->parser));
+    zsv_compare_partition_get_keys(input, input->parser, cells);
+    if (!p->started) {
+      if (p->start_keys && zsv_compare_partition_keys_cmp(cells, p->start_keys->cells, input->key_count) < 0)
+        continue;
+      p->started = 1;
+      p->first_row = row_start;
+    }
+    if (p->end_keys && zsv_compare_partition_keys_cmp(cells, p->end_keys->cells, input->key_count) >= 0) {
+      p->end_row = row_start;
+      return zsv_status_done;
+    }
+    if ((p->prev.cells && zsv_compare_partition_keys_cmp(cells, p->prev.cells, input->key_count) < 0) ||
+        zsv_compare_partition_keys_set(&p->prev, cells, input->key_count)) {
+      p->invalid = 1;
+      return zsv_status_done;
+    }
+    return zsv_status_row;
+  }
+  return stat;
+}
+
+static int zsv_compare_parallel_only_crlf(const struct zsv_opts *opts) {
+#ifndef ZSV_NO_ONLY_CRLF
+  return opts->only_crlf_rowend;
+#else
+  (void)(opts);
+  return 0;
+#endif
+}
+
+/**
+ * Start a parser at the first row after *pos, and read that row. On success, *pos is set to
+ * the row's offset. mid_opts are the input's options for a parser that starts mid-file
+ */
+static zsv_parser zsv_compare_parallel_probe(FILE *f, zsv_file_pos size, zsv_file_pos *pos,
+                                             const struct zsv_opts *mid_opts) {
+  zsv_file_pos start = zsv_find_chunk_start(f, *pos, size, zsv_compare_parallel_only_crlf(mid_opts));
+  if (start < 0 || fseeko(f, (off_t)start, SEEK_SET))
+    return NULL;
+  struct zsv_opts opts = *mid_opts;
+  opts.stream = f;
+  zsv_parser parser = zsv_new(&opts);
+  if (parser && zsv_next_row(parser) != zsv_status_row) {
+    zsv_delete(parser);
+    parser = NULL;
+  }
+  *pos = start;
+  return parser;
+}
+
+static zsv_file_pos zsv_compare_parallel_file_size(FILE *f) {
+  struct stat st;
+  if (fstat(fileno(f), &st) || !S_ISREG(st.st_mode))
+    return -1;
+  return (zsv_file_pos)st.st_size;
+}
+
+/**
+ * Find an offset in input from which its first row with keys >= k can be reached: the offset of a
+ * row whose keys are < k, or lo if there is none. hi is the size of the input
+ */
+static zsv_file_pos zsv_compare_parallel_split(struct zsv_compare_input *input, FILE *f, zsv_file_pos lo,
+                                               zsv_file_pos hi, const struct zsv_compare_partition_keys *k,
+                                               const struct zsv_opts *mid_opts, struct zsv_cell *cells) {
+  zsv_file_pos size = hi;
+  while (hi - lo > ZSV_COMPARE_PARALLEL_SEARCH_STOP) {
+    zsv_file_pos mid = lo + (hi - lo) / 2;
+    zsv_file_pos pos = mid;
+    zsv_parser parser = zsv_compare_parallel_probe(f, size, &pos, mid_opts);
+    char before = 0;
+    if (parser) {
+      zsv_compare_partition_get_keys(input, parser, cells);
+      before = pos < hi && zsv_compare_partition_keys_cmp(cells, k->cells, input->key_count) < 0;
+      zsv_delete(parser);
+    }
+    if (before)
+      lo = pos;
+    else
+      hi = mid;
+  }
+  return lo;
+}
+
+/**
+ * Sample up to `count` strictly increasing, non-empty boundary keys from evenly spaced rows of the
+ * first input. Returns the number of keys sampled
+ */
+static unsigned zsv_compare_parallel_boundaries(struct zsv_compare_input *input, FILE *f, zsv_file_pos data_start,
+                                                zsv_file_pos size, unsigned count,
+                                                struct zsv_compare_partition_keys *boundaries,
+                                                const struct zsv_opts *mid_opts, struct zsv_cell *cells) {
+  unsigned found = 0;
+  for (unsigned i = 1; i <= count; i++) {
+    zsv_file_pos pos = data_start + (size - data_start) / (count + 1) * i;
+    zsv_parser parser = zsv_compare_parallel_probe(f, size, &pos, mid_opts);
+    if (!parser)
+      continue;
+    zsv_compare_partition_get_keys(input, parser, cells);
+    size_t len = 0;
+    for (unsigned j = 0; j < input->key_count; j++)
+      len += cells[j].len;
+    if (len &&
+        (!found || zsv_compare_partition_keys_cmp(cells, boundaries[found - 1].cells, input->key_count) > 0) &&
+        !zsv_compare_partition_keys_set(&boundaries[found], cells, input->key_count))
+      found++;
+    zsv_delete(parser);
+  }
+  return found;
+}
+
+static void *zsv_compare_parallel_run(void *arg) {
+  struct zsv_compare_data *d = arg;
+  while (d->status == zsv_compare_status_ok && zsv_compare_next(d) == zsv_compare_status_ok)
+    ;
+  if (d->status == zsv_compare_status_no_more_input)
+    d->status = zsv_compare_status_ok;
+  return NULL;
+}
+
+// open a worker's parser for one input
+static enum zsv_compare_status zsv_compare_parallel_open(struct zsv_compare_input *input, struct zsv_opts *opts,
+                                                         struct zsv_prop_handler *custom_prop_handler) {
+  if (!(input->stream = fopen(input->path, "rb")))
+    return zsv_compare_status_error;
+  if (!input->partition->start_keys) { // first range: read from the start of the input, as input_init_unsorted() does
+    struct zsv_opts these_opts = *opts;
+    these_opts.stream = input->stream;
+    if (zsv_new_with_properties(&these_opts, custom_prop_handler, input->path, &input->parser) != zsv_status_ok ||
+        zsv_next_row(input->parser) != zsv_status_row)
+      return zsv_compare_status_error;
+    return zsv_compare_status_ok;
+  }
+  struct zsv_opts these_opts;
+  if (fseeko(input->stream, (off_t)input->partition->offset, SEEK_SET) ||
+      zsv_chunk_opts(&these_opts, opts, custom_prop_handler, input->path, input->stream))
+    return zsv_compare_status_error;
+  if (!(input->parser = zsv_new(&these_opts)))
+    return zsv_compare_status_memory;
+  return zsv_compare_status_ok;
+}
+
+// set up a worker to compare one key range, using a copy of data that shares its read-only members
+static enum zsv_compare_status zsv_compare_parallel_worker_init(struct zsv_compare_parallel_worker *w,
+                                                                struct zsv_compare_data *data, struct zsv_opts *opts,
+                                                                struct zsv_prop_handler *custom_prop_handler) {
+  struct zsv_compare_data *d = &w->data;
+  *d = *data;
+  d->inputs = NULL;
+  d->inputs_to_sort = NULL;
+  d->added_columns = NULL;
+  d->redline = NULL;
+  d->writer.record = NULL;
+  d->row_count = 0;
+  d->diff_count = 0;
+  d->next_row = zsv_compare_next_partition_row;
+
+  if (!(d->inputs = calloc(data->input_count, sizeof(*d->inputs))) ||
+      !(d->inputs_to_sort = calloc(data->input_count, sizeof(*d->inputs_to_sort))))
+    return zsv_compare_status_memory;
+  for (unsigned i = 0; i < data->input_count; i++) {
+    struct zsv_compare_input *input = &d->inputs[i];
+    *input = data->inputs[i];
+    input->stream = NULL;
+    input->parser = NULL;
+    input->row_loaded = input->done = input->missing = 0;
+    input->partition = &w->partitions[i];
+    d->inputs_to_sort[i] = input;
+    if (!(input->keys = malloc(input->key_count * sizeof(*input->keys))) ||
+        !(input->partition->cells = calloc(input->key_count, sizeof(*input->partition->cells))))
+      return zsv_compare_status_memory;
+    memcpy(input->keys, data->inputs[i].keys, input->key_count * sizeof(*input->keys));
+  }
+
+  unsigned added_count = 0;
+  for (struct zsv_compare_added_column *ac = data->added_columns; ac; ac = ac->next)
+    added_count++;
+  if (added_count) {
+    if (!(w->added_columns = calloc(added_count, sizeof(*w->added_columns))))
+      return zsv_compare_status_memory;
+    struct zsv_compare_added_column **next = &d->added_columns;
+    unsigned j = 0;
+    for (struct zsv_compare_added_column *ac = data->added_columns; ac; ac = ac->next, j++) {
+      w->added_columns[j] = *ac;
+      if (ac->input)
+        w->added_columns[j].input = &d->inputs[ac->input->index];
+      *next = &w->added_columns[j];
+      next = &w->added_columns[j].next;
+    }
+    *next = NULL;
+  }
+
+  if (data->writer.type == ZSV_COMPARE_OUTPUT_TYPE_JSON_REDLINE) {
+    if (!(d->redline = zsv_compare_redline_new(data->input_count, data->output_colcount)))
+      return zsv_compare_status_memory;
+  } else if (!(d->writer.record = zsv_memfile_open(ZSV_COMPARE_PARALLEL_RECORD_BUFF)))
+    return zsv_compare_status_memory;
+
+  enum zsv_compare_status stat = zsv_compare_status_ok;
+  for (unsigned i = 0; stat == zsv_compare_status_ok && i < data->input_count; i++)
+    stat = zsv_compare_parallel_open(&d->inputs[i], opts, custom_prop_handler);
+  return stat;
+}
+
+static void zsv_compare_parallel_worker_free(struct zsv_compare_parallel_worker *w, unsigned input_count) {
+  struct zsv_compare_data *d = &w->data;
+  if (d->inputs) {
+    for (unsigned i = 0; i < input_count; i++) {
+      struct zsv_compare_input *input = &d->inputs[i];
+      zsv_delete(input->parser);
+      if (input->stream)
+        fclose(input->stream);
+      free(input->keys);
+    }
+  }
+  free(d->inputs);
+  free(d->inputs_to_sort);
+  free(w->added_columns);
+  zsv_compare_redline_free(d->redline, input_count, d->output_colcount);
+  if (d->writer.record)
+    zsv_memfile_close(d->writer.record);
+  if (w->partitions)
+    for (unsigned i = 0; i < input_count; i++) {
+      zsv_compare_partition_keys_free(&w->partitions[i].prev);
+      free(w->partitions[i].cells);
+    }
+  free(w->partitions);
+}
+
+// write a worker's recorded output
+static void zsv_compare_parallel_replay(struct zsv_compare_data *data, struct zsv_memfile *record) {
+  unsigned char *buff = NULL;
+  size_t buff_size = 0;
+  char op;
+  if (zsv_memfile_rewind(record))
+    data->status = zsv_compare_status_error;
+  while (data->status == zsv_compare_status_ok && zsv_memfile_read(&op, 1, 1, record) == 1) {
+    if (op == ZSV_COMPARE_RECORD_ROW_START)
+      zsv_compare_json_row_start(data);
+    else if (op == ZSV_COMPARE_RECORD_ROW_END)
+      zsv_compare_json_row_end(data);
+    else {
+      unsigned char flags;
+      size_t len;
+      if (zsv_memfile_read(&flags, 1, 1, record) != 1 ||
+          zsv_memfile_read(&len, 1, sizeof(len), record) != sizeof(len)) {
+        data->status = zsv_compare_status_error;
+        break;
+      }
+      if (len > buff_size) {
+        unsigned char *tmp = realloc(buff, len);
+        if (!tmp) {
+          data->status = zsv_compare_status_memory;
+          break;
+        }
+        buff = tmp;
+        buff_size = len;
+      }
+      if (len && zsv_memfile_read(buff, 1, len, record) != len) {
+        data->status = zsv_compare_status_error;
+        break;
+      }
+      const unsigned char *s = (flags & 4) ? NULL : len ? buff : (const unsigned char *)"";
+      zsv_compare_output_strn(data, s, len, (flags & 1) ? ZSV_WRITER_NEW_ROW : ZSV_WRITER_SAME_ROW, flags & 2);
+    }
+  }
+  free(buff);
+}
+
+/**
+ * Compare sorted inputs in key ranges on data->threads threads. Returns nonzero if the comparison was
+ * done, or 0 if the inputs should instead be compared serially, in which case data is unchanged
+ */
+static char zsv_compare_parallel(struct zsv_compare_data *data, struct zsv_opts *opts,
+                                 struct zsv_prop_handler *custom_prop_handler) {
+  if (data->threads < 2 || !data->key_count || data->sort || data->hash ||
+      data->next_row != zsv_compare_next_unsorted_row || data->get_cell != zsv_compare_get_unsorted_cell)
+    return 0;
+  for (unsigned i = 0; i < data->input_count; i++) {
+    if (data->inputs[i].done || zsv_chunkable(data->inputs[i].path, opts) != zsv_chunk_status_ok)
+      return 0;
+  }
+
+  unsigned input_count = data->input_count;
+  unsigned key_count = data->key_count;
+  unsigned partition_count = 0;
+  char ok = 1;
+  char done = 0;
+  FILE **files = calloc(input_count, sizeof(*files));
+  struct zsv_opts *mid_opts = calloc(input_count, sizeof(*mid_opts));
+  zsv_file_pos *sizes = calloc(input_count, sizeof(*sizes));
+  struct zsv_cell *cells = calloc(key_count, sizeof(*cells));
+  struct zsv_compare_partition_keys *boundaries = calloc(data->threads - 1, sizeof(*boundaries));
+  struct zsv_compare_parallel_worker *workers = calloc(data->threads, sizeof(*workers));
+  if (!files || !mid_opts || !sizes || !cells || !boundaries || !workers)
+    goto parallel_done;
+
+  for (unsigned i = 0; i < input_count; i++) {
+    if (!(files[i] = fopen(data->inputs[i].path, "rb")) || (sizes[i] = zsv_compare_parallel_file_size(files[i])) < 0 ||
+        zsv_chunk_opts(&mid_opts[i], opts, custom_prop_handler, data->inputs[i].path, NULL))
+      goto parallel_done;
+  }
+
+  // split into key ranges at keys sampled from the first input
+  zsv_file_pos data_start = (zsv_file_pos)zsv_cum_scanned_length(data->inputs[0].parser);
+  if (sizes[0] - data_start < ZSV_COMPARE_PARALLEL_MIN_BYTES)
+    goto parallel_done;
+  unsigned boundary_count = zsv_compare_parallel_boundaries(&data->inputs[0], files[0], data_start, sizes[0],
+                                                            data->threads - 1, boundaries, &mid_opts[0], cells);
+  if (!boundary_count)
+    goto parallel_done;
+  partition_count = boundary_count + 1;
+
+  for (unsigned p = 0; p < partition_count; p++) {
+    if (!(workers[p].partitions = calloc(input_count, sizeof(*workers[p].partitions))))
+      goto parallel_done;
+    for (unsigned i = 0; i < input_count; i++) {
+      struct zsv_compare_partition *part = &workers[p].partitions[i];
+      part->start_keys = p ? &boundaries[p - 1] : NULL;
+      part->end_keys = p < boundary_count ? &boundaries[p] : NULL;
+      part->first_row = part->end_row = -1;
+    }
+  }
+  for (unsigned i = 0; i < input_count; i++) {
+    zsv_file_pos lo = (zsv_file_pos)zsv_cum_scanned_length(data->inputs[i].parser);
+    for (unsigned p = 1; p < partition_count; p++) {
+      lo = zsv_compare_parallel_split(&data->inputs[i], files[i], lo, sizes[i], &boundaries[p - 1], &mid_opts[i],
+                                      cells);
+      workers[p].partitions[i].offset = lo;
+    }
+  }
+
+  // output property names are allocated on first use, so do that before any worker needs them
+  if (data->print_key_col_names && !zsv_compare_combined_key_names(data))
+    goto parallel_done;
+
+  for (unsigned p = 0; ok && p < partition_count; p++)
+    ok = zsv_compare_parallel_worker_init(&workers[p], data, opts, custom_prop_handler) == zsv_compare_status_ok;
+  for (unsigned p = 1; ok && p < partition_count; p++)
+    workers[p].thread_started =
+      pthread_create(&workers[p].thread, NULL, zsv_compare_parallel_run, &workers[p].data) == 0;
+  if (ok)
+    zsv_compare_parallel_run(&workers[0].data);
+  for (unsigned p = 1; p < partition_count; p++) {
+    if (workers[p].thread_started)
+      pthread_join(workers[p].thread, NULL);
+    else if (ok)
+      zsv_compare_parallel_run(&workers[p].data);
+  }
+
+  // check that each range picked up where the last one left off, in every input
+  for (unsigned p = 0; ok && p < partition_count; p++) {
+    if (workers[p].data.status != zsv_compare_status_ok)
+      ok = 0;
+    for (unsigned i = 0; ok && i < input_count; i++) {
+      struct zsv_compare_partition *part = &workers[p].partitions[i];
+      if (part->invalid || (p && workers[p - 1].partitions[i].end_row != part->first_row))
+        ok = 0;
+    }
+  }
+  if (!ok) {
+    if (opts->verbose)
+      fprintf(stderr, "Unable to compare in parallel (inputs may not be sorted); comparing serially\n");
+    goto parallel_done;
+  }
+
+  if (opts->verbose)
+    fprintf(stderr, "Compared %u key ranges in parallel\n", partition_count);
+  done = 1;
+  for (unsigned p = 0; p < partition_count && data->status == zsv_compare_status_ok; p++) {
+    struct zsv_compare_data *d = &workers[p].data;
+    if (d->redline) {
+      zsv_compare_redline_append(data->redline, d->redline, input_count, data->output_colcount);
+      d->redline = NULL;
+    } else
+      zsv_compare_parallel_replay(data, d->writer.record);
+    data->diff_count = d->diff_count > INT_MAX - data->diff_count ? INT_MAX : data->diff_count + d->diff_count;
+  }
+  if (data->status == zsv_compare_status_ok)
+    data->status = zsv_compare_status_no_more_input;
+
+parallel_done:
+  if (workers)
+    for (unsigned p = 0; p < data->threads; p++)
+      zsv_compare_parallel_worker_free(&workers[p], input_count);
+  free(workers);
+  if (boundaries)
+    for (unsigned p = 0; p + 1 < data->threads; p++)
+      zsv_compare_partition_keys_free(&boundaries[p]);
+  free(boundaries);
+  free(cells);
+  if (files)
+    for (unsigned i = 0; i < input_count; i++)
+      if (files[i])
+        fclose(files[i]);
+  free(files);
+  free(mid_opts);
+  free(sizes);
+  return done;
+}
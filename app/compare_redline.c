@@ -126,6 +126,32 @@ static void zsv_compare_redline_free(struct zsv_compare_redline *e, unsigned inp
   zsv_compare_redline_free_base(e);
 }
 
+// Append src's rows to dest and add its totals to dest's, then free src
+static void zsv_compare_redline_append(struct zsv_compare_redline *dest, struct zsv_compare_redline *src,
+                                       unsigned input_count, unsigned output_colcount) {
+  if (src->rows_head) {
+    *dest->rows_tail = src->rows_head;
+    dest->rows_tail = src->rows_tail;
+  }
+  for (unsigned i = 0; i < input_count; i++) {
+    dest->input_row_counts[i] += src->input_row_counts[i];
+    dest->rows_only_in_input[i] += src->rows_only_in_input[i];
+  }
+  for (unsigned j = 0; j < output_colcount; j++) {
+    dest->col_stats[j].compared += src->col_stats[j].compared;
+    dest->col_stats[j].matched += src->col_stats[j].matched;
+    dest->col_stats[j].within_tolerance += src->col_stats[j].within_tolerance;
+    dest->col_stats[j].differing += src->col_stats[j].differing;
+  }
+  dest->rows_in_all += src->rows_in_all;
+  dest->rows_with_diff += src->rows_with_diff;
+  dest->cells_compared += src->cells_compared;
+  dest->cells_matched += src->cells_matched;
+  dest->cells_within_tolerance += src->cells_within_tolerance;
+  dest->cells_differing += src->cells_differing;
+  zsv_compare_redline_free_base(src);
+}
+
 static void zsv_compare_collect_row(struct zsv_compare_data *data, unsigned last_ix) {
   struct zsv_compare_redline *e = data->redline;
   if (!e)
@@ -1,91 +1,270 @@
 /**
- * To implement sorting, we will use sqlite, create a table for each CSV file and run "select * order by ..."
+ * To implement sorting, the key of each row of each input is read into a sorter (see utils/sort.h)
+ * together with the row's offset and length in the file. Rows are then read back from their offsets
+ * in key order and parsed again, so that the sorter holds only keys. Keys are trimmed and compared
+ * case-insensitively so that rows are returned in the same order in which the compare loop matches keys
  */
 
-#include "external/sqlite3/sqlite3_csv_vtab-mem.h"
+#include <stdint.h>
+#include "utils/chunk.h" // zsv_chunk_opts, zsv_file_pos
 
-static int zsv_compare_sort_prep_table(struct zsv_compare_data *data, const char *fname, char **err_msg,
-                                       unsigned int table_ix) {
-#define ZSV_COMPARE_MAX_TABLES 1000
-  char *sql = NULL;
-  if (table_ix > ZSV_COMPARE_MAX_TABLES)
-    return -1;
+// save the header row, since the parser is deleted once all rows have been loaded
+static enum zsv_compare_status zsv_compare_sort_save_header(struct zsv_compare_input *input) {
+  unsigned count = (unsigned)zsv_cell_count(input->parser);
+  size_t total_len = 0;
+  for (unsigned i = 0; i < count; i++)
+    total_len += zsv_get_cell_trimmed(input->parser, i).len;
+  if (!(input->sorted.header = calloc(count ? count : 1, sizeof(*input->sorted.header))) ||
+      !(input->sorted.header_buff = malloc(total_len ? total_len : 1)))
+    return zsv_compare_status_memory;
+  unsigned char *p = input->sorted.header_buff;
+  for (unsigned i = 0; i < count; i++) {
+    struct zsv_cell c = zsv_get_cell_trimmed(input->parser, i);
+    if (c.len)
+      memcpy(p, c.str, c.len);
+    input->sorted.header[i].str = p;
+    input->sorted.header[i].len = c.len;
+    input->sorted.header[i].quoted = 1;
+    p += c.len;
+  }
+  input->sorted.header_count = count;
+  return zsv_compare_status_ok;
+}
+
+// open the input and read its header row
+static enum zsv_compare_status zsv_compare_sort_open_parser(struct zsv_compare_input *input, struct zsv_opts *opts,
+                                                            struct zsv_prop_handler *custom_prop_handler) {
+  if (!(input->stream = fopen(input->path, "rb"))) {
+    perror(input->path);
+    return zsv_compare_status_error;
+  }
+  struct zsv_opts these_opts = *opts;
+  these_opts.stream = input->stream;
+  if (zsv_new_with_properties(&these_opts, custom_prop_handler, input->path, &input->parser) != zsv_status_ok ||
+      zsv_next_row(input->parser) != zsv_status_row)
+    return zsv_compare_status_error;
+  return zsv_compare_status_ok;
+}
+
+static void zsv_compare_sort_close_parser(struct zsv_compare_input *input) {
+  zsv_delete(input->parser);
+  input->parser = NULL;
+  if (input->stream)
+    fclose(input->stream);
+  input->stream = NULL;
+}
+
+/**
+ * Open the input, save its header and create its sorter. Keys are matched in the same way that
+ * zsv_compare() does, i.e. to the first column with a matching name. If any key is not found,
+ * keys_found is left unset and the error is reported after initialization
+ */
+static enum zsv_compare_status zsv_compare_sort_open(struct zsv_compare_data *data, struct zsv_compare_input *input,
+                                                     struct zsv_opts *opts,
+                                                     struct zsv_prop_handler *custom_prop_handler) {
+  enum zsv_compare_status stat = zsv_compare_sort_open_parser(input, opts, custom_prop_handler);
+  if (stat == zsv_compare_status_ok)
+    stat = zsv_compare_sort_save_header(input);
+  if (stat != zsv_compare_status_ok)
+    return stat;
 
-  sql = sqlite3_mprintf("CREATE VIRTUAL TABLE data%i USING csv(filename=%Q)", table_ix, fname);
+  if (!(input->sorted.keys = calloc(input->key_count ? input->key_count : 1, sizeof(*input->sorted.keys))))
+    return zsv_compare_status_memory;
+  unsigned found = 0;
+  for (unsigned k = 0; k < input->key_count; k++) {
+    const char *name = input->keys[k].key->name;
+    for (unsigned j = 0; j < input->sorted.header_count; j++) {
+      struct zsv_cell *c = &input->sorted.header[j];
+      if (!zsv_strincmp(c->str, c->len, (const unsigned char *)name, strlen(name))) {
+        input->sorted.keys[k].col = j;
+        input->sorted.keys[k].trim = 1;
+        input->sorted.keys[k].fold_case = 1;
+        found++;
+        break;
+      }
+    }
+  }
+  input->sorted.keys_found = found == input->key_count;
 
-  if (!sql)
-    return -1;
+  struct zsv_sort_opts sort_opts = {
+    .keys = input->sorted.keys,
+    .key_count = input->key_count,
+    .max_memory = data->sort_in_memory ? SIZE_MAX : data->max_memory,
+    .threads = data->threads,
+    .verbose = opts->verbose,
+  };
+  if (!(input->sorted.sorter = zsv_sorter_new(&sort_opts)))
+    return zsv_compare_status_memory;
+  return zsv_compare_status_ok;
+}
 
-  int rc = sqlite3_exec(data->sort_db, sql, NULL, NULL, err_msg);
-  sqlite3_free(sql);
-  return rc;
+static enum zsv_compare_status zsv_compare_sort_status(struct zsv_compare_input *input, enum zsv_sort_status stat) {
+  if (stat == zsv_sort_status_ok)
+    return zsv_compare_status_ok;
+  if (stat == zsv_sort_status_memory)
+    return zsv_compare_status_memory;
+  fprintf(stderr, "Error sorting %s\n", input->path);
+  return zsv_compare_status_error;
 }
 
-static int zsv_compare_sort_stmt_prep(sqlite3 *db, sqlite3_stmt **stmtp, struct zsv_compare_key *keys, unsigned ix) {
-  sqlite3_str *select_clause = sqlite3_str_new(db);
-  if (!select_clause) {
-    fprintf(stderr, "Out of memory!\n");
-    return -1;
+// reads the rows of an input, as a parser sees them, for zsv_compare_sort_load()
+struct zsv_compare_sort_loader {
+  struct zsv_compare_input *input;
+  // whether to keep the parser's current row: 1 if so, 0 if not, or -1 if out of memory
+  int (*keep)(void *ctx, struct zsv_compare_input *input);
+  void *ctx;
+  char header_done;
+  char finishing; // rows are being reported by zsv_finish()
+  enum zsv_compare_status stat;
+};
+
+static void zsv_compare_sort_load_row(void *ctx) {
+  struct zsv_compare_sort_loader *l = ctx;
+  struct zsv_compare_input *input = l->input;
+  if (!l->header_done) {
+    l->header_done = 1;
+    return;
   }
+  int keep = l->keep ? l->keep(l->ctx, input) : 1;
+  if (keep < 0)
+    l->stat = zsv_compare_status_memory;
+  else if (keep) {
+    uint64_t pos[2] = {zsv_chunk_row_offset(input->parser, l->finishing), zsv_row_length_raw_bytes(input->parser)};
+    l->stat = zsv_compare_sort_status(input, zsv_sorter_add_data(input->sorted.sorter, input->parser, pos, sizeof(pos)));
+  }
+  if (l->stat != zsv_compare_status_ok)
+    zsv_abort(input->parser);
+}
 
-  sqlite3_str_appendf(select_clause, "select * from data%i order by ", ix);
-  for (struct zsv_compare_key *key = keys; key; key = key->next)
-    sqlite3_str_appendf(select_clause, "%s\"%w\"", key == keys ? "" : ", ", key->name);
+/**
+ * Add the key, offset and length of each data row of the input that keep() keeps (or, if keep is
+ * NULL, of every data row) to the input's sorter
+ */
+static enum zsv_compare_status zsv_compare_sort_load(struct zsv_compare_input *input, struct zsv_opts *opts,
+                                                     struct zsv_prop_handler *custom_prop_handler,
+                                                     int (*keep)(void *ctx, struct zsv_compare_input *input),
+                                                     void *ctx) {
+  struct zsv_compare_sort_loader l = {input, keep, ctx, 0, 0, zsv_compare_status_ok};
+  if (!(input->stream = fopen(input->path, "rb"))) {
+    perror(input->path);
+    return zsv_compare_status_error;
+  }
+  struct zsv_opts these_opts = *opts;
+  these_opts.stream = input->stream;
+  these_opts.row_handler = zsv_compare_sort_load_row;
+  these_opts.ctx = &l;
+  if (zsv_new_with_properties(&these_opts, custom_prop_handler, input->path, &input->parser) != zsv_status_ok)
+    l.stat = zsv_compare_status_error;
+  else {
+    enum zsv_status zst;
+    while ((zst = zsv_parse_more(input->parser)) == zsv_status_ok)
+      ;
+    if (l.stat == zsv_compare_status_ok) {
+      if (zst == zsv_status_no_more_input) {
+        l.finishing = 1;
+        zsv_finish(input->parser);
+      } else
+        l.stat = zsv_compare_status_error;
+    }
+  }
+  zsv_compare_sort_close_parser(input);
+  return l.stat;
+}
 
-  int rc = sqlite3_prepare_v2(db, sqlite3_str_value(select_clause), -1, stmtp, NULL);
-  if (rc != SQLITE_OK)
-    fprintf(stderr, "%s: %s\n", sqlite3_errstr(rc), sqlite3_str_value(select_clause));
-  sqlite3_free(sqlite3_str_finish(select_clause));
-  return rc;
+// pass the parser the bytes of each sorted row in turn, each followed by a line end
+static size_t zsv_compare_sorted_read(void *restrict buff, size_t n, size_t size, void *restrict ctx) {
+  struct zsv_compare_input *input = ctx;
+  unsigned char *out = buff;
+  size_t want = n * size, done = 0;
+  while (done < want && !input->sorted.read_failed) {
+    if (input->sorted.row_left) {
+      size_t len = input->sorted.row_left < want - done ? (size_t)input->sorted.row_left : want - done;
+      if (fread(out + done, 1, len, input->stream) != len)
+        input->sorted.read_failed = 1;
+      input->sorted.row_left -= len;
+      done += len;
+    } else if (input->sorted.eol_left) {
+      out[done++] = "\r\n"[2 - input->sorted.eol_left--];
+    } else {
+      const unsigned char *data;
+      size_t len;
+      int rc = zsv_sorter_next_data(input->sorted.sorter, &data, &len);
+      if (rc <= 0) {
+        input->sorted.read_failed = rc < 0;
+        break;
+      }
+      uint64_t pos[2];
+      memcpy(pos, data, sizeof(pos));
+      if (len != sizeof(pos) || fseeko(input->stream, (zsv_file_pos)pos[0], SEEK_SET))
+        input->sorted.read_failed = 1;
+      input->sorted.row_left = pos[1];
+      input->sorted.eol_left = 2;
+    }
+  }
+  return done;
+}
+
+/**
+ * Finish sorting the input, and open a parser that reads its rows in key order. Rows are parsed as
+ * they would be from the middle of the file
+ */
+static enum zsv_compare_status zsv_compare_sort_start(struct zsv_compare_input *input, struct zsv_opts *opts,
+                                                      struct zsv_prop_handler *custom_prop_handler) {
+  enum zsv_compare_status stat = zsv_compare_sort_status(input, zsv_sorter_finish(input->sorted.sorter));
+  if (stat != zsv_compare_status_ok)
+    return stat;
+  if (!(input->stream = fopen(input->path, "rb"))) {
+    perror(input->path);
+    return zsv_compare_status_error;
+  }
+  struct zsv_opts these_opts;
+  if (zsv_chunk_opts(&these_opts, opts, custom_prop_handler, input->path, NULL))
+    return zsv_compare_status_error;
+  these_opts.stream = input;
+  these_opts.read = zsv_compare_sorted_read;
+  if (!(input->parser = zsv_new(&these_opts)))
+    return zsv_compare_status_memory;
+  return zsv_compare_status_ok;
 }
 
 static enum zsv_compare_status input_init_sorted(struct zsv_compare_data *data, struct zsv_compare_input *input,
                                                  struct zsv_opts *opts, struct zsv_prop_handler *custom_prop_handler) {
-  char *err_msg = NULL;
-  if (!sqlite3_zsv_list_add(input->path, opts, custom_prop_handler))
-    input->added = 1;
-  int rc = zsv_compare_sort_prep_table(data, input->path, &err_msg, input->index);
-
-  if (err_msg) {
-    fprintf(stderr, "%s\n", err_msg);
-    sqlite3_free(err_msg);
-  }
-  if (rc == SQLITE_OK)
-    rc = zsv_compare_sort_stmt_prep(data->sort_db, &input->sort_stmt, data->keys, input->index);
-  return rc == SQLITE_OK ? zsv_compare_status_ok : zsv_compare_status_error;
+  enum zsv_compare_status stat = zsv_compare_sort_open(data, input, opts, custom_prop_handler);
+  zsv_compare_sort_close_parser(input);
+  if (stat == zsv_compare_status_ok && input->sorted.keys_found)
+    stat = zsv_compare_sort_load(input, opts, custom_prop_handler, NULL, NULL);
+  if (stat == zsv_compare_status_ok)
+    stat = zsv_compare_sort_start(input, opts, custom_prop_handler);
+  return stat;
 }
 
 static enum zsv_status zsv_compare_next_sorted_row(struct zsv_compare_input *input) {
-  if (sqlite3_step(input->sort_stmt) == SQLITE_ROW)
-    return zsv_status_row;
-
-  // to do: check if error; if so return zsv_status_error
-  return zsv_status_done;
+  enum zsv_status stat = zsv_next_row(input->parser);
+  if (stat != zsv_status_row && input->sorted.read_failed) {
+    fprintf(stderr, "Error reading sorted rows of %s\n", input->path);
+    return zsv_status_error;
+  }
+  return stat;
 }
 
 static struct zsv_cell zsv_compare_get_sorted_colname(struct zsv_compare_input *input, unsigned ix) {
-  struct zsv_cell c = {
-    .str = (unsigned char *)sqlite3_column_name(input->sort_stmt, (int)ix),
-    .quoted = 1,
-  };
-  c.len = c.str ? strlen((const char *)c.str) : 0;
+  if (ix < input->sorted.header_count)
+    return input->sorted.header[ix];
+  struct zsv_cell c = {0};
   return c;
 }
 
 static unsigned zsv_compare_get_sorted_colcount(struct zsv_compare_input *input) {
-  int col_count = sqlite3_column_count(input->sort_stmt);
-  if (col_count >= 0)
-    return (unsigned)col_count;
-  return 0;
+  return input->sorted.header_count;
 }
 
 static struct zsv_cell zsv_compare_get_sorted_cell(struct zsv_compare_input *input, unsigned ix) {
-  struct zsv_cell c = {
-    .str = (unsigned char *)sqlite3_column_text(input->sort_stmt, (int)ix),
-    .quoted = 1,
-  };
-  c.len = c.str ? sqlite3_column_bytes(input->sort_stmt, (int)ix) : 0;
-  if (c.len)
-    c.str = (unsigned char *)zsv_strtrim(c.str, &c.len);
-  return c;
+  return zsv_get_cell_trimmed(input->parser, ix);
+}
+
+static void zsv_compare_sorted_free(struct zsv_compare_input *input) {
+  zsv_sorter_delete(input->sorted.sorter);
+  free(input->sorted.header);
+  free(input->sorted.header_buff);
+  free(input->sorted.keys);
 }
@@ -21,12 +21,9 @@
 
 #define ZSV_COUNT_PARALLEL_MIN_BYTES (1024 * 1024 * 2)
 
+#ifndef ZSV_NO_PARALLEL
 struct zsv_chunk_count_data {
-  unsigned int id;
-  size_t start_offset;
-  size_t end_offset;
-
-  size_t actual_next_row_start;
+  struct zsv_chunk chunk;
   size_t row_count;
   int status;
 
@@ -35,12 +32,7 @@ struct zsv_chunk_count_data {
 
   int skip;
 };
-
-struct zsv_count_parallel_data {
-  unsigned int chunk_count;
-  struct zsv_chunk_count_data *chunks;
-  pthread_t *threads;
-};
+#endif
 
 struct data {
   zsv_parser parser;
@@ -55,41 +47,13 @@ struct data {
   int run_in_parallel;
   int cancelled;
 #ifndef ZSV_NO_PARALLEL
-  struct zsv_count_parallel_data *pdata;
+  struct zsv_chunk_runner runner;
+  struct zsv_chunk_count_data *chunks;
   size_t end_offset_limit; // where this chunk (chunk 0) should stop
   size_t next_row_start;   // where chunk 0 actually ended
 #endif
 };
 
-#ifndef ZSV_NO_PARALLEL
-static void *process_chunk_internal(struct zsv_chunk_count_data *cdata);
-
-static struct zsv_count_parallel_data *parallel_data_new(unsigned int count) {
-  struct zsv_count_parallel_data *pd = calloc(1, sizeof(*pd));
-  if (!pd)
-    return NULL;
-  pd->chunk_count = count;
-  pd->chunks = calloc(count, sizeof(*pd->chunks));
-  pd->threads = calloc(count, sizeof(*pd->threads));
-  if (!pd->chunks || !pd->threads) {
-    free(pd->chunks);
-    free(pd->threads);
-    free(pd);
-    return NULL;
-  }
-  return pd;
-}
-
-static void parallel_data_delete(struct zsv_count_parallel_data *pd) {
-  if (pd) {
-    free(pd->chunks);
-    free(pd->threads);
-    free(pd);
-  }
-}
-
-#endif
-
 /* serial (non-parallelized) row handlers */
 static void row_verbose(void *ctx) {
   struct data *data = ctx;
@@ -137,7 +101,8 @@ static void worker_row_done(void *ctx) {
   struct worker_ctx *wctx = ctx;
   // Calculate absolute offset of the *next* row start
   size_t scanned = zsv_cum_scanned_length(wctx->parser);
-  wctx->cdata->actual_next_row_start = wctx->cdata->start_offset + scanned - zsv_row_length_raw_bytes(wctx->parser);
+  wctx->cdata->chunk.actual_next_row_start =
+    wctx->cdata->chunk.start_offset + scanned - zsv_row_length_raw_bytes(wctx->parser);
   zsv_abort(wctx->parser);
   wctx->cancelled = 1;
 }
@@ -152,25 +117,21 @@ static void worker_row(void *ctx) {
   }
 }
 
-static void *process_chunk_thread(void *arg) {
+static void *process_chunk(void *arg) {
   struct zsv_chunk_count_data *cdata = arg;
-  return process_chunk_internal(cdata);
-}
-
-static void *process_chunk_internal(struct zsv_chunk_count_data *cdata) {
   cdata->row_count = 0;
   cdata->status = 0;
 
-  if (cdata->start_offset >= cdata->end_offset) {
-    cdata->actual_next_row_start = cdata->start_offset;
+  if (cdata->chunk.start_offset >= cdata->chunk.end_offset) {
+    cdata->chunk.actual_next_row_start = cdata->chunk.start_offset;
     cdata->skip = 1;
     return NULL;
   }
 
-  struct zsv_opts opts = *cdata->opts_template;
+  struct zsv_opts opts;
   struct worker_ctx wctx = {0};
   wctx.cdata = cdata;
-  wctx.limit_len = cdata->end_offset - cdata->start_offset;
+  wctx.limit_len = cdata->chunk.end_offset - cdata->chunk.start_offset;
 
   FILE *f = fopen(cdata->input_path, "rb");
   if (!f) {
@@ -178,19 +139,15 @@ static void *process_chunk_internal(struct zsv_chunk_count_data *cdata) {
     return NULL;
   }
 
-  if (fseeko(f, cdata->start_offset, SEEK_SET) != 0) {
+  if (fseeko(f, cdata->chunk.start_offset, SEEK_SET) != 0) {
     fclose(f);
     cdata->status = zsv_status_error;
     return NULL;
   }
 
-  opts.stream = f;
+  zsv_chunk_opts(&opts, cdata->opts_template, NULL, NULL, f);
   opts.ctx = &wctx;
   opts.row_handler = worker_row;
-  /* Workers start mid-file, not at a CSV header. Set keep_empty_header_rows
-   * to bypass skip_to_first_row_w_data which checks cell contents — that
-   * check always sees blank rows in skip_cells mode (no cells populated). */
-  opts.keep_empty_header_rows = 1;
 
   wctx.parser = zsv_new(&opts);
   if (wctx.parser == NULL) {
@@ -207,7 +164,7 @@ static void *process_chunk_internal(struct zsv_chunk_count_data *cdata) {
 
   // if finished naturally (eof)
   if (!wctx.cancelled) {
-    cdata->actual_next_row_start = cdata->start_offset + zsv_cum_scanned_length(wctx.parser);
+    cdata->chunk.actual_next_row_start = cdata->chunk.start_offset + zsv_cum_scanned_length(wctx.parser);
   }
 
   zsv_finish(wctx.parser);
@@ -220,52 +177,21 @@ static void *process_chunk_internal(struct zsv_chunk_count_data *cdata) {
 static void header_handler(void *ctx) {
   struct data *data = ctx;
 #ifndef ZSV_NO_PARALLEL
-  if (data->input_path && data->num_chunks > 1) {
-    size_t header_end = zsv_cum_scanned_length(data->parser);
-    struct zsv_chunk_position *offsets =
-      zsv_guess_file_chunks(data->input_path, data->num_chunks, ZSV_COUNT_PARALLEL_MIN_BYTES, header_end
-#ifndef ZSV_NO_ONLY_CRLF
-                            ,
-                            data->opts->only_crlf_rowend
-#endif
-      );
-
-    if (offsets) {
-      data->pdata = parallel_data_new(data->num_chunks);
-      if (!data->pdata) {
-        fprintf(stderr, "Out of memory!\n");
-        zsv_free_chunks(offsets);
-      } else {
-        data->run_in_parallel = 1;
-        if (data->opts->verbose) {
-          for (unsigned int i = 0; i < data->num_chunks; i++) {
-            fprintf(stderr, "Chunk %i: %lld - %lld\n", i + 1, (long long)offsets[i].start, (long long)offsets[i].end);
-          }
-        }
-
-        /* set up worker chunks (1..n) */
-        for (unsigned int i = 1; i < data->num_chunks; i++) {
-          struct zsv_chunk_count_data *c = &data->pdata->chunks[i];
-          c->id = i;
-          c->start_offset = offsets[i].start;
-          c->end_offset = offsets[i].end;
-          c->input_path = data->input_path;
-          c->opts_template = data->opts;
-
-          if (pthread_create(&data->pdata->threads[i], NULL, process_chunk_thread, c) != 0) {
-            fprintf(stderr, "Error creating thread %d\n", i);
-            data->run_in_parallel = 0;
-            break;
-          }
-        }
-
-        if (data->run_in_parallel) {
-          data->end_offset_limit = offsets[0].end;
-          zsv_set_row_handler(data->parser, row_parallel);
-          data->run_in_parallel = 1;
-        }
-      }
-      zsv_free_chunks(offsets);
+  if (data->input_path && data->num_chunks > 1 &&
+      (data->chunks = calloc(data->num_chunks, sizeof(*data->chunks)))) {
+    for (unsigned int i = 1; i < data->num_chunks; i++) {
+      data->chunks[i].input_path = data->input_path;
+      data->chunks[i].opts_template = data->opts;
+    }
+    data->runner.chunks = data->chunks;
+    data->runner.chunk_size = sizeof(*data->chunks);
+    data->runner.chunk_count = data->num_chunks;
+    data->runner.process = process_chunk;
+    if (zsv_chunks_start(&data->runner, data->input_path, ZSV_COUNT_PARALLEL_MIN_BYTES,
+                         zsv_cum_scanned_length(data->parser), data->opts) == 0) {
+      data->run_in_parallel = 1;
+      data->end_offset_limit = data->chunks[0].chunk.end_offset;
+      zsv_set_row_handler(data->parser, row_parallel);
     }
   }
 #endif
@@ -406,30 +332,14 @@ int ZSV_MAIN_FUNC(ZSV_COMMAND)(int argc, const char *argv[], struct zsv_opts *op
 
         size_t total_rows = data.rows;
         // aggregate results
+        size_t prev_end = data.next_row_start;
         for (unsigned int i = 1; i < data.num_chunks; i++) {
-          pthread_join(data.pdata->threads[i], NULL);
-
-          struct zsv_chunk_count_data *prev_chunk = (i == 1) ? NULL : &data.pdata->chunks[i - 1];
-          struct zsv_chunk_count_data *curr_chunk = &data.pdata->chunks[i];
-
-          // determine where the previous chunk actually ended
-          size_t prev_end = (i == 1) ? data.next_row_start : prev_chunk->actual_next_row_start;
-          // check overlap
-          if (prev_end > curr_chunk->start_offset) {
-            if (data.opts->verbose) {
-              fprintf(stderr, "Overlap detected at chunk %u (expected %zu, got %zu). Reprocessing.\n", i,
-                      curr_chunk->start_offset, prev_end);
-            }
-            // reprocess synchronously
-            curr_chunk->start_offset = prev_end;
-            process_chunk_internal(curr_chunk);
-          }
-
-          total_rows += curr_chunk->row_count;
+          struct zsv_chunk_count_data *c = zsv_chunks_next(&data.runner, i, &prev_end);
+          total_rows += c->row_count;
         }
 
         fprintf(data.output_stream, "%zu\n", total_rows);
-        parallel_data_delete(data.pdata);
+        zsv_chunks_free(&data.runner);
 
       } else
 #endif
@@ -440,6 +350,9 @@ int ZSV_MAIN_FUNC(ZSV_COMMAND)(int argc, const char *argv[], struct zsv_opts *op
   }
 
 count_done:
+#ifndef ZSV_NO_PARALLEL
+  free(data.chunks);
+#endif
   if (opts.stream && opts.stream != stdin)
     fclose(opts.stream);
 
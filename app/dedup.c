@@ -0,0 +1,787 @@
+/*
+ * Copyright (C) 2021 Liquidaty and zsv contributors. All rights reserved.
+ *
+ * This file is part of zsv/lib, distributed under the MIT license as defined at
+ * https://opensource.org/licenses/MIT
+ */
+
+/*
+ * Remove duplicate rows, or rows with duplicate key values, keeping the first or
+ * last row of each key in input order.
+ *
+ * Keys are compared by a 128-bit hash of their (length-prefixed) cells. The input
+ * is read in two passes: the first builds a table of each key's first and last
+ * row and row count, and the second outputs the rows to keep. Both passes can
+ * run in parallel over chunks of the input; in the second, each worker writes
+ * its rows to its own buffer, and the buffers are output in chunk order. When
+ * keeping the first row of each key without counts, a serial run needs only one
+ * pass, as each row can be output as soon as it is seen.
+ *
+ * If the table would exceed the memory budget, keys are instead written to
+ * partition files by hash. Each partition is then resolved on its own into a
+ * result file with a keep/drop decision per row, in input order, which the
+ * second pass reads back in step (as the native sql join does)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <pthread.h>
+#include <sys/stat.h>
+
+#define ZSV_COMMAND dedup
+#include "zsv_command.h"
+
+#include <zsv/utils/writer.h>
+#include <zsv/utils/file.h>
+#include <zsv/utils/file-mem.h>
+#include <zsv/utils/string.h>
+#include <zsv/utils/arg.h>
+#include <zsv/utils/os.h>
+#include "utils/chunk.h"
+#include "utils/column.h"
+#include "utils/buff.h"
+#include "utils/hash.h"
+
+#define ZSV_DEDUP_DEFAULT_MAX_MEMORY_MB 1024
+#define ZSV_DEDUP_PARALLEL_MIN_BYTES (1024 * 1024 * 2)
+#define ZSV_DEDUP_PARALLEL_BUFFER_SZ (1024 * 1024 * 8)
+#define ZSV_DEDUP_MAX_PARTITIONS 256
+
+const char *zsv_dedup_usage_msg[] = {
+  ZSV_USAGE_PROG " " APPNAME ": remove duplicate rows",
+  "",
+  "Usage: " ZSV_USAGE_PROG " " APPNAME " [options] [filename]",
+  "",
+  "Outputs the header and, of each set of rows with the same values (or the same key",
+  "values, if -k is given), only the first (or last) row, in input order. Values are",
+  "compared by a 128-bit hash.",
+  "",
+  "Options:",
+  "  -k,--key <col>[,<col>...]: compare only the given column(s), each of which may be a",
+  "                             column name (case-insensitive) or #N for the Nth column",
+  "                             (1-based). May be repeated",
+  "  --keep first|last        : keep the first (default) or last row of each key",
+  "  --count                  : add a column with the number of rows with each key",
+  "  -o,--output <filename>   : output file",
+  "  -b                       : output with BOM",
+  "  --max-memory <MB>        : memory limit before spilling keys to temporary files",
+  "                             (default: 1024)",
+#ifndef ZSV_NO_PARALLEL
+  "  -j,--jobs <n>            : number of threads used to read the input",
+  "  --parallel               : use all available cores",
+#endif
+  "",
+  "Input read from stdin is first copied to a temporary file.",
+  NULL,
+};
+
+static int zsv_dedup_usage(void) {
+  zsv_print_usage(zsv_dedup_usage_msg);
+  return 0;
+}
+
+/* table of keys, each identified by its 128-bit hash */
+
+struct zsv_dedup_entry {
+  uint64_t count; // number of rows (or, when resolving a partition, records)
+  uint64_t first; // ordinal of the first row (when resolving a partition: whether a row has been kept)
+  uint64_t last;  // ordinal of the last row (when resolving a partition: index of the last row record)
+};
+
+struct zsv_dedup_table {
+  zsv_hash_set keys; // key: the hash; value: its zsv_dedup_entry
+};
+
+static void zsv_dedup_table_clear(struct zsv_dedup_table *t) {
+  zsv_hash_set_delete(t->keys);
+  t->keys = NULL;
+}
+
+static inline size_t zsv_dedup_table_count(const struct zsv_dedup_table *t) {
+  return t->keys ? zsv_hash_set_count(t->keys) : 0;
+}
+
+static inline size_t zsv_dedup_table_bytes(const struct zsv_dedup_table *t) {
+  return t->keys ? zsv_hash_set_bytes(t->keys) : 0;
+}
+
+static struct zsv_dedup_entry *zsv_dedup_table_find(const struct zsv_dedup_table *t, const uint64_t h[2]) {
+  size_t ix = t->keys ? zsv_hash_set_find(t->keys, h[0], h, 2 * sizeof(*h)) : ZSV_HASH_SET_NONE;
+  return ix == ZSV_HASH_SET_NONE ? NULL : zsv_hash_set_value(t->keys, ix);
+}
+
+// return the entry for h, adding it with a count of 0 if new; the caller must then increment the count
+static struct zsv_dedup_entry *zsv_dedup_table_get(struct zsv_dedup_table *t, const uint64_t h[2]) {
+  if (!t->keys && !(t->keys = zsv_hash_set_new(sizeof(struct zsv_dedup_entry))))
+    return NULL;
+  size_t ix = zsv_hash_set_add(t->keys, h[0], h, 2 * sizeof(*h), NULL);
+  return ix == ZSV_HASH_SET_NONE ? NULL : zsv_hash_set_value(t->keys, ix);
+}
+
+// get the i-th key of the table and its entry
+static const struct zsv_dedup_entry *zsv_dedup_table_entry(const struct zsv_dedup_table *t, size_t i,
+                                                           uint64_t h[2]) {
+  size_t len;
+  memcpy(h, zsv_hash_set_key(t->keys, i, &len), 2 * sizeof(*h));
+  return zsv_hash_set_value(t->keys, i);
+}
+
+/* execution */
+
+struct zsv_dedup;
+
+struct zsv_dedup_chunk {
+  struct zsv_chunk chunk;
+  int status; // 0: ok, 1: error, 2: the table exceeded the memory budget
+
+  struct zsv_dedup *d; // shared, read-only while workers run
+  zsv_parser parser;
+  size_t limit_len; // where this chunk's parser should stop
+  char cancelled;
+
+  uint64_t rows;         // data rows processed
+  uint64_t ordinal_base; // ordinal of this chunk's first row
+  struct zsv_dedup_table table;
+  struct zsv_buff key;
+
+  // output of the 2nd pass, for workers
+  zsv_memfile *out;
+  zsv_csv_writer writer;
+};
+
+struct zsv_dedup {
+  const char *input_path;
+  struct zsv_opts *opts; // template for parsers
+  struct zsv_prop_handler *custom_prop_handler;
+  zsv_csv_writer writer;
+  FILE *out;
+
+  const char **key_args; // -k columns, resolved against the header into key_cols
+  unsigned int key_count;
+  size_t *key_cols;
+  char keep_last;
+  char count;
+
+  size_t max_memory;
+  size_t chunk_max_memory; // memory budget of each chunk's table in the 1st pass
+  unsigned int num_chunks;
+  struct zsv_dedup_chunk *chunks; // chunks[0] is processed by the main thread
+  struct zsv_chunk_runner runner;
+  char parallel;  // whether the input was split into chunks
+  char running;   // whether the chunks after the first are read in this pass
+  char streaming; // whether the 1st pass outputs the first row of each key as it is seen
+
+  char pass;        // 1: hash keys, 2: output rows
+  char header_done; // the header row was resolved and output
+  struct zsv_dedup_table table; // the table of all keys, after the 1st pass
+
+  // when spilled: partition files of key records, each resolved into a result file
+  unsigned int partition_count;
+  FILE **parts;
+  char **part_fns;
+  FILE **results;
+  char **result_fns;
+  uint64_t partition_from; // ordinal of the first row that was partitioned
+  int err;
+};
+
+static int zsv_dedup_row_hash(const struct zsv_dedup *d, zsv_parser parser, struct zsv_buff *key, uint64_t h[2]) {
+  size_t cell_count = zsv_cell_count(parser);
+  size_t n = d->key_count ? d->key_count : cell_count;
+  key->len = 0;
+  for (size_t i = 0; i < n; i++) {
+    size_t col = d->key_count ? d->key_cols[i] : i;
+    struct zsv_cell c = col < cell_count ? zsv_get_cell(parser, col) : (struct zsv_cell){0};
+    if (zsv_buff_append_cell(key, c.str, c.len))
+      return 1;
+  }
+  zsv_hash128(key->s, key->len, h);
+  return 0;
+}
+
+static void zsv_dedup_write_row(const struct zsv_dedup *d, zsv_csv_writer w, zsv_parser parser, uint64_t count) {
+  size_t cell_count = zsv_cell_count(parser);
+  for (size_t i = 0; i < cell_count; i++) {
+    struct zsv_cell c = zsv_get_cell(parser, i);
+    zsv_writer_cell(w, i == 0, c.str, c.len, c.quoted);
+  }
+  if (d->count)
+    zsv_writer_cell_zu(w, cell_count == 0, (size_t)count);
+}
+
+static inline unsigned int zsv_dedup_partition(const struct zsv_dedup *d, const uint64_t h[2]) {
+  return (unsigned int)((h[1] >> 32) % d->partition_count);
+}
+
+// partition records are [u8 type][u64 hash[2]], where type is 1 for a row, or 0 for a key whose first row was output
+static int zsv_dedup_partition_write(struct zsv_dedup *d, unsigned char type, const uint64_t h[2]) {
+  unsigned char rec[1 + 2 * sizeof(uint64_t)];
+  rec[0] = type;
+  memcpy(rec + 1, h, 2 * sizeof(uint64_t));
+  return fwrite(rec, 1, sizeof(rec), d->parts[zsv_dedup_partition(d, h)]) != sizeof(rec);
+}
+
+// start writing keys to partition files; rows before ordinal partition_from have already been output
+static int zsv_dedup_partition_open(struct zsv_dedup *d, uint64_t partition_from) {
+  struct stat st;
+  size_t size = stat(d->input_path, &st) ? 0 : (size_t)st.st_size;
+  unsigned int count = (unsigned int)(2 * (size / d->max_memory) + 2);
+  if (count > ZSV_DEDUP_MAX_PARTITIONS)
+    count = ZSV_DEDUP_MAX_PARTITIONS;
+  d->partition_count = count;
+  d->partition_from = partition_from;
+  if (!(d->parts = calloc(count, sizeof(*d->parts))) || !(d->part_fns = calloc(count, sizeof(*d->part_fns))))
+    return 1;
+  for (unsigned int i = 0; i < count; i++)
+    if (!(d->parts[i] = zsv_buff_temp_file("zsvdedup", &d->part_fns[i])))
+      return 1;
+  if (d->opts->verbose)
+    fprintf(stderr, "Dedup: keys exceed memory budget; using %u partitions\n", count);
+  return 0;
+}
+
+/*
+ * resolve each partition into a result file of, per row record in the partition,
+ * [u8 keep] followed, if kept and with --count, by [u64 count]
+ */
+static int zsv_dedup_partition_resolve(struct zsv_dedup *d) {
+  struct zsv_dedup_table t = {0};
+  unsigned char rec[1 + 2 * sizeof(uint64_t)];
+  uint64_t h[2];
+  int err = !(d->results = calloc(d->partition_count, sizeof(*d->results))) ||
+            !(d->result_fns = calloc(d->partition_count, sizeof(*d->result_fns)));
+  for (unsigned int p = 0; !err && p < d->partition_count; p++) {
+    FILE *part = d->parts[p];
+    if (!(d->results[p] = zsv_buff_temp_file("zsvdedup", &d->result_fns[p])) || fseeko(part, 0, SEEK_SET))
+      err = 1;
+    uint64_t i = 0;
+    while (!err && fread(rec, 1, sizeof(rec), part) == sizeof(rec)) {
+      memcpy(h, rec + 1, sizeof(h));
+      struct zsv_dedup_entry *e = zsv_dedup_table_get(&t, h);
+      if (!e)
+        err = 1;
+      else {
+        e->count++;
+        if (rec[0])
+          e->last = i++;
+        else
+          e->first = 1;
+      }
+    }
+    if (!err && fseeko(part, 0, SEEK_SET))
+      err = 1;
+    i = 0;
+    while (!err && fread(rec, 1, sizeof(rec), part) == sizeof(rec)) {
+      if (!rec[0])
+        continue;
+      memcpy(h, rec + 1, sizeof(h));
+      struct zsv_dedup_entry *e = zsv_dedup_table_find(&t, h);
+      unsigned char keep = d->keep_last ? e->last == i : !e->first;
+      e->first = 1;
+      i++;
+      if (fwrite(&keep, 1, 1, d->results[p]) != 1 ||
+          (keep && d->count && fwrite(&e->count, sizeof(e->count), 1, d->results[p]) != 1))
+        err = 1;
+    }
+    zsv_dedup_table_clear(&t);
+    if (!err && fseeko(d->results[p], 0, SEEK_SET))
+      err = 1;
+  }
+  zsv_buff_temp_files_delete(d->parts, d->part_fns, d->partition_count);
+  d->parts = NULL;
+  d->part_fns = NULL;
+  return err;
+}
+
+// 1st pass: add the row's key to the chunk's table, or write it to a partition
+static void zsv_dedup_row_pass1(struct zsv_dedup_chunk *c) {
+  struct zsv_dedup *d = c->d;
+  uint64_t h[2];
+  uint64_t ordinal = c->rows++;
+  if (zsv_dedup_row_hash(d, c->parser, &c->key, h)) {
+    c->status = 1;
+    return;
+  }
+  if (d->parts) {
+    c->status = zsv_dedup_partition_write(d, 1, h);
+    return;
+  }
+
+  struct zsv_dedup_entry *e = zsv_dedup_table_get(&c->table, h);
+  if (!e) {
+    c->status = 1;
+    return;
+  }
+  if (!e->count++) {
+    e->first = ordinal;
+    if (d->streaming)
+      zsv_dedup_write_row(d, d->writer, c->parser, 0);
+  }
+  e->last = ordinal;
+
+  if (zsv_dedup_table_bytes(&c->table) > d->chunk_max_memory) {
+    if (!d->streaming) {
+      c->status = 2; // start over, partitioning all keys
+      zsv_abort(c->parser);
+      c->cancelled = 1;
+      return;
+    }
+    // the rows so far have been output: partition the keys seen, then the keys of all later rows
+    if (zsv_dedup_partition_open(d, ordinal + 1))
+      c->status = 1;
+    for (size_t i = 0, n = zsv_dedup_table_count(&c->table); !c->status && i < n; i++) {
+      uint64_t key[2];
+      zsv_dedup_table_entry(&c->table, i, key);
+      if (zsv_dedup_partition_write(d, 0, key))
+        c->status = 1;
+    }
+    zsv_dedup_table_clear(&c->table);
+  }
+}
+
+// 2nd pass: output the row if it is the first (or last) with its key
+static void zsv_dedup_row_pass2(struct zsv_dedup_chunk *c) {
+  struct zsv_dedup *d = c->d;
+  uint64_t h[2];
+  uint64_t ordinal = c->ordinal_base + c->rows++;
+  if (ordinal < d->partition_from)
+    return; // already output by the 1st pass
+  if (zsv_dedup_row_hash(d, c->parser, &c->key, h)) {
+    c->status = 1;
+    return;
+  }
+
+  unsigned char keep;
+  uint64_t count = 0;
+  if (d->results) {
+    FILE *f = d->results[zsv_dedup_partition(d, h)];
+    if (fread(&keep, 1, 1, f) != 1 || (keep && d->count && fread(&count, sizeof(count), 1, f) != 1)) {
+      c->status = 1;
+      return;
+    }
+  } else {
+    const struct zsv_dedup_entry *e = zsv_dedup_table_find(&d->table, h);
+    if (!e || !e->count) {
+      c->status = 1;
+      return;
+    }
+    keep = (d->keep_last ? e->last : e->first) == ordinal;
+    count = e->count;
+  }
+  if (keep)
+    zsv_dedup_write_row(d, c->writer, c->parser, count);
+}
+
+static void zsv_dedup_row_done(void *ctx) {
+  struct zsv_dedup_chunk *c = ctx;
+  // absolute offset of the start of the next row
+  c->chunk.actual_next_row_start =
+    c->chunk.start_offset + zsv_cum_scanned_length(c->parser) - zsv_row_length_raw_bytes(c->parser);
+  zsv_abort(c->parser);
+  c->cancelled = 1;
+}
+
+static void zsv_dedup_row_handler(void *ctx) {
+  struct zsv_dedup_chunk *c = ctx;
+  if (c->status)
+    return;
+  if (c->d->pass == 1)
+    zsv_dedup_row_pass1(c);
+  else
+    zsv_dedup_row_pass2(c);
+  if (UNLIKELY(c->limit_len && zsv_cum_scanned_length(c->parser) >= c->limit_len) && !c->cancelled)
+    zsv_set_row_handler(c->parser, zsv_dedup_row_done);
+}
+
+static void *zsv_dedup_process_chunk(void *arg) {
+  struct zsv_dedup_chunk *c = arg;
+  struct zsv_dedup *d = c->d;
+  // in case we are re-running due to incorrect chunk start
+  zsv_dedup_table_clear(&c->table);
+  c->status = 0;
+  c->cancelled = 0;
+  c->rows = 0;
+  if (c->chunk.start_offset >= c->chunk.end_offset) {
+    c->chunk.actual_next_row_start = c->chunk.start_offset;
+    return NULL;
+  }
+  c->limit_len = c->chunk.end_offset - c->chunk.start_offset;
+
+  if (d->pass == 2) {
+    struct zsv_csv_writer_options writer_opts = {0};
+    if (!(c->out = zsv_memfile_open(ZSV_DEDUP_PARALLEL_BUFFER_SZ)) && !(c->out = zsv_memfile_open(0))) {
+      c->status = 1;
+      return NULL;
+    }
+    writer_opts.stream = c->out;
+    writer_opts.write = (size_t(*)(const void *restrict, size_t, size_t, void *restrict))zsv_memfile_write;
+    if (!(c->writer = zsv_writer_new(&writer_opts))) {
+      c->status = 1;
+      return NULL;
+    }
+  }
+
+  FILE *f = fopen(d->input_path, "rb");
+  struct zsv_opts opts;
+  if (!f || fseeko(f, (off_t)c->chunk.start_offset, SEEK_SET) != 0 ||
+      zsv_chunk_opts(&opts, d->opts, d->custom_prop_handler, d->input_path, f))
+    c->status = 1;
+  else {
+    opts.row_handler = zsv_dedup_row_handler;
+    opts.ctx = c;
+    if (!(c->parser = zsv_new(&opts)))
+      c->status = 1;
+    else {
+      enum zsv_status status = zsv_status_ok;
+      while (status == zsv_status_ok && !c->cancelled)
+        status = zsv_parse_more(c->parser);
+      if (!c->cancelled) { // reached eof
+        zsv_finish(c->parser);
+        c->chunk.actual_next_row_start = c->chunk.start_offset + zsv_cum_scanned_length(c->parser);
+      }
+      zsv_delete(c->parser);
+      c->parser = NULL;
+    }
+  }
+  if (f)
+    fclose(f);
+  return NULL;
+}
+
+// the 1st time: resolve key columns and output the header; then start a worker for each chunk after the first
+static void zsv_dedup_header(void *ctx) {
+  struct zsv_dedup_chunk *c0 = ctx;
+  struct zsv_dedup *d = c0->d;
+  zsv_set_row_handler(c0->parser, zsv_dedup_row_handler);
+
+  if (!d->header_done) {
+    d->header_done = 1;
+    int err = 0;
+    for (unsigned int i = 0; !err && i < d->key_count; i++)
+      if ((err = zsv_find_column(c0->parser, d->key_args[i], &d->key_cols[i])))
+        fprintf(stderr, "Column not found: %s\n", d->key_args[i]);
+    if (err) {
+      d->err = 1;
+      zsv_abort(c0->parser);
+      c0->cancelled = 1;
+      return;
+    }
+    size_t cell_count = zsv_cell_count(c0->parser);
+    for (size_t i = 0; i < cell_count; i++) {
+      struct zsv_cell c = zsv_get_cell(c0->parser, i);
+      zsv_writer_cell(d->writer, i == 0, c.str, c.len, 1);
+    }
+    if (d->count)
+      zsv_writer_cell_s(d->writer, cell_count == 0, (const unsigned char *)"count", 0);
+
+    for (unsigned int i = 1; i < d->num_chunks; i++)
+      d->chunks[i].d = d;
+    d->runner.chunks = d->chunks;
+    d->runner.chunk_size = sizeof(*d->chunks);
+    d->runner.chunk_count = d->num_chunks;
+    d->runner.process = zsv_dedup_process_chunk;
+    d->chunk_max_memory = d->max_memory / d->num_chunks; // the workers use this as soon as they start
+    d->parallel = d->running = zsv_chunks_start(&d->runner, d->input_path, ZSV_DEDUP_PARALLEL_MIN_BYTES,
+                                                zsv_cum_scanned_length(c0->parser), d->opts) == 0;
+    if (!d->parallel)
+      d->chunk_max_memory = d->max_memory;
+    d->streaming = !d->parallel && !d->keep_last && !d->count;
+  } else if (d->parallel) {
+    // the 2nd pass reads the same chunks as the 1st, on this thread if workers cannot be started
+    zsv_chunks_run(&d->runner);
+    d->running = 1;
+  }
+  if (d->running)
+    c0->limit_len = c0->chunk.end_offset;
+}
+
+// add the keys of chunk c, whose first row has ordinal c->ordinal_base, to table t
+static int zsv_dedup_table_merge(struct zsv_dedup_table *t, const struct zsv_dedup_chunk *c) {
+  for (size_t i = 0, n = zsv_dedup_table_count(&c->table); i < n; i++) {
+    uint64_t h[2];
+    const struct zsv_dedup_entry *e = zsv_dedup_table_entry(&c->table, i, h);
+    struct zsv_dedup_entry *e0 = zsv_dedup_table_get(t, h);
+    if (!e0)
+      return 1;
+    if (!e0->count)
+      e0->first = c->ordinal_base + e->first;
+    e0->count += e->count;
+    e0->last = c->ordinal_base + e->last;
+  }
+  return 0;
+}
+
+// run a pass over the input; return 0 on success, 1 on error or 2 if the 1st pass exceeded the memory budget
+static int zsv_dedup_run_pass(struct zsv_dedup *d, char pass) {
+  struct zsv_dedup_chunk *c0 = &d->chunks[0];
+  d->pass = pass;
+  d->running = 0;
+  c0->d = d;
+  c0->rows = 0;
+  c0->status = 0;
+  c0->cancelled = 0;
+  c0->limit_len = 0;
+  c0->writer = d->writer;
+
+  struct zsv_opts popts = *d->opts;
+  FILE *f = fopen(d->input_path, "rb");
+  if (!f) {
+    fprintf(stderr, "Unable to open for reading: %s\n", d->input_path);
+    return 1;
+  }
+  popts.stream = f;
+  popts.row_handler = zsv_dedup_header;
+  popts.ctx = c0;
+  if (zsv_new_with_properties(&popts, d->custom_prop_handler, d->input_path, &c0->parser) != zsv_status_ok)
+    d->err = 1;
+  else {
+    // chunk 0: main thread, from the start of the input (incl. the header row)
+    while (!c0->cancelled && zsv_parse_more(c0->parser) == zsv_status_ok)
+      ;
+    if (!c0->cancelled) {
+      zsv_finish(c0->parser);
+      c0->chunk.actual_next_row_start = zsv_cum_scanned_length(c0->parser);
+    }
+    zsv_delete(c0->parser);
+    c0->parser = NULL;
+  }
+  fclose(f);
+  int rc = c0->status;
+
+  // wait for workers, then merge their tables (1st pass) or output (2nd pass) in chunk order
+  uint64_t ordinal_base = c0->rows;
+  size_t prev_end = c0->chunk.actual_next_row_start;
+  if (pass == 2 && d->running) {
+    // end the main writer's output before appending that of the workers
+    zsv_writer_delete(d->writer);
+    d->writer = NULL;
+    fflush(d->out);
+  }
+  for (unsigned int i = 1; d->running && i < d->num_chunks; i++) {
+    struct zsv_dedup_chunk *c = zsv_chunks_next(&d->runner, i, &prev_end);
+    if (c->status && (!rc || c->status == 1))
+      rc = c->status;
+    c->ordinal_base = ordinal_base;
+    ordinal_base += c->rows;
+
+    if (rc || d->err)
+      ;
+    else if (pass == 1) {
+      if (zsv_dedup_table_merge(&c0->table, c))
+        rc = 1;
+      else if (zsv_dedup_table_bytes(&c0->table) > d->max_memory)
+        rc = 2;
+    } else {
+      zsv_writer_delete(c->writer);
+      c->writer = NULL;
+      if (zsv_memfile_rewind(c->out) ||
+          zsv_copy_filelike_ptr((FILE *)c->out,
+                                (size_t(*)(void *restrict, size_t, size_t, void *restrict))zsv_memfile_read, d->out,
+                                (size_t(*)(const void *restrict, size_t, size_t, void *restrict))fwrite))
+        rc = 1;
+    }
+    zsv_dedup_table_clear(&c->table);
+    if (c->writer)
+      zsv_writer_delete(c->writer);
+    c->writer = NULL;
+    zsv_memfile_close(c->out);
+    c->out = NULL;
+  }
+
+  if (pass == 1) {
+    d->table = c0->table;
+    memset(&c0->table, 0, sizeof(c0->table));
+  }
+  return d->err ? 1 : rc;
+}
+
+int ZSV_MAIN_FUNC(ZSV_COMMAND)(int argc, const char *argv[], struct zsv_opts *opts,
+                               struct zsv_prop_handler *custom_prop_handler) {
+  if (argc > 1 && (!strcmp(argv[1], "-h") || !strcmp(argv[1], "--help")))
+    return zsv_dedup_usage();
+
+  int err = 0;
+  const char *input_path = NULL;
+  struct zsv_csv_writer_options writer_opts = zsv_writer_get_default_opts();
+  struct zsv_dedup d = {0};
+  char *keys = NULL; // copies of -k arguments, each nul-terminated
+  size_t keys_len = 0;
+  FILE *spool = NULL;
+  char *spool_fn = NULL;
+  d.opts = opts;
+  d.custom_prop_handler = custom_prop_handler;
+  d.max_memory = (size_t)ZSV_DEDUP_DEFAULT_MAX_MEMORY_MB * 1024 * 1024;
+  d.num_chunks = 1;
+  writer_opts.stream = stdout;
+
+  for (int arg_i = 1; !err && arg_i < argc; arg_i++) {
+    const char *arg = argv[arg_i];
+    if (!strcmp(arg, "-k") || !strcmp(arg, "--key")) {
+      if (++arg_i >= argc || !*argv[arg_i]) {
+        fprintf(stderr, "%s option requires a column name\n", arg);
+        err = 1;
+      } else {
+        size_t len = strlen(argv[arg_i]) + 1;
+        char *tmp = realloc(keys, keys_len + len + 1);
+        if (!tmp)
+          err = 1;
+        else {
+          keys = tmp;
+          memcpy(keys + keys_len, argv[arg_i], len);
+          keys_len += len;
+          keys[keys_len] = '\0';
+        }
+      }
+    } else if (!strcmp(arg, "--keep")) {
+      if (++arg_i >= argc || (strcmp(argv[arg_i], "first") && strcmp(argv[arg_i], "last"))) {
+        fprintf(stderr, "%s option requires first or last\n", arg);
+        err = 1;
+      } else
+        d.keep_last = !strcmp(argv[arg_i], "last");
+    } else if (!strcmp(arg, "--count"))
+      d.count = 1;
+    else if (!strcmp(arg, "-b"))
+      writer_opts.with_bom = 1;
+    else if (!strcmp(arg, "-o") || !strcmp(arg, "--output")) {
+      if (++arg_i >= argc) {
+        fprintf(stderr, "%s option requires a filename\n", arg);
+        err = 1;
+      } else if (writer_opts.stream != stdout) {
+        fprintf(stderr, "Output may not be specified more than once\n");
+        err = 1;
+      } else if (!(writer_opts.stream = fopen(argv[arg_i], "wb"))) {
+        writer_opts.stream = stdout;
+        fprintf(stderr, "Unable to open file for writing: %s\n", argv[arg_i]);
+        err = 1;
+      }
+    } else if (!strcmp(arg, "--max-memory")) {
+      if (++arg_i >= argc || atoi(argv[arg_i]) <= 0) {
+        fprintf(stderr, "%s option requires a positive number of MB\n", arg);
+        err = 1;
+      } else
+        d.max_memory = (size_t)atoi(argv[arg_i]) * 1024 * 1024;
+#ifndef ZSV_NO_PARALLEL
+    } else if (!strcmp(arg, "-j") || !strcmp(arg, "--jobs")) {
+      if (++arg_i >= argc || atoi(argv[arg_i]) <= 0) {
+        fprintf(stderr, "%s option requires a positive number\n", arg);
+        err = 1;
+      } else
+        d.num_chunks = (unsigned int)atoi(argv[arg_i]);
+    } else if (!strcmp(arg, "--parallel")) {
+      d.num_chunks = zsv_get_number_of_cores();
+      if (d.num_chunks < 2) {
+        fprintf(stderr, "Warning: --parallel specified but only one core found; using -j 4 instead\n");
+        d.num_chunks = 4;
+      }
+#endif
+    } else if (zsv_arg_is_option(arg)) {
+      fprintf(stderr, "Unrecognized option: %s\n", arg);
+      err = 1;
+    } else if (input_path) {
+      fprintf(stderr, "Input may not be specified more than once\n");
+      err = 1;
+    } else
+      input_path = arg;
+  }
+
+  // key columns: split -k arguments at commas
+  for (char *s = keys; !err && s && *s; s += strlen(s) + 1) {
+    for (char *t = s; *t; t++)
+      if (*t == ',')
+        d.key_count++;
+    d.key_count++;
+  }
+  if (!err && d.key_count &&
+      (!(d.key_args = calloc(d.key_count, sizeof(*d.key_args))) || !(d.key_cols = calloc(d.key_count, sizeof(size_t)))))
+    err = 1;
+  if (!err && d.key_count) {
+    unsigned int n = 0;
+    for (char *s = keys; *s; s += strlen(s) + 1) {
+      char *comma;
+      for (; (comma = strchr(s, ',')); s = comma + 1) {
+        *comma = '\0';
+        d.key_args[n++] = s;
+      }
+      d.key_args[n++] = s;
+    }
+  }
+
+  if (!err && input_path && !strcmp(input_path, "-"))
+    input_path = NULL;
+#ifdef NO_STDIN
+  if (!err && !input_path) {
+    fprintf(stderr, "Please specify an input file\n");
+    err = 1;
+  }
+#endif
+  if (!err && !input_path) { // two passes may be needed, so spool stdin to a temp file
+    char buff[64 * 1024];
+    size_t n;
+    if (!(spool = zsv_buff_temp_file("zsvdedup", &spool_fn)))
+      err = 1;
+    while (!err && (n = fread(buff, 1, sizeof(buff), stdin)) > 0)
+      if (fwrite(buff, 1, n, spool) != n)
+        err = 1;
+    if (!err && fflush(spool))
+      err = 1;
+    input_path = spool_fn;
+  }
+  d.input_path = input_path;
+
+  if (!err && d.num_chunks > 1) {
+    enum zsv_chunk_status stat = zsv_chunkable(input_path, opts);
+    if (stat != zsv_chunk_status_ok) {
+      if (opts->verbose)
+        fprintf(stderr, "Not running in parallel: %s\n", zsv_chunk_status_str(stat));
+      d.num_chunks = 1;
+    }
+  }
+  if (!err && (!(d.chunks = calloc(d.num_chunks, sizeof(*d.chunks))) || !(d.writer = zsv_writer_new(&writer_opts)))) {
+    fprintf(stderr, "Out of memory!\n");
+    err = 1;
+  }
+  d.out = writer_opts.stream;
+
+  if (!err) {
+    int rc = zsv_dedup_run_pass(&d, 1);
+    if (rc == 2) { // start over, partitioning all keys, on one thread
+      zsv_dedup_table_clear(&d.table);
+      d.parallel = 0;
+      rc = zsv_dedup_partition_open(&d, 0) ? 1 : zsv_dedup_run_pass(&d, 1);
+    }
+    if (!rc && d.parts)
+      rc = zsv_dedup_partition_resolve(&d);
+    if (!rc && d.header_done && (!d.streaming || d.results))
+      rc = zsv_dedup_run_pass(&d, 2);
+    if (rc) {
+      if (rc == 1 && !d.err)
+        fprintf(stderr, "Error removing duplicates\n");
+      err = 1;
+    }
+  }
+
+  zsv_dedup_table_clear(&d.table);
+  for (unsigned int i = 0; d.chunks && i < d.num_chunks; i++) {
+    zsv_dedup_table_clear(&d.chunks[i].table);
+    free(d.chunks[i].key.s);
+  }
+  zsv_buff_temp_files_delete(d.parts, d.part_fns, d.partition_count);
+  zsv_buff_temp_files_delete(d.results, d.result_fns, d.partition_count);
+  free(d.chunks);
+  zsv_chunks_free(&d.runner);
+  free(d.key_args);
+  free(d.key_cols);
+  free(keys);
+  if (d.writer)
+    zsv_writer_delete(d.writer);
+  if (writer_opts.stream && writer_opts.stream != stdout)
+    fclose(writer_opts.stream);
+  if (spool) {
+    fclose(spool);
+    unlink(spool_fn);
+  }
+  free(spool_fn);
+  return err;
+}
@@ -6,15 +6,33 @@
  * https://opensource.org/licenses/MIT
  */
 
-#include <sglib.h>
+/*
+ * Describe each column of a table: the range of its value lengths, its share of blank
+ * values, its first distinct values (compared case-insensitively) as examples, and,
+ * with -a, whether its values are unique and how many distinct values it has.
+ *
+ * With -j, the rows after the header are split into chunks that are read in parallel,
+ * each into its own partial results, which are then merged in chunk order. So that the
+ * other chunks can count each column's examples, the main thread first reads rows until
+ * all examples of every column are found (or ZSV_DESC_PREFIX_ROWS rows) before starting
+ * them. For a column whose examples are not all found by then, each other chunk counts
+ * its distinct values, up to ZSV_DESC_MAX_EXAMPLE_VALUES of them; if that is not enough
+ * to count the column's examples, the input is read again on one thread.
+ *
+ * Distinct values are kept in hash sets, until a column that is not
+ * unique has more than ZSV_DESC_MAX_EXACT_DISTINCT of them, after which their count is
+ * estimated with a HyperLogLog sketch
+ */
 
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <stdint.h>
 #include <math.h>
 #include <fenv.h>
 #include <time.h>
 #include <unistd.h> // unlink()
+#include <pthread.h>
 
 #define ZSV_COMMAND desc
 #include "zsv_command.h"
@@ -23,18 +41,32 @@
 #include <zsv/utils/file.h>
 #include <zsv/utils/mem.h>
 #include <zsv/utils/string.h>
+#include <zsv/utils/os.h>
+#include "utils/chunk.h"
+#include "utils/sketch.h"
+#include "utils/hash.h"
 
 #define ZSV_DESC_MAX_COLS_DEFAULT 32768
 #define ZSV_DESC_MAX_COLS_DEFAULT_S "32768"
 
+#define ZSV_DESC_PARALLEL_MIN_BYTES (1024 * 1024 * 2)
+#define ZSV_DESC_PREFIX_ROWS 10000 // most rows read before the other chunks are started
+
+#define ZSV_DESC_MAX_EXACT_DISTINCT 1000
+#define ZSV_DESC_MAX_EXACT_DISTINCT_S "1000"
+#define ZSV_DESC_MAX_EXAMPLE_VALUES 1000 // per column, in each chunk after the first
+
 #define ZSV_DESC_FLAG_MINMAX 1
 #define ZSV_DESC_FLAG_MINMAXLEN 2
+#define ZSV_DESC_FLAG_DISTINCT 4
 #define ZSV_DESC_FLAG_UNIQUE 32
 #define ZSV_DESC_FLAG_UNIQUE_CI 64
 
 struct zsv_desc_string_list {
   struct zsv_desc_string_list *next;
   unsigned char *value;
+  unsigned char *lc; // value in lower case, as examples are compared
+  size_t lc_len;
   size_t count;
 };
 
@@ -42,51 +74,66 @@ void zsv_desc_string_list_free(struct zsv_desc_string_list *e) {
   struct zsv_desc_string_list *n;
   for (; e; e = n) {
     n = e->next;
-    if (e->value)
-      free(e->value);
+    free(e->value);
+    free(e->lc);
     free(e);
   }
 }
 
-typedef struct zsv_desc_unique_key {
-  unsigned char color : 1;
-  unsigned char _ : 7;
-  unsigned char *value;
-  struct zsv_desc_unique_key *left;
-  struct zsv_desc_unique_key *right;
-} zsv_desc_unique_key;
+/* sets of values (see utils/hash.h), each with the number of times it was added */
 
-struct zsv_desc_unique_key_container {
-  struct zsv_desc_unique_key *key;
-  size_t max_count;
-  size_t count;
-  unsigned char not_enum : 1;
-  unsigned char dummy : 7;
+struct zsv_desc_value {
+  size_t count;               // times added
+  const unsigned char *value; // the value as first added, if its key is e.g. in lower case, else NULL
+  size_t value_len;
 };
 
-static struct zsv_desc_unique_key *zsv_desc_unique_key_new(const unsigned char *value, size_t len) {
-  zsv_desc_unique_key *key = calloc(1, sizeof(*key));
-  if (!key || !(key->value = malloc(len + 1)))
-    ; // handle out-of-memory error!
-  else {
-    memcpy(key->value, value, len);
-    key->value[len] = '\0';
-  }
-  return key;
+static size_t zsv_desc_value_set_count(zsv_hash_set s) {
+  return s ? zsv_hash_set_count(s) : 0;
 }
 
-static void zsv_desc_unique_key_delete(zsv_desc_unique_key *e) {
-  if (e)
-    free(e->value);
-  free(e);
+static void zsv_desc_value_set_clear(zsv_hash_set *s) {
+  zsv_hash_set_delete(*s);
+  *s = NULL;
 }
 
-static int zsv_desc_unique_key_cmp(zsv_desc_unique_key *x, zsv_desc_unique_key *y) {
-  return strcmp((const char *)x->value, (const char *)y->value);
+static struct zsv_desc_value *zsv_desc_value_set_get(zsv_hash_set s, uint64_t hash, const unsigned char *key,
+                                                     size_t key_len) {
+  size_t ix = s ? zsv_hash_set_find(s, hash, key, key_len) : ZSV_HASH_SET_NONE;
+  return ix == ZSV_HASH_SET_NONE ? NULL : zsv_hash_set_value(s, ix);
 }
 
-SGLIB_DEFINE_RBTREE_PROTOTYPES(zsv_desc_unique_key, left, right, color, zsv_desc_unique_key_cmp);
-SGLIB_DEFINE_RBTREE_FUNCTIONS(zsv_desc_unique_key, left, right, color, zsv_desc_unique_key_cmp);
+// return the entry of the given key, adding it with a count of 0 if new (the caller then
+// increments the count). value, if not NULL, is the value whose key this is, to keep with
+// it. The entry moves when another key is added. Returns NULL if out of memory
+static struct zsv_desc_value *zsv_desc_value_set_add(zsv_hash_set *s, uint64_t hash, const unsigned char *key,
+                                                     size_t key_len, const unsigned char *value, size_t value_len) {
+  char added = 0;
+  size_t ix;
+  if ((!*s && !(*s = zsv_hash_set_new(sizeof(struct zsv_desc_value)))) ||
+      (ix = zsv_hash_set_add(*s, hash, key, key_len, &added)) == ZSV_HASH_SET_NONE)
+    return NULL;
+  struct zsv_desc_value *e = zsv_hash_set_value(*s, ix);
+  if (added && value && value_len) {
+    unsigned char *p = zsv_hash_set_alloc(*s, value_len);
+    if (!p)
+      return NULL;
+    memcpy(p, value, value_len);
+    e->value = p;
+    e->value_len = value_len;
+  }
+  return e;
+}
+
+// get the value kept with the given key, or the key itself
+static const unsigned char *zsv_desc_value_set_value(zsv_hash_set s, size_t ix, size_t *len) {
+  const struct zsv_desc_value *e = zsv_hash_set_value(s, ix);
+  if (e->value) {
+    *len = e->value_len;
+    return e->value;
+  }
+  return zsv_hash_set_key(s, ix, len);
+}
 
 #define ZSV_DESC_MAX_EXAMPLE_COUNT 5 // could make this customizable...
 struct zsv_desc_column_data {
@@ -95,14 +142,27 @@ struct zsv_desc_column_data {
 
   unsigned char not_unique : 1;
   unsigned char not_unique_ci : 1;
-  unsigned char _ : 6;
+  unsigned char distinct_estimated : 1;  // distinct values are counted by distinct_hll
+  unsigned char example_values_full : 1; // example_values has ZSV_DESC_MAX_EXAMPLE_VALUES
+  unsigned char _ : 4;
+
+  zsv_hash_set distinct; // distinct values, until distinct_estimated
+  struct zsv_hll distinct_hll;
+  zsv_hash_set values_ci; // distinct values in lower case, until not_unique_ci
 
-  struct zsv_desc_unique_key_container unique_values;
-  struct zsv_desc_unique_key_container unique_values_ci;
+  // in the first chunk: the examples
   struct zsv_desc_string_list *examples;
   struct zsv_desc_string_list **examples_tail;
   unsigned int examples_count;
 
+  // in each other chunk, if the examples were all found before it started: the count of
+  // each example. Else: the count of each value in lower case, with the counts of the
+  // first values (the first keys of example_values) as each of them was first seen (for
+  // --quick, which stops counting once all examples are found)
+  size_t example_counts[ZSV_DESC_MAX_EXAMPLE_COUNT];
+  zsv_hash_set example_values;
+  size_t first_value_counts[ZSV_DESC_MAX_EXAMPLE_COUNT][ZSV_DESC_MAX_EXAMPLE_COUNT];
+
   unsigned int total_count;
   struct {
     unsigned int count;
@@ -118,40 +178,15 @@ static void zsv_desc_column_data_finalize(struct zsv_desc_column_data *col, unsi
   col->position = i;
 }
 
-static void zsv_desc_column_unique_values_delete(zsv_desc_unique_key **tree) {
-  if (tree && *tree) {
-    struct sglib_zsv_desc_unique_key_iterator it;
-    struct zsv_desc_unique_key *e;
-    for (e = sglib_zsv_desc_unique_key_it_init(&it, *tree); e; e = sglib_zsv_desc_unique_key_it_next(&it))
-      zsv_desc_unique_key_delete(e);
-    *tree = NULL;
-  }
-}
-
 static void zsv_desc_column_data_free(struct zsv_desc_column_data *e) {
   free(e->name);
-  zsv_desc_column_unique_values_delete(&e->unique_values.key);
-  zsv_desc_column_unique_values_delete(&e->unique_values_ci.key);
+  zsv_desc_value_set_clear(&e->distinct);
+  zsv_hll_free(&e->distinct_hll);
+  zsv_desc_value_set_clear(&e->values_ci);
+  zsv_desc_value_set_clear(&e->example_values);
   zsv_desc_string_list_free(e->examples);
 }
 
-struct zsv_desc_column_name {
-  struct zsv_desc_column_name *next;
-  char *name;
-};
-
-static void zsv_desc_column_names_delete(struct zsv_desc_column_name **p) {
-  if (p && *p) {
-    struct zsv_desc_column_name *next;
-    for (struct zsv_desc_column_name *e = *p; e; e = next) {
-      next = e->next;
-      free(e->name);
-      free(e);
-    }
-    *p = NULL;
-  }
-}
-
 enum zsv_desc_status {
   zsv_desc_status_ok = 0,
   zsv_desc_status_error, // generic error
@@ -160,8 +195,25 @@ enum zsv_desc_status {
   zsv_desc_status_argument
 };
 
+struct zsv_desc_data;
+
+struct zsv_desc_chunk {
+  struct zsv_chunk chunk;
+  struct zsv_desc_data *data; // shared; its columns are read-only to other chunks
+  int status; // 0: ok, 1: error
+
+  zsv_parser parser;
+  size_t limit_len; // where this chunk's parser should stop
+  char cancelled;
+
+  struct zsv_desc_column_data *columns; // of the first chunk: data->columns
+  unsigned char *lc;                    // a value in lower case
+  size_t lc_size;
+};
+
 struct zsv_desc_data {
   struct zsv_opts *opts;
+  struct zsv_prop_handler *custom_prop_handler;
   const char *input_filename;
   zsv_csv_writer csv_writer;
 
@@ -173,23 +225,15 @@ struct zsv_desc_data {
   unsigned int errcount;
 
   unsigned int max_cols;
-  unsigned int current_column_ix;
-
-  struct zsv_desc_column_name *column_names;
-  struct zsv_desc_column_name **column_names_tail;
 
   unsigned int col_count;
   struct zsv_desc_column_data *columns;
 
-#define ZSV_DESC_MAX_ENUM_DEFAULT 100
-  size_t max_enum;
   size_t row_count;
 
   char *err_msg;
   enum zsv_desc_status err;
 
-  zsv_parser parser;
-
   unsigned char flags; // see ZSV_DESC_FLAG_XXX
   unsigned char done;
 
@@ -198,8 +242,16 @@ struct zsv_desc_data {
   char *overflowed;
   size_t overflow_count;
 
+  unsigned int num_chunks;
+  struct zsv_desc_chunk *chunks; // chunks[0] is read by the main thread
+  struct zsv_chunk_runner runner;
+  unsigned char *examples_found; // per column: whether all its examples were found before other chunks started
+  unsigned int examples_pending; // columns whose examples have not all been found
+
   unsigned char quick : 1;
-  unsigned char _ : 7;
+  unsigned char parallel : 1;       // whether the input was split into chunks
+  unsigned char chunks_started : 1; // whether the chunks after the first were started
+  unsigned char _ : 5;
 };
 
 static void zsv_desc_finalize(struct zsv_desc_data *data) {
@@ -220,6 +272,9 @@ static void write_headers(struct zsv_desc_data *data) {
   if (data->flags & ZSV_DESC_FLAG_UNIQUE_CI)
     zsv_writer_cell_s(data->csv_writer, 0, (const unsigned char *)"Unique (case-insensitive)", 0);
 
+  if (data->flags & ZSV_DESC_FLAG_DISTINCT)
+    zsv_writer_cell_s(data->csv_writer, 0, (const unsigned char *)"Distinct", 0);
+
   for (int i = 0; headers2[i]; i++)
     zsv_writer_cell(data->csv_writer, 0, (const unsigned char *)headers2[i], strlen(headers2[i]), 1);
 }
@@ -256,6 +311,17 @@ static void zsv_desc_print(struct zsv_desc_data *data) {
         zsv_writer_cell_s(data->csv_writer, 0, (const unsigned char *)s, 0);
       }
 
+      // distinct
+      if (data->flags & ZSV_DESC_FLAG_DISTINCT) {
+        size_t n = zsv_desc_value_set_count(c->distinct);
+        if (c->distinct_estimated) {
+          n = (size_t)zsv_hll_estimate(&c->distinct_hll);
+          if (n > c->total_count - c->mblank.count)
+            n = c->total_count - c->mblank.count;
+        }
+        zsv_writer_cell_zu(data->csv_writer, 0, n);
+      }
+
       // count, blank %
       zsv_writer_cell_zu(data->csv_writer, 0, c->total_count);
       zsv_writer_cell_Lf(data->csv_writer, 0, ".2",
@@ -284,138 +350,471 @@ static void zsv_desc_set_err(struct zsv_desc_data *data, enum zsv_desc_status er
   }
 }
 
-// zsv_desc_column_update_unique(): return 1 if unique, 0 if dupe
-static int zsv_desc_column_update_unique(struct zsv_desc_unique_key_container *key_container,
-                                         const unsigned char *utf8_value, size_t len) {
-  zsv_desc_unique_key *key = zsv_desc_unique_key_new(utf8_value, len);
-  if (sglib_zsv_desc_unique_key_find_member(key_container->key, key)) { // not unique
-    if (key_container->count > key_container->max_count) {
-      zsv_desc_column_unique_values_delete(&key_container->key);
-      key_container->not_enum = 1;
+// zsv_desc_lowercase(): get a value in lower case, as examples and case-insensitive
+// uniqueness compare it: the value itself if it has no upper case, else a copy in the
+// chunk's buffer. Returns NULL if out of memory
+static const unsigned char *zsv_desc_lowercase(struct zsv_desc_chunk *c, const unsigned char *s, size_t *lenp) {
+  size_t len = *lenp;
+  char ascii = 1, upper = 0;
+  for (size_t i = 0; i < len && ascii; i++) {
+    if (s[i] & 0x80)
+      ascii = 0;
+    else if (s[i] >= 'A' && s[i] <= 'Z')
+      upper = 1;
+  }
+  if (ascii && !upper)
+    return s;
+
+  unsigned char *lc = NULL;
+  if (!ascii && !(lc = zsv_strtolowercase(s, lenp)))
+    return NULL;
+  if (c->lc_size < *lenp) {
+    size_t size = c->lc_size ? c->lc_size * 2 : 256;
+    if (size < *lenp)
+      size = *lenp;
+    unsigned char *tmp = realloc(c->lc, size);
+    if (!tmp) {
+      free(lc);
+      return NULL;
     }
-    zsv_desc_unique_key_delete(key);
-    return 0;
+    c->lc = tmp;
+    c->lc_size = size;
+  }
+  if (lc) {
+    memcpy(c->lc, lc, *lenp);
+    free(lc);
   } else {
-    sglib_zsv_desc_unique_key_add(&key_container->key, key);
-    key_container->count++;
+    for (size_t i = 0; i < len; i++)
+      c->lc[i] = s[i] >= 'A' && s[i] <= 'Z' ? s[i] + ('a' - 'A') : s[i];
+  }
+  return c->lc;
+}
+
+static struct zsv_desc_string_list *zsv_desc_example_find(struct zsv_desc_column_data *col, const unsigned char *lc,
+                                                          size_t lc_len) {
+  for (struct zsv_desc_string_list *sl = col->examples; sl; sl = sl->next)
+    if (sl->lc_len == lc_len && !memcmp(sl->lc, lc, lc_len))
+      return sl;
+  return NULL;
+}
+
+static int zsv_desc_example_new(struct zsv_desc_column_data *col, const unsigned char *value, size_t len,
+                                const unsigned char *lc, size_t lc_len, size_t count) {
+  struct zsv_desc_string_list *sl = calloc(1, sizeof(*sl));
+  if (!sl || !(sl->value = zsv_memdup(value, len)) || !(sl->lc = zsv_memdup(lc, lc_len))) {
+    zsv_desc_string_list_free(sl);
     return 1;
   }
+  sl->lc_len = lc_len;
+  sl->count = count;
+  if (!col->examples_tail)
+    col->examples_tail = &col->examples;
+  *col->examples_tail = sl;
+  col->examples_tail = &sl->next;
+  col->examples_count++;
+  return 0;
 }
 
-static void zsv_desc_cell(void *ctx, unsigned char *restrict utf8_value, size_t len) {
-  struct zsv_desc_data *data = ctx;
-  if (!data || data->err || data->done)
-    return;
+// in the first chunk: count the value if it is an example, else add it as one if there is room
+static int zsv_desc_example_add(struct zsv_desc_data *data, struct zsv_desc_column_data *col,
+                                const unsigned char *value, size_t len, const unsigned char *lc, size_t lc_len) {
+  struct zsv_desc_string_list *sl = zsv_desc_example_find(col, lc, lc_len);
+  if (sl)
+    sl->count++;
+  else if (col->examples_count < ZSV_DESC_MAX_EXAMPLE_COUNT) {
+    if (zsv_desc_example_new(col, value, len, lc, lc_len, 0))
+      return 1;
+    if (col->examples_count == ZSV_DESC_MAX_EXAMPLE_COUNT)
+      data->examples_pending--;
+  }
+  return 0;
+}
 
-  // trim the cell values, so we don't count e.g. " abc" as different from "abc"
-  utf8_value = (unsigned char *)zsv_strtrim(utf8_value, &len);
-  if (data->row_count == 0) {
-    if (data->current_column_ix < data->max_cols) {
-      struct zsv_desc_column_name *e = calloc(1, sizeof(*e));
-      if (!e) {
-        zsv_desc_set_err(data, zsv_desc_status_memory, NULL);
-        return;
+// in each other chunk: count the value, as an example, or among the column's values
+static int zsv_desc_chunk_example_add(struct zsv_desc_data *data, unsigned int i, struct zsv_desc_column_data *col,
+                                      const unsigned char *value, size_t len, const unsigned char *lc,
+                                      size_t lc_len) {
+  if (data->examples_found[i]) {
+    unsigned int k = 0;
+    for (struct zsv_desc_string_list *sl = data->columns[i].examples; sl; sl = sl->next, k++) {
+      if (sl->lc_len == lc_len && !memcmp(sl->lc, lc, lc_len)) {
+        col->example_counts[k]++;
+        break;
       }
+    }
+    return 0;
+  }
 
-      if (len)
-        e->name = zsv_memdup(utf8_value, len);
-      *data->column_names_tail = e;
-      data->column_names_tail = &e->next;
+  uint64_t hash = zsv_hash(lc, lc_len);
+  struct zsv_desc_value *e;
+  if (col->example_values_full) { // count only the values already seen
+    if ((e = zsv_desc_value_set_get(col->example_values, hash, lc, lc_len)))
+      e->count++;
+    return 0;
+  }
+  if (!(e = zsv_desc_value_set_add(&col->example_values, hash, lc, lc_len, value, len)))
+    return 1;
+  if (!e->count) {
+    size_t n = zsv_hash_set_count(col->example_values) - 1;
+    if (n < ZSV_DESC_MAX_EXAMPLE_COUNT) {
+      for (size_t j = 0; j < n; j++)
+        col->first_value_counts[n][j] = ((struct zsv_desc_value *)zsv_hash_set_value(col->example_values, j))->count;
     }
-  } else {
-    if (data->current_column_ix < data->col_count) {
-      struct zsv_desc_column_data *col = &data->columns[data->current_column_ix];
-      if (col) {
-        col->total_count++;
-        if (!len)
-          col->mblank.count++;
-        else {
-          if (col->lengths.lo == 0 || len < col->lengths.lo)
-            col->lengths.lo = len;
-          if (len > col->lengths.hi)
-            col->lengths.hi = len;
-          if (col->examples_count < ZSV_DESC_MAX_EXAMPLE_COUNT || !data->quick) {
-            char already_have = 0;
-            if (!col->examples_tail)
-              col->examples_tail = &col->examples;
-            for (struct zsv_desc_string_list *sl = col->examples; !already_have && sl; sl = sl->next) {
-              if (sl->value && !zsv_strincmp(utf8_value, len, sl->value, strlen((char *)sl->value))) {
-                already_have = 1;
-                sl->count++;
-              }
-            }
-            if (!already_have && col->examples_count < ZSV_DESC_MAX_EXAMPLE_COUNT) {
-              struct zsv_desc_string_list *sl;
-              if ((sl = *col->examples_tail = calloc(1, sizeof(*sl)))) {
-                col->examples_tail = &sl->next;
-                sl->value = zsv_memdup(utf8_value, len);
-                col->examples_count++;
-              }
-            }
-          }
-
-          if (data->flags & ZSV_DESC_FLAG_UNIQUE) {
-            if (!col->not_unique)
-              if (!zsv_desc_column_update_unique(&col->unique_values, utf8_value, len)) // dupe
-                col->not_unique = 1;
-          }
-
-          if (data->flags & ZSV_DESC_FLAG_UNIQUE_CI) {
-            if (!col->not_unique_ci || !col->unique_values_ci.not_enum
-                // )
-            ) {
-              unsigned char *lc = zsv_strtolowercase(utf8_value, &len);
-              if (lc) {
-                if (!zsv_desc_column_update_unique(&col->unique_values_ci, lc, len))
-                  col->not_unique_ci = 1;
-                free(lc);
-              }
-            }
-          }
-        }
-      }
+    if (n + 1 == ZSV_DESC_MAX_EXAMPLE_VALUES)
+      col->example_values_full = 1;
+  }
+  e->count++;
+  return 0;
+}
+
+// count distinct values with a HyperLogLog sketch instead of a set
+static int zsv_desc_distinct_estimate(struct zsv_desc_column_data *col) {
+  if (col->distinct_estimated)
+    return 0;
+  for (size_t i = 0, n = zsv_desc_value_set_count(col->distinct); i < n; i++)
+    if (zsv_hll_add(&col->distinct_hll, zsv_hash_set_hash(col->distinct, i)))
+      return 1;
+  zsv_desc_value_set_clear(&col->distinct);
+  col->distinct_estimated = 1;
+  return 0;
+}
+
+// once a column is known not to be unique, keep at most ZSV_DESC_MAX_EXACT_DISTINCT of its values
+static int zsv_desc_distinct_limit(struct zsv_desc_column_data *col) {
+  if (col->not_unique && !col->distinct_estimated &&
+      zsv_desc_value_set_count(col->distinct) > ZSV_DESC_MAX_EXACT_DISTINCT)
+    return zsv_desc_distinct_estimate(col);
+  return 0;
+}
+
+static int zsv_desc_distinct_add(struct zsv_desc_column_data *col, const unsigned char *value, size_t len) {
+  uint64_t hash = zsv_hash(value, len);
+  if (col->distinct_estimated)
+    return zsv_hll_add(&col->distinct_hll, hash);
+  struct zsv_desc_value *e = zsv_desc_value_set_add(&col->distinct, hash, value, len, NULL, 0);
+  if (!e)
+    return 1;
+  if (e->count++)
+    col->not_unique = 1;
+  return zsv_desc_distinct_limit(col);
+}
+
+static int zsv_desc_unique_ci_add(struct zsv_desc_column_data *col, const unsigned char *lc, size_t lc_len) {
+  struct zsv_desc_value *e = zsv_desc_value_set_add(&col->values_ci, zsv_hash(lc, lc_len), lc, lc_len, NULL, 0);
+  if (!e)
+    return 1;
+  if (e->count++) {
+    col->not_unique_ci = 1;
+    zsv_desc_value_set_clear(&col->values_ci);
+  }
+  return 0;
+}
+
+static void zsv_desc_chunk_row(struct zsv_desc_chunk *c) {
+  struct zsv_desc_data *data = c->data;
+  char first = c == data->chunks;
+  size_t cell_count = zsv_cell_count(c->parser);
+  if (cell_count > data->col_count)
+    cell_count = data->col_count;
+  for (unsigned int i = 0; i < cell_count && !c->status; i++) {
+    struct zsv_desc_column_data *col = &c->columns[i];
+    struct zsv_cell cell = zsv_get_cell(c->parser, i);
+    size_t len = cell.len;
+    // trim the cell values, so we don't count e.g. " abc" as different from "abc"
+    const unsigned char *value = zsv_strtrim(cell.str, &len);
+    col->total_count++;
+    if (!len) {
+      col->mblank.count++;
+      continue;
     }
+    if (col->lengths.lo == 0 || len < col->lengths.lo)
+      col->lengths.lo = len;
+    if (len > col->lengths.hi)
+      col->lengths.hi = len;
+
+    char examples = first ? col->examples_count < ZSV_DESC_MAX_EXAMPLE_COUNT || !data->quick
+                          : !data->examples_found[i] || !data->quick;
+    const unsigned char *lc = NULL;
+    size_t lc_len = len;
+    if ((examples || (data->flags & ZSV_DESC_FLAG_UNIQUE_CI)) && !(lc = zsv_desc_lowercase(c, value, &lc_len)))
+      c->status = 1;
+    else if (examples && (first ? zsv_desc_example_add(data, col, value, len, lc, lc_len)
+                                : zsv_desc_chunk_example_add(data, i, col, value, len, lc, lc_len)))
+      c->status = 1;
+    else if ((data->flags & (ZSV_DESC_FLAG_UNIQUE | ZSV_DESC_FLAG_DISTINCT)) &&
+             zsv_desc_distinct_add(col, value, len))
+      c->status = 1;
+    else if ((data->flags & ZSV_DESC_FLAG_UNIQUE_CI) && !col->not_unique_ci && zsv_desc_unique_ci_add(col, lc, lc_len))
+      c->status = 1;
   }
-  data->current_column_ix++;
 }
 
-static void zsv_desc_row(void *ctx) {
-  struct zsv_desc_data *data = ctx;
+static void zsv_desc_start_chunks(struct zsv_desc_data *data);
 
-  if (!data || data->err)
+static void zsv_desc_row_done(void *ctx) {
+  struct zsv_desc_chunk *c = ctx;
+  // absolute offset of the start of the next row
+  c->chunk.actual_next_row_start =
+    c->chunk.start_offset + zsv_cum_scanned_length(c->parser) - zsv_row_length_raw_bytes(c->parser);
+  zsv_abort(c->parser);
+  c->cancelled = 1;
+}
+
+static void zsv_desc_row(void *ctx) {
+  struct zsv_desc_chunk *c = ctx;
+  struct zsv_desc_data *data = c->data;
+  if (c->status)
     return;
 
-  if (data->row_count == 0) {
-    if (data->current_column_ix < data->max_cols)
-      data->col_count = data->current_column_ix;
-    else
-      data->current_column_ix = data->max_cols;
-    if (!(data->columns = calloc(data->col_count, sizeof(*data->columns)))) {
-      zsv_desc_set_err(data, zsv_desc_status_memory, NULL);
-      return;
+  zsv_desc_chunk_row(c);
+  if (c == data->chunks) {
+    if (++data->row_count % 50000 == 0 && data->opts->verbose)
+      fprintf(stderr, "%zu rows read\n", data->row_count);
+    if (data->parallel && !data->chunks_started &&
+        (!data->examples_pending || data->row_count >= ZSV_DESC_PREFIX_ROWS))
+      zsv_desc_start_chunks(data);
+  }
+  if (UNLIKELY(c->limit_len && zsv_cum_scanned_length(c->parser) >= c->limit_len) && !c->cancelled)
+    zsv_set_row_handler(c->parser, zsv_desc_row_done);
+}
+
+static void zsv_desc_chunk_clear(struct zsv_desc_chunk *c) {
+  if (c->columns && c != c->data->chunks) {
+    for (unsigned int i = 0; i < c->data->col_count; i++)
+      zsv_desc_column_data_free(&c->columns[i]);
+    free(c->columns);
+  }
+  c->columns = NULL;
+  free(c->lc);
+  c->lc = NULL;
+  c->lc_size = 0;
+}
+
+static void *zsv_desc_process_chunk(void *arg) {
+  struct zsv_desc_chunk *c = arg;
+  struct zsv_desc_data *data = c->data;
+  // in case we are re-running due to incorrect chunk start
+  zsv_desc_chunk_clear(c);
+  c->status = 0;
+  c->cancelled = 0;
+  if (!(c->columns = calloc(data->col_count ? data->col_count : 1, sizeof(*c->columns)))) {
+    c->status = 1;
+    return NULL;
+  }
+  if (c->chunk.start_offset >= c->chunk.end_offset) {
+    c->chunk.actual_next_row_start = c->chunk.start_offset;
+    return NULL;
+  }
+  c->limit_len = c->chunk.end_offset - c->chunk.start_offset;
+
+  FILE *f = fopen(data->input_filename, "rb");
+  struct zsv_opts opts;
+  if (!f || fseeko(f, (off_t)c->chunk.start_offset, SEEK_SET) != 0 ||
+      zsv_chunk_opts(&opts, data->opts, data->custom_prop_handler, data->input_filename, f))
+    c->status = 1;
+  else {
+    opts.row_handler = zsv_desc_row;
+    opts.ctx = c;
+    if (!(c->parser = zsv_new(&opts)))
+      c->status = 1;
+    else {
+      while (!zsv_signal_interrupted && !c->cancelled && zsv_parse_more(c->parser) == zsv_status_ok)
+        ;
+      if (!c->cancelled) { // reached eof
+        zsv_finish(c->parser);
+        c->chunk.actual_next_row_start = c->chunk.start_offset + zsv_cum_scanned_length(c->parser);
+      }
+      zsv_delete(c->parser);
+      c->parser = NULL;
     }
+  }
+  if (f)
+    fclose(f);
+  return NULL;
+}
 
-    struct zsv_desc_column_name *cn = data->column_names;
-    for (unsigned int i = 0; i < data->col_count && cn; cn = cn->next, i++) {
-      struct zsv_desc_column_data *col = &data->columns[i];
-      if (cn->name && *cn->name) {
-        col->name = cn->name;
-        cn->name = NULL;
+// start a worker for each chunk after the first, once the examples found so far are final
+static void zsv_desc_start_chunks(struct zsv_desc_data *data) {
+  for (unsigned int i = 0; i < data->col_count; i++)
+    data->examples_found[i] = data->columns[i].examples_count == ZSV_DESC_MAX_EXAMPLE_COUNT;
+  data->chunks_started = 1;
+  if (zsv_chunks_run(&data->runner) && data->opts->verbose)
+    fprintf(stderr, "Reading the remaining chunks on the main thread\n");
+}
+
+// the 1st row: get the column names, then split the rest of the input into chunks
+static void zsv_desc_header(void *ctx) {
+  struct zsv_desc_chunk *c0 = ctx;
+  struct zsv_desc_data *data = c0->data;
+  size_t cell_count = zsv_cell_count(c0->parser);
+  data->col_count = cell_count < data->max_cols ? (unsigned int)cell_count : data->max_cols;
+  if (!(data->columns = calloc(data->col_count ? data->col_count : 1, sizeof(*data->columns))) ||
+      !(data->examples_found = calloc(data->col_count ? data->col_count : 1, 1))) {
+    zsv_desc_set_err(data, zsv_desc_status_memory, NULL);
+    c0->status = 1;
+    zsv_abort(c0->parser);
+    c0->cancelled = 1;
+    return;
+  }
+  c0->columns = data->columns;
+  data->examples_pending = data->col_count;
+  for (unsigned int i = 0; i < data->col_count; i++) {
+    struct zsv_cell cell = zsv_get_cell(c0->parser, i);
+    size_t len = cell.len;
+    const unsigned char *name = zsv_strtrim(cell.str, &len);
+    if (len)
+      data->columns[i].name = zsv_memdup(name, len);
+  }
+
+  if (data->header_only) {
+    data->done = 1;
+    zsv_abort(c0->parser);
+    c0->cancelled = 1;
+    return;
+  }
+
+  for (unsigned int i = 1; i < data->num_chunks; i++)
+    data->chunks[i].data = data;
+  data->runner.chunks = data->chunks;
+  data->runner.chunk_size = sizeof(*data->chunks);
+  data->runner.chunk_count = data->num_chunks;
+  data->runner.process = zsv_desc_process_chunk;
+  if (zsv_chunks_split(&data->runner, data->input_filename, ZSV_DESC_PARALLEL_MIN_BYTES,
+                       zsv_cum_scanned_length(c0->parser), data->opts) == 0) {
+    data->parallel = 1;
+    c0->limit_len = c0->chunk.end_offset;
+  }
+  zsv_set_row_handler(c0->parser, zsv_desc_row);
+}
+
+// merge the examples of a chunk after the first into those of the columns. Returns 0 on
+// success, 1 if out of memory, or 2 if the chunk did not keep the counts needed
+static int zsv_desc_merge_examples(struct zsv_desc_data *data, unsigned int i, struct zsv_desc_column_data *col,
+                                   struct zsv_desc_column_data *other) {
+  if (data->examples_found[i]) {
+    unsigned int k = 0;
+    for (struct zsv_desc_string_list *sl = col->examples; sl; sl = sl->next, k++)
+      sl->count += other->example_counts[k];
+    return 0;
+  }
+
+  zsv_hash_set values = other->example_values;
+  size_t first_count = zsv_desc_value_set_count(values);
+  if (first_count > ZSV_DESC_MAX_EXAMPLE_COUNT)
+    first_count = ZSV_DESC_MAX_EXAMPLE_COUNT;
+  const unsigned char *key, *value;
+  size_t key_len, value_len;
+  if (data->quick) {
+    // values are counted until the last example is first seen, which, as each value before
+    // it is either an example already or a new one, is one of the chunk's first values
+    size_t needed = ZSV_DESC_MAX_EXAMPLE_COUNT - col->examples_count, stop = first_count;
+    for (size_t k = 0; k < first_count && needed; k++) {
+      key = zsv_hash_set_key(values, k, &key_len);
+      if (!zsv_desc_example_find(col, key, key_len) && !--needed)
+        stop = k;
+    }
+    if (!needed && stop == first_count) // examples were complete before this chunk
+      return 0;
+    for (size_t k = 0; k < first_count && k <= stop; k++) {
+      const struct zsv_desc_value *e = zsv_hash_set_value(values, k);
+      size_t count = k == stop ? 1 : stop < first_count ? other->first_value_counts[stop][k] : e->count;
+      key = zsv_hash_set_key(values, k, &key_len);
+      struct zsv_desc_string_list *sl = zsv_desc_example_find(col, key, key_len);
+      if (sl)
+        sl->count += count;
+      else {
+        value = zsv_desc_value_set_value(values, k, &value_len);
+        if (zsv_desc_example_new(col, value, value_len, key, key_len, count - 1))
+          return 1;
       }
-      col->unique_values_ci.max_count = data->max_enum;
     }
+    return 0;
+  }
 
-    if (data->header_only) {
-      data->done = 1;
-      zsv_abort(data->parser);
+  for (struct zsv_desc_string_list *sl = col->examples; sl; sl = sl->next) {
+    const struct zsv_desc_value *e = zsv_desc_value_set_get(values, zsv_hash(sl->lc, sl->lc_len), sl->lc, sl->lc_len);
+    if (e)
+      sl->count += e->count;
+    else if (other->example_values_full)
+      return 2;
+  }
+  for (size_t k = 0; k < first_count && col->examples_count < ZSV_DESC_MAX_EXAMPLE_COUNT; k++) {
+    const struct zsv_desc_value *e = zsv_hash_set_value(values, k);
+    key = zsv_hash_set_key(values, k, &key_len);
+    if (!zsv_desc_example_find(col, key, key_len)) {
+      value = zsv_desc_value_set_value(values, k, &value_len);
+      if (zsv_desc_example_new(col, value, value_len, key, key_len, e->count - 1))
+        return 1;
     }
-  } else {
-    if (data->row_count % 50000 == 0 && data->opts->verbose)
-      fprintf(stderr, "%zu rows read\n", data->row_count);
   }
+  return 0;
+}
 
-  data->current_column_ix = 0;
-  ++data->row_count;
+static int zsv_desc_merge_distinct(struct zsv_desc_column_data *col, struct zsv_desc_column_data *other) {
+  if (other->not_unique)
+    col->not_unique = 1;
+  size_t n = zsv_desc_value_set_count(other->distinct);
+  if (col->distinct_estimated || other->distinct_estimated) {
+    if (zsv_desc_distinct_estimate(col))
+      return 1;
+    if (other->distinct_estimated)
+      return zsv_hll_merge(&col->distinct_hll, &other->distinct_hll);
+    for (size_t i = 0; i < n; i++)
+      if (zsv_hll_add(&col->distinct_hll, zsv_hash_set_hash(other->distinct, i)))
+        return 1;
+    return 0;
+  }
+  for (size_t i = 0; i < n; i++) {
+    size_t key_len;
+    const unsigned char *key = zsv_hash_set_key(other->distinct, i, &key_len);
+    struct zsv_desc_value *e0 =
+      zsv_desc_value_set_add(&col->distinct, zsv_hash_set_hash(other->distinct, i), key, key_len, NULL, 0);
+    if (!e0)
+      return 1;
+    if (e0->count)
+      col->not_unique = 1;
+    e0->count += ((const struct zsv_desc_value *)zsv_hash_set_value(other->distinct, i))->count;
+  }
+  return zsv_desc_distinct_limit(col);
+}
+
+static int zsv_desc_merge_unique_ci(struct zsv_desc_column_data *col, struct zsv_desc_column_data *other) {
+  if (col->not_unique_ci)
+    return 0;
+  if (other->not_unique_ci) {
+    col->not_unique_ci = 1;
+    zsv_desc_value_set_clear(&col->values_ci);
+    return 0;
+  }
+  for (size_t i = 0, n = zsv_desc_value_set_count(other->values_ci); i < n && !col->not_unique_ci; i++) {
+    size_t key_len;
+    const unsigned char *key = zsv_hash_set_key(other->values_ci, i, &key_len);
+    if (zsv_desc_unique_ci_add(col, key, key_len))
+      return 1;
+  }
+  return 0;
+}
+
+// merge the results of a chunk after the first into the columns
+static int zsv_desc_merge(struct zsv_desc_data *data, struct zsv_desc_chunk *c) {
+  int rc = 0;
+  for (unsigned int i = 0; !rc && i < data->col_count; i++) {
+    struct zsv_desc_column_data *col = &data->columns[i];
+    struct zsv_desc_column_data *other = &c->columns[i];
+    col->total_count += other->total_count;
+    col->mblank.count += other->mblank.count;
+    if (other->lengths.lo && (!col->lengths.lo || other->lengths.lo < col->lengths.lo))
+      col->lengths.lo = other->lengths.lo;
+    if (other->lengths.hi > col->lengths.hi)
+      col->lengths.hi = other->lengths.hi;
+
+    rc = zsv_desc_merge_examples(data, i, col, other);
+    if (!rc && (data->flags & (ZSV_DESC_FLAG_UNIQUE | ZSV_DESC_FLAG_DISTINCT)))
+      rc = zsv_desc_merge_distinct(col, other);
+    if (!rc && (data->flags & ZSV_DESC_FLAG_UNIQUE_CI))
+      rc = zsv_desc_merge_unique_ci(col, other);
+  }
+  return rc;
 }
 
 const char *zsv_desc_usage_msg[] = {
@@ -428,8 +827,13 @@ const char *zsv_desc_usage_msg[] = {
   "  -C <max_num_of_columns>  : maximum number of columns (default: " ZSV_DESC_MAX_COLS_DEFAULT_S ")",
   "  -H                       : output header names only",
   "  -q,--quick               : minimize example counts",
-  "  -a,--all                 : calculate all metadata (for now, this only adds uniqueness info)",
+  "  -a,--all                 : calculate all metadata (for now, this only adds uniqueness info and",
+  "                             distinct value counts, which are estimated above " ZSV_DESC_MAX_EXACT_DISTINCT_S " unless unique)",
   "  -o <filename>            : filename to save output to (default: stdout)",
+#ifndef ZSV_NO_PARALLEL
+  "  -j,--jobs <n>            : number of threads used to read the input",
+  "  --parallel               : use all available cores",
+#endif
   NULL,
 };
 
@@ -438,15 +842,30 @@ static int zsv_desc_usage(void) {
   return 0;
 }
 
-static void zsv_desc_cleanup(struct zsv_desc_data *data) {
+// free the results, e.g. to read the input again
+static void zsv_desc_reset(struct zsv_desc_data *data) {
+  for (unsigned int i = 0; data->chunks && i < data->num_chunks; i++)
+    zsv_desc_chunk_clear(&data->chunks[i]);
   if (data->columns) {
     for (unsigned int i = 0; i < data->col_count; i++)
       zsv_desc_column_data_free(&data->columns[i]);
     free(data->columns);
     data->columns = NULL;
   }
+  free(data->examples_found);
+  data->examples_found = NULL;
+  data->col_count = 0;
+  data->row_count = 0;
+  zsv_chunks_free(&data->runner);
+  data->parallel = 0;
+  data->chunks_started = 0;
+}
+
+static void zsv_desc_cleanup(struct zsv_desc_data *data) {
+  zsv_desc_reset(data);
+  free(data->chunks);
+  data->chunks = NULL;
 
-  zsv_desc_column_names_delete(&data->column_names);
   free(data->err_msg);
   data->err_msg = NULL;
 
@@ -462,29 +881,43 @@ static void zsv_desc_cleanup(struct zsv_desc_data *data) {
   zsv_writer_delete(data->csv_writer);
 }
 
-#define ZSV_DESC_TMPFN_TEMPLATE "zsv_desc_XXXXXXXXXXXX"
-
-static void zsv_desc_execute(struct zsv_desc_data *data, struct zsv_prop_handler *custom_prop_handler,
-                             const char *input_path) {
-  data->opts->cell_handler = zsv_desc_cell;
-  data->opts->row_handler = zsv_desc_row;
-  data->opts->ctx = data;
-
-  if (!data->max_enum)
-    data->max_enum = ZSV_DESC_MAX_ENUM_DEFAULT;
-  if (zsv_new_with_properties(data->opts, custom_prop_handler, input_path, &data->parser) == zsv_status_ok) {
-    FILE *input_temp_file = NULL;
-    enum zsv_status status;
-    if (input_temp_file)
-      zsv_set_scan_filter(data->parser, zsv_filter_write, input_temp_file);
-    while (!zsv_signal_interrupted && (status = zsv_parse_more(data->parser)) == zsv_status_ok)
-      ;
+// read the input; return 0 on success, 1 on error or 2 if examples could not be counted in parallel
+static int zsv_desc_execute(struct zsv_desc_data *data) {
+  struct zsv_desc_chunk *c0 = &data->chunks[0];
+  memset(c0, 0, sizeof(*c0));
+  c0->data = data;
+
+  struct zsv_opts popts = *data->opts;
+  popts.cell_handler = NULL;
+  popts.row_handler = zsv_desc_header;
+  popts.ctx = c0;
+  if (zsv_new_with_properties(&popts, data->custom_prop_handler, data->input_filename, &c0->parser) != zsv_status_ok)
+    return 1;
 
-    if (input_temp_file)
-      fclose(input_temp_file);
-    zsv_finish(data->parser);
-    zsv_delete(data->parser);
+  // chunk 0: main thread, from the start of the input (incl. the header row)
+  while (!zsv_signal_interrupted && !c0->cancelled && zsv_parse_more(c0->parser) == zsv_status_ok)
+    ;
+  if (!c0->cancelled) {
+    zsv_finish(c0->parser);
+    c0->chunk.actual_next_row_start = zsv_cum_scanned_length(c0->parser);
+  }
+  zsv_delete(c0->parser);
+  c0->parser = NULL;
+  int rc = c0->status;
+  if (data->parallel && !data->chunks_started) // chunk 0 ended before its examples were all found
+    zsv_desc_start_chunks(data);
+
+  // wait for workers, then merge their results in chunk order
+  size_t prev_end = c0->chunk.actual_next_row_start;
+  for (unsigned int i = 1; data->parallel && i < data->num_chunks; i++) {
+    struct zsv_desc_chunk *c = zsv_chunks_next(&data->runner, i, &prev_end);
+    if (!rc)
+      rc = c->status;
+    if (!rc)
+      rc = zsv_desc_merge(data, c);
+    zsv_desc_chunk_clear(c);
   }
+  return rc;
 }
 
 int ZSV_MAIN_FUNC(ZSV_COMMAND)(int argc, const char *argv[], struct zsv_opts *opts,
@@ -495,14 +928,14 @@ int ZSV_MAIN_FUNC(ZSV_COMMAND)(int argc, const char *argv[], struct zsv_opts *op
     zsv_desc_usage();
   else {
     struct zsv_desc_data data = {0};
-    const char *input_path = NULL;
     int err = 0;
     if (opts->malformed_utf8_replace != ZSV_MALFORMED_UTF8_DO_NOT_REPLACE) // user specified to be 'none'
       opts->malformed_utf8_replace = '?';
 
     data.opts = opts;
+    data.custom_prop_handler = custom_prop_handler;
     data.max_cols = ZSV_DESC_MAX_COLS_DEFAULT; // default
-    data.column_names_tail = &data.column_names;
+    data.num_chunks = 1;
 
     struct zsv_csv_writer_options writer_opts = zsv_writer_get_default_opts();
 
@@ -524,6 +957,19 @@ int ZSV_MAIN_FUNC(ZSV_COMMAND)(int argc, const char *argv[], struct zsv_opts *op
                                   "-C (max cols) invalid: should be positive integer > 9 (got %s)", argv[arg_i]);
         else
           data.max_cols = atoi(argv[arg_i]);
+#ifndef ZSV_NO_PARALLEL
+      } else if (!strcmp(argv[arg_i], "-j") || !strcmp(argv[arg_i], "--jobs")) {
+        if (++arg_i >= argc || atoi(argv[arg_i]) <= 0)
+          data.err = zsv_printerr(zsv_desc_status_error, "%s option requires a positive number", argv[arg_i - 1]);
+        else
+          data.num_chunks = (unsigned int)atoi(argv[arg_i]);
+      } else if (!strcmp(argv[arg_i], "--parallel")) {
+        data.num_chunks = zsv_get_number_of_cores();
+        if (data.num_chunks < 2) {
+          fprintf(stderr, "Warning: --parallel specified but only one core found; using -j 4 instead\n");
+          data.num_chunks = 4;
+        }
+#endif
       } else if (zsv_arg_is_option(argv[arg_i])) {
         data.err = zsv_err_unrecognized_option(argv[arg_i]);
       } else {
@@ -535,8 +981,7 @@ int ZSV_MAIN_FUNC(ZSV_COMMAND)(int argc, const char *argv[], struct zsv_opts *op
         } else if (!(data.opts->stream = fopen(argv[arg_i], "rb"))) {
           err = 1;
           fprintf(stderr, "Could not open for reading: %s\n", argv[arg_i]);
-        } else
-          input_path = argv[arg_i];
+        }
 
         if (data.opts->stream && data.opts->stream != stdin)
           data.input_filename = argv[arg_i];
@@ -558,12 +1003,35 @@ int ZSV_MAIN_FUNC(ZSV_COMMAND)(int argc, const char *argv[], struct zsv_opts *op
 #endif
     }
 
+    if (!data.err && data.num_chunks > 1) {
+      enum zsv_chunk_status stat = zsv_chunkable(data.input_filename, opts);
+      if (stat != zsv_chunk_status_ok) {
+        if (opts->verbose)
+          fprintf(stderr, "Not running in parallel: %s\n", zsv_chunk_status_str(stat));
+        data.num_chunks = 1;
+      }
+    }
+    if (!data.err && !(data.chunks = calloc(data.num_chunks, sizeof(*data.chunks))))
+      data.err = zsv_printerr(zsv_desc_status_memory, "Out of memory!");
+
     if (data.err) {
       zsv_desc_cleanup(&data);
       return 1;
     }
 
-    zsv_desc_execute(&data, custom_prop_handler, input_path);
+    int rc = zsv_desc_execute(&data);
+    if (rc == 2) { // start over on one thread
+      if (opts->verbose)
+        fprintf(stderr, "Examples could not be counted in parallel; reading the input again\n");
+      zsv_desc_reset(&data);
+      data.num_chunks = 1;
+      rc = fseeko(data.opts->stream, 0, SEEK_SET) ? 1 : zsv_desc_execute(&data);
+    }
+    if (rc) {
+      fprintf(stderr, "Error describing input\n");
+      zsv_desc_cleanup(&data);
+      return 1;
+    }
     zsv_desc_finalize(&data);
     zsv_desc_print(&data);
     zsv_desc_cleanup(&data);
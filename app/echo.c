@@ -26,6 +26,7 @@
 #ifdef ZSV_EXTRAS
 #include <zsv/utils/overwrite.h>
 #endif
+#include "utils/chunk.h"
 
 struct zsv_echo_data {
   FILE *in;
@@ -34,6 +35,8 @@ struct zsv_echo_data {
   zsv_parser parser;
   size_t row_ix;
   size_t start_row, end_row;
+  size_t tail;
+  zsv_file_pos header_end;
 
   unsigned char *skip_until_prefix;
   size_t skip_until_prefix_len;
@@ -115,6 +118,117 @@ static void zsv_echo_row_start_at(void *ctx) {
     data->row_ix++;
 }
 
+// --tail: output the header row, then stop; the last rows are output by zsv_echo_tail()
+static void zsv_echo_row_tail_header(void *ctx) {
+  struct zsv_echo_data *data = ctx;
+  zsv_echo_row(ctx);
+  data->header_end = (zsv_file_pos)zsv_cum_scanned_length(data->parser);
+  zsv_abort(data->parser);
+}
+
+struct zsv_echo_tail_scan {
+  zsv_parser parser;
+  zsv_file_pos from;
+  size_t rows;
+  char finishing; // rows are being reported by zsv_finish()
+  // verify that rows start at the given offsets
+  const zsv_file_pos *expected;
+  size_t expected_count;
+  char mismatch;
+  // or, save the start offsets of the last ring_size rows
+  zsv_file_pos *ring;
+  size_t ring_size;
+};
+
+static void zsv_echo_tail_scan_row(void *ctx) {
+  struct zsv_echo_tail_scan *scan = ctx;
+  zsv_file_pos pos = scan->from + (zsv_file_pos)zsv_chunk_row_offset(scan->parser, scan->finishing);
+  if (scan->expected) {
+    if (scan->rows >= scan->expected_count || scan->expected[scan->rows] != pos) {
+      scan->mismatch = 1;
+      zsv_abort(scan->parser);
+    }
+  } else
+    scan->ring[scan->rows % scan->ring_size] = pos;
+  scan->rows++;
+}
+
+// parse data->in from the given offset (a row start) to the end
+static int zsv_echo_parse_from(struct zsv_echo_data *data, const struct zsv_opts *optsp, zsv_file_pos from,
+                               void (*row_handler)(void *), void *ctx, zsv_parser *parser, char *finishing) {
+  if (fseeko(data->in, from, SEEK_SET) != 0)
+    return 1;
+  // parsing starts after the header row
+  struct zsv_opts opts;
+  zsv_chunk_opts(&opts, optsp, NULL, NULL, data->in);
+  opts.row_handler = row_handler;
+  opts.ctx = ctx;
+  if (!(*parser = zsv_new(&opts)))
+    return 1;
+  while (!zsv_signal_interrupted && zsv_parse_more(*parser) == zsv_status_ok)
+    ;
+  if (finishing)
+    *finishing = 1;
+  zsv_finish(*parser);
+  zsv_delete(*parser);
+  *parser = NULL;
+  return 0;
+}
+
+/*
+ * output the last data->tail rows. Their starts are found by scanning backward from the end of
+ * the file, and verified by parsing forward from the first of them, so that only the tail of
+ * the file is read. If verification fails (e.g. due to quote chars inside unquoted cells), all
+ * rows after the header are parsed instead
+ */
+static int zsv_echo_tail(struct zsv_echo_data *data, const struct zsv_opts *opts) {
+  int only_crlf = 0;
+#ifndef ZSV_NO_ONLY_CRLF
+  only_crlf = opts->only_crlf_rowend;
+#endif
+  struct zsv_echo_tail_scan scan = {0};
+  zsv_file_pos start = -1;
+
+  // the header row's end offset is that of its last cell; skip its line end
+  char le[2];
+  size_t le_len = fseeko(data->in, data->header_end, SEEK_SET) ? 0 : fread(le, 1, sizeof(le), data->in);
+  if (le_len && le[0] == '\r' && le_len > 1 && le[1] == '\n')
+    data->header_end += 2;
+  else if (le_len && (le[0] == '\n' || le[0] == '\r'))
+    data->header_end++;
+
+  uint64_t count = data->tail;
+  zsv_file_pos *starts = zsv_guess_tail_rows(data->in, data->header_end, &count, only_crlf);
+  if (starts && count) {
+    scan.from = starts[0];
+    scan.expected = starts;
+    scan.expected_count = (size_t)count;
+    if (!zsv_echo_parse_from(data, opts, scan.from, zsv_echo_tail_scan_row, &scan, &scan.parser, &scan.finishing) &&
+        !scan.mismatch && scan.rows == scan.expected_count)
+      start = starts[0];
+  } else if (starts)
+    start = data->header_end; // no rows
+  free(starts);
+
+  if (start < 0) {
+    if (opts->verbose)
+      fprintf(stderr, "Could not verify row boundaries found from the end of the file; reading all rows\n");
+    memset(&scan, 0, sizeof(scan));
+    scan.from = data->header_end;
+    scan.ring_size = data->tail;
+    if (!(scan.ring = malloc(scan.ring_size * sizeof(*scan.ring))) ||
+        zsv_echo_parse_from(data, opts, scan.from, zsv_echo_tail_scan_row, &scan, &scan.parser, &scan.finishing)) {
+      free(scan.ring);
+      return 1;
+    }
+    start = !scan.rows                   ? data->header_end
+            : scan.rows < scan.ring_size ? scan.ring[0]
+                                         : scan.ring[scan.rows % scan.ring_size];
+    free(scan.ring);
+  }
+  return zsv_echo_parse_from(data, opts, start, zsv_echo_row, data, &data->parser, NULL);
+}
+
 const char *zsv_echo_usage_msg[] = {
 #ifdef ZSV_EXTRAS
   ZSV_USAGE_PROG " " APPNAME ": write tabular input to stdout with optional cell overwrites",
@@ -135,6 +249,8 @@ const char *zsv_echo_usage_msg[] = {
   "  --end-row      <N>     : only output up to row N (starting at 1)",
   "  --between-rows <N> <M> : equivalent to --start-row N --end-row M",
   "  --skip-until <value>   : skip rows until the row where first column starts with the given value",
+  "  --tail <N>             : only output the header and the last N rows, reading the file",
+  "                           backward from its end",
 #ifdef ZSV_EXTRAS
   "  --overwrite <source>   : overwrite cells using given source",
   "",
@@ -211,6 +327,12 @@ int ZSV_MAIN_FUNC(ZSV_COMMAND)(int argc, const char *argv[], struct zsv_opts *op
     } else if (!strcmp(arg, "--overwrite")) {
       overwrite_opts.src = zsv_next_arg(++arg_i, argc, argv, &err);
 #endif
+    } else if (!strcmp(arg, "--tail")) {
+      const char *val = zsv_next_arg(++arg_i, argc, argv, &err);
+      if (!val || !*val || !(atol(val) > 0))
+        err = zsv_printerr(1, "%s requires an integer value > 0\n", arg);
+      else
+        data.tail = (size_t)atol(val);
     } else if (!strcmp(arg, "--end-row") || !strcmp(arg, "--start-row") || !strcmp(arg, "--between-row") ||
                !strcmp(arg, "--between-rows")) {
       const char *val = zsv_next_arg(++arg_i, argc, argv, &err);
@@ -267,6 +389,14 @@ int ZSV_MAIN_FUNC(ZSV_COMMAND)(int argc, const char *argv[], struct zsv_opts *op
   }
   if (data.end_row > 0 && data.end_row < data.start_row)
     err = zsv_printerr(1, "--start-row must be less than --end-row");
+  if (!err && data.tail &&
+      (data.start_row || data.end_row || data.skip_until_prefix || data.contiguous || data.trim_columns
+#ifdef ZSV_EXTRAS
+       || overwrite_opts.src
+#endif
+       ))
+    err = zsv_printerr(1, "--tail cannot be used together with row selection, --contiguous, --trim-columns"
+                          " or --overwrite\n");
 
   if (err) {
     zsv_echo_cleanup(&data);
@@ -275,19 +405,21 @@ int ZSV_MAIN_FUNC(ZSV_COMMAND)(int argc, const char *argv[], struct zsv_opts *op
 
   unsigned char buff[4096];
 
-  if (data.start_row)
+  if (data.tail)
+    opts.row_handler = zsv_echo_row_tail_header;
+  else if (data.start_row)
     opts.row_handler = zsv_echo_row_start_at;
   else if (data.skip_until_prefix)
     opts.row_handler = zsv_echo_row_skip_until;
   else
     opts.row_handler = zsv_echo_row;
 
-  if (data.trim_columns) {
-    // trim columns requires two passes, because we may need to read the entire table
-    // to know the maximum number of non-empty columns (e.g. the last row might contain
-    // more non-empty columns than the rest of the table
+  // trim columns requires two passes, because we may need to read the entire table
+  // to know the maximum number of non-empty columns (e.g. the last row might contain
+  // more non-empty columns than the rest of the table; and --tail reads the input backward
 
-    // first, save the file if it is stdin
+  // first, save the file if it is stdin
+  if (data.trim_columns || data.tail) {
     if (data.in == stdin) {
       if (!(data.tmp_fn = zsv_get_temp_filename("zec"))) {
         zsv_echo_cleanup(&data);
@@ -317,7 +449,9 @@ int ZSV_MAIN_FUNC(ZSV_COMMAND)(int argc, const char *argv[], struct zsv_opts *op
         }
       }
     }
+  }
 
+  if (data.trim_columns) {
     // next, determine the max number of columns from the left that contain data
     struct zsv_opts tmp_opts = opts;
     tmp_opts.row_handler = zsv_echo_get_max_nonempty_cols;
@@ -378,6 +512,9 @@ int ZSV_MAIN_FUNC(ZSV_COMMAND)(int argc, const char *argv[], struct zsv_opts *op
 
       zsv_finish(data.parser);
       zsv_delete(data.parser);
+      data.parser = NULL;
+      if (data.tail && data.row_ix && zsv_echo_tail(&data, &opts))
+        err = 1;
     }
   }
   zsv_echo_cleanup(&data);
@@ -0,0 +1,5 @@
+#define SQLITE_CORE 1
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include "sqlite3.h"
@@ -42,6 +42,7 @@
 #include "sqlite3.h"
 #include "sqlite3ext.h"
 SQLITE_EXTENSION_INIT1
+#include <stdint.h>
 #include <string.h>
 #include <stdlib.h>
 #include <assert.h>
@@ -52,6 +53,9 @@ SQLITE_EXTENSION_INIT1
 #include <zsv/utils/string.h>
 #include <zsv/utils/arg.h>
 #include <zsv/utils/prop.h>
+#include <zsv/utils/coltype.h>
+#include "../../utils/index.h"
+#include "../../utils/key_index.h"
 #include "sqlite3_csv_vtab-mem.c"
 
 #ifndef SQLITE_OMIT_VIRTUALTABLE
@@ -102,6 +106,13 @@ typedef struct zsvTable {
   char *zFilename;                /* Name of the CSV file */
   struct zsv_opts parser_opts;    /* template; per-cursor copies set .stream */
   struct zsv_prop_handler custom_prop_handler;
+  unsigned char *coltypes;        /* if infer_types: enum zsv_coltype per column */
+  size_t coltype_count;
+  struct zsv_index *index;        /* row offsets for rowid seeks; built on first use */
+  char index_failed;              /* index could not be built; seek by scanning */
+  size_t column_count;
+  zsv_key_index *key_indexes;     /* per column: saved key index, if any; opened on first use */
+  char *key_index_tried;
 } zsvTable;
 
 struct zsvTable *zsvTable_new(const char *filename) {
@@ -129,6 +140,11 @@ typedef struct zsvCursor {
   zsv_parser parser;
   enum zsv_status parser_status;
   sqlite_int64 rowCount;
+  sqlite_int64 maxRowid;          /* if nonzero, stop after this rowid */
+  struct zsv_key_index_match *matches; /* if set, visit only these rows (from a key index) */
+  size_t matchCount;
+  size_t matchIx;
+  struct zsv_opts matchOpts;      /* options for parsing from a match's offset */
 } zsvCursor;
 
 /*
@@ -148,6 +164,12 @@ static int zsvtabCreate(
 static void zsvTable_delete(struct zsvTable *z) {
   if(z) {
     sqlite3_free(z->zFilename);
+    free(z->coltypes);
+    zsv_index_delete(z->index);
+    for(size_t i = 0; z->key_indexes && i < z->column_count; i++)
+      zsv_key_index_close(z->key_indexes[i]);
+    free(z->key_indexes);
+    free(z->key_index_tried);
     sqlite3_free(z);
   }
 }
@@ -164,6 +186,10 @@ static void zsvCursor_free(struct zsvCursor *cur) {
     cur->stream = NULL;
   }
   cur->rowCount = 0;
+  cur->maxRowid = 0;
+  free(cur->matches);
+  cur->matches = NULL;
+  cur->matchCount = cur->matchIx = 0;
 }
 
 /* Open pTab's file and construct a parser over it using pTab's saved options.
@@ -171,8 +197,9 @@ static void zsvCursor_free(struct zsvCursor *cur) {
 ** both are left NULL (the stream, if opened, is closed here) and SQLITE_ERROR is
 ** returned. Shared by zsvCursor_init (per-cursor scan) and zsvtabConnect (a
 ** throwaway header read); each caller does its own zsv_next_row handling after,
-** since that part diverges (stop-at-header vs skip-header-then-advance). */
-static int zsvOpenParser(struct zsvTable *pTab, FILE **pStream, zsv_parser *pParser) {
+** since that part diverges (stop-at-header vs skip-header-then-advance).
+** If pOpts is non-NULL, it receives the options merged with saved properties. */
+static int zsvOpenParser(struct zsvTable *pTab, FILE **pStream, zsv_parser *pParser, struct zsv_opts *pOpts) {
   *pStream = NULL;
   *pParser = NULL;
   FILE *stream = fopen(pTab->zFilename, "rb");
@@ -186,13 +213,15 @@ static int zsvOpenParser(struct zsvTable *pTab, FILE **pStream, zsv_parser *pPar
     return SQLITE_ERROR;
   }
   *pStream = stream;
+  if(pOpts)
+    *pOpts = opts;
   return SQLITE_OK;
 }
 
 /* Open a fresh parser for this cursor, positioned at the first data row.
 ** Skips the header row exactly as zsvtabConnect does when building the schema. */
 static int zsvCursor_init(struct zsvCursor *cur, struct zsvTable *pTab) {
-  if(zsvOpenParser(pTab, &cur->stream, &cur->parser) != SQLITE_OK)
+  if(zsvOpenParser(pTab, &cur->stream, &cur->parser, NULL) != SQLITE_OK)
     return SQLITE_ERROR;
   if((cur->parser_status = zsv_next_row(cur->parser)) != zsv_status_row) /* header */
     return SQLITE_ERROR;
@@ -201,6 +230,165 @@ static int zsvCursor_init(struct zsvCursor *cur, struct zsvTable *pTab) {
   return SQLITE_OK;
 }
 
+struct zsvIndexBuilder {
+  zsv_parser parser;
+  struct zsv_index *ix;
+};
+
+static void zsvIndexBuilder_row(void *ctx) {
+  struct zsvIndexBuilder *b = ctx;
+  if(zsv_index_add_row(b->ix, zsv_cum_scanned_length(b->parser)) != zsv_index_status_ok)
+    zsv_abort(b->parser);
+}
+
+/* Build pTab's row index with one pass over the file, so that later rowid
+** lookups seek directly to their row. Not attempted again after a failure */
+static int zsvTable_buildIndex(struct zsvTable *pTab) {
+  if(pTab->index)
+    return SQLITE_OK;
+  if(pTab->index_failed)
+    return SQLITE_ERROR;
+  pTab->index_failed = 1;
+
+  struct zsvIndexBuilder b = { 0 };
+  struct zsv_opts opts = pTab->parser_opts;
+  if(!(opts.stream = fopen(pTab->zFilename, "rb")))
+    return SQLITE_ERROR;
+  opts.row_handler = zsvIndexBuilder_row;
+  opts.ctx = &b;
+  enum zsv_status stat = zsv_status_error;
+  if(zsv_new_with_properties(&opts, &pTab->custom_prop_handler, pTab->zFilename, &b.parser) == zsv_status_ok
+     && !opts.overwrite.next /* overwrites are keyed by row position, so we can't start mid-file */
+     && (b.ix = zsv_index_new())) {
+    while((stat = zsv_parse_more(b.parser)) == zsv_status_ok)
+      ;
+    if(stat == zsv_status_no_more_input)
+      stat = zsv_finish(b.parser);
+  }
+  if(b.parser)
+    zsv_delete(b.parser);
+  fclose(opts.stream);
+
+  if(stat != zsv_status_ok && stat != zsv_status_no_more_input) {
+    zsv_index_delete(b.ix);
+    return SQLITE_ERROR;
+  }
+  zsv_index_commit_rows(b.ix);
+  pTab->index = b.ix;
+  pTab->index_failed = 0;
+  return SQLITE_OK;
+}
+
+/* Open a fresh parser for this cursor, positioned at the row with the given
+** rowid (1 = first data row). Uses the row index to seek when possible and
+** otherwise reads and discards the preceding rows */
+static int zsvCursor_initAt(struct zsvCursor *cur, struct zsvTable *pTab, sqlite_int64 rowid) {
+  if(rowid > 1 && zsvTable_buildIndex(pTab) == SQLITE_OK) {
+    struct zsv_opts opts;
+    if(zsvOpenParser(pTab, &cur->stream, &cur->parser, &opts) != SQLITE_OK)
+      return SQLITE_ERROR;
+    zsv_delete(cur->parser);
+    cur->parser = NULL;
+    cur->rowCount = rowid;
+    if((uint64_t)(rowid - 1) > pTab->index->row_count) {
+      cur->parser_status = zsv_status_no_more_input; /* past the last row */
+      return SQLITE_OK;
+    }
+    // the index holds offsets of raw row ends, so parse from there as-is
+    opts.header_span = 0;
+    opts.rows_to_ignore = 0;
+    if(zsv_index_seek_row(pTab->index, &opts, (uint64_t)(rowid - 1)) != zsv_index_status_ok
+       || !(cur->parser = zsv_new(&opts)))
+      return SQLITE_ERROR;
+    cur->parser_status = zsv_next_row(cur->parser);
+    return SQLITE_OK;
+  }
+
+  int rc = zsvCursor_init(cur, pTab);
+  while(rc == SQLITE_OK && cur->rowCount < rowid && cur->parser_status == zsv_status_row) {
+    cur->parser_status = zsv_next_row(cur->parser);
+    cur->rowCount++;
+  }
+  return rc;
+}
+
+/* Get the saved key index of the given column (see `zsv index build`), or NULL
+** if there is none or it is out of date. Columns with an inferred type are not
+** looked up, as their values are compared as numbers rather than as text */
+static zsv_key_index zsvTable_keyIndex(struct zsvTable *pTab, int col) {
+  if(col < 0 || (size_t)col >= pTab->column_count
+     || ((size_t)col < pTab->coltype_count && pTab->coltypes[col] != zsv_coltype_text))
+    return NULL;
+  if(!pTab->key_indexes) {
+    pTab->key_indexes = calloc(pTab->column_count, sizeof(*pTab->key_indexes));
+    pTab->key_index_tried = calloc(pTab->column_count, 1);
+    if(!pTab->key_indexes || !pTab->key_index_tried) {
+      free(pTab->key_indexes);
+      free(pTab->key_index_tried);
+      pTab->key_indexes = NULL;
+      pTab->key_index_tried = NULL;
+      return NULL;
+    }
+  }
+  if(!pTab->key_index_tried[col]) {
+    pTab->key_index_tried[col] = 1;
+    pTab->key_indexes[col] = zsv_key_index_open(pTab->zFilename, (size_t)col);
+  }
+  return pTab->key_indexes[col];
+}
+
+/* Position the cursor at its current key index match, parsing from the match's
+** offset with a fresh parser */
+static void zsvCursor_seekMatch(struct zsvCursor *cur) {
+  if(cur->parser) {
+    zsv_delete(cur->parser);
+    cur->parser = NULL;
+  }
+  cur->parser_status = zsv_status_no_more_input;
+  if(cur->matchIx >= cur->matchCount)
+    return;
+  const struct zsv_key_index_match *m = &cur->matches[cur->matchIx];
+  if(fseeko(cur->stream, (off_t)m->offset, SEEK_SET) || !(cur->parser = zsv_new(&cur->matchOpts)))
+    cur->parser_status = zsv_status_error;
+  else
+    cur->parser_status = zsv_next_row(cur->parser);
+  cur->rowCount = (sqlite_int64)m->row;
+}
+
+/* Open this cursor on the rows whose key column equals the given value, as
+** found in the column's key index. Returns SQLITE_NOTFOUND if the index can't be
+** used, in which case the caller scans instead */
+static int zsvCursor_initMatches(struct zsvCursor *cur, struct zsvTable *pTab, int col, sqlite3_value *v) {
+  zsv_key_index ix = zsvTable_keyIndex(pTab, col);
+  if(!ix)
+    return SQLITE_NOTFOUND;
+  if(sqlite3_value_type(v) == SQLITE_NULL) { /* NULL never matches */
+    cur->parser_status = zsv_status_no_more_input;
+    return SQLITE_OK;
+  }
+  // a TEXT column compares with a numeric value as text, so look up the value's text
+  const unsigned char *key = sqlite3_value_text(v);
+  int len = sqlite3_value_bytes(v);
+  if(!key)
+    return SQLITE_NOTFOUND;
+  if(zsvOpenParser(pTab, &cur->stream, &cur->parser, &cur->matchOpts) != SQLITE_OK)
+    return SQLITE_ERROR;
+  zsv_delete(cur->parser);
+  cur->parser = NULL;
+  if(cur->matchOpts.overwrite.next /* overwrites may change key values */
+     || zsv_key_index_find(ix, key, (size_t)len, &cur->matches, &cur->matchCount) != zsv_key_index_status_ok) {
+    zsvCursor_free(cur);
+    return SQLITE_NOTFOUND;
+  }
+  // each match is parsed from its own offset, as a data row
+  cur->matchOpts.header_span = 0;
+  cur->matchOpts.rows_to_ignore = 0;
+  cur->matchOpts.keep_empty_header_rows = 1;
+  cur->matchIx = 0;
+  zsvCursor_seekMatch(cur);
+  return SQLITE_OK;
+}
+
 #include "vtab_helper.c"
 
 #define BLANK_COLUMN_NAME_PREFIX "Blank_Column"
@@ -219,6 +407,8 @@ static long zsv_csv_colname_find(char *const *seen, size_t n, const char *name)
 }
 
 /* Append the `"col" TEXT, ...` specifications for each header cell to pStr.
+** Columns with an inferred type (see `coltypes`, which may be NULL) are declared
+** INTEGER or REAL instead of TEXT.
 ** When `dedupe` is nonzero, duplicate column names are made unique by appending
 ** _2, _3, ... so input with repeated headers is loadable: the first occurrence of
 ** a name keeps it and later occurrences are renamed. A synthesized name is probed
@@ -230,7 +420,8 @@ static long zsv_csv_colname_find(char *const *seen, size_t n, const char *name)
 ** (allocated with asprintf, naming the column and its 1-based positions) so the
 ** caller can fail with an actionable message instead of SQLite's generic one.
 ** Returns 0 on success, 1 if a duplicate was reported, -1 on out-of-memory. */
-static int zsv_csv_append_column_defs(sqlite3_str *pStr, zsv_parser parser, int dedupe, int warn, char **dup_errmsg) {
+static int zsv_csv_append_column_defs(sqlite3_str *pStr, zsv_parser parser, int dedupe, int warn, char **dup_errmsg,
+                                      const unsigned char *coltypes, size_t coltype_count) {
   size_t ncols = zsv_cell_count(parser);
   char **base = NULL;  // user-supplied name (trimmed, or blank placeholder) per column
   char **final = NULL; // unique name assigned to each column (may alias base[i])
@@ -305,7 +496,9 @@ static int zsv_csv_append_column_defs(sqlite3_str *pStr, zsv_parser parser, int
         nrenamed++;
       }
     }
-    sqlite3_str_appendf(pStr, "%s\"%w\" TEXT", i > 0 ? "," : "", final[i]);
+    enum zsv_coltype coltype = i < coltype_count ? coltypes[i] : zsv_coltype_text;
+    sqlite3_str_appendf(pStr, "%s\"%w\" %s", i > 0 ? "," : "", final[i],
+                        coltype == zsv_coltype_integer ? "INTEGER" : coltype == zsv_coltype_real ? "REAL" : "TEXT");
   }
 
   if(warn && nrenamed) {
@@ -337,6 +530,11 @@ done:
 /**
  * Parameters:
  *    filename=FILENAME          Name of file containing CSV content
+ *    dedupe=1                   Rename duplicate column names instead of failing
+ *    warn_renames=1             Print a note when columns are renamed
+ *    infer_types=1|2            Declare columns whose sampled values are all
+ *                               numeric as INTEGER or REAL, and return their
+ *                               values as such. 2 = do not use the type cache
  *
  * The number of columns in the first row of the input file determines the
  * column names and column count
@@ -351,15 +549,16 @@ static int zsvtabConnect(
   (void)(_pAux);
   zsvTable pTmp = { 0 };
   int rc = SQLITE_OK;        /* Result code from this routine */
-  #define ZSVTABCONNECT_PARAM_MAX 3
+  #define ZSVTABCONNECT_PARAM_MAX 4
   static const char *azParam[ZSVTABCONNECT_PARAM_MAX] = {
-     "filename", "dedupe", "warn_renames"
+     "filename", "dedupe", "warn_renames", "infer_types"
   };
   char *azPValue[ZSVTABCONNECT_PARAM_MAX]; /* Parameter values */
   memset(azPValue, 0, sizeof(azPValue));
 # define CSV_FILENAME     (azPValue[0])
 # define CSV_DEDUPE       (azPValue[1])
 # define CSV_WARN_RENAMES (azPValue[2])
+# define CSV_INFER_TYPES  (azPValue[3])
 
   char *schema = NULL;
   zsvTable *pNew = NULL;
@@ -401,7 +600,7 @@ static int zsvtabConnect(
 
   // Read the header row with a throwaway parser (each scan uses its own
   // cursor-owned parser, so the table holds no live parser or file handle).
-  if(zsvOpenParser(pNew, &hdr_stream, &hdr_parser) != SQLITE_OK) {
+  if(zsvOpenParser(pNew, &hdr_stream, &hdr_parser, NULL) != SQLITE_OK) {
     asprintf(&errmsg, "Unable to open for reading: %s", pNew->zFilename);
     goto zsvtab_connect_error;
   }
@@ -412,6 +611,15 @@ static int zsvtabConnect(
     goto zsvtab_connect_error;
   }
 
+  pNew->column_count = zsv_cell_count(hdr_parser);
+
+  int infer_types = CSV_INFER_TYPES ? atoi(CSV_INFER_TYPES) : 0;
+  if(infer_types && zsv_coltypes_get(pNew->zFilename, &pNew->parser_opts, &pNew->custom_prop_handler,
+                                     infer_types == 1, &pNew->coltypes, &pNew->coltype_count) != zsv_status_ok) {
+    asprintf(&errmsg, "Unable to infer column types: %s", pNew->zFilename);
+    goto zsvtab_connect_error;
+  }
+
   *ppVtab = (sqlite3_vtab*)pNew;
 
   // generate the CREATE TABLE statement. When `dedupe` is requested, repeated
@@ -420,7 +628,8 @@ static int zsvtabConnect(
   int do_warn = CSV_WARN_RENAMES && atoi(CSV_WARN_RENAMES) != 0;
   sqlite3_str *pStr = sqlite3_str_new(0);
   sqlite3_str_appendf(pStr, "CREATE TABLE x(");
-  int defstat = zsv_csv_append_column_defs(pStr, hdr_parser, do_dedupe, do_warn, &errmsg);
+  int defstat = zsv_csv_append_column_defs(pStr, hdr_parser, do_dedupe, do_warn, &errmsg,
+                                          pNew->coltypes, pNew->coltype_count);
   if(defstat) {
     sqlite3_free(sqlite3_str_finish(pStr));
     if(defstat > 0) // duplicate column name; errmsg holds an actionable message
@@ -480,18 +689,84 @@ zsvtab_connect_error:
   return rc;
 }
 
+/* idxNum bits: which rowid constraints are passed to xFilter, in argv order */
+#define ZSVTAB_ROWID_EQ    1
+#define ZSVTAB_ROWID_LOWER 2 /* rowid > or >= argv value */
+#define ZSVTAB_ROWID_UPPER 4 /* rowid < or <= argv value */
+#define ZSVTAB_ROWID_GT    8 /* lower bound is exclusive */
+#define ZSVTAB_ROWID_LT   16 /* upper bound is exclusive */
+#define ZSVTAB_KEY_EQ     32 /* column = argv value, via the column's key index;
+                                the column number + 1 is in the bits above 8 */
+
 /*
-** Only a forward full table scan is supported.  xBestIndex is mostly
-** a no-op.  If CSVTEST_FIDX is set, then the presence of equality
-** constraints lowers the estimated cost, which is fiction, but is useful
-** for testing certain kinds of virtual table behavior.
+** Scans are forward-only, in rowid order. Constraints on rowid (=, >, >=,
+** <, <=) are used to start the scan at the first qualifying row, which is
+** found via the table's row index, and to stop it after the last one.
+** Without a rowid equality, an equality on a column that has a key index
+** (see `zsv index build`) is used to visit only the rows with that value.
+** The constraints are not omitted, so SQLite still checks them; xFilter
+** therefore only needs to visit a superset of the matching rows.
 */
 static int zsvtabBestIndex(
   sqlite3_vtab *tab,
   sqlite3_index_info *pIdxInfo
 ){
-  (void)(tab);
+  int eq = -1, lower = -1, upper = -1, key_eq = -1;
+  for(int i = 0; i < pIdxInfo->nConstraint; i++) {
+    const struct sqlite3_index_constraint *c = &pIdxInfo->aConstraint[i];
+    if(c->usable && c->iColumn >= 0 && c->op == SQLITE_INDEX_CONSTRAINT_EQ && key_eq < 0
+       && zsvTable_keyIndex((zsvTable*)tab, c->iColumn))
+      key_eq = i;
+    if(!c->usable || c->iColumn != -1)
+      continue;
+    switch(c->op) {
+    case SQLITE_INDEX_CONSTRAINT_EQ:
+      eq = i;
+      break;
+    case SQLITE_INDEX_CONSTRAINT_GT:
+    case SQLITE_INDEX_CONSTRAINT_GE:
+      lower = i;
+      break;
+    case SQLITE_INDEX_CONSTRAINT_LT:
+    case SQLITE_INDEX_CONSTRAINT_LE:
+      upper = i;
+      break;
+    }
+  }
+
+  int argc = 0;
+  pIdxInfo->idxNum = 0;
   pIdxInfo->estimatedCost = 1000000;
+  if(eq >= 0) {
+    pIdxInfo->idxNum = ZSVTAB_ROWID_EQ;
+    pIdxInfo->aConstraintUsage[eq].argvIndex = ++argc;
+    pIdxInfo->estimatedCost = 1;
+    pIdxInfo->estimatedRows = 1;
+    pIdxInfo->idxFlags |= SQLITE_INDEX_SCAN_UNIQUE;
+  } else if(key_eq >= 0) {
+    pIdxInfo->idxNum = ZSVTAB_KEY_EQ | ((pIdxInfo->aConstraint[key_eq].iColumn + 1) << 8);
+    pIdxInfo->aConstraintUsage[key_eq].argvIndex = ++argc;
+    pIdxInfo->estimatedCost = 10;
+    pIdxInfo->estimatedRows = 10;
+  } else {
+    if(lower >= 0) {
+      pIdxInfo->idxNum |= ZSVTAB_ROWID_LOWER;
+      if(pIdxInfo->aConstraint[lower].op == SQLITE_INDEX_CONSTRAINT_GT)
+        pIdxInfo->idxNum |= ZSVTAB_ROWID_GT;
+      pIdxInfo->aConstraintUsage[lower].argvIndex = ++argc;
+      pIdxInfo->estimatedCost /= 4;
+    }
+    if(upper >= 0) {
+      pIdxInfo->idxNum |= ZSVTAB_ROWID_UPPER;
+      if(pIdxInfo->aConstraint[upper].op == SQLITE_INDEX_CONSTRAINT_LT)
+        pIdxInfo->idxNum |= ZSVTAB_ROWID_LT;
+      pIdxInfo->aConstraintUsage[upper].argvIndex = ++argc;
+      pIdxInfo->estimatedCost /= 4;
+    }
+  }
+
+  if(pIdxInfo->nOrderBy == 1 && pIdxInfo->aOrderBy[0].iColumn == -1 && !pIdxInfo->aOrderBy[0].desc)
+    pIdxInfo->orderByConsumed = 1;
   return SQLITE_OK;
 }
 
@@ -526,25 +801,89 @@ static int zsvtabClose(sqlite3_vtab_cursor *cur){
 }
 
 /*
-** Only a full table scan is supported.  So xFilter simply (re)opens this
-** cursor's own parser at the start of the file.
+** Get the rowid bound implied by a constraint value: the floor of a real
+** value for a lower bound and its ceiling for an upper bound (a superset of
+** the exact range, as SQLite rechecks the constraint). An exclusive bound on
+** an integer value is made inclusive. Returns 0 if the value is not numeric,
+** in which case the bound is not used. A NULL value can never match, and
+** yields an empty range
+*/
+static int zsvtabRowidBound(sqlite3_value *v, int upper, int exclusive, sqlite_int64 *bound, int *empty) {
+  switch(sqlite3_value_type(v)) {
+  case SQLITE_INTEGER:
+    *bound = sqlite3_value_int64(v);
+    if(exclusive && *bound != (upper ? INT64_MIN : INT64_MAX))
+      *bound += upper ? -1 : 1;
+    return 1;
+  case SQLITE_FLOAT: {
+    double d = sqlite3_value_double(v);
+    if(d < -9e18)
+      *bound = upper ? -1 : 0;
+    else if(d > 9e18)
+      *bound = (sqlite_int64)9e18;
+    else {
+      *bound = (sqlite_int64)d; /* truncates toward zero */
+      if(upper && (double)*bound < d)
+        (*bound)++;
+      else if(!upper && (double)*bound > d)
+        (*bound)--;
+    }
+    return 1;
+  }
+  case SQLITE_NULL:
+    *empty = 1;
+    return 0;
+  default:
+    return 0;
+  }
+}
+
+/*
+** (Re)open this cursor's own parser at the first row that can satisfy the
+** rowid constraints chosen by xBestIndex (or at the start of the file)
 */
 static int zsvtabFilter(
   sqlite3_vtab_cursor *pVtabCursor,
   int idxNum, const char *idxStr,
   int argc, sqlite3_value **argv
 ){
-  (void)(idxNum);
   (void)(idxStr);
-  (void)(argc);
-  (void)(argv);
   struct zsvCursor *pCur = (struct zsvCursor*)pVtabCursor;
   zsvTable *pTab = (zsvTable*)pVtabCursor->pVtab;
 
   zsvCursor_free(pCur); // discard any prior scan (xFilter may be called repeatedly)
-  int rc = zsvCursor_init(pCur, pTab);
+
+  if((idxNum & ZSVTAB_KEY_EQ) && argc > 0) {
+    int rc = zsvCursor_initMatches(pCur, pTab, (idxNum >> 8) - 1, argv[0]);
+    if(rc != SQLITE_NOTFOUND)
+      return rc;
+    return zsvCursor_init(pCur, pTab) == SQLITE_OK ? SQLITE_OK : (zsvCursor_free(pCur), SQLITE_ERROR);
+  }
+
+  sqlite_int64 lo = 1, hi = INT64_MAX, v;
+  int empty = 0, j = 0;
+  if((idxNum & ZSVTAB_ROWID_EQ) && j < argc) {
+    if(zsvtabRowidBound(argv[j], 0, 0, &v, &empty) && v > lo)
+      lo = v;
+    if(zsvtabRowidBound(argv[j++], 1, 0, &v, &empty))
+      hi = v;
+  }
+  if((idxNum & ZSVTAB_ROWID_LOWER) && j < argc)
+    if(zsvtabRowidBound(argv[j++], 0, idxNum & ZSVTAB_ROWID_GT, &v, &empty) && v > lo)
+      lo = v;
+  if((idxNum & ZSVTAB_ROWID_UPPER) && j < argc)
+    if(zsvtabRowidBound(argv[j++], 1, idxNum & ZSVTAB_ROWID_LT, &v, &empty) && v < hi)
+      hi = v;
+  if(empty || hi < lo) {
+    pCur->parser_status = zsv_status_no_more_input;
+    return SQLITE_OK;
+  }
+
+  int rc = zsvCursor_initAt(pCur, pTab, lo);
   if(rc != SQLITE_OK)
     zsvCursor_free(pCur);
+  else if(hi != INT64_MAX)
+    pCur->maxRowid = hi;
   return rc;
 }
 
@@ -555,6 +894,11 @@ static int zsvtabFilter(
 */
 static int zsvtabNext(sqlite3_vtab_cursor *cur){
   struct zsvCursor *pCur = (struct zsvCursor*)cur;
+  if(pCur->matches) {
+    pCur->matchIx++;
+    zsvCursor_seekMatch(pCur);
+    return SQLITE_OK;
+  }
   pCur->parser_status = zsv_next_row(pCur->parser);
   pCur->rowCount++;
   return SQLITE_OK;
@@ -566,7 +910,7 @@ static int zsvtabNext(sqlite3_vtab_cursor *cur){
 */
 static int zsvtabEof(sqlite3_vtab_cursor *cur){
   struct zsvCursor *pCur = (struct zsvCursor*)cur;
-  return pCur->parser_status != zsv_status_row;
+  return pCur->parser_status != zsv_status_row || (pCur->maxRowid && pCur->rowCount > pCur->maxRowid);
 }
 
 /*
@@ -580,6 +924,20 @@ static int zsvtabColumn(
 ){
   struct zsvCursor *pCur = (struct zsvCursor*)cur;
   struct zsv_cell c = zsv_get_cell(pCur->parser, i);
+  zsvTable *pTab = (zsvTable*)cur->pVtab;
+  if(c.len && (size_t)i < pTab->coltype_count && pTab->coltypes[i] != zsv_coltype_text) {
+    // typed column: values that do not parse strictly (e.g. "n/a") stay text
+    int64_t i64;
+    double dbl;
+    if(pTab->coltypes[i] == zsv_coltype_integer && zsv_parse_int64(c.str, c.len, &i64)) {
+      sqlite3_result_int64(ctx, i64);
+      return SQLITE_OK;
+    }
+    if(zsv_parse_double(c.str, c.len, &dbl)) {
+      sqlite3_result_double(ctx, dbl);
+      return SQLITE_OK;
+    }
+  }
   // SQLITE_STATIC is safe: the cell points into this cursor's own parser buffer,
   // which stays valid until this cursor advances (zsvtabNext) or closes -- no
   // other cursor can free it.
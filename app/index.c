@@ -0,0 +1,115 @@
+/*
+ * Copyright (C) 2021 Liquidaty and zsv contributors. All rights reserved.
+ *
+ * This file is part of zsv/lib, distributed under the MIT license as defined at
+ * https://opensource.org/licenses/MIT
+ */
+
+/*
+ * Build or remove the persisted key index of one or more columns of a file
+ * (see utils/key_index.h), as used by `zsv lookup`, the sql csv table and
+ * sheet's find
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include <unistd.h> // unlink
+
+#define ZSV_COMMAND index
+#include "zsv_command.h"
+
+#include <zsv/utils/arg.h>
+#include "utils/key_index.h"
+
+const char *zsv_index_usage_msg[] = {
+  ZSV_USAGE_PROG " " APPNAME ": build or remove a key index",
+  "",
+  "Usage: " ZSV_USAGE_PROG " " APPNAME " build|rm -k <column> [-k <column> ...] <filename>",
+  "",
+  "build saves an index of the values of each given column, with which rows can be found",
+  "by value without reading the whole file (e.g. by `" ZSV_USAGE_PROG " lookup`, or by `sql`",
+  "or `sheet` find when filtering on an exact value). An index is saved in the file's",
+  "cache directory, and is ignored once the file changes. rm removes it.",
+  "",
+  "Options:",
+  "  -k,--key <column>: column name (case-insensitive) or #N for the Nth column",
+  NULL,
+};
+
+static int zsv_index_usage(void) {
+  zsv_print_usage(zsv_index_usage_msg);
+  return 0;
+}
+
+int ZSV_MAIN_FUNC(ZSV_COMMAND)(int argc, const char *argv[], struct zsv_opts *opts,
+                               struct zsv_prop_handler *custom_prop_handler) {
+  if (argc < 2 || !strcmp(argv[1], "-h") || !strcmp(argv[1], "--help"))
+    return zsv_index_usage();
+
+  int err = 0;
+  char rm = 0;
+  const char *input_path = NULL;
+  const char **keys = calloc((size_t)argc, sizeof(*keys));
+  size_t key_count = 0;
+  if (!keys)
+    err = 1;
+  else if (!strcmp(argv[1], "rm"))
+    rm = 1;
+  else if (strcmp(argv[1], "build")) {
+    fprintf(stderr, "Unrecognized subcommand: %s\n", argv[1]);
+    err = 1;
+  }
+
+  for (int arg_i = 2; !err && arg_i < argc; arg_i++) {
+    const char *arg = argv[arg_i];
+    if (!strcmp(arg, "-k") || !strcmp(arg, "--key")) {
+      if (++arg_i >= argc || !*argv[arg_i]) {
+        fprintf(stderr, "%s option requires a column name\n", arg);
+        err = 1;
+      } else
+        keys[key_count++] = argv[arg_i];
+    } else if (zsv_arg_is_option(arg)) {
+      fprintf(stderr, "Unrecognized option: %s\n", arg);
+      err = 1;
+    } else if (input_path) {
+      fprintf(stderr, "Input may not be specified more than once\n");
+      err = 1;
+    } else
+      input_path = arg;
+  }
+  if (!err && (!input_path || !key_count)) {
+    fprintf(stderr, "Please specify a filename and at least one key column\n");
+    err = 1;
+  }
+
+  for (size_t i = 0; !err && i < key_count; i++) {
+    size_t col;
+    enum zsv_key_index_status stat = zsv_key_index_column(input_path, opts, custom_prop_handler, keys[i], &col);
+    if (stat == zsv_key_index_status_no_column)
+      fprintf(stderr, "Column not found: %s\n", keys[i]);
+    else if (stat != zsv_key_index_status_ok)
+      fprintf(stderr, "Unable to read %s\n", input_path);
+    else if (rm) {
+      char *fn = zsv_key_index_filepath(input_path, col, 0);
+      if (fn && unlink(fn)) {
+        perror(fn);
+        stat = zsv_key_index_status_error;
+      }
+      free(fn);
+    } else {
+      uint64_t row_count = 0;
+      if ((stat = zsv_key_index_build(input_path, opts, custom_prop_handler, col, &row_count)) !=
+          zsv_key_index_status_ok)
+        fprintf(stderr, "Unable to build index of %s\n", keys[i]);
+      else if (opts->verbose)
+        fprintf(stderr, "Indexed %" PRIu64 " rows by %s\n", row_count, keys[i]);
+    }
+    if (stat != zsv_key_index_status_ok)
+      err = 1;
+  }
+  free(keys);
+  return err;
+}
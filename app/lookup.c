@@ -0,0 +1,330 @@
+/*
+ * Copyright (C) 2021 Liquidaty and zsv contributors. All rights reserved.
+ *
+ * This file is part of zsv/lib, distributed under the MIT license as defined at
+ * https://opensource.org/licenses/MIT
+ */
+
+/*
+ * Output the rows whose key column equals any of the given values.
+ *
+ * If the key column has an index (see `zsv index build`, and utils/key_index.h)
+ * that is up to date, each value's rows are found in the index, and only those
+ * rows are read: their bytes are read into memory, in input order, and parsed
+ * together. Otherwise, every row is read and compared
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#define ZSV_COMMAND lookup
+#include "zsv_command.h"
+
+#include <zsv/utils/writer.h>
+#include <zsv/utils/arg.h>
+#include "utils/chunk.h"
+#include "utils/key_index.h"
+
+const char *zsv_lookup_usage_msg[] = {
+  ZSV_USAGE_PROG " " APPNAME ": output rows with the given key values",
+  "",
+  "Usage: " ZSV_USAGE_PROG " " APPNAME " [options] <filename> -k <column> <value> [<value> ...]",
+  "",
+  "Outputs the header and, in input order, each row whose key column equals one of the",
+  "given values. If the key column has been indexed with `" ZSV_USAGE_PROG " index build`, rows",
+  "are read directly from their offsets; otherwise, all rows are read.",
+  "",
+  "Options:",
+  "  -k,--key <column>      : key column name (case-insensitive) or #N for the Nth column",
+  "  --build                : build the index if it is missing or out of date",
+  "  -o,--output <filename> : output file",
+  "  -b                     : output with BOM",
+  NULL,
+};
+
+static int zsv_lookup_usage(void) {
+  zsv_print_usage(zsv_lookup_usage_msg);
+  return 0;
+}
+
+struct zsv_lookup_value {
+  const unsigned char *s;
+  size_t len;
+};
+
+struct zsv_lookup {
+  struct zsv_opts *opts;
+  zsv_parser parser;
+  zsv_csv_writer writer;
+  size_t col;
+  struct zsv_lookup_value *values; // sorted
+  size_t value_count;
+  size_t rows_parsed;
+  char header_only;
+};
+
+static int zsv_lookup_value_cmp(const void *x, const void *y) {
+  const struct zsv_lookup_value *a = x, *b = y;
+  int c = memcmp(a->s, b->s, a->len < b->len ? a->len : b->len);
+  return c ? c : a->len < b->len ? -1 : a->len > b->len;
+}
+
+static void zsv_lookup_write_row(struct zsv_lookup *d) {
+  size_t cell_count = zsv_cell_count(d->parser);
+  for (size_t i = 0; i < cell_count; i++) {
+    struct zsv_cell c = zsv_get_cell(d->parser, i);
+    zsv_writer_cell(d->writer, i == 0, c.str, c.len, c.quoted);
+  }
+}
+
+static void zsv_lookup_scan_row(void *ctx) {
+  struct zsv_lookup *d = ctx;
+  struct zsv_cell c = d->col < zsv_cell_count(d->parser) ? zsv_get_cell(d->parser, d->col) : (struct zsv_cell){0};
+  struct zsv_lookup_value v = {c.str, c.len};
+  if (bsearch(&v, d->values, d->value_count, sizeof(*d->values), zsv_lookup_value_cmp))
+    zsv_lookup_write_row(d);
+}
+
+static void zsv_lookup_header(void *ctx) {
+  struct zsv_lookup *d = ctx;
+  zsv_lookup_write_row(d);
+  if (d->header_only)
+    zsv_abort(d->parser);
+  else
+    zsv_set_row_handler(d->parser, zsv_lookup_scan_row);
+}
+
+// parse the input from the start; output the header and, unless header_only, matching rows
+static int zsv_lookup_scan(struct zsv_lookup *d, FILE *in, const char *input_path,
+                           struct zsv_prop_handler *custom_prop_handler, char header_only) {
+  if (fseeko(in, 0, SEEK_SET))
+    return 1;
+  d->header_only = header_only;
+  d->opts->stream = in;
+  d->opts->row_handler = zsv_lookup_header;
+  d->opts->ctx = d;
+  if (zsv_new_with_properties(d->opts, custom_prop_handler, input_path, &d->parser) != zsv_status_ok)
+    return 1;
+  while (!zsv_signal_interrupted && zsv_parse_more(d->parser) == zsv_status_ok)
+    ;
+  zsv_finish(d->parser);
+  zsv_delete(d->parser);
+  d->parser = NULL;
+  return 0;
+}
+
+struct zsv_lookup_mem {
+  const unsigned char *s;
+  size_t len;
+  size_t pos;
+};
+
+static size_t zsv_lookup_mem_read(void *restrict buff, size_t n, size_t size, void *restrict ctx) {
+  struct zsv_lookup_mem *m = ctx;
+  size_t bytes = n * size;
+  if (bytes > m->len - m->pos)
+    bytes = m->len - m->pos;
+  memcpy(buff, m->s + m->pos, bytes);
+  m->pos += bytes;
+  return bytes;
+}
+
+static void zsv_lookup_mem_row(void *ctx) {
+  struct zsv_lookup *d = ctx;
+  d->rows_parsed++;
+  zsv_lookup_write_row(d);
+}
+
+static int zsv_lookup_match_cmp(const void *x, const void *y) {
+  const struct zsv_key_index_match *a = x, *b = y;
+  return a->row < b->row ? -1 : a->row > b->row;
+}
+
+/*
+ * output the rows found in the index. Returns 0 on success, or non-zero on error,
+ * including if the rows read do not parse as expected
+ */
+static int zsv_lookup_indexed(struct zsv_lookup *d, FILE *in, zsv_key_index ix) {
+  struct zsv_key_index_match *matches = NULL;
+  size_t count = 0, capacity = 0;
+  int err = 0;
+  for (size_t i = 0; i < d->value_count && !err; i++) {
+    struct zsv_key_index_match *m;
+    size_t n;
+    if (zsv_key_index_find(ix, d->values[i].s, d->values[i].len, &m, &n) != zsv_key_index_status_ok)
+      err = 1;
+    else if (n) {
+      if (count + n > capacity) {
+        capacity = (count + n) * 2;
+        struct zsv_key_index_match *tmp = realloc(matches, capacity * sizeof(*tmp));
+        if (!tmp)
+          err = 1;
+        else
+          matches = tmp;
+      }
+      if (!err)
+        memcpy(matches + count, m, n * sizeof(*m));
+      count += n;
+      free(m);
+    }
+  }
+  if (!err)
+    qsort(matches, count, sizeof(*matches), zsv_lookup_match_cmp);
+
+  // read the rows, each followed by a line end, in input order
+  const char *le = "\n";
+#ifndef ZSV_NO_ONLY_CRLF
+  if (d->opts->only_crlf_rowend)
+    le = "\r\n";
+#endif
+  size_t le_len = strlen(le), mem_len = 0;
+  for (size_t i = 0; i < count && !err; i++)
+    mem_len += (size_t)matches[i].len + le_len;
+  unsigned char *mem = !err && mem_len ? malloc(mem_len) : NULL;
+  if (mem_len && !mem)
+    err = 1;
+  size_t row_count = 0;
+  mem_len = 0;
+  for (size_t i = 0; i < count && !err; i++) {
+    if (i && matches[i].row == matches[i - 1].row)
+      continue; // a value given more than once
+    size_t len = (size_t)matches[i].len;
+    if (fseeko(in, (zsv_file_pos)matches[i].offset, SEEK_SET) || fread(mem + mem_len, 1, len, in) != len)
+      err = 1;
+    memcpy(mem + mem_len + len, le, le_len);
+    mem_len += len + le_len;
+    row_count++;
+  }
+  free(matches);
+
+  if (!err && mem_len) {
+    struct zsv_lookup_mem m = {mem, mem_len, 0};
+    struct zsv_opts opts;
+    zsv_chunk_opts(&opts, d->opts, NULL, NULL, NULL);
+    opts.stream = &m;
+    opts.read = zsv_lookup_mem_read;
+    opts.row_handler = zsv_lookup_mem_row;
+    opts.ctx = d;
+    if (!(d->parser = zsv_new(&opts)))
+      err = 1;
+    else {
+      while (zsv_parse_more(d->parser) == zsv_status_ok)
+        ;
+      zsv_finish(d->parser);
+      zsv_delete(d->parser);
+      d->parser = NULL;
+      if (d->rows_parsed != row_count) {
+        fprintf(stderr, "Rows read from the index did not parse as expected\n");
+        err = 1;
+      }
+    }
+  }
+  free(mem);
+  return err;
+}
+
+int ZSV_MAIN_FUNC(ZSV_COMMAND)(int argc, const char *argv[], struct zsv_opts *opts,
+                               struct zsv_prop_handler *custom_prop_handler) {
+  if (argc < 2 || !strcmp(argv[1], "-h") || !strcmp(argv[1], "--help"))
+    return zsv_lookup_usage();
+
+  int err = 0;
+  const char *input_path = NULL;
+  const char *key = NULL;
+  char build = 0;
+  struct zsv_csv_writer_options writer_opts = zsv_writer_get_default_opts();
+  struct zsv_lookup d = {0};
+  d.opts = opts;
+  writer_opts.stream = stdout;
+  if (!(d.values = calloc((size_t)argc, sizeof(*d.values))))
+    err = 1;
+
+  for (int arg_i = 1; !err && arg_i < argc; arg_i++) {
+    const char *arg = argv[arg_i];
+    if (!strcmp(arg, "-k") || !strcmp(arg, "--key")) {
+      if (++arg_i >= argc || !*argv[arg_i]) {
+        fprintf(stderr, "%s option requires a column name\n", arg);
+        err = 1;
+      } else
+        key = argv[arg_i];
+    } else if (!strcmp(arg, "--build"))
+      build = 1;
+    else if (!strcmp(arg, "-b"))
+      writer_opts.with_bom = 1;
+    else if (!strcmp(arg, "-o") || !strcmp(arg, "--output")) {
+      if (++arg_i >= argc) {
+        fprintf(stderr, "%s option requires a filename\n", arg);
+        err = 1;
+      } else if (writer_opts.stream != stdout) {
+        fprintf(stderr, "Output may not be specified more than once\n");
+        err = 1;
+      } else if (!(writer_opts.stream = fopen(argv[arg_i], "wb"))) {
+        writer_opts.stream = stdout;
+        fprintf(stderr, "Unable to open file for writing: %s\n", argv[arg_i]);
+        err = 1;
+      }
+    } else if (!input_path) {
+      if (zsv_arg_is_option(arg)) {
+        fprintf(stderr, "Unrecognized option: %s\n", arg);
+        err = 1;
+      } else
+        input_path = arg;
+    } else {
+      // any other argument after the filename is a value
+      d.values[d.value_count].s = (const unsigned char *)arg;
+      d.values[d.value_count++].len = strlen(arg);
+    }
+  }
+  if (!err && (!input_path || !key || !d.value_count)) {
+    fprintf(stderr, "Please specify a filename, a key column and at least one value\n");
+    err = 1;
+  }
+
+  FILE *in = NULL;
+  if (!err && !(in = fopen(input_path, "rb"))) {
+    fprintf(stderr, "Unable to open for reading: %s\n", input_path);
+    err = 1;
+  }
+
+  if (!err) {
+    enum zsv_key_index_status stat = zsv_key_index_column(input_path, opts, custom_prop_handler, key, &d.col);
+    if (stat == zsv_key_index_status_no_column)
+      fprintf(stderr, "Column not found: %s\n", key);
+    if (stat != zsv_key_index_status_ok)
+      err = 1;
+  }
+
+  zsv_key_index ix = NULL;
+  if (!err && !(ix = zsv_key_index_open(input_path, d.col)) && build) {
+    if (zsv_key_index_build(input_path, opts, custom_prop_handler, d.col, NULL) != zsv_key_index_status_ok)
+      fprintf(stderr, "Unable to build index of %s\n", key);
+    else
+      ix = zsv_key_index_open(input_path, d.col);
+  }
+
+  if (!err && !(d.writer = zsv_writer_new(&writer_opts)))
+    err = 1;
+
+  if (!err) {
+    qsort(d.values, d.value_count, sizeof(*d.values), zsv_lookup_value_cmp);
+    if (ix) {
+      err = zsv_lookup_scan(&d, in, input_path, custom_prop_handler, 1) || zsv_lookup_indexed(&d, in, ix);
+    } else {
+      if (opts->verbose)
+        fprintf(stderr, "No index of %s; reading all rows\n", key);
+      err = zsv_lookup_scan(&d, in, input_path, custom_prop_handler, 0);
+    }
+  }
+
+  zsv_key_index_close(ix);
+  if (d.writer)
+    zsv_writer_delete(d.writer);
+  if (writer_opts.stream && writer_opts.stream != stdout)
+    fclose(writer_opts.stream);
+  if (in)
+    fclose(in);
+  free(d.values);
+  return err;
+}
@@ -0,0 +1,493 @@
+/*
+ * Copyright (C) 2021 Liquidaty and zsv contributors. All rights reserved.
+ *
+ * This file is part of zsv/lib, distributed under the MIT license as defined at
+ * https://opensource.org/licenses/MIT
+ */
+
+/*
+ * Output a random sample of rows without reading the whole input.
+ *
+ * For a seekable file, random byte offsets are drawn, and the row around each is
+ * found by zsv_find_row_bounds(). A random offset lands in a row with probability
+ * proportional to its length, so each row found is kept with probability c / length,
+ * where c is a length near the shortest of those seen in a first (pilot) round of
+ * draws; then, every row is about equally likely to be kept. The rows kept are read
+ * back in input order and parsed as a whole, which also verifies their boundaries.
+ *
+ * Input that cannot be seeked (stdin), small input, or input with too few rows
+ * relative to the sample size is instead read in full with reservoir sampling, as
+ * is any input whose rows could not be sampled reliably
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include <time.h>
+
+#define ZSV_COMMAND sample
+#include "zsv_command.h"
+
+#include <zsv/utils/writer.h>
+#include <zsv/utils/arg.h>
+#include "utils/chunk.h"
+#include "utils/buff.h"
+#include "utils/hash.h"
+
+#define ZSV_SAMPLE_MIN_SEEK_BYTES (1024 * 1024) // smaller input is read in full
+#define ZSV_SAMPLE_MAX_WINDOW (1024 * 1024)     // rows longer than this are not found by seeking
+#define ZSV_SAMPLE_MIN_PILOT 64
+
+const char *zsv_sample_usage_msg[] = {
+  ZSV_USAGE_PROG " " APPNAME ": output a random sample of rows",
+  "",
+  "Usage: " ZSV_USAGE_PROG " " APPNAME " -n <count> [options] [filename]",
+  "",
+  "Outputs the header and a random sample of <count> rows, in input order. Each row is",
+  "about equally likely to be sampled. Rows of a large file are found by seeking to",
+  "random offsets, so that only a small part of the file is read; otherwise, all",
+  "rows are read.",
+  "",
+  "Options:",
+  "  -n <count>             : number of rows to sample",
+  "  --seed <n>             : seed for the random number generator, for repeatable output",
+  "  -o,--output <filename> : output file",
+  "  -b                     : output with BOM",
+  NULL,
+};
+
+static int zsv_sample_usage(void) {
+  zsv_print_usage(zsv_sample_usage_msg);
+  return 0;
+}
+
+// a reservoir row, saved as [u8 quoted][u32 len][bytes] per cell
+struct zsv_sample_slot {
+  uint64_t ordinal;
+  struct zsv_buff row;
+};
+
+struct zsv_sample_row {
+  zsv_file_pos start;
+  zsv_file_pos end;
+};
+
+struct zsv_sample {
+  struct zsv_opts *opts;
+  zsv_parser parser;
+  zsv_csv_writer writer;
+  uint64_t n;
+  uint64_t rng;
+  char seek;
+
+  zsv_file_pos header_end;
+
+  // reservoir sampling
+  struct zsv_sample_slot *slots;
+  size_t slot_capacity;
+  uint64_t row_count;
+
+  // sampling by seeking
+  FILE *in;
+  struct zsv_sample_row *rows;
+  size_t row_count_kept;
+  size_t rows_parsed;
+  char write_rows;
+
+  int err;
+};
+
+// splitmix64
+static uint64_t zsv_sample_rand(struct zsv_sample *d) {
+  uint64_t z = (d->rng += 0x9E3779B97F4A7C15ULL);
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+  return z ^ (z >> 31);
+}
+
+static double zsv_sample_rand_unit(struct zsv_sample *d) {
+  return (double)(zsv_sample_rand(d) >> 11) * (1.0 / 9007199254740992.0);
+}
+
+static void zsv_sample_write_row(struct zsv_sample *d, zsv_parser parser) {
+  size_t cell_count = zsv_cell_count(parser);
+  for (size_t i = 0; i < cell_count; i++) {
+    struct zsv_cell c = zsv_get_cell(parser, i);
+    zsv_writer_cell(d->writer, i == 0, c.str, c.len, c.quoted);
+  }
+}
+
+static void zsv_sample_reservoir_row(void *ctx) {
+  struct zsv_sample *d = ctx;
+  uint64_t ix = d->row_count++;
+  if (ix >= d->n && (ix = zsv_sample_rand(d) % (ix + 1)) >= d->n)
+    return;
+  if (ix >= d->slot_capacity) {
+    size_t capacity = d->slot_capacity ? d->slot_capacity * 2 : 256;
+    if (capacity > d->n)
+      capacity = (size_t)d->n;
+    struct zsv_sample_slot *tmp = realloc(d->slots, capacity * sizeof(*tmp));
+    if (!tmp) {
+      d->err = 1;
+      zsv_abort(d->parser);
+      return;
+    }
+    memset(tmp + d->slot_capacity, 0, (capacity - d->slot_capacity) * sizeof(*tmp));
+    d->slots = tmp;
+    d->slot_capacity = capacity;
+  }
+  struct zsv_sample_slot *slot = &d->slots[ix];
+  slot->ordinal = d->row_count - 1;
+  slot->row.len = 0;
+  size_t cell_count = zsv_cell_count(d->parser);
+  for (size_t i = 0; i < cell_count && !d->err; i++) {
+    struct zsv_cell c = zsv_get_cell(d->parser, i);
+    unsigned char quoted = c.quoted ? 1 : 0;
+    if (zsv_buff_append(&slot->row, &quoted, 1) || zsv_buff_append_cell(&slot->row, c.str, c.len))
+      d->err = 1;
+  }
+  if (d->err)
+    zsv_abort(d->parser);
+}
+
+static void zsv_sample_header(void *ctx) {
+  struct zsv_sample *d = ctx;
+  zsv_sample_write_row(d, d->parser);
+  if (d->seek) {
+    d->header_end = (zsv_file_pos)zsv_cum_scanned_length(d->parser);
+    zsv_abort(d->parser);
+  } else
+    zsv_set_row_handler(d->parser, zsv_sample_reservoir_row);
+}
+
+static int zsv_sample_slot_cmp(const void *a, const void *b) {
+  const struct zsv_sample_slot *x = a, *y = b;
+  return x->ordinal < y->ordinal ? -1 : x->ordinal > y->ordinal;
+}
+
+static void zsv_sample_reservoir_output(struct zsv_sample *d) {
+  size_t count = d->row_count < d->n ? (size_t)d->row_count : (size_t)d->n;
+  qsort(d->slots, count, sizeof(*d->slots), zsv_sample_slot_cmp);
+  for (size_t i = 0; i < count; i++) {
+    const unsigned char *s = d->slots[i].row.s, *end = s + d->slots[i].row.len;
+    for (char first = 1; s < end; first = 0) {
+      unsigned char quoted = *s;
+      uint32_t len = zsv_buff_u32(s + 1);
+      zsv_writer_cell(d->writer, first, s + 1 + sizeof(len), len, quoted);
+      s += 1 + sizeof(len) + len;
+    }
+  }
+}
+
+// parse d->in from the given offset (a row start) to the end, with reservoir sampling
+static int zsv_sample_reservoir_from(struct zsv_sample *d, zsv_file_pos from) {
+  if (fseeko(d->in, from, SEEK_SET) != 0)
+    return 1;
+  // parsing starts after the header row
+  struct zsv_opts opts;
+  zsv_chunk_opts(&opts, d->opts, NULL, NULL, d->in);
+  opts.row_handler = zsv_sample_reservoir_row;
+  opts.ctx = d;
+  if (!(d->parser = zsv_new(&opts)))
+    return 1;
+  while (!zsv_signal_interrupted && zsv_parse_more(d->parser) == zsv_status_ok)
+    ;
+  zsv_finish(d->parser);
+  zsv_delete(d->parser);
+  d->parser = NULL;
+  return d->err;
+}
+
+struct zsv_sample_mem {
+  const unsigned char *s;
+  size_t len;
+  size_t pos;
+};
+
+static size_t zsv_sample_mem_read(void *restrict buff, size_t n, size_t size, void *restrict ctx) {
+  struct zsv_sample_mem *m = ctx;
+  size_t bytes = n * size;
+  if (bytes > m->len - m->pos)
+    bytes = m->len - m->pos;
+  memcpy(buff, m->s + m->pos, bytes);
+  m->pos += bytes;
+  return bytes;
+}
+
+static void zsv_sample_kept_row(void *ctx) {
+  struct zsv_sample *d = ctx;
+  d->rows_parsed++;
+  if (d->write_rows)
+    zsv_sample_write_row(d, d->parser);
+}
+
+// parse the rows kept, which have been read into mem; count them, or write them
+static int zsv_sample_parse_kept(struct zsv_sample *d, const struct zsv_buff *mem, char write_rows) {
+  struct zsv_sample_mem m = {mem->s, mem->len, 0};
+  struct zsv_opts opts;
+  zsv_chunk_opts(&opts, d->opts, NULL, NULL, NULL);
+  opts.read = zsv_sample_mem_read;
+  opts.stream = &m;
+  opts.row_handler = zsv_sample_kept_row;
+  opts.ctx = d;
+  d->rows_parsed = 0;
+  d->write_rows = write_rows;
+  if (!(d->parser = zsv_new(&opts)))
+    return 1;
+  while (zsv_parse_more(d->parser) == zsv_status_ok)
+    ;
+  zsv_finish(d->parser);
+  zsv_delete(d->parser);
+  d->parser = NULL;
+  return 0;
+}
+
+static int zsv_sample_row_cmp(const void *a, const void *b) {
+  const struct zsv_sample_row *x = a, *y = b;
+  return x->start < y->start ? -1 : x->start > y->start;
+}
+
+static int zsv_sample_len_cmp(const void *a, const void *b) {
+  const zsv_file_pos *x = a, *y = b;
+  return *x < *y ? -1 : *x > *y;
+}
+
+// keep the row found by a draw with probability c / length, unless it was already kept.
+// Returns 1 if kept, 0 if not or -1 if out of memory
+static int zsv_sample_keep(struct zsv_sample *d, zsv_hash_set kept, struct zsv_sample_row row, double c) {
+  zsv_file_pos len = row.end - row.start;
+  if (len > c && zsv_sample_rand_unit(d) * (double)len >= c)
+    return 0;
+  char added = 0;
+  if (zsv_hash_set_add(kept, zsv_hash_mix((uint64_t)row.start), &row.start, sizeof(row.start), &added) ==
+      ZSV_HASH_SET_NONE)
+    return -1;
+  if (!added)
+    return 0;
+  d->rows[d->row_count_kept++] = row;
+  return 1;
+}
+
+/*
+ * sample rows of d->in between lower and upper by seeking. Returns 0 if the sample was
+ * output, 1 if the input should be read in full instead, or -1 on error
+ */
+static int zsv_sample_seek(struct zsv_sample *d, zsv_file_pos lower, zsv_file_pos upper) {
+  int only_crlf = 0;
+#ifndef ZSV_NO_ONLY_CRLF
+  only_crlf = d->opts->only_crlf_rowend;
+#endif
+  size_t pilot_count = d->n * 2 < ZSV_SAMPLE_MIN_PILOT ? ZSV_SAMPLE_MIN_PILOT : (size_t)d->n * 2;
+  uint64_t max_draws = d->n * 100 + 1000;
+
+  int rc = 1;
+  uint64_t draws = 0;
+  size_t pilot_found = 0;
+  struct zsv_sample_row *pilot = malloc(pilot_count * sizeof(*pilot));
+  zsv_file_pos *lengths = malloc(pilot_count * sizeof(*lengths));
+  zsv_hash_set kept = zsv_hash_set_new(0); // starts of the rows kept
+  struct zsv_buff mem = {0};
+  if (!pilot || !lengths || !kept)
+    rc = -1;
+
+  // pilot round: find the rows' lengths
+  double inverse_sum = 0;
+  for (; rc == 1 && draws < pilot_count; draws++) {
+    zsv_file_pos offset = lower + (zsv_file_pos)(zsv_sample_rand(d) % (uint64_t)(upper - lower));
+    struct zsv_sample_row row;
+    int found = zsv_find_row_bounds(d->in, offset, lower, upper, d->opts->delimiter, only_crlf, ZSV_SAMPLE_MAX_WINDOW,
+                                    &row.start, &row.end);
+    if (found < 0)
+      rc = -1;
+    else if (found == 0 && row.end > row.start) {
+      pilot[pilot_found] = row;
+      lengths[pilot_found++] = row.end - row.start;
+      inverse_sum += 1.0 / (double)(row.end - row.start);
+    }
+  }
+
+  double c = 0;
+  if (rc == 1 && pilot_found) {
+    // rows found are length-biased, so their harmonic mean length estimates the mean row length
+    double est_rows = (double)(upper - lower) * inverse_sum / (double)pilot_found;
+    if (est_rows >= (double)d->n * 4) {
+      qsort(lengths, pilot_found, sizeof(*lengths), zsv_sample_len_cmp);
+      c = (double)lengths[pilot_found / 20];
+    } else if (d->opts->verbose)
+      fprintf(stderr, "Estimated %.0f rows; reading all rows\n", est_rows);
+  }
+
+  if (c > 0 && !(d->rows = malloc(d->n * sizeof(*d->rows))))
+    rc = -1;
+  else if (c > 0) {
+    for (size_t i = 0; rc == 1 && i < pilot_found && d->row_count_kept < d->n; i++)
+      if (zsv_sample_keep(d, kept, pilot[i], c) < 0)
+        rc = -1;
+    for (; rc == 1 && d->row_count_kept < d->n && draws < max_draws; draws++) {
+      zsv_file_pos offset = lower + (zsv_file_pos)(zsv_sample_rand(d) % (uint64_t)(upper - lower));
+      struct zsv_sample_row row;
+      int found = zsv_find_row_bounds(d->in, offset, lower, upper, d->opts->delimiter, only_crlf,
+                                      ZSV_SAMPLE_MAX_WINDOW, &row.start, &row.end);
+      if (found < 0)
+        rc = -1;
+      else if (found == 0 && row.end > row.start && zsv_sample_keep(d, kept, row, c) < 0)
+        rc = -1;
+    }
+    if (d->opts->verbose)
+      fprintf(stderr, "Sampled %zu rows in %" PRIu64 " draws\n", d->row_count_kept, draws);
+  }
+
+  if (rc == 1 && c > 0 && d->row_count_kept == d->n) {
+    // read the rows kept in input order, and verify that they parse as that many rows
+    qsort(d->rows, d->row_count_kept, sizeof(*d->rows), zsv_sample_row_cmp);
+    for (size_t i = 0; rc == 1 && i < d->row_count_kept; i++) {
+      size_t len = (size_t)(d->rows[i].end - d->rows[i].start);
+      if (fseeko(d->in, d->rows[i].start, SEEK_SET) != 0 || zsv_buff_extend(&mem, len) ||
+          fread(mem.s + mem.len - len, 1, len, d->in) != len)
+        rc = -1;
+    }
+    if (rc == 1 && !zsv_sample_parse_kept(d, &mem, 0)) {
+      if (d->rows_parsed == d->row_count_kept)
+        rc = zsv_sample_parse_kept(d, &mem, 1) ? -1 : 0;
+      else if (d->opts->verbose)
+        fprintf(stderr, "Sampled rows did not parse as expected; reading all rows\n");
+    }
+  } else if (rc == 1 && c > 0 && d->opts->verbose)
+    fprintf(stderr, "Could not sample enough rows by seeking; reading all rows\n");
+
+  free(mem.s);
+  zsv_hash_set_delete(kept);
+  free(lengths);
+  free(pilot);
+  return rc;
+}
+
+int ZSV_MAIN_FUNC(ZSV_COMMAND)(int argc, const char *argv[], struct zsv_opts *opts,
+                               struct zsv_prop_handler *custom_prop_handler) {
+  if (argc < 2 || !strcmp(argv[1], "-h") || !strcmp(argv[1], "--help"))
+    return zsv_sample_usage();
+
+  int err = 0;
+  const char *input_path = NULL;
+  struct zsv_csv_writer_options writer_opts = zsv_writer_get_default_opts();
+  struct zsv_sample d = {0};
+  char have_seed = 0;
+  d.opts = opts;
+  writer_opts.stream = stdout;
+
+  for (int arg_i = 1; !err && arg_i < argc; arg_i++) {
+    const char *arg = argv[arg_i];
+    if (!strcmp(arg, "-n")) {
+      if (++arg_i >= argc || (d.n = (uint64_t)strtoull(argv[arg_i], NULL, 10)) == 0) {
+        fprintf(stderr, "%s option requires a positive number\n", arg);
+        err = 1;
+      }
+    } else if (!strcmp(arg, "--seed")) {
+      if (++arg_i >= argc) {
+        fprintf(stderr, "%s option requires a value\n", arg);
+        err = 1;
+      } else {
+        d.rng = (uint64_t)strtoull(argv[arg_i], NULL, 10);
+        have_seed = 1;
+      }
+    } else if (!strcmp(arg, "-b"))
+      writer_opts.with_bom = 1;
+    else if (!strcmp(arg, "-o") || !strcmp(arg, "--output")) {
+      if (++arg_i >= argc) {
+        fprintf(stderr, "%s option requires a filename\n", arg);
+        err = 1;
+      } else if (writer_opts.stream != stdout) {
+        fprintf(stderr, "Output may not be specified more than once\n");
+        err = 1;
+      } else if (!(writer_opts.stream = fopen(argv[arg_i], "wb"))) {
+        writer_opts.stream = stdout;
+        fprintf(stderr, "Unable to open file for writing: %s\n", argv[arg_i]);
+        err = 1;
+      }
+    } else if (zsv_arg_is_option(arg)) {
+      fprintf(stderr, "Unrecognized option: %s\n", arg);
+      err = 1;
+    } else if (input_path) {
+      fprintf(stderr, "Input may not be specified more than once\n");
+      err = 1;
+    } else
+      input_path = arg;
+  }
+  if (!err && !d.n) {
+    fprintf(stderr, "Please specify -n <count>\n");
+    err = 1;
+  }
+  if (!have_seed)
+    d.rng = (uint64_t)time(NULL) ^ ((uint64_t)clock() << 32);
+
+  zsv_file_pos size = 0;
+  if (!err) {
+    if (!input_path || !strcmp(input_path, "-")) {
+#ifdef NO_STDIN
+      fprintf(stderr, "Please specify an input file\n");
+      err = 1;
+#else
+      d.in = stdin;
+      input_path = NULL;
+#endif
+    } else if (!(d.in = fopen(input_path, "rb"))) {
+      fprintf(stderr, "Unable to open for reading: %s\n", input_path);
+      err = 1;
+    } else if (fseeko(d.in, 0, SEEK_END) == 0 && (size = ftello(d.in)) >= ZSV_SAMPLE_MIN_SEEK_BYTES &&
+               fseeko(d.in, 0, SEEK_SET) == 0)
+      d.seek = 1;
+    else if (fseeko(d.in, 0, SEEK_SET) != 0)
+      err = 1;
+  }
+
+  if (!err && !(d.writer = zsv_writer_new(&writer_opts)))
+    err = 1;
+
+  if (!err) {
+    // read the header; then, unless seeking, all rows
+    opts->stream = d.in;
+    opts->row_handler = zsv_sample_header;
+    opts->ctx = &d;
+    if (zsv_new_with_properties(opts, custom_prop_handler, input_path, &d.parser) != zsv_status_ok)
+      err = 1;
+    else {
+      while (!zsv_signal_interrupted && zsv_parse_more(d.parser) == zsv_status_ok)
+        ;
+      zsv_finish(d.parser);
+      zsv_delete(d.parser);
+      d.parser = NULL;
+    }
+  }
+
+  if (!err && d.seek && d.header_end > 0) {
+    // the header row's end offset is that of its last cell; skip its line end
+    char le[2];
+    size_t le_len = fseeko(d.in, d.header_end, SEEK_SET) ? 0 : fread(le, 1, sizeof(le), d.in);
+    if (le_len && le[0] == '\r' && le_len > 1 && le[1] == '\n')
+      d.header_end += 2;
+    else if (le_len && (le[0] == '\n' || le[0] == '\r'))
+      d.header_end++;
+
+    int rc = d.header_end < size ? zsv_sample_seek(&d, d.header_end, size) : 0;
+    if (rc < 0)
+      err = 1;
+    else if (rc > 0)
+      err = zsv_sample_reservoir_from(&d, d.header_end);
+  }
+  if (!err && d.row_count)
+    zsv_sample_reservoir_output(&d);
+
+  for (size_t i = 0; i < d.slot_capacity; i++)
+    free(d.slots[i].row.s);
+  free(d.slots);
+  free(d.rows);
+  if (d.writer)
+    zsv_writer_delete(d.writer);
+  if (writer_opts.stream && writer_opts.stream != stdout)
+    fclose(writer_opts.stream);
+  if (d.in && d.in != stdin)
+    fclose(d.in);
+  return err || d.err;
+}
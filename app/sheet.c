@@ -37,6 +37,7 @@
 #include "sheet/lexer.c"
 #include "sheet/procedure.c"
 #include "utils/column_range.h"
+#include "utils/chunk.h"
 
 /* TODO: move this somewhere else like common or utils */
 #define UNUSED(X) ((void)X)
@@ -107,8 +108,10 @@ static int zsvsheet_parse_compare(const char *spec, struct zsvsheet_compare_opts
 }
 
 #include "sheet/utf8-width.c"
+#include "sheet/scheduler.c"
 #include "sheet/ui_buffer.c"
 #include "sheet/index.c"
+#include "sheet/block_cache.c"
 #include "sheet/read-data.c"
 #include "sheet/key-bindings.c"
 
@@ -162,6 +165,26 @@ static size_t zsvsheet_cell_display_width(struct zsvsheet_ui_buffer *ui_buffer,
   return width < ZSVSHEET_CELL_DISPLAY_MIN_WIDTH ? ZSVSHEET_CELL_DISPLAY_MIN_WIDTH : width;
 }
 
+// zsvsheet_fit_buffer_window: if the buffer does not hold all the columns to display, move its
+// window of columns to hold them plus ZSVSHEET_SCREEN_BUFFER_WINDOW_MARGIN columns on each side.
+// All columns are held while columns are compared. Returns non-zero if the window moved, in
+// which case the buffer must be read again
+static int zsvsheet_fit_buffer_window(struct zsvsheet_ui_buffer *ub, struct zsvsheet_display_dimensions *ddims,
+                                      const struct zsvsheet_compare_opts *cmp) {
+  if (!zsvsheet_ui_buffer_has_data_file(ub)) // a buffer that can't be read again holds all columns
+    return 0;
+  if (cmp->active)
+    return zsvsheet_screen_buffer_set_window(ub->buffer, 0, 0);
+  size_t first, count = zsvsheet_screen_buffer_window(ub->buffer, &first);
+  size_t start_col = ub->buff_offset.col;
+  size_t visible = ddims->columns / zsvsheet_cell_display_width(ub, ddims) + 1;
+  if (count && start_col >= first && start_col + visible <= first + count)
+    return 0;
+  size_t margin = ZSVSHEET_SCREEN_BUFFER_WINDOW_MARGIN;
+  return zsvsheet_screen_buffer_set_window(ub->buffer, start_col > margin ? start_col - margin : 0,
+                                           visible + 2 * margin);
+}
+
 static void display_buffer_subtable(struct zsvsheet_ui_buffer *ui_buffer, size_t input_header_span,
                                     struct zsvsheet_display_dimensions *ddims, const struct zsvsheet_compare_opts *cmp);
 
@@ -413,6 +436,9 @@ static void zsvsheet_priv_set_status(const struct zsvsheet_display_dimensions *d
 #include "sheet/file.c"
 #include "sheet/usage.c"
 #include "sheet/transformation.c"
+#include "sheet/find.c"
+#include "sheet/row_view.c"
+#include "sheet/column_cache.c"
 
 struct zsvsheet_key_data *zsvsheet_key_handlers = NULL;
 struct zsvsheet_key_data **zsvsheet_next_key_handler = &zsvsheet_key_handlers;
@@ -596,7 +622,16 @@ static char zsvsheet_handle_find_next(struct zsvsheet_display_info *di, struct z
   zsvsheet_opts.find_exact = find_exact;
   zsvsheet_opts.found_rownum = 0;
   zsvsheet_opts.found_colnum = uib->cursor_col + uib->buff_offset.col;
-  if (zsvsheet_find_next(uib, &zsvsheet_opts, header_span, custom_prop_handler) > 0) {
+  enum zsvsheet_find_status fst = zsvsheet_find_next(uib, &zsvsheet_opts, header_span, ddims, custom_prop_handler);
+  if (fst == zsvsheet_find_status_cancelled) {
+    zsvsheet_priv_set_status(ddims, 1, "Find cancelled");
+    return 0;
+  }
+  if (zsvsheet_opts.found_rownum > 0) {
+    // a sequential find can pass the rows indexed so far; the found row exists, so position
+    // the buffer with it counted rather than from the end of the rows indexed
+    if (uib->dimensions.row_count <= zsvsheet_opts.found_rownum)
+      uib->dimensions.row_count = zsvsheet_opts.found_rownum + 1;
     *update_buffer = zsvsheet_goto_input_raw_row(uib, zsvsheet_opts.found_rownum, header_span, ddims, (size_t)-1);
 
     // move to zsvsheet_opts->found_colnum, skipping the "Row #" column when the buffer has one
@@ -638,7 +673,7 @@ static size_t zsvsheet_find_column_match(zsvsheet_screen_buffer_t buffer, size_t
 static zsvsheet_status zsvsheet_goto_column(struct zsvsheet_sheet_context *state, bool next) {
   struct zsvsheet_display_info *di = &state->display_info;
   struct zsvsheet_ui_buffer *current_ui_buffer = *(di->ui_buffers.current);
-  if (!zsvsheet_buffer_data_filename(current_ui_buffer))
+  if (!zsvsheet_ui_buffer_has_data_file(current_ui_buffer))
     return zsvsheet_status_ok;
 
   if (!next) {
@@ -820,7 +855,6 @@ static zsvsheet_status zsvsheet_buffer_new_static(struct zsvsheet_proc_context *
   struct zsvsheet_display_info *di = &state->display_info;
   struct zsvsheet_screen_buffer_opts bopts = {
     .no_rownum_column = 1,
-    .cell_buff_len = 64,
     .max_cell_len = 0,
     .rows = 256,
   };
@@ -891,8 +925,11 @@ out:
 #include "sheet/help.c"
 #include "sheet/errors.c"
 
+#include "sheet/pivot_agg.c"
 #include "sheet/pivot.c"
 #include "sheet/sqlfilter.c"
+#include "sheet/sort.c"
+#include "sheet/stats.c"
 #include "sheet/newline_handler.c"
 
 static zsvsheet_status zsvsheet_compare_handler(struct zsvsheet_proc_context *ctx) {
@@ -1087,6 +1124,9 @@ struct builtin_proc_desc {
   { zsvsheet_builtin_proc_newline,        "<Enter>",     "Follow hyperlink (if any)",                                       zsvsheet_newline_handler      },
   { zsvsheet_builtin_proc_pivot_cur_col,  "pivot",       "Group rows by the column under the cursor",                       zsvsheet_pivot_handler        },
   { zsvsheet_builtin_proc_pivot_expr,     "pivotexpr",   "Group rows with group-by SQL expression",                         zsvsheet_pivot_handler        },
+  { zsvsheet_builtin_proc_sort,           "sort",        "Sort rows by the column under the cursor",                        zsvsheet_sort_handler         },
+  { zsvsheet_builtin_proc_sort_desc,      "sortdesc",    "Sort rows by the column under the cursor, descending",            zsvsheet_sort_handler         },
+  { zsvsheet_builtin_proc_stats,          "stats",       "Show statistics of each column",                                  zsvsheet_stats_handler        },
   { zsvsheet_builtin_proc_errors,         "errors",      "Show errors (if any)",                                            zsvsheet_errors_handler       },
   { zsvsheet_builtin_proc_errors_clear,   "errors-clear","Clear any/all errors",                                            zsvsheet_errors_handler       },
   { zsvsheet_builtin_proc_compare,       "compare",     "Highlight differences between two column ranges",                  zsvsheet_compare_handler      },
@@ -1106,16 +1146,38 @@ static void zsvsheet_check_buffer_worker_updates(struct zsvsheet_ui_buffer *ub,
                                                  struct zsvsheet_display_dimensions *display_dims,
                                                  struct zsvsheet_sheet_context *handler_state) {
   pthread_mutex_lock(&ub->mutex);
-  if (ub->status) {
-    if (display_dims)
+  if (ub->status && display_dims) {
+    uint64_t done, total;
+    if (ub->status_is_index_placeholder && ub->ixopts && ub->index_job &&
+             !zsvsheet_job_progress(ub->index_job, &done, &total) && total)
+      zsvsheet_priv_set_status(display_dims, 1, "%s(building index %d%%) ",
+                               ub->ixopts->old_ui_status ? ub->ixopts->old_ui_status : "", (int)(done * 100 / total));
+    else
       zsvsheet_priv_set_status(display_dims, 1, "%s", ub->status);
   }
-  if (ub->index_ready && ub->dimensions.row_count != ub->index->row_count + 1) {
+  int data_changed = zsvsheet_ui_buffer_swap_pending_data(ub);
+  if (ub->index_ready && (data_changed || ub->dimensions.row_count != ub->index->row_count + 1)) {
+    char grew = ub->dimensions.row_count < ub->index->row_count + 1;
     ub->dimensions.row_count = ub->index->row_count + 1;
+    if (handler_state) {
+      handler_state->display_info.update_buffer = true;
+      // a find that passes the rows indexed so far positions the buffer as if the row found
+      // were the last; now that the rows after it are counted, position it to show them
+      if (grew && display_dims)
+        zsvsheet_goto_input_raw_row(ub, zsvsheet_get_input_raw_row(&ub->input_offset, &ub->buff_offset, ub->cursor_row),
+                                    handler_state->display_info.header_span, display_dims, ub->cursor_row);
+    }
+  }
+  if (ub->row_view && ub->dimensions.row_count != ub->row_view->row_count + 1) { // rows are still being selected
+    ub->dimensions.row_count = ub->row_view->row_count + 1;
     if (handler_state)
       handler_state->display_info.update_buffer = true;
   }
   pthread_mutex_unlock(&ub->mutex);
+  if (data_changed) { // blocks read from the old file are stale
+    zsvsheet_block_cache_delete(ub->block_cache);
+    ub->block_cache = NULL;
+  }
 }
 
 int ZSV_MAIN_FUNC(ZSV_COMMAND)(int argc, const char *argv[], struct zsv_opts *optsp,
@@ -1246,6 +1308,11 @@ int ZSV_MAIN_FUNC(ZSV_COMMAND)(int argc, const char *argv[], struct zsv_opts *op
     .compare = compare_opts,
   };
 
+  if (zsvsheet_fit_buffer_window(current_ui_buffer, &display_dims, &handler_state.compare)) {
+    struct zsvsheet_ui_buffer *ub = current_ui_buffer;
+    struct zsvsheet_opts zsvsheet_opts = {0};
+    read_data(&ub, NULL, ub->input_offset.row, ub->input_offset.col, header_span, &zsvsheet_opts, custom_prop_handler);
+  }
   if (handler_state.compare.active)
     zsvsheet_apply_compare_attrs(current_ui_buffer, &handler_state.compare);
 
@@ -1287,8 +1354,10 @@ int ZSV_MAIN_FUNC(ZSV_COMMAND)(int argc, const char *argv[], struct zsv_opts *op
 
     struct zsvsheet_ui_buffer *ub = current_ui_buffer;
     zsvsheet_check_buffer_worker_updates(ub, &display_dims, &handler_state);
+    if (zsvsheet_fit_buffer_window(ub, &display_dims, &handler_state.compare))
+      handler_state.display_info.update_buffer = true;
 
-    if (handler_state.display_info.update_buffer && zsvsheet_buffer_data_filename(ub)) {
+    if (handler_state.display_info.update_buffer && zsvsheet_ui_buffer_has_data_file(ub)) {
       struct zsvsheet_opts zsvsheet_opts = {0};
       if (read_data(&ub, NULL, current_ui_buffer->input_offset.row, current_ui_buffer->input_offset.col, header_span,
                     &zsvsheet_opts, custom_prop_handler)) {
@@ -1307,6 +1376,7 @@ int ZSV_MAIN_FUNC(ZSV_COMMAND)(int argc, const char *argv[], struct zsv_opts *op
   free(handler_state.goto_column);
 zsvsheet_exit:
   zsvsheet_ui_buffers_delete(current_ui_buffer);
+  zsvsheet_scheduler_shutdown();
   zsvsheet_key_handlers_delete(&zsvsheet_key_handlers, &zsvsheet_next_key_handler);
   return err;
 }
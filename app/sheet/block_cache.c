@@ -0,0 +1,248 @@
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <pthread.h>
+#include <zsv.h>
+
+#include "../utils/index.h"
+#include "block_cache.h"
+
+static void zsvsheet_block_delete(struct zsvsheet_block *b) {
+  if (b) {
+    free(b->data);
+    free(b);
+  }
+}
+
+static int zsvsheet_block_append(struct zsvsheet_block *b, const void *data, size_t len) {
+  if (b->data_len + len > b->data_capacity) {
+    size_t capacity = b->data_capacity ? b->data_capacity * 2 : 64 * 1024;
+    while (capacity < b->data_len + len)
+      capacity *= 2;
+    unsigned char *p = realloc(b->data, capacity);
+    if (!p)
+      return -1;
+    b->data = p;
+    b->data_capacity = capacity;
+  }
+  memcpy(b->data + b->data_len, data, len);
+  b->data_len += len;
+  return 0;
+}
+
+static int zsvsheet_block_append_row(struct zsvsheet_block *b, zsv_parser parser) {
+  uint32_t cell_count = (uint32_t)zsv_cell_count(parser);
+  if (zsvsheet_block_append(b, &cell_count, sizeof(cell_count)))
+    return -1;
+  for (uint32_t i = 0; i < cell_count; i++) {
+    struct zsv_cell c = zsv_get_cell(parser, i);
+    uint32_t len = (uint32_t)c.len;
+    if (zsvsheet_block_append(b, &len, sizeof(len)) || (len && zsvsheet_block_append(b, c.str, len)))
+      return -1;
+  }
+  b->row_count++;
+  return 0;
+}
+
+// zsvsheet_block_load: read a block from the data file, without the cache lock held
+static struct zsvsheet_block *zsvsheet_block_load(struct zsvsheet_block_cache *cache, FILE **fpp, size_t block_no) {
+  if (!*fpp && !(*fpp = fopen(cache->filename, "rb")))
+    return NULL;
+
+  struct zsv_opts opts = cache->opts;
+  opts.stream = *fpp;
+  struct zsvsheet_ui_buffer *uib = cache->uib;
+  enum zsv_index_status zst = zsv_index_status_error;
+  pthread_mutex_lock(&uib->mutex);
+  if (uib->index_ready && uib->index)
+    zst = zsv_index_seek_row(uib->index, &opts, (uint64_t)block_no << ZSV_INDEX_ROW_SHIFT);
+  pthread_mutex_unlock(&uib->mutex);
+  if (zst != zsv_index_status_ok)
+    return NULL;
+
+  struct zsvsheet_block *b = calloc(1, sizeof(*b));
+  zsv_parser parser = b ? zsv_new(&opts) : NULL;
+  if (!parser) {
+    free(b);
+    return NULL;
+  }
+  b->block_no = block_no;
+  enum zsv_status stat = zsv_status_ok;
+  while (b->row_count < ZSV_INDEX_ROW_N && (stat = zsv_next_row(parser)) == zsv_status_row) {
+    if (zsvsheet_block_append_row(b, parser)) {
+      stat = zsv_status_memory;
+      break;
+    }
+  }
+  zsv_delete(parser);
+  if (b->row_count < ZSV_INDEX_ROW_N && stat != zsv_status_done && stat != zsv_status_no_more_input) {
+    zsvsheet_block_delete(b);
+    return NULL;
+  }
+  return b;
+}
+
+static struct zsvsheet_block *zsvsheet_block_cache_find(struct zsvsheet_block_cache *cache, size_t block_no) {
+  for (struct zsvsheet_block *b = cache->lru_head; b; b = b->lru_next)
+    if (b->block_no == block_no)
+      return b;
+  return NULL;
+}
+
+static void zsvsheet_block_cache_unlink(struct zsvsheet_block_cache *cache, struct zsvsheet_block *b) {
+  if (b->lru_prev)
+    b->lru_prev->lru_next = b->lru_next;
+  else
+    cache->lru_head = b->lru_next;
+  if (b->lru_next)
+    b->lru_next->lru_prev = b->lru_prev;
+  else
+    cache->lru_tail = b->lru_prev;
+  b->lru_prev = b->lru_next = NULL;
+}
+
+static void zsvsheet_block_cache_push(struct zsvsheet_block_cache *cache, struct zsvsheet_block *b) {
+  b->lru_next = cache->lru_head;
+  if (cache->lru_head)
+    cache->lru_head->lru_prev = b;
+  cache->lru_head = b;
+  if (!cache->lru_tail)
+    cache->lru_tail = b;
+}
+
+// zsvsheet_block_cache_insert: add a loaded block as the most recently used, evicting the least
+// recently used while over budget. If another thread added the block first, keep that one
+static struct zsvsheet_block *zsvsheet_block_cache_insert(struct zsvsheet_block_cache *cache,
+                                                          struct zsvsheet_block *b) {
+  struct zsvsheet_block *existing = zsvsheet_block_cache_find(cache, b->block_no);
+  if (existing) {
+    zsvsheet_block_delete(b);
+    return existing;
+  }
+  zsvsheet_block_cache_push(cache, b);
+  cache->block_count++;
+  cache->bytes += b->data_capacity;
+  while (cache->block_count > 1 &&
+         (cache->block_count > ZSVSHEET_BLOCK_CACHE_MAX_BLOCKS || cache->bytes > ZSVSHEET_BLOCK_CACHE_MAX_BYTES)) {
+    struct zsvsheet_block *evict = cache->lru_tail;
+    zsvsheet_block_cache_unlink(cache, evict);
+    cache->block_count--;
+    cache->bytes -= evict->data_capacity;
+    zsvsheet_block_delete(evict);
+  }
+  return b;
+}
+
+static void zsvsheet_block_cache_prefetch_run(struct zsvsheet_job *job, void *arg) {
+  struct zsvsheet_block_cache *cache = arg;
+  pthread_mutex_lock(&cache->mutex);
+  while (cache->want_count && !zsvsheet_job_cancelled(job)) {
+    size_t block_no = cache->want[0];
+    memmove(cache->want, cache->want + 1, --cache->want_count * sizeof(*cache->want));
+    if (zsvsheet_block_cache_find(cache, block_no))
+      continue;
+    cache->loading = block_no;
+    cache->loading_active = 1;
+    pthread_mutex_unlock(&cache->mutex);
+
+    struct zsvsheet_block *b = zsvsheet_block_load(cache, &cache->prefetch_fp, block_no);
+
+    pthread_mutex_lock(&cache->mutex);
+    cache->loading_active = 0;
+    if (b)
+      zsvsheet_block_cache_insert(cache, b);
+    pthread_cond_broadcast(&cache->cond);
+  }
+  cache->prefetching = 0;
+  pthread_mutex_unlock(&cache->mutex);
+}
+
+struct zsvsheet_block_cache *zsvsheet_block_cache_new(struct zsvsheet_ui_buffer *uib, const char *filename,
+                                                      const struct zsv_opts *opts) {
+  struct zsvsheet_block_cache *cache = calloc(1, sizeof(*cache));
+  if (cache) {
+    if (!(cache->filename = strdup(filename))) {
+      free(cache);
+      return NULL;
+    }
+    cache->uib = uib;
+    cache->opts = *opts;
+    cache->opts.stream = NULL;
+    pthread_mutex_init(&cache->mutex, NULL);
+    pthread_cond_init(&cache->cond, NULL);
+  }
+  return cache;
+}
+
+struct zsvsheet_block *zsvsheet_block_cache_get(struct zsvsheet_block_cache *cache, size_t block_no) {
+  pthread_mutex_lock(&cache->mutex);
+  struct zsvsheet_block *b;
+  while (!(b = zsvsheet_block_cache_find(cache, block_no)) && cache->loading_active && cache->loading == block_no)
+    pthread_cond_wait(&cache->cond, &cache->mutex); // the prefetch job is already reading it
+  if (b) {
+    zsvsheet_block_cache_unlink(cache, b);
+    zsvsheet_block_cache_push(cache, b);
+    return b;
+  }
+  pthread_mutex_unlock(&cache->mutex);
+
+  if (!(b = zsvsheet_block_load(cache, &cache->fp, block_no)))
+    return NULL;
+  pthread_mutex_lock(&cache->mutex);
+  return zsvsheet_block_cache_insert(cache, b);
+}
+
+void zsvsheet_block_cache_release(struct zsvsheet_block_cache *cache) {
+  pthread_mutex_unlock(&cache->mutex);
+}
+
+void zsvsheet_block_cache_prefetch(struct zsvsheet_block_cache *cache, size_t start_row, size_t end_row) {
+  size_t first = start_row >> ZSV_INDEX_ROW_SHIFT;
+  size_t last = end_row >> ZSV_INDEX_ROW_SHIFT;
+  pthread_mutex_lock(&cache->mutex);
+  char forward = start_row > cache->last_start_row;
+  char backward = start_row < cache->last_start_row;
+  cache->last_start_row = start_row;
+  cache->want_count = 0;
+  for (size_t i = 1; i <= ZSVSHEET_BLOCK_CACHE_PREFETCH; i++) {
+    if (!backward)
+      cache->want[cache->want_count++] = last + i;
+    if (!forward && first >= i)
+      cache->want[cache->want_count++] = first - i;
+  }
+  struct zsvsheet_job *finished = NULL;
+  if (cache->want_count && !cache->prefetching) {
+    // the last job, if any, has found want empty and is finishing; start another
+    finished = cache->prefetch_job;
+    if ((cache->prefetch_job =
+           zsvsheet_job_submit(zsvsheet_job_priority_prefetch, zsvsheet_block_cache_prefetch_run, cache)))
+      cache->prefetching = 1;
+  }
+  pthread_mutex_unlock(&cache->mutex);
+  if (finished) {
+    zsvsheet_job_wait(finished); // it no longer needs the cache mutex, so will not be long
+    zsvsheet_job_release(finished);
+  }
+}
+
+void zsvsheet_block_cache_delete(struct zsvsheet_block_cache *cache) {
+  if (cache) {
+    if (cache->prefetch_job) {
+      zsvsheet_job_cancel(cache->prefetch_job);
+      zsvsheet_job_wait(cache->prefetch_job);
+      zsvsheet_job_release(cache->prefetch_job);
+    }
+    for (struct zsvsheet_block *b = cache->lru_head, *next; b; b = next) {
+      next = b->lru_next;
+      zsvsheet_block_delete(b);
+    }
+    if (cache->fp)
+      fclose(cache->fp);
+    if (cache->prefetch_fp)
+      fclose(cache->prefetch_fp);
+    pthread_cond_destroy(&cache->cond);
+    pthread_mutex_destroy(&cache->mutex);
+    free(cache->filename);
+    free(cache);
+  }
+}
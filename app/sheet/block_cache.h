@@ -0,0 +1,79 @@
+#ifndef SHEET_BLOCK_CACHE_H
+#define SHEET_BLOCK_CACHE_H
+
+#include <pthread.h>
+
+#include "zsv.h"
+#include "../utils/index.h"
+#include "scheduler.h"
+
+/*
+ * Cache of parsed row blocks for a buffer's data file, so that scrolling back to rows
+ * already viewed does not read and parse the file again
+ *
+ * A block holds the ZSV_INDEX_ROW_N data rows that start at a row stored in the buffer's
+ * row index, so that loading one takes a single seek. Blocks are kept in least-recently
+ * used order, up to ZSVSHEET_BLOCK_CACHE_MAX_BLOCKS blocks or
+ * ZSVSHEET_BLOCK_CACHE_MAX_BYTES bytes. A job of prefetch priority, with its own file
+ * handle, loads the blocks next to the viewport in the direction of scrolling
+ */
+
+#define ZSVSHEET_BLOCK_CACHE_MAX_BLOCKS 64
+#define ZSVSHEET_BLOCK_CACHE_MAX_BYTES (128 * 1024 * 1024)
+#define ZSVSHEET_BLOCK_CACHE_PREFETCH 2 // blocks to prefetch ahead of the viewport
+
+struct zsvsheet_ui_buffer;
+
+struct zsvsheet_block {
+  size_t block_no;
+  size_t row_count; // < ZSV_INDEX_ROW_N only for the last block of the file
+  // each row is [u32 cell count], then for each cell [u32 length][bytes]
+  unsigned char *data;
+  size_t data_len;
+  size_t data_capacity;
+  struct zsvsheet_block *lru_prev, *lru_next;
+};
+
+struct zsvsheet_block_cache {
+  struct zsvsheet_ui_buffer *uib; // owner; its mutex guards the row index
+  char *filename;
+  struct zsv_opts opts; // parser options, as merged with saved properties
+  FILE *fp;             // reader for blocks loaded on demand
+  FILE *prefetch_fp;    // reader for the prefetch job
+
+  pthread_mutex_t mutex;                      // guards everything below
+  pthread_cond_t cond;                        // signals a loaded block
+  struct zsvsheet_job *prefetch_job;          // loads the blocks in want; finishes when there are none
+  struct zsvsheet_block *lru_head, *lru_tail; // most recently used first
+  size_t block_count;
+  size_t bytes;
+  size_t want[2 * ZSVSHEET_BLOCK_CACHE_PREFETCH]; // blocks to prefetch, in order
+  size_t want_count;
+  size_t loading; // block being loaded by the prefetch job, if loading_active
+  size_t last_start_row;
+  unsigned char loading_active : 1;
+  unsigned char prefetching : 1; // prefetch_job has not yet found want empty
+  unsigned char _ : 6;
+};
+
+struct zsvsheet_block_cache *zsvsheet_block_cache_new(struct zsvsheet_ui_buffer *uib, const char *filename,
+                                                      const struct zsv_opts *opts);
+
+/**
+ * Get a block, loading it if needed. On success the cache is locked and the block may
+ * be read until zsvsheet_block_cache_release() is called. Returns NULL if the block
+ * is not yet covered by the row index or could not be read
+ */
+struct zsvsheet_block *zsvsheet_block_cache_get(struct zsvsheet_block_cache *cache, size_t block_no);
+
+void zsvsheet_block_cache_release(struct zsvsheet_block_cache *cache);
+
+/**
+ * Request prefetch of the blocks around the rows now displayed, in the direction of
+ * scrolling
+ */
+void zsvsheet_block_cache_prefetch(struct zsvsheet_block_cache *cache, size_t start_row, size_t end_row);
+
+void zsvsheet_block_cache_delete(struct zsvsheet_block_cache *cache);
+
+#endif
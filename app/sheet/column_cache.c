@@ -0,0 +1,103 @@
+/*
+ * Column caches for operations on one column of a large file
+ *
+ * A column cache (see ../utils/column_cache.h) holds one column's distinct values and,
+ * for each row, the number of its value and its offset in the file. Filtering or pivoting
+ * on a column then reads only that column's values, and the rows that are selected are
+ * read directly from their offsets. A file's column cache is built the first time the
+ * column is filtered or pivoted, if the file is at least ZSVSHEET_COLUMN_CACHE_MIN_FILE_SIZE
+ * bytes, and is reused until the file or the options it is parsed with change
+ */
+
+#include <sys/stat.h>
+
+#define ZSVSHEET_COLUMN_CACHE_MIN_FILE_SIZE ((off_t)32 * 1024 * 1024)
+
+static int zsvsheet_column_cache_large(const char *filename) {
+  struct stat st;
+  return !stat(filename, &st) && st.st_size >= ZSVSHEET_COLUMN_CACHE_MIN_FILE_SIZE;
+}
+
+// zsvsheet_column_cache_usable: whether a column cache can be used for the buffer's data file:
+// it must be large and as opened (not the output of a transformation, nor the rows of a view
+// of only some of them), and its rows must be readable from their offsets. If so, row_opts is
+// set to the options with which to parse them
+static int zsvsheet_column_cache_usable(struct zsvsheet_ui_buffer *uib, struct zsv_prop_handler *custom_prop_handler,
+                                        struct zsv_opts *row_opts) {
+  if (uib->data_filename || uib->temp_filename || !uib->filename || (uib->row_view && uib->row_view->subset) ||
+      !zsvsheet_column_cache_large(uib->filename))
+    return 0;
+  return !zsvsheet_ui_buffer_seek_opts(uib, custom_prop_handler, row_opts);
+}
+
+struct zsvsheet_column_cache_progress {
+  struct zsvsheet_display_dimensions *ddims;
+  const char *action;
+  uint64_t file_size;
+};
+
+static int zsvsheet_column_cache_on_progress(void *ctx, uint64_t bytes_read) {
+  struct zsvsheet_column_cache_progress *p = ctx;
+  zsvsheet_priv_set_status(p->ddims, 1, "%s column... %" PRIu64 "%% (ESC to cancel)", p->action,
+                           p->file_size ? bytes_read * 100 / p->file_size : 0);
+  refresh();
+  return getch() == 27; // ESC
+}
+
+// zsvsheet_column_cache_read: read the given column of the given file, saving its cache if
+// save is set, else holding it only in memory
+static zsv_column_cache zsvsheet_column_cache_read(const char *filename, const struct zsv_opts *zopts,
+                                                   struct zsvsheet_display_dimensions *ddims,
+                                                   struct zsv_prop_handler *custom_prop_handler, size_t col,
+                                                   char save) {
+  struct stat st;
+  struct zsvsheet_column_cache_progress p = {ddims, save ? "Caching" : "Reading",
+                                             stat(filename, &st) ? 0 : (uint64_t)st.st_size};
+  struct zsv_opts opts = *zopts;
+  opts.errprintf = zsv_no_printf;
+  opts.errf = NULL;
+  zsv_column_cache cc = NULL;
+  enum zsv_column_cache_status stat;
+  cbreak(); // leave half-delay mode, in which getch() would wait even with nodelay()
+  nodelay(stdscr, TRUE);
+  if (!save)
+    cc = zsv_column_cache_new(filename, &opts, custom_prop_handler, col, zsvsheet_column_cache_on_progress, &p, &stat);
+  else if (zsv_column_cache_build(filename, &opts, custom_prop_handler, col, zsvsheet_column_cache_on_progress, &p) ==
+           zsv_column_cache_status_ok)
+    cc = zsv_column_cache_open(filename, &opts, custom_prop_handler, col);
+  nodelay(stdscr, FALSE);
+  halfdelay(2);
+  zsvsheet_priv_set_status(ddims, 1, "");
+  return cc;
+}
+
+// zsvsheet_column_cache_get: get the cache of the given (0-based) column of the buffer's file,
+// building it first if there is none. The file of a row view is the file whose rows it shows.
+// If the cache is not usable but any_size is set, the column is read into memory instead.
+// Returns NULL if neither can be used, or if reading the column failed or was cancelled
+static zsv_column_cache zsvsheet_column_cache_get(struct zsvsheet_ui_buffer *uib,
+                                                  struct zsvsheet_display_dimensions *ddims,
+                                                  struct zsv_prop_handler *custom_prop_handler, size_t col,
+                                                  struct zsv_opts *row_opts, char any_size) {
+  struct zsvsheet_row_view *v = uib->row_view;
+  const char *filename;
+  const struct zsv_opts *zopts;
+  char usable;
+  if (v) {
+    filename = v->filename;
+    zopts = &v->opts;
+    *row_opts = v->row_opts;
+    usable = !uib->temp_filename && zsvsheet_column_cache_large(filename);
+  } else {
+    filename = uib->data_filename ? uib->data_filename : uib->filename;
+    zopts = &uib->zsv_opts;
+    usable = zsvsheet_column_cache_usable(uib, custom_prop_handler, row_opts);
+    if (!usable && (!any_size || zsvsheet_ui_buffer_seek_opts(uib, custom_prop_handler, row_opts)))
+      return NULL;
+  }
+  if (usable) {
+    zsv_column_cache cc = zsv_column_cache_open(filename, zopts, custom_prop_handler, col);
+    return cc ? cc : zsvsheet_column_cache_read(filename, zopts, ddims, custom_prop_handler, col, 1);
+  }
+  return any_size ? zsvsheet_column_cache_read(filename, zopts, ddims, custom_prop_handler, col, 0) : NULL;
+}
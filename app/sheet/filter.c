@@ -44,6 +44,43 @@ static int zsvsheet_nullify_row_buff(zsv_parser z) {
   return have_overwrite;
 }
 
+// zsvsheet_filter_matches: whether the text contains the filter, or matches it if it is a regex
+static int zsvsheet_filter_matches(struct filtered_file_ctx *ctx, const unsigned char *s, size_t len) {
+#ifdef HAVE_PCRE2_8
+  if (ctx->regex)
+    return zsv_pcre2_8_match(ctx->regex, s, len);
+#endif
+  return memmem(s, len, ctx->filter, ctx->filter_len) != NULL;
+}
+
+// zsvsheet_filter_row_passes: whether the parser's current row passes the filter. If col_plus_1 is
+// set, only the cell with that (1-based) index is tested. An empty cell or row passes
+static int zsvsheet_filter_row_passes(struct filtered_file_ctx *ctx, zsv_parser parser, size_t col_plus_1) {
+  size_t col_count = zsv_cell_count(parser);
+  size_t start_ix = 0;
+  if (col_plus_1) {
+    col_count = col_plus_1;
+    start_ix = col_plus_1 - 1;
+  }
+  int have_overwrite = col_plus_1 ? 0 : zsvsheet_nullify_row_buff(parser);
+  if (have_overwrite || col_plus_1) {
+    // we need to do this cell by cell
+    for (unsigned int i = start_ix; i < col_count; i++) {
+      struct zsv_cell cell = zsv_get_cell(parser, i);
+      if (cell.len && !zsvsheet_filter_matches(ctx, cell.str, cell.len))
+        return 0;
+    }
+  } else {
+    struct zsv_cell first_cell = zsv_get_cell(parser, 0);
+    struct zsv_cell last_cell = zsv_get_cell(parser, col_count - 1);
+    const unsigned char *start = first_cell.str;
+    const unsigned char *end = last_cell.str + last_cell.len;
+    if (end > start && !zsvsheet_filter_matches(ctx, start, end - start))
+      return 0;
+  }
+  return 1;
+}
+
 static void zsvsheet_save_filtered_file_row_handler(zsvsheet_transformation trn) {
   struct filtered_file_ctx *ctx = zsvsheet_transformation_user_context(trn);
   zsv_parser parser = zsvsheet_transformation_parser(trn);
@@ -55,47 +92,8 @@ static void zsvsheet_save_filtered_file_row_handler(zsvsheet_transformation trn)
   if (col_count == 0)
     return;
   if (ctx->seen_header) {
-    size_t start_ix = 0;
-    if (single_row_ix_plus_1) {
-      col_count = single_row_ix_plus_1;
-      start_ix = single_row_ix_plus_1 - 1;
-      if (ctx->has_row_num)
-        col_count++, start_ix++;
-    }
-    int have_overwrite = single_row_ix_plus_1 ? 0 : zsvsheet_nullify_row_buff(parser);
-    if (have_overwrite || single_row_ix_plus_1) {
-      // we need to do this cell by cell
-      for (unsigned int i = start_ix; i < col_count; i++) {
-        struct zsv_cell cell = zsv_get_cell(parser, i);
-        const unsigned char *start = cell.str;
-        const unsigned char *end = cell.str + cell.len;
-        if (cell.len) {
-#ifdef HAVE_PCRE2_8
-          if (ctx->regex) {
-            if (!zsv_pcre2_8_match(ctx->regex, start, end - start))
-              return; // no match: don't save this row
-          } else
-#endif
-            if (!memmem(start, end - start, ctx->filter, ctx->filter_len))
-            return; // no match: don't save this row
-        }
-      }
-    } else {
-      struct zsv_cell first_cell = zsv_get_cell(parser, 0);
-      struct zsv_cell last_cell = zsv_get_cell(parser, col_count - 1);
-      const unsigned char *start = first_cell.str;
-      const unsigned char *end = last_cell.str + last_cell.len;
-      if (end > start) {
-#ifdef HAVE_PCRE2_8
-        if (ctx->regex) {
-          if (!zsv_pcre2_8_match(ctx->regex, start, end - start))
-            return; // no match: don't save this row
-        } else
-#endif
-          if (!memmem(start, end - start, ctx->filter, ctx->filter_len))
-          return; // no match: don't save this row
-      }
-    }
+    if (!zsvsheet_filter_row_passes(ctx, parser, single_row_ix_plus_1 ? single_row_ix_plus_1 + ctx->has_row_num : 0))
+      return; // no match: don't save this row
   } else {
     struct zsv_cell first_cell = zsv_get_cell(parser, 0);
     ctx->seen_header = 1;
@@ -146,8 +144,124 @@ static void zsvsheet_filter_file_on_done(zsvsheet_transformation trn) {
   free(ctx->filter);
 }
 
+struct filtered_rows_ctx {
+  struct filtered_file_ctx filter;
+  size_t col_plus_1; // 1-based column of the viewed file to test, or 0 to test every cell
+};
+
+static int zsvsheet_filter_keep_row(void *ctx, zsv_parser parser, const struct zsv_key_index_match *row) {
+  (void)(row);
+  struct filtered_rows_ctx *c = ctx;
+  return zsv_cell_count(parser) > 0 && zsvsheet_filter_row_passes(&c->filter, parser, c->col_plus_1);
+}
+
+static void zsvsheet_filter_rows_on_done(void *ctx, struct zsvsheet_ui_buffer *uib, uint64_t row_count) {
+  struct filtered_rows_ctx *c = ctx;
+  char status[64];
+  snprintf(status, sizeof(status), "(%" PRIu64 " filtered rows) ", row_count);
+  zsvsheet_ui_buffer_set_status(uib, status);
+#ifdef HAVE_PCRE2_8
+  zsv_pcre2_8_delete(c->filter.regex);
+#endif
+  free(c->filter.filter);
+}
+
+// zsvsheet_filter_column_cache: filter on one column of a large file using its column cache, testing each
+// distinct value once. If the buffer is a row view, only the rows it shows are filtered. Returns non-zero
+// if the column cache can't be used, else sets *zst
+static int zsvsheet_filter_column_cache(zsvsheet_proc_context_t proc_ctx, const char *row_filter, size_t col,
+                                        enum zsvsheet_status *zst) {
+  struct zsvsheet_sheet_context *state = (struct zsvsheet_sheet_context *)proc_ctx->subcommand_context;
+  struct zsvsheet_ui_buffer *uib = zsvsheet_buffer_current(proc_ctx);
+  struct zsvsheet_row_view *from = uib->row_view;
+  struct zsv_opts row_opts;
+  zsv_column_cache cc =
+    zsvsheet_column_cache_get(uib, state->display_info.dimensions, state->custom_prop_handler, col, &row_opts, 0);
+  if (!cc)
+    return 1;
+
+  size_t filter_len = strlen(row_filter);
+#ifdef HAVE_PCRE2_8
+  regex_handle_t *regex = *row_filter == '/' && row_filter[1] ? zsv_pcre2_8_new(row_filter + 1, 0) : NULL;
+#endif
+  size_t value_count = zsv_column_cache_value_count(cc);
+  uint64_t cc_row_count = zsv_column_cache_row_count(cc);
+  uint64_t row_count = from ? from->row_count : cc_row_count;
+  char *passes = malloc(value_count ? value_count : 1);
+  struct zsv_key_index_match *rows = NULL;
+  size_t passed = 0;
+  int err = !passes;
+  for (size_t i = 0; i < value_count && !err; i++) {
+    size_t len;
+    const unsigned char *value = zsv_column_cache_value(cc, i, &len);
+    // as in zsvsheet_save_filtered_file_row_handler(), an empty cell passes
+#ifdef HAVE_PCRE2_8
+    if (regex)
+      passes[i] = !len || zsv_pcre2_8_match(regex, value, len);
+    else
+#endif
+      passes[i] = !len || memmem(value, len, row_filter, filter_len) != NULL;
+  }
+  // count, then collect, the rows that pass
+  const uint32_t *row_values = zsv_column_cache_row_values(cc);
+  for (int collect = 0; collect < 2 && !err; collect++) {
+    if (collect && !(rows = malloc((passed ? passed : 1) * sizeof(*rows))))
+      err = 1;
+    passed = 0;
+    for (uint64_t i = 0; !err && i < row_count; i++) {
+      struct zsv_key_index_match row;
+      if (from)
+        zsvsheet_row_view_get(from, i, &row);
+      else {
+        row.row = i + 1;
+        zsv_column_cache_row(cc, i, &row.offset, &row.len);
+      }
+      if (!row.row || row.row > cc_row_count)
+        err = 1;
+      else if (passes[row_values[row.row - 1]]) {
+        if (collect)
+          rows[passed] = row;
+        passed++;
+      }
+    }
+  }
+  zsv_column_cache_close(cc);
+  free(passes);
+#ifdef HAVE_PCRE2_8
+  zsv_pcre2_8_delete(regex);
+#endif
+
+  struct zsvsheet_row_view *v = err ? NULL : zsvsheet_row_view_new_from(uib, state->custom_prop_handler, 1);
+  if (!v) {
+    free(rows);
+    return 1;
+  }
+  v->selection = rows;
+  v->selection_capacity = v->row_count = passed;
+  *zst = zsvsheet_row_view_open(proc_ctx, v, uib->has_row_num, zsvsheet_row_view_temp_filename(uib), 0);
+  if (*zst == zsvsheet_status_ok) {
+    char status[64];
+    snprintf(status, sizeof(status), "(%zu filtered rows) ", passed);
+    zsvsheet_ui_buffer_set_status(zsvsheet_buffer_current(proc_ctx), status);
+  }
+  return 0;
+}
+
+// zsvsheet_filter_file: filter the current buffer's rows, or only the cells of the given column if
+// single_row_ix_plus_1 is set. Rows that can be read from their offsets are shown as a row view of
+// the data file (see row_view.c); else the filtered rows are written to a new file
 static enum zsvsheet_status zsvsheet_filter_file(zsvsheet_proc_context_t proc_ctx, const char *row_filter,
                                                  size_t single_row_ix_plus_1) {
+  struct zsvsheet_ui_buffer *uib = zsvsheet_buffer_current(proc_ctx);
+  // columns of the file follow the Row # column, if it is not data or the view shows its own
+  size_t col_offset = uib && uib->rownum_col_offset && !uib->has_row_num ? 1 : 0;
+  if (uib && uib->row_view)
+    col_offset += uib->row_view->add_row_num;
+  enum zsvsheet_status zst;
+  if (uib && single_row_ix_plus_1 && single_row_ix_plus_1 >= col_offset && *row_filter &&
+      !zsvsheet_filter_column_cache(proc_ctx, row_filter, single_row_ix_plus_1 - col_offset, &zst))
+    return zst;
+
   struct filtered_file_ctx ctx = {
     .seen_header = 0,
     .row_num = 0,
@@ -157,9 +271,24 @@ static enum zsvsheet_status zsvsheet_filter_file(zsvsheet_proc_context_t proc_ct
     .filter_len = strlen(row_filter),
 #ifdef HAVE_PCRE2_8
     .regex = row_filter && *row_filter == '/' && row_filter[1] ? zsv_pcre2_8_new(row_filter + 1, 0) : NULL,
-    .single_row_ix_plus_1 = single_row_ix_plus_1,
 #endif
+    .single_row_ix_plus_1 = single_row_ix_plus_1,
   };
+
+  if (uib) {
+    struct filtered_rows_ctx rows_ctx = {ctx, 0};
+    if (single_row_ix_plus_1 && single_row_ix_plus_1 >= col_offset)
+      rows_ctx.col_plus_1 = single_row_ix_plus_1 - col_offset + 1;
+    struct zsvsheet_row_select_opts opts = {
+      .ctx = zsv_memdup(&rows_ctx, sizeof(rows_ctx)),
+      .keep = zsvsheet_filter_keep_row,
+      .on_done = zsvsheet_filter_rows_on_done,
+    };
+    if (opts.ctx && !zsvsheet_row_select(proc_ctx, opts, &zst))
+      return zst;
+    free(opts.ctx);
+  }
+
   struct zsvsheet_buffer_transformation_opts opts = {
     .user_context = zsv_memdup(&ctx, sizeof(ctx)),
     .row_handler = zsvsheet_save_filtered_file_row_handler,
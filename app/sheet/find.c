@@ -0,0 +1,392 @@
+/*
+ * Parallel find over a buffer's data file, once its row index is complete
+ *
+ * The rows after the cursor are split into chunks of whole index blocks, of about
+ * ZSVSHEET_FIND_CHUNK_BYTES each. Viewport-priority jobs read a chunk's raw bytes, skip it if
+ * the bytes do not contain the search text, and otherwise parse its rows to confirm a
+ * match. The first match is reported once every chunk before it has been searched,
+ * while the UI shows progress and can cancel
+ */
+
+#include <sys/stat.h>
+#include <zsv/utils/os.h> // zsv_get_number_of_cores
+
+#define ZSVSHEET_FIND_CHUNK_BYTES (8 * 1024 * 1024)
+
+enum zsvsheet_find_status {
+  zsvsheet_find_status_done = 0, // searched; found_rownum is set if found
+  zsvsheet_find_status_fallback, // could not search in parallel; search sequentially
+  zsvsheet_find_status_cancelled
+};
+
+struct zsvsheet_find_chunk {
+  uint64_t begin; // offset of the line end that precedes the chunk's first row
+  uint64_t end;   // offset of the line end that follows the chunk's last row, or the file size
+  size_t first_row;
+  size_t found_row;
+  size_t found_col;
+  unsigned char done : 1;
+  unsigned char found : 1;
+  unsigned char _ : 6;
+};
+
+struct zsvsheet_find_job {
+  const char *filename;
+  struct zsv_opts opts;
+  const char *needle;
+  size_t needle_len;
+  size_t specified_column_plus_1;
+  size_t start_row; // first row to search, from column start_col
+  size_t start_col;
+  char exact;
+  char prefilter; // skip chunks whose raw bytes do not contain the needle
+
+  pthread_mutex_t mutex; // guards the fields below and each chunk's results
+  struct zsvsheet_find_chunk *chunks;
+  size_t chunk_count;
+  size_t next_chunk;
+  size_t first_found; // lowest chunk with a match, or chunk_count
+  char cancelled;
+  char failed; // a chunk could not be read
+};
+
+struct zsvsheet_find_mem {
+  const unsigned char *s;
+  size_t len;
+  size_t pos;
+};
+
+static size_t zsvsheet_find_mem_read(void *restrict buff, size_t n, size_t size, void *restrict ctx) {
+  struct zsvsheet_find_mem *m = ctx;
+  size_t bytes = n * size;
+  if (bytes > m->len - m->pos)
+    bytes = m->len - m->pos;
+  memcpy(buff, m->s + m->pos, bytes);
+  m->pos += bytes;
+  return bytes;
+}
+
+// zsvsheet_find_chunk_parser: get a parser of the rows of a chunk read into memory, given the
+// options with which to parse rows read from their offsets. m is the parser's stream
+static zsv_parser zsvsheet_find_chunk_parser(const struct zsv_opts *row_opts, const unsigned char *data, size_t len,
+                                             struct zsvsheet_find_mem *m) {
+  // skip the line end that precedes the first row
+  size_t skip = len && data[0] == '\r' ? 1 : 0;
+  if (skip < len && data[skip] == '\n')
+    skip++;
+  else if (!skip && len && data[0] == '\n')
+    skip = 1;
+  m->s = data + skip;
+  m->len = len - skip;
+  m->pos = 0;
+  struct zsv_opts opts;
+  zsv_chunk_opts(&opts, row_opts, NULL, NULL, NULL);
+  opts.stream = m;
+  opts.read = zsvsheet_find_mem_read;
+  return zsv_new(&opts);
+}
+
+// zsvsheet_find_in_chunk: parse the chunk's rows and find the first match. Returns 1 if found
+static int zsvsheet_find_in_chunk(struct zsvsheet_find_job *job, struct zsvsheet_find_chunk *chunk,
+                                  const unsigned char *data, size_t len, size_t *row_out, size_t *col_out) {
+  struct zsvsheet_find_mem m;
+  zsv_parser parser = zsvsheet_find_chunk_parser(&job->opts, data, len, &m);
+  if (!parser)
+    return 0;
+  int found = 0;
+  for (size_t row = chunk->first_row; !found && zsv_next_row(parser) == zsv_status_row; row++) {
+    if (row < job->start_row)
+      continue;
+    size_t col_plus_1 = zsvsheet_found_in_row(parser, row == job->start_row ? job->start_col : 0,
+                                              zsv_cell_count(parser), job->needle, job->needle_len,
+                                              job->specified_column_plus_1, job->exact);
+    if (col_plus_1) {
+      *row_out = row;
+      *col_out = col_plus_1 - 1;
+      found = 1;
+    }
+  }
+  zsv_delete(parser);
+  return found;
+}
+
+static void zsvsheet_find_worker(struct zsvsheet_job *worker, void *arg) {
+  struct zsvsheet_find_job *job = arg;
+  (void)(worker); // the search is cancelled through job->cancelled, which also stops it once found
+  FILE *fp = fopen(job->filename, "rb");
+  unsigned char *data = NULL;
+  size_t data_capacity = 0;
+  if (!fp) {
+    pthread_mutex_lock(&job->mutex);
+    job->failed = job->cancelled = 1;
+    pthread_mutex_unlock(&job->mutex);
+  }
+  while (fp) {
+    pthread_mutex_lock(&job->mutex);
+    size_t i = job->next_chunk;
+    // chunks after a match need not be searched
+    char stop = job->cancelled || i >= job->chunk_count || i > job->first_found;
+    if (!stop)
+      job->next_chunk++;
+    pthread_mutex_unlock(&job->mutex);
+    if (stop)
+      break;
+
+    struct zsvsheet_find_chunk *chunk = &job->chunks[i];
+    size_t len = (size_t)(chunk->end - chunk->begin);
+    size_t row = 0, col = 0;
+    int found = 0, failed = 0;
+    if (len > data_capacity) {
+      unsigned char *p = realloc(data, len);
+      if (!p)
+        failed = 1;
+      else {
+        data = p;
+        data_capacity = len;
+      }
+    }
+    if (!failed && len && (fseeko(fp, (off_t)chunk->begin, SEEK_SET) || fread(data, 1, len, fp) != len))
+      failed = 1;
+    if (!failed && len && (!job->prefilter || memmem(data, len, job->needle, job->needle_len)))
+      found = zsvsheet_find_in_chunk(job, chunk, data, len, &row, &col);
+
+    pthread_mutex_lock(&job->mutex);
+    if (failed)
+      job->failed = job->cancelled = 1;
+    chunk->done = 1;
+    if (found) {
+      chunk->found = 1;
+      chunk->found_row = row;
+      chunk->found_col = col;
+      if (i < job->first_found)
+        job->first_found = i;
+    }
+    pthread_mutex_unlock(&job->mutex);
+  }
+  free(data);
+  if (fp)
+    fclose(fp);
+}
+
+// zsvsheet_find_chunks: split the rows from block first_block to the end of the file into
+// chunks of whole index blocks, of about chunk_bytes each. Caller must hold the buffer's mutex
+static struct zsvsheet_find_chunk *zsvsheet_find_chunks(const struct zsv_index *ix, size_t first_block,
+                                                        uint64_t file_size, uint64_t chunk_bytes, size_t *count) {
+  size_t block_count = (size_t)(ix->row_count >> ZSV_INDEX_ROW_SHIFT) + 1;
+  size_t capacity = 0;
+  struct zsvsheet_find_chunk *chunks = NULL;
+  *count = 0;
+  for (size_t b = first_block; b < block_count; b++) {
+    uint64_t offset, remaining;
+    if (zsv_index_row_end_offset(ix, (uint64_t)b << ZSV_INDEX_ROW_SHIFT, &offset, &remaining) !=
+        zsv_index_status_ok)
+      break;
+    if (*count && offset - chunks[*count - 1].begin < chunk_bytes)
+      continue; // extend the current chunk
+    if (*count == capacity) {
+      capacity = capacity ? capacity * 2 : 64;
+      struct zsvsheet_find_chunk *p = realloc(chunks, capacity * sizeof(*chunks));
+      if (!p) {
+        free(chunks);
+        return NULL;
+      }
+      chunks = p;
+    }
+    if (*count)
+      chunks[*count - 1].end = offset;
+    memset(&chunks[*count], 0, sizeof(*chunks));
+    chunks[*count].begin = offset;
+    chunks[*count].first_row = b << ZSV_INDEX_ROW_SHIFT;
+    (*count)++;
+  }
+  if (*count)
+    chunks[*count - 1].end = file_size;
+  return chunks;
+}
+
+/**
+ * Find the next match after the cursor using all cores, if the buffer's row index is
+ * complete and the rest of the file spans more than one chunk. start_row is the first
+ * (0-based) data row to search, from column zsvsheet_opts->found_colnum
+ */
+static enum zsvsheet_find_status zsvsheet_find_next_parallel(struct zsvsheet_ui_buffer *uib,
+                                                             struct zsvsheet_opts *zsvsheet_opts, size_t start_row,
+                                                             const struct zsvsheet_display_dimensions *ddims,
+                                                             struct zsv_prop_handler *custom_prop_handler) {
+  const char *filename = uib->data_filename ? uib->data_filename : uib->filename;
+  if (!filename || !zsvsheet_opts->find || !*zsvsheet_opts->find)
+    return zsvsheet_find_status_fallback;
+
+  struct zsvsheet_find_job job = {0};
+  job.filename = filename;
+  job.needle = zsvsheet_opts->find;
+  job.needle_len = strlen(job.needle);
+  job.specified_column_plus_1 = zsvsheet_opts->find_specified_column_plus_1;
+  job.exact = zsvsheet_opts->find_exact;
+  job.start_row = start_row;
+  job.start_col = zsvsheet_opts->found_colnum;
+  // a quote in the text is doubled in the raw bytes of a quoted cell
+  job.prefilter = !memchr(job.needle, '"', job.needle_len);
+
+  struct stat st;
+  if (stat(filename, &st) || zsvsheet_ui_buffer_seek_opts(uib, custom_prop_handler, &job.opts))
+    return zsvsheet_find_status_fallback;
+
+  pthread_mutex_lock(&uib->mutex);
+  if (zsvsheet_ui_buffer_index_complete(uib))
+    job.chunks = zsvsheet_find_chunks(uib->index, start_row >> ZSV_INDEX_ROW_SHIFT, (uint64_t)st.st_size,
+                                      ZSVSHEET_FIND_CHUNK_BYTES, &job.chunk_count);
+  pthread_mutex_unlock(&uib->mutex);
+  if (job.chunk_count < 2) {
+    free(job.chunks);
+    return zsvsheet_find_status_fallback;
+  }
+
+  job.first_found = job.chunk_count;
+  pthread_mutex_init(&job.mutex, NULL);
+  size_t worker_count = zsv_get_number_of_cores();
+  if (worker_count > job.chunk_count)
+    worker_count = job.chunk_count;
+  struct zsvsheet_job **workers = calloc(worker_count, sizeof(*workers));
+  size_t started = 0;
+  for (; workers && started < worker_count; started++)
+    if (!(workers[started] = zsvsheet_job_submit(zsvsheet_job_priority_viewport, zsvsheet_find_worker, &job)))
+      break;
+
+  enum zsvsheet_find_status status = zsvsheet_find_status_done;
+  if (!started)
+    status = zsvsheet_find_status_fallback;
+  else {
+    halfdelay(1);
+    size_t searched = 0; // chunks before this one have been searched without a match
+    while (1) {
+      pthread_mutex_lock(&job.mutex);
+      while (searched < job.chunk_count && job.chunks[searched].done && !job.chunks[searched].found)
+        searched++;
+      char finished = job.failed || searched == job.chunk_count || job.chunks[searched].done;
+      if (job.failed)
+        status = zsvsheet_find_status_fallback; // search sequentially instead
+      else if (finished && searched < job.chunk_count) {
+        zsvsheet_opts->found_rownum = job.chunks[searched].found_row + 1;
+        zsvsheet_opts->found_colnum = job.chunks[searched].found_col;
+      }
+      if (finished)
+        job.cancelled = 1; // stop the workers that are still searching later chunks
+      pthread_mutex_unlock(&job.mutex);
+      if (finished)
+        break;
+
+      zsvsheet_priv_set_status(ddims, 1, "Searching... %zu%% (ESC to cancel)", searched * 100 / job.chunk_count);
+      refresh();
+      if (getch() == 27) { // ESC
+        pthread_mutex_lock(&job.mutex);
+        job.cancelled = 1;
+        pthread_mutex_unlock(&job.mutex);
+        status = zsvsheet_find_status_cancelled;
+        break;
+      }
+    }
+    halfdelay(2);
+  }
+  for (size_t i = 0; i < started; i++) {
+    zsvsheet_job_wait(workers[i]);
+    zsvsheet_job_release(workers[i]);
+  }
+  free(workers);
+  pthread_mutex_destroy(&job.mutex);
+  free(job.chunks);
+  return status;
+}
+
+// Search the in-memory screen buffer for the next match after the cursor cell. Used for
+// static buffers (help/errors) that have no data file; scans row-major and sets
+// found_rownum/found_colnum in buffer coords (these buffers have no row-number column).
+static void zsvsheet_find_next_in_buffer(struct zsvsheet_ui_buffer *uib, struct zsvsheet_opts *zsvsheet_opts,
+                                         size_t header_span) {
+  const char *needle = zsvsheet_opts->find;
+  if (!needle)
+    return;
+  zsvsheet_screen_buffer_t buffer = uib->buffer;
+  size_t needle_len = strlen(needle);
+  size_t row_count = uib->dimensions.row_count;
+  size_t col_count = uib->dimensions.col_count;
+  size_t from_row = uib->input_offset.row + uib->buff_offset.row + uib->cursor_row;
+  size_t from_col = uib->cursor_col + uib->buff_offset.col;
+  if (from_row < header_span)
+    from_row = header_span;
+  for (size_t r = from_row; r < row_count; r++) {
+    for (size_t c = (r == from_row ? from_col + 1 : 0); c < col_count; c++) {
+      if (zsvsheet_opts->find_specified_column_plus_1 && c + 1 != zsvsheet_opts->find_specified_column_plus_1)
+        continue;
+      const unsigned char *cell = zsvsheet_screen_buffer_cell_display(buffer, r, c);
+      if (!cell)
+        continue;
+      size_t cell_len = strlen((const char *)cell);
+      if (zsvsheet_opts->find_exact ? (cell_len == needle_len && !memcmp(cell, needle, needle_len))
+                                    : (memmem(cell, cell_len, needle, needle_len) != NULL)) {
+        zsvsheet_opts->found_rownum = r;
+        zsvsheet_opts->found_colnum = c;
+        return;
+      }
+    }
+  }
+}
+
+// zsvsheet_find_next_in_key_index: for an exact find in one column that has a saved
+// key index (see `zsv index`), get the next match from the index instead of reading
+// the file. Returns 0 if the index was used (found or not), else non-zero
+static int zsvsheet_find_next_in_key_index(const char *filename, struct zsvsheet_opts *zsvsheet_opts,
+                                           size_t start_row) {
+  if (!zsvsheet_opts->find_exact || !zsvsheet_opts->find_specified_column_plus_1)
+    return 1;
+  size_t col = zsvsheet_opts->find_specified_column_plus_1 - 1;
+  zsv_key_index ix = zsv_key_index_open(filename, col);
+  if (!ix)
+    return 1;
+  struct zsv_key_index_match *matches = NULL;
+  size_t count = 0;
+  int rc = 1;
+  if (zsv_key_index_find(ix, (const unsigned char *)zsvsheet_opts->find, strlen(zsvsheet_opts->find), &matches,
+                         &count) == zsv_key_index_status_ok) {
+    rc = 0;
+    // the search starts in data row start_row + 1, at column found_colnum
+    for (size_t i = 0; i < count; i++) {
+      if (matches[i].row > start_row + 1 || (matches[i].row == start_row + 1 && col >= zsvsheet_opts->found_colnum)) {
+        zsvsheet_opts->found_rownum = matches[i].row;
+        zsvsheet_opts->found_colnum = col;
+        break;
+      }
+    }
+  }
+  free(matches);
+  zsv_key_index_close(ix);
+  return rc;
+}
+
+static enum zsvsheet_find_status zsvsheet_find_next(struct zsvsheet_ui_buffer *uib,
+                                                    struct zsvsheet_opts *zsvsheet_opts, size_t header_span,
+                                                    const struct zsvsheet_display_dimensions *ddims,
+                                                    struct zsv_prop_handler *custom_prop_handler) {
+  enum zsvsheet_find_status status = zsvsheet_find_status_done;
+  if (!uib->data_filename && !uib->filename) // static buffer: no data file, scan screen buffer
+    zsvsheet_find_next_in_buffer(uib, zsvsheet_opts, header_span);
+  else {
+    struct zsvsheet_rowcol *input_offset = &uib->input_offset;
+    struct zsvsheet_rowcol *buff_offset = &uib->buff_offset;
+    size_t cursor_row = uib->cursor_row;
+    size_t start_row = input_offset->row + buff_offset->row + header_span + cursor_row - 1;
+    if (start_row > 0)
+      start_row--;
+    // a key index holds row numbers in file order, which a row view does not show
+    if ((uib->row_view ||
+         zsvsheet_find_next_in_key_index(uib->data_filename ? uib->data_filename : uib->filename, zsvsheet_opts,
+                                         start_row)) &&
+        (status = zsvsheet_find_next_parallel(uib, zsvsheet_opts, start_row, ddims, custom_prop_handler)) ==
+          zsvsheet_find_status_fallback) {
+      status = zsvsheet_find_status_done;
+      read_data(&uib, NULL, start_row, 0, header_span, zsvsheet_opts, custom_prop_handler);
+    }
+  }
+  zsvsheet_opts->find = NULL;
+  return status;
+}
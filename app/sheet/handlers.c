@@ -81,12 +81,16 @@ const char *zsvsheet_buffer_filename(zsvsheet_buffer_t h) {
   return uib ? uib->filename : NULL;
 }
 
+static const char *zsvsheet_row_view_data_filename(struct zsvsheet_ui_buffer *uib);
+
 /**
  * Get the data file associated with a buffer. This might not be the same as the filename,
  * such as when the data has been filtered
  */
 const char *zsvsheet_buffer_data_filename(zsvsheet_buffer_t h) {
   struct zsvsheet_ui_buffer *uib = h;
+  if (uib && uib->row_view) // filtered rows are written out only when needed
+    return zsvsheet_row_view_data_filename(uib);
   if (uib)
     return uib->data_filename ? uib->data_filename : uib->filename;
   return NULL;
@@ -1,6 +1,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <unistd.h>
+#include <sys/stat.h>
 #include <zsv.h>
 #include <zsv/utils/prop.h>
 #include <zsv/utils/file.h>
@@ -32,6 +33,9 @@ enum zsv_index_status build_memory_index(struct zsvsheet_index_opts *optsp) {
   if (!ix_zopts.stream)
     goto out;
 
+  struct stat st;
+  uint64_t file_size = fstat(fileno(ix_zopts.stream), &st) ? 0 : (uint64_t)st.st_size;
+
   ix_zopts.ctx = &ixr;
   ix_zopts.row_handler = build_memory_index_row_handler;
 
@@ -52,11 +56,14 @@ enum zsv_index_status build_memory_index(struct zsvsheet_index_opts *optsp) {
       continue;
     committed_bytes = zsv_cum_scanned_length(ixr.parser);
 
-    pthread_mutex_lock(&optsp->uib->mutex);
-    if (optsp->uib->worker_cancelled) {
-      cancelled = 1;
-      zst = zsv_status_cancelled;
+    if (optsp->job) {
+      zsvsheet_job_set_progress(optsp->job, committed_bytes, file_size);
+      if (zsvsheet_job_cancelled(optsp->job)) {
+        cancelled = 1;
+        zst = zsv_status_cancelled;
+      }
     }
+    pthread_mutex_lock(&optsp->uib->mutex);
     zsv_index_commit_rows(ixr.ix);
     optsp->uib->index_ready = 1;
     pthread_mutex_unlock(&optsp->uib->mutex);
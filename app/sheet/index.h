@@ -4,6 +4,7 @@
 #include <pthread.h>
 
 #include "zsv.h"
+#include "scheduler.h"
 
 struct zsvsheet_indexer {
   zsv_parser parser;
@@ -18,6 +19,7 @@ struct zsvsheet_index_opts {
   int *errp;
   struct zsv_prop_handler *custom_prop_handler;
   char *old_ui_status;
+  struct zsvsheet_job *job; // the job building the index, for cancellation and progress
 };
 
 enum zsv_index_status build_memory_index(struct zsvsheet_index_opts *optsp);
@@ -180,6 +180,9 @@ struct zsvsheet_key_binding zsvsheet_vim_key_bindings[] = {
   { .ch = '\r',                .proc_id = zsvsheet_builtin_proc_newline,       },
   { .ch = 'v',                 .proc_id = zsvsheet_builtin_proc_pivot_cur_col, },
   { .ch = 'V',                 .proc_id = zsvsheet_builtin_proc_pivot_expr,    },
+  { .ch = 's',                 .proc_id = zsvsheet_builtin_proc_sort,          },
+  { .ch = 'S',                 .proc_id = zsvsheet_builtin_proc_sort_desc,     },
+  { .ch = 'i',                 .proc_id = zsvsheet_builtin_proc_stats,         },
   {
     .ch = '\0',
     .ch_name = "",
@@ -267,6 +270,9 @@ struct zsvsheet_key_binding zsvsheet_emacs_key_bindings[] = {
 
   { .ch = 'v',                    .proc_id = zsvsheet_builtin_proc_pivot_cur_col, },
   { .ch = 'V',                    .proc_id = zsvsheet_builtin_proc_pivot_expr,    },
+  { .ch = 's',                    .proc_id = zsvsheet_builtin_proc_sort,          },
+  { .ch = 'S',                    .proc_id = zsvsheet_builtin_proc_sort_desc,     },
+  { .ch = 'i',                    .proc_id = zsvsheet_builtin_proc_stats,         },
   {
     .ch = '\0',
     .ch_name = "",
@@ -6,6 +6,7 @@
 
 #include <assert.h>
 #include <errno.h>
+#include <inttypes.h>
 #include "../external/sqlite3/sqlite3.h"
 #include <zsv/ext/implementation.h>
 #include <zsv/ext/sheet.h>
@@ -16,9 +17,26 @@
 #include "handlers_internal.h"
 #include "./curses.h"
 #include "../sql_internal.h"
+#include "pivot_agg.h"
 
 #include "sheet-sql.c"
 
+/*
+ * A pivot on a column is computed natively: a worker thread reads the file once and
+ * groups its rows with a hash aggregation (see pivot_agg.h). While it reads, it rewrites
+ * the pivot table with the counts so far, at intervals that grow with the number of rows
+ * read, and the table is shown as it is refined. Drill-down reads the group's rows from
+ * their offsets. A pivot on a sql expression, or a drill-down whose rows were not kept,
+ * is run in sqlite.
+ *
+ * When a large file is read to the end, the groups are also saved as the column's cache
+ * (see column_cache.c), and a later pivot on the same column is computed from the cache
+ * without reading the file
+ */
+
+#define ZSVSHEET_PIVOT_REFRESH_ROWS_MIN (64 * 1024)
+#define ZSVSHEET_PIVOT_REFRESH_ROWS_MAX (4 * 1024 * 1024)
+
 struct pivot_row {
   char *value;
 };
@@ -32,6 +50,19 @@ struct pivot_data {
     size_t used;
   } rows;
   char column_name_expr;
+
+  // native pivot on a column
+  char native;
+  struct zsvsheet_pivot_agg agg;
+  struct zsvsheet_ui_buffer *uib; // the pivot table
+  struct zsv_opts zopts;          // options of the data file
+  struct zsv_opts row_opts;       // options to parse the data file's rows read from their offsets
+  struct zsv_prop_handler *custom_prop_handler;
+  char has_row_num;    // the data file has its own Row # column
+  char temp_data_file; // the data file is another buffer's temporary file
+  size_t col;
+  zsv_column_cache cc; // the column's cache, if the pivot was computed from it
+  char save_cache;     // save the column's cache once the whole file has been read
 };
 
 static void pivot_data_delete(void *h) {
@@ -40,6 +71,8 @@ static void pivot_data_delete(void *h) {
     for (size_t i = 0; i < pd->rows.used; i++)
       free(pd->rows.data[i].value);
     free(pd->rows.data);
+    zsvsheet_pivot_agg_clear(&pd->agg);
+    zsv_column_cache_close(pd->cc);
     free(pd->value_sql);
     free(pd->data_filename);
     free(pd);
@@ -103,8 +136,9 @@ static enum zsv_ext_status get_cell_attrs(void *pdh, zsvsheet_cell_attr_t *attrs
   attr |= A_ITALIC;
 #endif
 
-  if (end_row > pd->rows.used)
-    end_row = pd->rows.used;
+  size_t used = pd->native ? pd->uib->dimensions.row_count : pd->rows.used;
+  if (end_row > used)
+    end_row = used;
   for (size_t i = start_row; i < end_row; i++)
     attrs[i * cols] = attr;
   return zsv_ext_status_ok;
@@ -121,6 +155,70 @@ static void pivot_on_data_cell(void *ctx, size_t col_ix, const char *text, size_
     add_pivot_row(ctx, text, len);
 }
 
+// pivot_table_value: get the group value in the given row of the pivot table from its file, rather
+// than from the (possibly truncated) display. Caller must free
+static char *pivot_table_value(struct pivot_data *pd, size_t row, size_t *len) {
+  struct zsvsheet_ui_buffer *uib = pd->uib;
+  struct zsv_opts opts = {0};
+  if (!row || !(opts.stream = fopen(uib->data_filename, "rb")))
+    return NULL;
+  pthread_mutex_lock(&uib->mutex);
+  enum zsv_index_status ixst = zsv_index_status_error;
+  if (uib->index_ready && uib->index)
+    ixst = zsv_index_seek_row(uib->index, &opts, row - 1);
+  pthread_mutex_unlock(&uib->mutex);
+  zsv_parser parser = ixst == zsv_index_status_ok ? zsv_new(&opts) : NULL;
+  char *value = NULL;
+  if (parser && zsv_next_row(parser) == zsv_status_row) {
+    struct zsv_cell c = zsv_get_cell(parser, 0);
+    if ((value = malloc(c.len + 1))) {
+      if (c.len)
+        memcpy(value, c.str, c.len);
+      value[c.len] = '\0';
+      *len = c.len;
+    }
+  }
+  zsv_delete(parser);
+  fclose(opts.stream);
+  return value;
+}
+
+// pivot_drill_down_rows: open a view of the rows of a group, read from their offsets in the
+// data file. Returns non-zero if they can't be read that way
+static int pivot_drill_down_rows(zsvsheet_proc_context_t ctx, struct pivot_data *pd, const char *value, size_t len,
+                                 enum zsvsheet_status *zst) {
+  if (!pd->cc) {
+    const struct zsvsheet_pivot_group *g = zsvsheet_pivot_agg_find(&pd->agg, (const unsigned char *)value, len);
+    struct zsv_key_index_match *rows;
+    if (!g || pd->agg.rows_dropped || !(rows = zsv_memdup(g->rows, g->count * sizeof(*rows))))
+      return 1;
+    return zsvsheet_row_view_open_rows(ctx, pd->data_filename, &pd->zopts, &pd->row_opts, pd->custom_prop_handler,
+                                       pd->has_row_num, pd->temp_data_file, rows, g->count, zst);
+  }
+
+  // select the rows with the value's number in the column cache
+  int64_t value_ix = zsv_column_cache_find(pd->cc, (const unsigned char *)value, len);
+  if (value_ix < 0)
+    return 1;
+  const uint32_t *row_values = zsv_column_cache_row_values(pd->cc);
+  uint64_t row_count = zsv_column_cache_row_count(pd->cc);
+  size_t count = 0;
+  for (uint64_t i = 0; i < row_count; i++)
+    count += row_values[i] == (uint32_t)value_ix;
+  struct zsv_key_index_match *rows = malloc((count ? count : 1) * sizeof(*rows));
+  if (!rows)
+    return 1;
+  for (uint64_t i = 0, j = 0; i < row_count; i++) {
+    if (row_values[i] == (uint32_t)value_ix) {
+      rows[j].row = i + 1;
+      zsv_column_cache_row(pd->cc, i, &rows[j].offset, &rows[j].len);
+      j++;
+    }
+  }
+  return zsvsheet_row_view_open_rows(ctx, pd->data_filename, &pd->zopts, &pd->row_opts, pd->custom_prop_handler,
+                                     pd->has_row_num, pd->temp_data_file, rows, count, zst);
+}
+
 zsvsheet_status pivot_drill_down(zsvsheet_proc_context_t ctx) {
   enum zsvsheet_status zst = zsvsheet_status_ok;
   zsvsheet_buffer_t buff = zsvsheet_buffer_current(ctx);
@@ -130,7 +228,19 @@ zsvsheet_status pivot_drill_down(zsvsheet_proc_context_t ctx) {
       zsvsheet_buffer_get_selected_cell(buff, &rc) != zsvsheet_status_ok) {
     return zsvsheet_status_error;
   }
-  struct pivot_row *pr = get_pivot_row_data(pd, rc.row);
+  struct pivot_row native_row = {0};
+  struct pivot_row *pr = NULL;
+  if (pd && pd->native) {
+    size_t len;
+    if ((native_row.value = pivot_table_value(pd, rc.row, &len))) {
+      if (!pivot_drill_down_rows(ctx, pd, native_row.value, len, &zst)) {
+        free(native_row.value);
+        return zst;
+      }
+      pr = &native_row; // the group's rows were not kept: select them in sqlite
+    }
+  } else
+    pr = get_pivot_row_data(pd, rc.row);
   if (pd && pd->data_filename && pd->value_sql && pr) {
     // interactive (no flag surface): disambiguate duplicate input columns so the
     // pivot's underlying table can be created; warn stays off to keep curses clean
@@ -175,6 +285,7 @@ zsvsheet_status pivot_drill_down(zsvsheet_proc_context_t ctx) {
       zsv_sqlite3_db_delete(zdb);
     }
   }
+  free(native_row.value);
   return zst;
 }
 
@@ -182,6 +293,356 @@ static void zsvsheet_check_buffer_worker_updates(struct zsvsheet_ui_buffer *ub,
                                                  struct zsvsheet_display_dimensions *display_dims,
                                                  struct zsvsheet_sheet_context *handler_state);
 
+struct pivot_job {
+  struct pivot_data *pd;
+  struct zsvsheet_ui_buffer *uib; // set once the pivot table is open
+  zsv_parser parser;
+  FILE *stream;
+  size_t col;
+  uint64_t row_count; // data rows read
+  uint64_t next_refresh;
+  char header_done;
+  char finishing; // rows are being reported by zsv_finish()
+  char failed;
+};
+
+static void pivot_job_row(void *ctx) {
+  struct pivot_job *job = ctx;
+  if (!job->header_done) {
+    job->header_done = 1;
+    return;
+  }
+  zsv_parser parser = job->parser;
+  struct zsv_cell c = job->col < zsv_cell_count(parser) ? zsv_get_cell(parser, job->col) : (struct zsv_cell){0};
+  struct zsv_key_index_match row;
+  row.row = ++job->row_count;
+  row.len = zsv_row_length_raw_bytes(parser);
+  row.offset = zsv_chunk_row_offset(parser, job->finishing);
+  if (!zsvsheet_pivot_agg_add(&job->pd->agg, c.len ? c.str : (const unsigned char *)"", c.len, &row)) {
+    job->failed = 1;
+    zsv_abort(parser);
+  }
+}
+
+static void pivot_job_delete(struct pivot_job *job) {
+  if (job) {
+    zsv_delete(job->parser);
+    if (job->stream)
+      fclose(job->stream);
+    free(job);
+  }
+}
+
+static struct pivot_job *pivot_job_new(struct pivot_data *pd, size_t col) {
+  struct pivot_job *job = calloc(1, sizeof(*job));
+  if (!job)
+    return NULL;
+  job->pd = pd;
+  job->col = col;
+  job->next_refresh = ZSVSHEET_PIVOT_REFRESH_ROWS_MIN;
+  struct zsv_opts opts = pd->zopts;
+  opts.row_handler = pivot_job_row;
+  opts.ctx = job;
+  opts.errprintf = zsv_no_printf;
+  opts.errf = NULL;
+  if (!(opts.stream = job->stream = fopen(pd->data_filename, "rb")) ||
+      zsv_new_with_properties(&opts, pd->custom_prop_handler, pd->data_filename, &job->parser) != zsv_status_ok) {
+    pivot_job_delete(job);
+    return NULL;
+  }
+  return job;
+}
+
+// pivot_job_parse: read more of the file. Returns zsv_status_ok until there is no more to read
+static enum zsv_status pivot_job_parse(struct pivot_job *job) {
+  enum zsv_status zst = zsv_parse_more(job->parser);
+  if (zst == zsv_status_no_more_input && !job->failed) {
+    job->finishing = 1;
+    zsv_finish(job->parser);
+  }
+  return job->failed ? zsv_status_memory : zst;
+}
+
+// pivot_write: write the groups so far, ordered by value, to a new temp file and index its rows
+static int pivot_write(struct pivot_data *pd, char **filename_out, struct zsv_index **index_out) {
+  struct zsvsheet_pivot_group **sorted = zsvsheet_pivot_agg_sorted(&pd->agg);
+  char *filename = zsv_get_temp_filename("zsvpivot");
+  FILE *f = filename ? fopen(filename, "wb") : NULL;
+  struct zsv_index *index = zsv_index_new();
+  struct transformation_writer_index_ctx *ixctx = calloc(1, sizeof(*ixctx));
+  int err = 1;
+  if (sorted && f && index && ixctx) {
+    struct zsv_csv_writer_options writer_opts = zsv_writer_get_default_opts();
+    writer_opts.stream = f;
+    writer_opts.on_row = transformation_writer_index_on_row;
+    writer_opts.on_row_ctx = ixctx;
+    writer_opts.on_delete = transformation_writer_index_delete;
+    writer_opts.on_delete_ctx = ixctx;
+    ixctx->index = index;
+    zsv_csv_writer w = zsv_writer_new(&writer_opts);
+    if (w) {
+      ixctx->writer = w;
+      ixctx = NULL; // freed with the writer
+      const char *header = pd->value_sql;
+      zsv_writer_cell(w, 1, (const unsigned char *)header, strlen(header), 1);
+      zsv_writer_cell_s(w, 0, (const unsigned char *)"Count", 0);
+      for (size_t i = 0, n = zsvsheet_pivot_agg_count(&pd->agg); i < n; i++) {
+        zsv_writer_cell(w, 1, sorted[i]->value, sorted[i]->len, 1);
+        zsv_writer_cell_zu(w, 0, (size_t)sorted[i]->count);
+      }
+      zsv_writer_delete(w);
+      err = 0;
+    }
+  }
+  free(ixctx);
+  free(sorted);
+  if (f && fclose(f))
+    err = 1;
+  if (err) {
+    if (f)
+      unlink(filename);
+    free(filename);
+    zsv_index_delete(index);
+    return err;
+  }
+  zsv_index_commit_rows(index);
+  *filename_out = filename;
+  *index_out = index;
+  return 0;
+}
+
+// pivot_job_refresh: write the groups so far and leave them for the UI thread to show. If done, the
+// pivot table is then complete
+static void pivot_job_refresh(struct pivot_job *job, char done) {
+  struct zsvsheet_ui_buffer *uib = job->uib;
+  char *filename = NULL;
+  struct zsv_index *index = NULL;
+  uint64_t step = job->row_count;
+  if (step < ZSVSHEET_PIVOT_REFRESH_ROWS_MIN)
+    step = ZSVSHEET_PIVOT_REFRESH_ROWS_MIN;
+  else if (step > ZSVSHEET_PIVOT_REFRESH_ROWS_MAX)
+    step = ZSVSHEET_PIVOT_REFRESH_ROWS_MAX;
+  job->next_refresh = job->row_count + step;
+  if (pivot_write(job->pd, &filename, &index))
+    job->failed = 1;
+
+  pthread_mutex_lock(&uib->mutex);
+  if (filename) {
+    if (uib->pending_data_filename) { // not yet shown
+      unlink(uib->pending_data_filename);
+      free(uib->pending_data_filename);
+      zsv_index_delete(uib->pending_index);
+    }
+    uib->pending_data_filename = filename;
+    uib->pending_index = index;
+  }
+  if (done)
+    uib->write_done = 1;
+  pthread_mutex_unlock(&uib->mutex);
+}
+
+// pivot_save_column_cache: save the groups of the whole file, with their rows, as the column's cache
+static void pivot_save_column_cache(struct pivot_data *pd, uint64_t row_count) {
+  struct zsvsheet_pivot_agg *agg = &pd->agg;
+  if (!pd->save_cache || agg->rows_dropped)
+    return;
+  size_t n = zsvsheet_pivot_agg_count(agg);
+  struct zsvsheet_pivot_group **sorted = zsvsheet_pivot_agg_sorted(agg);
+  const unsigned char **values = malloc((n ? n : 1) * sizeof(*values));
+  size_t *value_lens = malloc((n ? n : 1) * sizeof(*value_lens));
+  uint32_t *row_values = malloc((row_count ? row_count : 1) * sizeof(*row_values));
+  uint64_t *row_offsets = malloc((row_count ? row_count : 1) * sizeof(*row_offsets));
+  uint32_t *row_lens = malloc((row_count ? row_count : 1) * sizeof(*row_lens));
+  int err = !sorted || !values || !value_lens || !row_values || !row_offsets || !row_lens || n >= UINT32_MAX;
+  for (size_t i = 0; i < n && !err; i++) {
+    values[i] = sorted[i]->value;
+    value_lens[i] = sorted[i]->len;
+    for (uint64_t j = 0; j < sorted[i]->count && !err; j++) {
+      const struct zsv_key_index_match *r = &sorted[i]->rows[j];
+      if (r->row < 1 || r->row > row_count || r->len > UINT32_MAX)
+        err = 1;
+      else {
+        row_values[r->row - 1] = (uint32_t)i;
+        row_offsets[r->row - 1] = r->offset;
+        row_lens[r->row - 1] = (uint32_t)r->len;
+      }
+    }
+  }
+  if (!err)
+    zsv_column_cache_save(pd->data_filename, &pd->zopts, pd->custom_prop_handler, pd->col, n, values, value_lens,
+                          row_count, row_values, row_offsets, row_lens);
+  free(sorted);
+  free(values);
+  free(value_lens);
+  free(row_values);
+  free(row_offsets);
+  free(row_lens);
+}
+
+static void pivot_job_run(struct zsvsheet_job *worker, void *arg) {
+  struct pivot_job *job = arg;
+  struct zsvsheet_ui_buffer *uib = job->uib;
+  char cancelled = 0;
+  enum zsv_status zst;
+  while ((zst = pivot_job_parse(job)) == zsv_status_ok) {
+    if ((cancelled = zsvsheet_job_cancelled(worker)))
+      break;
+    if (job->row_count >= job->next_refresh) {
+      char status[64];
+      snprintf(status, sizeof(status), "(%" PRIu64 " rows read) Press ESC to cancel ", job->row_count);
+      zsvsheet_ui_buffer_set_status(uib, status);
+      pivot_job_refresh(job, 0);
+    }
+  }
+  pivot_job_refresh(job, 1);
+  if (job->failed)
+    zsvsheet_ui_buffer_set_status(uib, "Pivot table incomplete: out of memory");
+  else if (cancelled)
+    zsvsheet_ui_buffer_set_status(uib, "Pivot table incomplete: cancelled");
+  else {
+    zsvsheet_ui_buffer_set_status(uib, NULL);
+    pivot_save_column_cache(job->pd, job->row_count);
+  }
+  pivot_job_delete(job);
+}
+
+// pivot_wait: show the pivot table as it is refined, until it is complete or ESC cancels it
+static void pivot_wait(struct zsvsheet_proc_context *ctx, struct zsvsheet_ui_buffer *uib) {
+  struct zsvsheet_sheet_context *state = (struct zsvsheet_sheet_context *)ctx->subcommand_context;
+  struct zsvsheet_display_info *di = &state->display_info;
+  while (1) {
+    pthread_mutex_lock(&uib->mutex);
+    char done = uib->write_done; // the last version is then pending, and is shown below
+    pthread_mutex_unlock(&uib->mutex);
+
+    di->update_buffer = 0;
+    zsvsheet_check_buffer_worker_updates(uib, di->dimensions, state);
+    if (di->update_buffer) {
+      struct zsvsheet_opts zsvsheet_opts = {0};
+      read_data(&uib, NULL, uib->input_offset.row, uib->input_offset.col, di->header_span, &zsvsheet_opts,
+                state->custom_prop_handler);
+    }
+    display_buffer_subtable(uib, di->header_span, di->dimensions, &state->compare);
+    if (done)
+      break;
+    if (getch() == 27) // ESC
+      zsvsheet_job_cancel(uib->worker);
+  }
+}
+
+// pivot_open: open the pivot table written to the given file, which the buffer then owns
+static struct zsvsheet_ui_buffer *pivot_open(struct zsvsheet_proc_context *ctx, struct pivot_data *pd, char *filename,
+                                             struct zsv_index *index, enum zsvsheet_status *stat) {
+  struct zsvsheet_ui_buffer_opts uibopts = {0};
+  uibopts.data_filename = filename;
+  uibopts.write_after_open = 1;
+  if ((*stat = zsvsheet_open_file_opts(ctx, &uibopts)) != zsvsheet_status_ok) {
+    unlink(filename);
+    free(filename);
+    zsv_index_delete(index);
+    return NULL;
+  }
+  free(filename); // the buffer has its own copy, and removes the file when closed
+
+  struct zsvsheet_ui_buffer *uib = zsvsheet_buffer_current(ctx);
+  uib->index = index;
+  uib->index_started = 1;
+  uib->index_ready = 1;
+  pd->uib = uib;
+  zsvsheet_buffer_set_ctx(uib, pd, pivot_data_delete);
+  zsvsheet_buffer_set_cell_attrs(uib, get_cell_attrs);
+  zsvsheet_buffer_on_newline(uib, pivot_drill_down);
+  return uib;
+}
+
+// pivot_column_cached: group the rows by the value of the column, counting them in the column's cache
+static enum zsvsheet_status pivot_column_cached(struct zsvsheet_proc_context *ctx, struct pivot_data *pd) {
+  size_t value_count = zsv_column_cache_value_count(pd->cc);
+  uint64_t row_count = zsv_column_cache_row_count(pd->cc);
+  const uint32_t *row_values = zsv_column_cache_row_values(pd->cc);
+  uint64_t *counts = calloc(value_count ? value_count : 1, sizeof(*counts));
+  if (!counts)
+    return zsvsheet_status_memory;
+  for (uint64_t i = 0; i < row_count; i++)
+    counts[row_values[i]]++;
+  pd->agg.rows_dropped = 1; // the rows are in the cache
+  int err = 0;
+  for (size_t i = 0; i < value_count && !err; i++) {
+    size_t len;
+    const unsigned char *value = zsv_column_cache_value(pd->cc, i, &len);
+    struct zsvsheet_pivot_group *g = zsvsheet_pivot_agg_add(&pd->agg, value, len, NULL);
+    if (!g)
+      err = 1;
+    else
+      g->count = counts[i];
+  }
+  free(counts);
+
+  char *filename = NULL;
+  struct zsv_index *index = NULL;
+  enum zsvsheet_status stat;
+  if (err || pivot_write(pd, &filename, &index))
+    return zsvsheet_status_memory;
+  struct zsvsheet_ui_buffer *uib = pivot_open(ctx, pd, filename, index, &stat);
+  if (uib)
+    uib->write_done = 1;
+  return stat;
+}
+
+// pivot_column: group the rows by the value of the given column
+static enum zsvsheet_status pivot_column(struct zsvsheet_proc_context *ctx, struct pivot_data *pd) {
+  struct pivot_job *job = pivot_job_new(pd, pd->col);
+  if (!job)
+    return zsvsheet_status_error;
+
+  // read the first rows before the pivot table is shown
+  enum zsv_status zst;
+  while ((zst = pivot_job_parse(job)) == zsv_status_ok && job->row_count < ZSVSHEET_PIVOT_REFRESH_ROWS_MIN)
+    ;
+  char *filename = NULL;
+  struct zsv_index *index = NULL;
+  if (job->failed || pivot_write(pd, &filename, &index)) {
+    pivot_job_delete(job);
+    return zsvsheet_status_memory;
+  }
+
+  enum zsvsheet_status stat;
+  struct zsvsheet_ui_buffer *uib = pivot_open(ctx, pd, filename, index, &stat);
+  if (!uib) {
+    pivot_job_delete(job);
+    return stat;
+  }
+
+  if (zst != zsv_status_ok) { // the whole file has been read
+    uib->write_done = 1;
+    pivot_save_column_cache(pd, job->row_count);
+    pivot_job_delete(job);
+    return zsvsheet_status_ok;
+  }
+  job->uib = uib;
+  zsvsheet_ui_buffer_set_status(uib, "(working) Press ESC to cancel ");
+  if (zsvsheet_ui_buffer_create_worker(uib, pivot_job_run, job) != 0) {
+    uib->write_done = 1;
+    zsvsheet_ui_buffer_set_status(uib, "Pivot table incomplete: unable to start worker");
+    pivot_job_delete(job);
+    return zsvsheet_status_ok;
+  }
+  pivot_wait(ctx, uib);
+  return zsvsheet_status_ok;
+}
+
+// pivot_find_value: move the cursor to the group of the given value
+static void pivot_find_value(struct zsvsheet_proc_context *ctx, zsvsheet_buffer_t buff, const char *value) {
+  struct zsvsheet_sheet_context *state = (struct zsvsheet_sheet_context *)ctx->subcommand_context;
+  struct zsvsheet_display_info *di = &state->display_info;
+  zsvsheet_check_buffer_worker_updates(buff, di->dimensions, NULL);
+  zsvsheet_handle_find_next(di, buff, value,
+                            1, // find value in first column
+                            1, // exact
+                            1, // header_span
+                            di->dimensions, &di->update_buffer, NULL);
+}
+
 /**
  * Here we define a custom command for the zsv `sheet` feature
  */
@@ -236,6 +697,34 @@ static zsvsheet_status zsvsheet_pivot_handler(struct zsvsheet_proc_context *ctx)
   }
 
   enum zsvsheet_status zst = zsvsheet_status_ok;
+  struct zsvsheet_ui_buffer *uib = buff;
+  size_t col_offset = uib->rownum_col_offset && !uib->has_row_num ? 1 : 0;
+  if (column_name_expr && rc.col >= col_offset) {
+    struct zsvsheet_sheet_context *state = (struct zsvsheet_sheet_context *)ctx->subcommand_context;
+    struct pivot_data *pd = pivot_data_new(data_filename, expr, column_name_expr);
+    if (!pd)
+      zst = zsvsheet_status_memory;
+    else {
+      pd->native = 1;
+      pd->zopts = zsvsheet_buffer_get_zsv_opts(buff);
+      pd->custom_prop_handler = state->custom_prop_handler;
+      pd->has_row_num = uib->has_row_num;
+      pd->temp_data_file = uib->data_filename || uib->temp_filename;
+      pd->col = rc.col - col_offset;
+      if (zsvsheet_ui_buffer_seek_opts(uib, state->custom_prop_handler, &pd->row_opts))
+        pd->agg.rows_dropped = 1; // rows can't be read from their offsets; drill down in sqlite
+      else if (zsvsheet_column_cache_usable(uib, state->custom_prop_handler, &pd->row_opts))
+        pd->save_cache = !(pd->cc = zsv_column_cache_open(data_filename, &pd->zopts, pd->custom_prop_handler, pd->col));
+      if ((zst = pd->cc ? pivot_column_cached(ctx, pd) : pivot_column(ctx, pd)) != zsvsheet_status_ok) {
+        pivot_data_delete(pd);
+        zsvsheet_ui_buffer_set_status(buff, "Unable to create pivot table");
+      } else if (selected_cell_str_dup)
+        pivot_find_value(ctx, zsvsheet_buffer_current(ctx), selected_cell_str_dup);
+    }
+    free(selected_cell_str_dup);
+    return zst;
+  }
+
   // interactive (no flag surface): disambiguate duplicate input columns; warn off for curses
   struct zsv_sqlite3_dbopts dbopts = {.dedupe_cols = 1};
   struct zsv_opts zopts = zsvsheet_buffer_get_zsv_opts(buff);
@@ -294,16 +783,8 @@ static zsvsheet_status zsvsheet_pivot_handler(struct zsvsheet_proc_context *ctx)
             napms(200); // sleep for 200ms, then check index again
           // TO DO: fix this if there is no data!
 
-          if (selected_cell_str_dup) {
-            struct zsvsheet_sheet_context *state = (struct zsvsheet_sheet_context *)ctx->subcommand_context;
-            struct zsvsheet_display_info *di = &state->display_info;
-            zsvsheet_check_buffer_worker_updates(buff, di->dimensions, NULL);
-            zsvsheet_handle_find_next(di, buff, selected_cell_str_dup,
-                                      1, // find value in first column
-                                      1, // exact
-                                      1, // header_span
-                                      di->dimensions, &di->update_buffer, NULL);
-          }
+          if (selected_cell_str_dup)
+            pivot_find_value(ctx, buff, selected_cell_str_dup);
         }
       }
     }
@@ -0,0 +1,88 @@
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "pivot_agg.h"
+
+static void zsvsheet_pivot_agg_drop_rows(struct zsvsheet_pivot_agg *agg) {
+  for (size_t i = 0, n = zsvsheet_pivot_agg_count(agg); i < n; i++) {
+    struct zsvsheet_pivot_group *g = zsv_hash_set_value(agg->groups, i);
+    free(g->rows);
+    g->rows = NULL;
+    g->rows_capacity = 0;
+  }
+  agg->row_bytes = 0;
+  agg->rows_dropped = 1;
+}
+
+static int zsvsheet_pivot_agg_add_row(struct zsvsheet_pivot_agg *agg, struct zsvsheet_pivot_group *g,
+                                      const struct zsv_key_index_match *row) {
+  if (g->count == g->rows_capacity) {
+    size_t capacity = g->rows_capacity ? g->rows_capacity * 2 : 4;
+    size_t added = (capacity - g->rows_capacity) * sizeof(*g->rows);
+    if (agg->row_bytes + added > ZSVSHEET_PIVOT_AGG_MAX_ROW_BYTES) {
+      zsvsheet_pivot_agg_drop_rows(agg);
+      return 0;
+    }
+    struct zsv_key_index_match *rows = realloc(g->rows, capacity * sizeof(*rows));
+    if (!rows)
+      return 1;
+    g->rows = rows;
+    g->rows_capacity = capacity;
+    agg->row_bytes += added;
+  }
+  g->rows[g->count] = *row;
+  return 0;
+}
+
+size_t zsvsheet_pivot_agg_count(struct zsvsheet_pivot_agg *agg) {
+  return agg->groups ? zsv_hash_set_count(agg->groups) : 0;
+}
+
+struct zsvsheet_pivot_group *zsvsheet_pivot_agg_add(struct zsvsheet_pivot_agg *agg, const unsigned char *value,
+                                                    size_t len, const struct zsv_key_index_match *row) {
+  if (!agg->groups && !(agg->groups = zsv_hash_set_new(sizeof(struct zsvsheet_pivot_group))))
+    return NULL;
+  char added = 0;
+  size_t ix = zsv_hash_set_add(agg->groups, zsv_hash(value, len), value, len, &added);
+  if (ix == ZSV_HASH_SET_NONE)
+    return NULL;
+  struct zsvsheet_pivot_group *g = zsv_hash_set_value(agg->groups, ix);
+  if (added)
+    g->value = zsv_hash_set_key(agg->groups, ix, &g->len);
+  if (row && !agg->rows_dropped && zsvsheet_pivot_agg_add_row(agg, g, row))
+    return NULL;
+  g->count++;
+  return g;
+}
+
+struct zsvsheet_pivot_group *zsvsheet_pivot_agg_find(struct zsvsheet_pivot_agg *agg, const unsigned char *value,
+                                                     size_t len) {
+  size_t ix = agg->groups ? zsv_hash_set_find(agg->groups, zsv_hash(value, len), value, len) : ZSV_HASH_SET_NONE;
+  return ix == ZSV_HASH_SET_NONE ? NULL : zsv_hash_set_value(agg->groups, ix);
+}
+
+static int zsvsheet_pivot_group_cmp(const void *x, const void *y) {
+  const struct zsvsheet_pivot_group *a = *(struct zsvsheet_pivot_group *const *)x;
+  const struct zsvsheet_pivot_group *b = *(struct zsvsheet_pivot_group *const *)y;
+  int c = memcmp(a->value, b->value, a->len < b->len ? a->len : b->len);
+  return c ? c : a->len < b->len ? -1 : a->len > b->len;
+}
+
+struct zsvsheet_pivot_group **zsvsheet_pivot_agg_sorted(struct zsvsheet_pivot_agg *agg) {
+  size_t n = zsvsheet_pivot_agg_count(agg);
+  struct zsvsheet_pivot_group **sorted = malloc((n ? n : 1) * sizeof(*sorted));
+  if (sorted) {
+    for (size_t i = 0; i < n; i++)
+      sorted[i] = zsv_hash_set_value(agg->groups, i);
+    qsort(sorted, n, sizeof(*sorted), zsvsheet_pivot_group_cmp);
+  }
+  return sorted;
+}
+
+void zsvsheet_pivot_agg_clear(struct zsvsheet_pivot_agg *agg) {
+  for (size_t i = 0, n = zsvsheet_pivot_agg_count(agg); i < n; i++)
+    free(((struct zsvsheet_pivot_group *)zsv_hash_set_value(agg->groups, i))->rows);
+  zsv_hash_set_delete(agg->groups);
+  memset(agg, 0, sizeof(*agg));
+}
@@ -0,0 +1,60 @@
+#ifndef SHEET_PIVOT_AGG_H
+#define SHEET_PIVOT_AGG_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "../utils/key_index.h" // struct zsv_key_index_match
+#include "../utils/hash.h"
+
+/*
+ * Streaming hash aggregation for the pivot table
+ *
+ * Rows are grouped by the value of one column as the file is read. Each distinct value is
+ * interned once in a zsv_hash_set, and its group holds a count and the rows that have the value
+ * (row number, offset and length), so that a group's rows can be read back directly. If
+ * the row lists would exceed ZSVSHEET_PIVOT_AGG_MAX_ROW_BYTES, they are dropped and only
+ * the counts are kept
+ */
+
+#define ZSVSHEET_PIVOT_AGG_MAX_ROW_BYTES ((size_t)512 * 1024 * 1024)
+
+struct zsvsheet_pivot_group {
+  const unsigned char *value; // interned in the set of groups
+  size_t len;
+  uint64_t count;
+  struct zsv_key_index_match *rows; // count entries, in row order, unless rows_dropped
+  size_t rows_capacity;
+};
+
+struct zsvsheet_pivot_agg {
+  zsv_hash_set groups; // distinct values, each with its struct zsvsheet_pivot_group
+  size_t row_bytes;
+  unsigned char rows_dropped : 1; // row lists were not kept; counts only
+  unsigned char _ : 7;
+};
+
+/**
+ * Add a row to the group of the given value. If row is NULL, only the count is kept.
+ * Returns the group, which is only valid until the next call, or NULL if out of memory
+ */
+struct zsvsheet_pivot_group *zsvsheet_pivot_agg_add(struct zsvsheet_pivot_agg *agg, const unsigned char *value,
+                                                    size_t len, const struct zsv_key_index_match *row);
+
+size_t zsvsheet_pivot_agg_count(struct zsvsheet_pivot_agg *agg);
+
+/**
+ * Get the group of the given value, or NULL if there is none
+ */
+struct zsvsheet_pivot_group *zsvsheet_pivot_agg_find(struct zsvsheet_pivot_agg *agg, const unsigned char *value,
+                                                     size_t len);
+
+/**
+ * Get the groups ordered by value (bytewise, as in sql's default collation). Caller must
+ * free the returned array, which is only valid until the next call to _add()
+ */
+struct zsvsheet_pivot_group **zsvsheet_pivot_agg_sorted(struct zsvsheet_pivot_agg *agg);
+
+void zsvsheet_pivot_agg_clear(struct zsvsheet_pivot_agg *agg);
+
+#endif
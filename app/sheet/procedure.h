@@ -42,7 +42,10 @@ enum {
   zsvsheet_builtin_proc_pivot_cur_col,
   zsvsheet_builtin_proc_errors,
   zsvsheet_builtin_proc_errors_clear,
-  zsvsheet_builtin_proc_compare
+  zsvsheet_builtin_proc_compare,
+  zsvsheet_builtin_proc_sort,
+  zsvsheet_builtin_proc_sort_desc,
+  zsvsheet_builtin_proc_stats
 };
 
 #define ZSVSHEET_PROC_INVALID 0
@@ -5,6 +5,7 @@
 #include "sheet_internal.h"
 #include "screen_buffer.h"
 #include "../utils/index.h"
+#include "../utils/key_index.h"
 #include "index.h"
 
 #if defined(WIN32) || defined(_WIN32)
@@ -42,7 +43,7 @@ static size_t zsvsheet_found_in_row(zsv_parser parser, size_t col_start, size_t
   return 0;
 }
 
-static void *get_data_index(void *d);
+static void get_data_index(struct zsvsheet_job *job, void *d);
 
 static void get_data_index_async(struct zsvsheet_ui_buffer *uibuffp, const char *filename, struct zsv_opts *optsp,
                                  struct zsv_prop_handler *custom_prop_handler, char *old_ui_status) {
@@ -61,9 +62,8 @@ static void get_data_index_async(struct zsvsheet_ui_buffer *uibuffp, const char
   ixopts->uib->ixopts = ixopts;
   ixopts->old_ui_status = old_ui_status;
 
-  if (uibuffp->worker_active)
-    zsvsheet_ui_buffer_join_worker(uibuffp);
-  if (zsvsheet_ui_buffer_create_worker(uibuffp, get_data_index, ixopts) != 0) {
+  if (zsvsheet_ui_buffer_start_job(uibuffp, &uibuffp->index_job, zsvsheet_job_priority_background, get_data_index,
+                                   ixopts) != 0) {
     free(uibuffp->status); // restore the pre-"(building index)" status
     uibuffp->status = old_ui_status;
     uibuffp->status_is_index_placeholder = 0;
@@ -72,6 +72,124 @@ static void get_data_index_async(struct zsvsheet_ui_buffer *uibuffp, const char
   }
 }
 
+static void read_data_write_rownum(zsvsheet_screen_buffer_t buffer, size_t row, size_t rownum) {
+  char buff[32];
+  int n = snprintf(buff, sizeof(buff), "%zu", rownum);
+  if (!(n > 0 && n < (int)sizeof(buff)))
+    sprintf(buff, "########");
+  zsvsheet_screen_buffer_write_cell(buffer, row, 0, (unsigned char *)buff);
+}
+
+// zsvsheet_ui_buffer_seek_opts: get the options, as merged with saved properties, with which to
+// parse the buffer's data file from a row offset in the index. Returns non-zero if the file
+// can't be read that way, e.g. because it has overwrites, which are keyed by row position
+static int zsvsheet_ui_buffer_seek_opts(struct zsvsheet_ui_buffer *uibuff, struct zsv_prop_handler *custom_prop_handler,
+                                        struct zsv_opts *opts) {
+  const char *filename = uibuff->data_filename ? uibuff->data_filename : uibuff->filename;
+  zsv_parser parser = NULL;
+  *opts = uibuff->zsv_opts;
+  if (!filename || !(opts->stream = fopen(filename, "rb")))
+    return 1;
+  opts->errprintf = zsv_no_printf;
+  opts->errf = NULL;
+  enum zsv_status zst = zsv_new_with_properties(opts, custom_prop_handler, filename, &parser);
+  zsv_delete(parser);
+  fclose(opts->stream);
+  opts->stream = NULL;
+  if (zst != zsv_status_ok || opts->overwrite.next)
+    return 1;
+  opts->header_span = 0;
+  opts->rows_to_ignore = 0;
+  return 0;
+}
+
+// read_data_from_block_cache: fill the buffer's data rows from the block cache, once the
+// row index is ready; then request prefetch of the neighboring blocks. Returns 0 on
+// success, else non-zero, in which case read_data() reads the file directly
+static int read_data_from_block_cache(struct zsvsheet_ui_buffer *uibuff, size_t start_row, size_t start_col,
+                                      size_t header_span, struct zsvsheet_opts *zsvsheet_opts,
+                                      struct zsv_prop_handler *custom_prop_handler) {
+  if (uibuff->block_cache_off || !header_span)
+    return 1;
+  pthread_mutex_lock(&uibuff->mutex);
+  // a file still being written may end in a partial row, which must not be cached
+  int usable = zsvsheet_ui_buffer_index_ready(uibuff, 1) && !(uibuff->write_in_progress && !uibuff->write_done);
+  pthread_mutex_unlock(&uibuff->mutex);
+  if (!usable)
+    return 1;
+
+  if (!uibuff->block_cache) {
+    struct zsv_opts opts;
+    if (zsvsheet_ui_buffer_seek_opts(uibuff, custom_prop_handler, &opts)) {
+      uibuff->block_cache_off = 1;
+      return 1;
+    }
+    const char *filename = uibuff->data_filename ? uibuff->data_filename : uibuff->filename;
+    if (!(uibuff->block_cache = zsvsheet_block_cache_new(uibuff, filename, &opts)))
+      return 1;
+  }
+
+  zsvsheet_screen_buffer_t buffer = uibuff->buffer;
+  if (uibuff->has_row_num)
+    zsvsheet_opts->hide_row_nums = 1;
+  size_t rows_read = header_span;
+  size_t row = start_row;
+  char at_end = 0;
+  while (!at_end && rows_read < zsvsheet_screen_buffer_rows(buffer)) {
+    struct zsvsheet_block *blk = zsvsheet_block_cache_get(uibuff->block_cache, row >> ZSV_INDEX_ROW_SHIFT);
+    if (!blk)
+      return 1;
+    const unsigned char *p = blk->data;
+    for (size_t i = 0; i < blk->row_count && rows_read < zsvsheet_screen_buffer_rows(buffer); i++) {
+      uint32_t col_count, len;
+      memcpy(&col_count, p, sizeof(col_count));
+      p += sizeof(col_count);
+      if (i < (row & (ZSV_INDEX_ROW_N - 1))) { // before the first row to display
+        for (uint32_t j = 0; j < col_count; j++, p += len) {
+          memcpy(&len, p, sizeof(len));
+          p += sizeof(len);
+        }
+        continue;
+      }
+      if (col_count + !buffer->opts.no_rownum_column > buffer->cols &&
+          zsvsheet_screen_buffer_grow(buffer, col_count) != zsvsheet_priv_status_ok) {
+        zsvsheet_block_cache_release(uibuff->block_cache);
+        return -1;
+      }
+      if (col_count > uibuff->dimensions.col_count)
+        uibuff->dimensions.col_count = col_count;
+
+      zsvsheet_screen_buffer_clear_row(buffer, rows_read);
+      size_t rownum_column_offset = 0;
+      if (zsvsheet_opts->hide_row_nums == 0) {
+        read_data_write_rownum(buffer, rows_read, header_span + row);
+        rownum_column_offset = 1;
+      }
+      for (uint32_t j = 0; j < col_count; j++, p += len) {
+        memcpy(&len, p, sizeof(len));
+        p += sizeof(len);
+        if (len && j >= start_col && j + rownum_column_offset < zsvsheet_screen_buffer_cols(buffer))
+          zsvsheet_screen_buffer_write_cell_w_len(buffer, rows_read, j + rownum_column_offset, p, len);
+      }
+      rows_read++;
+      row++;
+    }
+    at_end = blk->row_count < ZSV_INDEX_ROW_N;
+    zsvsheet_block_cache_release(uibuff->block_cache);
+  }
+
+  if (rows_read > uibuff->buff_used_rows) {
+    uibuff->buff_used_rows = rows_read;
+    uibuff->dimensions.row_count = rows_read;
+  }
+  zsvsheet_block_cache_prefetch(uibuff->block_cache, start_row, row > start_row ? row - 1 : start_row);
+  return 0;
+}
+
+static int read_data_from_row_view(struct zsvsheet_ui_buffer *uibuff, size_t start_row, size_t start_col,
+                                   size_t header_span, struct zsvsheet_opts *zsvsheet_opts,
+                                   struct zsv_prop_handler *custom_prop_handler);
+
 static int read_data(struct zsvsheet_ui_buffer **uibufferp,   // a new zsvsheet_ui_buffer will be allocated
                      struct zsvsheet_ui_buffer_opts *uibopts, // if *uibufferp == NULL and uibopts != NULL
                      size_t start_row, size_t start_col, size_t header_span, struct zsvsheet_opts *zsvsheet_opts,
@@ -89,6 +207,15 @@ static int read_data(struct zsvsheet_ui_buffer **uibufferp,   // a new zsvsheet_
     opts = uibopts->zsv_opts;
 
   struct zsvsheet_ui_buffer *uibuff = uibufferp ? *uibufferp : NULL;
+  if (uibuff && uibuff->row_view) {
+    uib_parse_errs_clear(&parse_errs);
+    return read_data_from_row_view(uibuff, start_row, start_col, header_span, zsvsheet_opts, custom_prop_handler);
+  }
+  if (uibuff && !zsvsheet_opts->find &&
+      !read_data_from_block_cache(uibuff, start_row, start_col, header_span, zsvsheet_opts, custom_prop_handler)) {
+    uib_parse_errs_clear(&parse_errs);
+    return 0;
+  }
   size_t remaining_rows_to_skip = start_row;
   size_t remaining_header_to_skip = header_span;
   size_t original_row_num = 0;
@@ -177,6 +304,9 @@ static int read_data(struct zsvsheet_ui_buffer **uibufferp,   // a new zsvsheet_
         rc = -1;
         goto done;
       }
+      // the file can be read again when other columns are displayed, so hold only those near the
+      // ones displayed (see zsvsheet_fit_buffer_window())
+      zsvsheet_screen_buffer_set_window(buffer, 0, 2 * ZSVSHEET_SCREEN_BUFFER_WINDOW_MARGIN);
       *uibufferp = uibuff = tmp_uibuff;
       if (uibuff) {
         uibuff->parse_errs = parse_errs;            // transfer errors
@@ -242,16 +372,12 @@ static int read_data(struct zsvsheet_ui_buffer **uibufferp,   // a new zsvsheet_
       continue;
     }
 
+    zsvsheet_screen_buffer_clear_row(buffer, rows_read);
     if (zsvsheet_opts->hide_row_nums == 0) {
       if (rows_read == 0) // header
         zsvsheet_screen_buffer_write_cell(buffer, 0, 0, (const unsigned char *)ZSVSHEET_ROWNUM_HEADER);
-      else {
-        char buff[32];
-        int n = snprintf(buff, sizeof(buff), "%zu", original_row_num - 1);
-        if (!(n > 0 && n < (int)sizeof(buff)))
-          sprintf(buff, "########");
-        zsvsheet_screen_buffer_write_cell(buffer, rows_read, 0, (unsigned char *)buff);
-      }
+      else
+        read_data_write_rownum(buffer, rows_read, original_row_num - 1);
       rownum_column_offset = 1;
     }
 
@@ -305,11 +431,12 @@ done:
 }
 
 // get_data_index(): return an index for constant-time access
-static void *get_data_index(void *gdi) {
+static void get_data_index(struct zsvsheet_job *job, void *gdi) {
   struct zsvsheet_index_opts *d = gdi;
   pthread_mutex_t *mutexp = d->mutexp;
   struct zsvsheet_ui_buffer *uib = d->uib;
 
+  d->job = job;
   enum zsv_index_status ix_status = build_memory_index(d);
 
   pthread_mutex_lock(mutexp);
@@ -327,57 +454,4 @@ static void *get_data_index(void *gdi) {
 
   free(to_free);
   free(d);
-
-  return NULL;
-}
-
-// Search the in-memory screen buffer for the next match after the cursor cell. Used for
-// static buffers (help/errors) that have no data file; scans row-major and sets
-// found_rownum/found_colnum in buffer coords (these buffers have no row-number column).
-static void zsvsheet_find_next_in_buffer(struct zsvsheet_ui_buffer *uib, struct zsvsheet_opts *zsvsheet_opts,
-                                         size_t header_span) {
-  const char *needle = zsvsheet_opts->find;
-  if (!needle)
-    return;
-  zsvsheet_screen_buffer_t buffer = uib->buffer;
-  size_t needle_len = strlen(needle);
-  size_t row_count = uib->dimensions.row_count;
-  size_t col_count = uib->dimensions.col_count;
-  size_t from_row = uib->input_offset.row + uib->buff_offset.row + uib->cursor_row;
-  size_t from_col = uib->cursor_col + uib->buff_offset.col;
-  if (from_row < header_span)
-    from_row = header_span;
-  for (size_t r = from_row; r < row_count; r++) {
-    for (size_t c = (r == from_row ? from_col + 1 : 0); c < col_count; c++) {
-      if (zsvsheet_opts->find_specified_column_plus_1 && c + 1 != zsvsheet_opts->find_specified_column_plus_1)
-        continue;
-      const unsigned char *cell = zsvsheet_screen_buffer_cell_display(buffer, r, c);
-      if (!cell)
-        continue;
-      size_t cell_len = strlen((const char *)cell);
-      if (zsvsheet_opts->find_exact ? (cell_len == needle_len && !memcmp(cell, needle, needle_len))
-                                    : (memmem(cell, cell_len, needle, needle_len) != NULL)) {
-        zsvsheet_opts->found_rownum = r;
-        zsvsheet_opts->found_colnum = c;
-        return;
-      }
-    }
-  }
-}
-
-static size_t zsvsheet_find_next(struct zsvsheet_ui_buffer *uib, struct zsvsheet_opts *zsvsheet_opts,
-                                 size_t header_span, struct zsv_prop_handler *custom_prop_handler) {
-  if (!uib->data_filename && !uib->filename) // static buffer: no data file, scan screen buffer
-    zsvsheet_find_next_in_buffer(uib, zsvsheet_opts, header_span);
-  else {
-    struct zsvsheet_rowcol *input_offset = &uib->input_offset;
-    struct zsvsheet_rowcol *buff_offset = &uib->buff_offset;
-    size_t cursor_row = uib->cursor_row;
-    size_t start_row = input_offset->row + buff_offset->row + header_span + cursor_row - 1;
-    if (start_row > 0)
-      start_row--;
-    read_data(&uib, NULL, start_row, 0, header_span, zsvsheet_opts, custom_prop_handler);
-  }
-  zsvsheet_opts->find = NULL;
-  return zsvsheet_opts->found_rownum;
 }
@@ -0,0 +1,702 @@
+/*
+ * Row views: buffers that show rows of a data file without writing them out
+ *
+ * A row view holds where each row that it shows is in the file it views, and reads the rows
+ * that are displayed or searched directly from their offsets. A sorted view (see sort.c) holds
+ * the order of the file's data rows, as positions in a column cache; a selection, such as the
+ * rows that pass a filter, holds the number, offset and length of each row (24 bytes per row).
+ * A view made from a row view reads from the same file, so filtering a view scans only the rows
+ * that it shows, and stacked filters never write a temporary file.
+ *
+ * A view of only some of the file's rows shows their row numbers in a Row # column of its own,
+ * as the output of a transformation does. Its rows are written to a temporary file only when
+ * its data file is requested, e.g. for a pivot table or an extension's transformation
+ */
+
+#include <inttypes.h>
+#include "../utils/column_cache.h"
+#include "../utils/key_index.h" // struct zsv_key_index_match
+
+#define ZSVSHEET_ROWS_READ_BYTES (1024 * 1024)
+#define ZSVSHEET_ROWS_CHUNK_BYTES (4 * 1024 * 1024)
+
+// rows are read from their offsets this many at a time
+#define ZSVSHEET_ROW_VIEW_BATCH 4096
+
+// zsvsheet_rows_reader: reads rows, in order of offset, through a window of the file
+struct zsvsheet_rows_reader {
+  FILE *f;
+  unsigned char *buff;
+  size_t capacity;
+  size_t window;  // bytes to read at a time; 0 = ZSVSHEET_ROWS_READ_BYTES
+  uint64_t start; // offset of buff in the file
+  size_t len;
+};
+
+static int zsvsheet_rows_reader_read(struct zsvsheet_rows_reader *r, uint64_t offset, size_t len, unsigned char *out) {
+  if (offset < r->start || offset + len > r->start + r->len) {
+    size_t window = r->window ? r->window : ZSVSHEET_ROWS_READ_BYTES;
+    size_t capacity = len > window ? len : window;
+    if (capacity > r->capacity) {
+      unsigned char *tmp = realloc(r->buff, capacity);
+      if (!tmp)
+        return 1;
+      r->buff = tmp;
+      r->capacity = capacity;
+    }
+    if (fseeko(r->f, (off_t)offset, SEEK_SET))
+      return 1;
+    r->start = offset;
+    r->len = fread(r->buff, 1, capacity, r->f);
+    if (r->len < len)
+      return 1;
+  }
+  memcpy(out, r->buff + (offset - r->start), len);
+  return 0;
+}
+
+// zsvsheet_read_rows: read and parse the given rows, calling on_row with the parser positioned
+// at each one, until on_row returns non-zero. Returns the number of rows passed to on_row
+static size_t zsvsheet_read_rows(struct zsvsheet_rows_reader *r, const struct zsv_opts *row_opts,
+                                 const struct zsv_key_index_match *rows, size_t count,
+                                 int (*on_row)(void *ctx, zsv_parser parser, const struct zsv_key_index_match *row),
+                                 void *ctx) {
+  const char *le = "\n";
+#ifndef ZSV_NO_ONLY_CRLF
+  if (row_opts->only_crlf_rowend)
+    le = "\r\n";
+#endif
+  size_t le_len = strlen(le);
+  unsigned char *mem = NULL;
+  size_t mem_capacity = 0, done = 0;
+  char stop = 0;
+  for (size_t i = 0; i < count && !stop;) {
+    // read a chunk of rows, each followed by a line end, then parse them
+    size_t start = i, mem_len = 0;
+    for (; i < count && (i == start || mem_len + rows[i].len + le_len <= ZSVSHEET_ROWS_CHUNK_BYTES); i++) {
+      size_t len = (size_t)rows[i].len;
+      if (mem_len + len + le_len > mem_capacity) {
+        size_t capacity = mem_len + len + le_len > ZSVSHEET_ROWS_CHUNK_BYTES ? mem_len + len + le_len
+                                                                              : ZSVSHEET_ROWS_CHUNK_BYTES;
+        unsigned char *tmp = realloc(mem, capacity);
+        if (!tmp)
+          goto out;
+        mem = tmp;
+        mem_capacity = capacity;
+      }
+      if (zsvsheet_rows_reader_read(r, rows[i].offset, len, mem + mem_len))
+        goto out;
+      memcpy(mem + mem_len + len, le, le_len);
+      mem_len += len + le_len;
+    }
+
+    struct zsvsheet_find_mem m = {mem, mem_len, 0};
+    struct zsv_opts opts;
+    zsv_chunk_opts(&opts, row_opts, NULL, NULL, NULL);
+    opts.stream = &m;
+    opts.read = zsvsheet_find_mem_read;
+    zsv_parser parser = zsv_new(&opts);
+    if (!parser)
+      goto out;
+    while (!stop && done < i && zsv_next_row(parser) == zsv_status_row)
+      stop = on_row(ctx, parser, &rows[done++]) != 0;
+    zsv_delete(parser);
+    if (!stop && done != i) // the rows did not parse as expected
+      break;
+  }
+out:
+  free(mem);
+  return done;
+}
+
+struct zsvsheet_row_view {
+  char *filename;           // the file whose rows are shown
+  struct zsv_opts opts;     // options with which to parse the file from its start
+  struct zsv_opts row_opts; // options with which to parse rows read from their offsets
+  struct zsv_prop_handler *custom_prop_handler;
+
+  zsv_column_cache cc; // sorted view: the sort column, with the offset and length of each row
+  uint32_t *rows;      // sorted view: the 0-based data row shown in each row of the view
+
+  struct zsv_key_index_match *selection; // selection: the number, offset and length of each row shown
+  size_t selection_capacity;
+
+  uint64_t row_count; // rows shown; a selection still being made grows under the buffer's mutex
+  struct zsvsheet_rows_reader reader;
+  unsigned char subset : 1;      // only some of the file's data rows are shown
+  unsigned char add_row_num : 1; // the row numbers are shown in a Row # column of the view's own
+  unsigned char _ : 6;
+};
+
+static void zsvsheet_row_view_delete(struct zsvsheet_row_view *v) {
+  if (v) {
+    free(v->filename);
+    zsv_column_cache_close(v->cc);
+    free(v->rows);
+    free(v->selection);
+    free(v->reader.buff);
+    if (v->reader.f)
+      fclose(v->reader.f);
+    free(v);
+  }
+}
+
+static struct zsvsheet_row_view *zsvsheet_row_view_new(const char *filename, const struct zsv_opts *opts,
+                                                       const struct zsv_opts *row_opts,
+                                                       struct zsv_prop_handler *custom_prop_handler) {
+  struct zsvsheet_row_view *v = calloc(1, sizeof(*v));
+  if (v) {
+    v->opts = *opts;
+    v->row_opts = *row_opts;
+    v->custom_prop_handler = custom_prop_handler;
+    if (!(v->filename = strdup(filename)) || !(v->reader.f = fopen(filename, "rb"))) {
+      zsvsheet_row_view_delete(v);
+      return NULL;
+    }
+  }
+  return v;
+}
+
+// zsvsheet_row_view_new_from: create a view of the rows of the buffer's data file or, if the
+// buffer is itself a row view, of the file that it views. If subset is set, the view will
+// show only some of them. Returns NULL if the rows can't be read from their offsets
+static struct zsvsheet_row_view *zsvsheet_row_view_new_from(struct zsvsheet_ui_buffer *uib,
+                                                            struct zsv_prop_handler *custom_prop_handler,
+                                                            char subset) {
+  struct zsvsheet_row_view *from = uib->row_view, *v;
+  if (from) {
+    if ((v = zsvsheet_row_view_new(from->filename, &from->opts, &from->row_opts, from->custom_prop_handler))) {
+      v->subset = from->subset;
+      v->add_row_num = from->add_row_num;
+      v->reader.window = from->reader.window;
+    }
+  } else {
+    struct zsv_opts row_opts;
+    if (zsvsheet_ui_buffer_seek_opts(uib, custom_prop_handler, &row_opts))
+      return NULL;
+    v = zsvsheet_row_view_new(uib->data_filename ? uib->data_filename : uib->filename, &uib->zsv_opts, &row_opts,
+                              custom_prop_handler);
+  }
+  if (v && subset) {
+    v->subset = 1;
+    v->add_row_num |= !uib->has_row_num;
+  }
+  return v;
+}
+
+// zsvsheet_row_view_temp_filename: whether the file of a view made from the buffer is another
+// buffer's temporary data file
+static char zsvsheet_row_view_temp_filename(struct zsvsheet_ui_buffer *uib) {
+  if (uib->row_view)
+    return uib->temp_filename;
+  return uib->data_filename || uib->temp_filename;
+}
+
+// zsvsheet_row_view_get: get the number, offset and length of the given (0-based) row of the view
+static void zsvsheet_row_view_get(const struct zsvsheet_row_view *v, uint64_t i, struct zsv_key_index_match *row) {
+  if (v->cc) {
+    row->row = (uint64_t)v->rows[i] + 1;
+    zsv_column_cache_row(v->cc, v->rows[i], &row->offset, &row->len);
+  } else
+    *row = v->selection[i];
+}
+
+// zsvsheet_row_view_add: add rows to a selection
+static int zsvsheet_row_view_add(struct zsvsheet_row_view *v, const struct zsv_key_index_match *rows, size_t count) {
+  if (v->row_count + count > v->selection_capacity) {
+    size_t capacity = v->selection_capacity ? v->selection_capacity * 2 : 1024;
+    while (capacity < v->row_count + count)
+      capacity *= 2;
+    struct zsv_key_index_match *tmp = realloc(v->selection, capacity * sizeof(*tmp));
+    if (!tmp)
+      return 1;
+    v->selection = tmp;
+    v->selection_capacity = capacity;
+  }
+  memcpy(v->selection + v->row_count, rows, count * sizeof(*rows));
+  v->row_count += count;
+  return 0;
+}
+
+// zsvsheet_row_view_read: read rows start to end of the view through the given reader, as
+// zsvsheet_read_rows() does. If mutex is set, it guards a selection that may still be growing.
+// Returns the number of rows passed to on_row
+static uint64_t zsvsheet_row_view_read(struct zsvsheet_row_view *v, struct zsvsheet_rows_reader *reader,
+                                       pthread_mutex_t *mutex, uint64_t start, uint64_t end,
+                                       int (*on_row)(void *ctx, zsv_parser parser,
+                                                     const struct zsv_key_index_match *row),
+                                       void *ctx) {
+  struct zsv_key_index_match *rows = malloc(ZSVSHEET_ROW_VIEW_BATCH * sizeof(*rows));
+  uint64_t done = 0;
+  for (uint64_t i = start; rows && i < end;) {
+    size_t n = end - i < ZSVSHEET_ROW_VIEW_BATCH ? (size_t)(end - i) : ZSVSHEET_ROW_VIEW_BATCH;
+    if (mutex)
+      pthread_mutex_lock(mutex);
+    for (size_t j = 0; j < n; j++)
+      zsvsheet_row_view_get(v, i + j, &rows[j]);
+    if (mutex)
+      pthread_mutex_unlock(mutex);
+    size_t read = zsvsheet_read_rows(reader, &v->row_opts, rows, n, on_row, ctx);
+    done += read;
+    if (read != n)
+      break;
+    i += n;
+  }
+  free(rows);
+  return done;
+}
+
+struct zsvsheet_row_view_read_ctx {
+  struct zsvsheet_ui_buffer *uib;
+  struct zsvsheet_opts *zsvsheet_opts;
+  size_t start_col;
+  size_t rows_read; // rows of the screen buffer filled so far
+  size_t row;       // 0-based view row of the next row read
+  size_t find_len;
+  char found;
+  char err;
+};
+
+// zsvsheet_row_view_write_row: write the parser's current row to the given row of the screen buffer
+static int zsvsheet_row_view_write_row(struct zsvsheet_row_view_read_ctx *c, zsv_parser parser, size_t buff_row,
+                                       const unsigned char *rownum, size_t rownum_len) {
+  struct zsvsheet_ui_buffer *uib = c->uib;
+  zsvsheet_screen_buffer_t buffer = uib->buffer;
+  size_t add_row_num = uib->row_view->add_row_num;
+  size_t col_count = zsv_cell_count(parser) + add_row_num;
+  if (col_count + !buffer->opts.no_rownum_column > buffer->cols &&
+      zsvsheet_screen_buffer_grow(buffer, col_count) != zsvsheet_priv_status_ok)
+    return 1;
+  if (col_count > uib->dimensions.col_count)
+    uib->dimensions.col_count = col_count;
+
+  zsvsheet_screen_buffer_clear_row(buffer, buff_row); // drop what it held for rows shown before
+  size_t rownum_column_offset = 0;
+  if (c->zsvsheet_opts->hide_row_nums == 0 || add_row_num) {
+    zsvsheet_screen_buffer_write_cell_w_len(buffer, buff_row, 0, rownum, rownum_len);
+    rownum_column_offset = 1;
+  }
+  for (size_t i = c->start_col;
+       i + add_row_num < col_count && i + rownum_column_offset < zsvsheet_screen_buffer_cols(buffer); i++) {
+    struct zsv_cell cell = zsv_get_cell(parser, i);
+    zsvsheet_screen_buffer_write_cell_w_len(buffer, buff_row, i + rownum_column_offset, cell.str, cell.len);
+  }
+  return 0;
+}
+
+static int zsvsheet_row_view_on_row(void *ctx, zsv_parser parser, const struct zsv_key_index_match *row) {
+  struct zsvsheet_row_view_read_ctx *c = ctx;
+  struct zsvsheet_opts *zsvsheet_opts = c->zsvsheet_opts;
+  c->row++;
+  if (zsvsheet_opts->find) { // find the next occurrence, as read_data() does
+    // columns of the view are columns of the file, after any Row # column of the view's own
+    size_t add_row_num = c->uib->row_view->add_row_num;
+    size_t col_start = zsvsheet_opts->found_colnum > add_row_num ? zsvsheet_opts->found_colnum - add_row_num : 0;
+    size_t specified_column_plus_1 = zsvsheet_opts->find_specified_column_plus_1;
+    size_t col_ix_plus_1 = 0;
+    if (!specified_column_plus_1 || specified_column_plus_1 > add_row_num)
+      col_ix_plus_1 = zsvsheet_found_in_row(parser, col_start, zsv_cell_count(parser), zsvsheet_opts->find, c->find_len,
+                                            specified_column_plus_1 ? specified_column_plus_1 - add_row_num : 0,
+                                            zsvsheet_opts->find_exact);
+    if (col_ix_plus_1) {
+      zsvsheet_opts->found_rownum = c->row;
+      zsvsheet_opts->found_colnum = col_ix_plus_1 - 1 + add_row_num;
+      c->found = 1;
+      return 1;
+    }
+    zsvsheet_opts->found_colnum = 0; // next row search starts at beg of row
+    return 0;
+  }
+
+  char rownum[32];
+  int n = snprintf(rownum, sizeof(rownum), "%" PRIu64, row->row);
+  if (!(n > 0 && n < (int)sizeof(rownum)))
+    n = snprintf(rownum, sizeof(rownum), "########");
+  if (zsvsheet_row_view_write_row(c, parser, c->rows_read, (const unsigned char *)rownum, (size_t)n)) {
+    c->err = 1;
+    return 1;
+  }
+  c->rows_read++;
+  return 0;
+}
+
+// zsvsheet_row_view_read_header: write the viewed file's header to the first row of the screen buffer
+static int zsvsheet_row_view_read_header(struct zsvsheet_row_view_read_ctx *c) {
+  struct zsvsheet_row_view *v = c->uib->row_view;
+  struct zsv_opts opts = v->opts;
+  opts.errprintf = zsv_no_printf;
+  opts.errf = NULL;
+  if (!(opts.stream = fopen(v->filename, "rb")))
+    return 1;
+  zsv_parser parser = NULL;
+  int err = 1;
+  if (zsv_new_with_properties(&opts, v->custom_prop_handler, v->filename, &parser) == zsv_status_ok &&
+      zsv_next_row(parser) == zsv_status_row)
+    err = zsvsheet_row_view_write_row(c, parser, 0, (const unsigned char *)ZSVSHEET_ROWNUM_HEADER,
+                                      ZSVSHEET_ROWNUM_HEADER_LEN);
+  zsv_delete(parser);
+  fclose(opts.stream);
+  return err;
+}
+
+// read_data_from_row_view: read_data() for a buffer with a row view. start_row is a row of the
+// view, from which rows are displayed or, if zsvsheet_opts->find is set, searched
+static int read_data_from_row_view(struct zsvsheet_ui_buffer *uibuff, size_t start_row, size_t start_col,
+                                   size_t header_span, struct zsvsheet_opts *zsvsheet_opts,
+                                   struct zsv_prop_handler *custom_prop_handler) {
+  (void)(custom_prop_handler);
+  struct zsvsheet_row_view *v = uibuff->row_view;
+  if (uibuff->has_row_num)
+    zsvsheet_opts->hide_row_nums = 1;
+  struct zsvsheet_row_view_read_ctx c = {0};
+  c.uib = uibuff;
+  c.zsvsheet_opts = zsvsheet_opts;
+  c.start_col = start_col;
+  c.rows_read = header_span;
+  c.row = start_row;
+  c.find_len = zsvsheet_opts->find ? strlen(zsvsheet_opts->find) : 0;
+  if (!zsvsheet_opts->find && !header_span) {
+    if (zsvsheet_row_view_read_header(&c))
+      return -1;
+    c.rows_read = 1;
+  }
+
+  pthread_mutex_lock(&uibuff->mutex);
+  uint64_t row_count = v->row_count;
+  pthread_mutex_unlock(&uibuff->mutex);
+
+  uint64_t end = row_count;
+  if (!zsvsheet_opts->find && start_row + zsvsheet_screen_buffer_rows(uibuff->buffer) - c.rows_read < end)
+    end = start_row + zsvsheet_screen_buffer_rows(uibuff->buffer) - c.rows_read;
+  int rc = 0;
+  if (start_row < end) {
+    uint64_t done = zsvsheet_row_view_read(v, &v->reader, &uibuff->mutex, start_row, end, zsvsheet_row_view_on_row, &c);
+    if (c.err || (!c.found && done != end - start_row))
+      rc = -1;
+  }
+
+  if (!zsvsheet_opts->find) {
+    if (c.rows_read > uibuff->buff_used_rows)
+      uibuff->buff_used_rows = c.rows_read;
+    uibuff->dimensions.row_count = (size_t)row_count + 1;
+  }
+  return rc;
+}
+
+struct zsvsheet_write_rows_ctx {
+  zsv_csv_writer w;
+  char has_row_num;
+};
+
+static int zsvsheet_write_rows_on_row(void *ctx, zsv_parser parser, const struct zsv_key_index_match *row) {
+  struct zsvsheet_write_rows_ctx *c = ctx;
+  if (!c->has_row_num)
+    zsv_writer_cell_zu(c->w, 1, (size_t)row->row);
+  for (size_t j = 0, n = zsv_cell_count(parser); j < n; j++) {
+    struct zsv_cell cell = zsv_get_cell(parser, j);
+    zsv_writer_cell(c->w, j == 0 && c->has_row_num, cell.str, cell.len, cell.quoted);
+  }
+  return 0;
+}
+
+// zsvsheet_row_view_write: write the view's header and rows, as shown, to a temporary file.
+// Returns its name, or NULL on error. Caller must free
+static char *zsvsheet_row_view_write(struct zsvsheet_row_view *v) {
+  char *tmp_fn = zsv_get_temp_filename("zsvrows");
+  zsv_csv_writer w = tmp_fn ? zsv_writer_new(&(struct zsv_csv_writer_options){.output_path = tmp_fn}) : NULL;
+  struct zsvsheet_write_rows_ctx ctx = {w, !v->add_row_num};
+  int err = 1;
+  if (w) {
+    // the header
+    struct zsv_opts opts = v->opts;
+    zsv_parser parser = NULL;
+    opts.errprintf = zsv_no_printf;
+    opts.errf = NULL;
+    if ((opts.stream = fopen(v->filename, "rb"))) {
+      if (zsv_new_with_properties(&opts, v->custom_prop_handler, v->filename, &parser) == zsv_status_ok &&
+          zsv_next_row(parser) == zsv_status_row) {
+        if (v->add_row_num)
+          zsv_writer_cell_s(w, 1, (const unsigned char *)ZSVSHEET_ROWNUM_HEADER, 0);
+        for (size_t i = 0, n = zsv_cell_count(parser); i < n; i++) {
+          struct zsv_cell c = zsv_get_cell(parser, i);
+          zsv_writer_cell(w, i == 0 && !v->add_row_num, c.str, c.len, c.quoted);
+        }
+        err = 0;
+      }
+      zsv_delete(parser);
+      fclose(opts.stream);
+    }
+    if (!err &&
+        zsvsheet_row_view_read(v, &v->reader, NULL, 0, v->row_count, zsvsheet_write_rows_on_row, &ctx) != v->row_count)
+      err = 1;
+    zsv_writer_delete(w);
+  }
+  if (err && tmp_fn) {
+    unlink(tmp_fn);
+    free(tmp_fn);
+    tmp_fn = NULL;
+  }
+  return tmp_fn;
+}
+
+// zsvsheet_row_view_data_filename: the data file of a buffer with a row view. A view of only
+// some of its file's rows is written to a temporary file the first time this is called, once
+// its selection is complete
+static const char *zsvsheet_row_view_data_filename(struct zsvsheet_ui_buffer *uib) {
+  if (!uib->row_view->subset || uib->data_filename)
+    return uib->data_filename ? uib->data_filename : uib->filename;
+  if (uib->worker)
+    zsvsheet_ui_buffer_join_worker(uib);
+  return uib->data_filename = zsvsheet_row_view_write(uib->row_view);
+}
+
+// zsvsheet_row_view_open: open a buffer that shows the view, which it takes ownership of, and
+// make it the current buffer. has_row_num is whether the viewed file has its own Row # column,
+// temp_filename whether it is another buffer's temporary data file, and write_after_open
+// whether rows are still being added to the view
+static enum zsvsheet_status zsvsheet_row_view_open(struct zsvsheet_proc_context *ctx, struct zsvsheet_row_view *v,
+                                                   char has_row_num, char temp_filename, char write_after_open) {
+  struct zsvsheet_sheet_context *state = (struct zsvsheet_sheet_context *)ctx->subcommand_context;
+  struct zsvsheet_display_info *di = &state->display_info;
+  struct zsvsheet_screen_buffer_opts bopts = {0};
+  bopts.no_rownum_column = has_row_num || v->add_row_num;
+  struct zsvsheet_ui_buffer_opts uibopts = {0};
+  uibopts.filename = v->filename;
+  if (!v->subset) // else the data file is the view's rows as written by zsvsheet_row_view_write()
+    uibopts.zsv_opts = v->opts;
+  uibopts.write_after_open = write_after_open;
+  enum zsvsheet_priv_status pstat;
+  struct zsvsheet_ui_buffer *nbuff = NULL;
+  zsvsheet_screen_buffer_t buffer = zsvsheet_screen_buffer_new(1, &bopts, &pstat);
+  if (buffer) // rows are read again from their offsets when other columns are displayed
+    zsvsheet_screen_buffer_set_window(buffer, 0, 2 * ZSVSHEET_SCREEN_BUFFER_WINDOW_MARGIN);
+  if (!buffer || pstat != zsvsheet_priv_status_ok || !(nbuff = zsvsheet_ui_buffer_new(buffer, &uibopts))) {
+    zsvsheet_screen_buffer_delete(buffer);
+    zsvsheet_row_view_delete(v);
+    return zsvsheet_status_memory;
+  }
+  nbuff->row_view = v;
+  nbuff->has_row_num = has_row_num || v->add_row_num;
+  nbuff->temp_filename = temp_filename;
+  nbuff->index_started = 1; // rows are read from their offsets, not from a row index
+
+  struct zsvsheet_opts zsvsheet_opts = {0};
+  if (read_data(&nbuff, NULL, 0, 0, 0, &zsvsheet_opts, state->custom_prop_handler)) {
+    zsvsheet_ui_buffer_delete(nbuff);
+    return zsvsheet_status_error;
+  }
+  nbuff->cursor_row = 1; // first row is header
+  zsvsheet_ui_buffer_push(di->ui_buffers.base, di->ui_buffers.current, nbuff);
+  return zsvsheet_status_ok;
+}
+
+// zsvsheet_row_view_open_rows: open a view of the given rows of a data file, in order of offset,
+// which it takes ownership of. Returns non-zero if they can't be read from their offsets, else
+// sets *zst to the status of opening the view
+static int zsvsheet_row_view_open_rows(zsvsheet_proc_context_t ctx, const char *data_filename,
+                                       const struct zsv_opts *zopts, const struct zsv_opts *row_opts,
+                                       struct zsv_prop_handler *custom_prop_handler, char has_row_num,
+                                       char temp_filename, struct zsv_key_index_match *rows, size_t count,
+                                       enum zsvsheet_status *zst) {
+  struct zsvsheet_row_view *v = zsvsheet_row_view_new(data_filename, zopts, row_opts, custom_prop_handler);
+  if (!v) {
+    free(rows);
+    return 1;
+  }
+  v->selection = rows;
+  v->selection_capacity = v->row_count = count;
+  v->subset = 1;
+  v->add_row_num = !has_row_num;
+  *zst = zsvsheet_row_view_open(ctx, v, has_row_num, temp_filename, 0);
+  return 0;
+}
+
+// zsvsheet_row_select_opts: how to select the rows of a new view
+struct zsvsheet_row_select_opts {
+  void *ctx; // freed once the selection is done
+  // whether to keep the row at which the parser is positioned
+  int (*keep)(void *ctx, zsv_parser parser, const struct zsv_key_index_match *row);
+  // called once the selection is done or cancelled, with the number of rows kept
+  void (*on_done)(void *ctx, struct zsvsheet_ui_buffer *uib, uint64_t row_count);
+};
+
+struct zsvsheet_row_select {
+  struct zsvsheet_row_select_opts opts;
+  struct zsvsheet_ui_buffer *uib; // the buffer of the view, once it is open
+  struct zsvsheet_row_view *v;
+
+  // the rows scanned: those of a view, read through a reader of the select's own, else the
+  // whole of v's file
+  struct zsvsheet_row_view *from;
+  struct zsvsheet_rows_reader reader;
+  uint64_t next; // next row of from to scan
+  zsv_parser parser;
+  FILE *stream;
+  uint64_t data_row;
+
+  struct zsv_key_index_match *kept; // rows kept since the view was last updated
+  size_t kept_count;
+  size_t kept_capacity;
+
+  unsigned char header_done : 1;
+  unsigned char finishing : 1;
+  unsigned char err : 1;
+  unsigned char _ : 5;
+};
+
+static void zsvsheet_row_select_delete(struct zsvsheet_row_select *s) {
+  zsv_delete(s->parser);
+  if (s->stream)
+    fclose(s->stream);
+  free(s->reader.buff);
+  if (s->reader.f)
+    fclose(s->reader.f);
+  free(s->kept);
+  free(s->opts.ctx);
+  free(s);
+}
+
+static int zsvsheet_row_select_keep(struct zsvsheet_row_select *s, const struct zsv_key_index_match *row) {
+  if (s->kept_count == s->kept_capacity) {
+    size_t capacity = s->kept_capacity ? s->kept_capacity * 2 : 256;
+    struct zsv_key_index_match *tmp = realloc(s->kept, capacity * sizeof(*tmp));
+    if (!tmp)
+      return 1;
+    s->kept = tmp;
+    s->kept_capacity = capacity;
+  }
+  s->kept[s->kept_count++] = *row;
+  return 0;
+}
+
+static void zsvsheet_row_select_file_row(void *ctx) {
+  struct zsvsheet_row_select *s = ctx;
+  if (!s->header_done) {
+    s->header_done = 1;
+    return;
+  }
+  size_t len = zsv_row_length_raw_bytes(s->parser);
+  struct zsv_key_index_match row = {++s->data_row, zsv_chunk_row_offset(s->parser, s->finishing), len};
+  if (s->opts.keep(s->opts.ctx, s->parser, &row) && zsvsheet_row_select_keep(s, &row)) {
+    s->err = 1;
+    zsv_abort(s->parser);
+  }
+}
+
+static int zsvsheet_row_select_view_row(void *ctx, zsv_parser parser, const struct zsv_key_index_match *row) {
+  struct zsvsheet_row_select *s = ctx;
+  if (s->opts.keep(s->opts.ctx, parser, row) && zsvsheet_row_select_keep(s, row)) {
+    s->err = 1;
+    return 1;
+  }
+  return 0;
+}
+
+// zsvsheet_row_select_more: scan the next part of the rows. Returns non-zero if there is more to scan
+static int zsvsheet_row_select_more(struct zsvsheet_row_select *s) {
+  if (s->from) {
+    uint64_t end = s->from->row_count - s->next > ZSVSHEET_ROW_VIEW_BATCH ? s->next + ZSVSHEET_ROW_VIEW_BATCH
+                                                                         : s->from->row_count;
+    if (zsvsheet_row_view_read(s->from, &s->reader, NULL, s->next, end, zsvsheet_row_select_view_row, s) !=
+        end - s->next)
+      s->err = 1;
+    s->next = end;
+    return !s->err && s->next < s->from->row_count;
+  }
+  enum zsv_status zst = zsv_parse_more(s->parser);
+  if (zst == zsv_status_ok)
+    return !s->err;
+  if (zst == zsv_status_no_more_input && !s->err) {
+    s->finishing = 1;
+    zsv_finish(s->parser);
+  } else
+    s->err = 1;
+  return 0;
+}
+
+// zsvsheet_row_select_update: add the rows kept so far to the view. Returns non-zero on error
+static int zsvsheet_row_select_update(struct zsvsheet_row_select *s) {
+  if (s->kept_count && zsvsheet_row_view_add(s->v, s->kept, s->kept_count))
+    return 1;
+  s->kept_count = 0;
+  return 0;
+}
+
+static void zsvsheet_row_select_done(struct zsvsheet_row_select *s) {
+  struct zsvsheet_ui_buffer *uib = s->uib;
+  pthread_mutex_lock(&uib->mutex);
+  uib->write_done = 1;
+  uint64_t row_count = s->v->row_count;
+  pthread_mutex_unlock(&uib->mutex);
+  if (s->opts.on_done)
+    s->opts.on_done(s->opts.ctx, uib, row_count);
+  zsvsheet_row_select_delete(s);
+}
+
+static void zsvsheet_run_row_select(struct zsvsheet_job *job, void *arg) {
+  struct zsvsheet_row_select *s = arg;
+  struct zsvsheet_ui_buffer *uib = s->uib;
+  char more = 1, cancelled = 0;
+  while (more && !cancelled) {
+    more = zsvsheet_row_select_more(s);
+    pthread_mutex_lock(&uib->mutex);
+    if (zsvsheet_row_select_update(s))
+      more = 0;
+    pthread_mutex_unlock(&uib->mutex);
+    cancelled = zsvsheet_job_cancelled(job);
+  }
+  zsvsheet_row_select_done(s);
+}
+
+// zsvsheet_row_select: open a view of the rows of the current buffer that opts.keep keeps, scanning
+// the whole of the buffer's data file or, if the buffer is itself a row view, only the rows that it
+// shows. Rows are scanned in the background, and shown as they are kept. Returns non-zero
+// if the rows can't be read from their offsets, in which case opts.ctx is not freed; else sets *zst
+static int zsvsheet_row_select(zsvsheet_proc_context_t ctx, struct zsvsheet_row_select_opts opts,
+                               enum zsvsheet_status *zst) {
+  struct zsvsheet_sheet_context *state = (struct zsvsheet_sheet_context *)ctx->subcommand_context;
+  struct zsvsheet_ui_buffer *uib = zsvsheet_buffer_current(ctx);
+  struct zsvsheet_row_select *s = calloc(1, sizeof(*s));
+  if (!s)
+    return 1;
+  if (!(s->v = zsvsheet_row_view_new_from(uib, state->custom_prop_handler, 1))) {
+    free(s);
+    return 1;
+  }
+  s->opts = opts;
+  if ((s->from = uib->row_view)) {
+    s->reader.window = s->from->reader.window;
+    s->reader.f = fopen(s->from->filename, "rb");
+  } else if ((s->stream = fopen(s->v->filename, "rb"))) {
+    struct zsv_opts zopts = s->v->opts;
+    zopts.errprintf = zsv_no_printf;
+    zopts.errf = NULL;
+    zopts.stream = s->stream;
+    zopts.row_handler = zsvsheet_row_select_file_row;
+    zopts.ctx = s;
+    if (zsv_new_with_properties(&zopts, s->v->custom_prop_handler, s->v->filename, &s->parser) != zsv_status_ok)
+      s->parser = NULL;
+  }
+  if (!(s->from ? s->reader.f != NULL : s->parser != NULL)) {
+    zsvsheet_row_view_delete(s->v);
+    s->opts.ctx = NULL;
+    zsvsheet_row_select_delete(s);
+    return 1;
+  }
+
+  // the view opens with no rows, which the worker adds as it finds them
+  *zst = zsvsheet_row_view_open(ctx, s->v, uib->has_row_num, zsvsheet_row_view_temp_filename(uib), 1);
+  if (*zst != zsvsheet_status_ok) { // the view was deleted
+    if (s->opts.on_done)
+      s->opts.on_done(s->opts.ctx, NULL, 0);
+    zsvsheet_row_select_delete(s);
+    return 0;
+  }
+  s->uib = zsvsheet_buffer_current(ctx);
+  zsvsheet_ui_buffer_set_status(s->uib, "(working) Press ESC to cancel ");
+  if (zsvsheet_ui_buffer_create_worker(s->uib, zsvsheet_run_row_select, s) == 0)
+    return 0;
+  zsvsheet_ui_buffer_set_status(s->uib, "Selection incomplete: unable to start worker");
+  zsvsheet_row_select_done(s);
+  return 0;
+}
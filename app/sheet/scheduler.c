@@ -0,0 +1,209 @@
+#include <stdlib.h>
+#include <pthread.h>
+#include <zsv/utils/os.h> // zsv_get_number_of_cores
+#include "scheduler.h"
+
+#define ZSVSHEET_JOB_PRIORITY_COUNT (zsvsheet_job_priority_background + 1)
+
+struct zsvsheet_job {
+  struct zsvsheet_job *next; // next in its queue
+  zsvsheet_job_func run;
+  void *arg;
+  enum zsvsheet_job_priority priority;
+  uint64_t done, total; // progress, as last reported
+  unsigned refs;        // the submitter's, and the scheduler's until the job has run
+  unsigned char cancelled : 1;
+  unsigned char finished : 1;
+  unsigned char _ : 6;
+};
+
+static struct {
+  pthread_mutex_t mutex; // guards everything below, and each job's fields other than run and arg
+  pthread_cond_t work;   // signals a new job, a finished job, or stop
+  pthread_cond_t done;   // signals a finished job
+  struct {
+    struct zsvsheet_job *head, *tail;
+  } queue[ZSVSHEET_JOB_PRIORITY_COUNT];
+  size_t running[ZSVSHEET_JOB_PRIORITY_COUNT];
+  pthread_t *threads;
+  size_t thread_count;
+  size_t idle; // threads waiting for a job
+  unsigned char stop : 1;
+  unsigned char _ : 7;
+} zsvsheet_scheduler = {
+  .mutex = PTHREAD_MUTEX_INITIALIZER,
+  .work = PTHREAD_COND_INITIALIZER,
+  .done = PTHREAD_COND_INITIALIZER,
+};
+
+size_t zsvsheet_scheduler_threads(void) {
+  size_t n = zsv_get_number_of_cores() * 2;
+  return n < 4 ? 4 : n;
+}
+
+// zsvsheet_scheduler_next: dequeue the next job that may start, if any. A job of priority p
+// may start only while fewer than (thread limit - p) jobs of priority p or lower are running,
+// so that each more urgent priority always has a thread left for it. Called with the mutex held
+static struct zsvsheet_job *zsvsheet_scheduler_next(void) {
+  size_t limit = zsvsheet_scheduler_threads();
+  for (size_t p = 0; p < ZSVSHEET_JOB_PRIORITY_COUNT; p++) {
+    struct zsvsheet_job *job = zsvsheet_scheduler.queue[p].head;
+    if (!job)
+      continue;
+    size_t running = 0;
+    for (size_t q = p; q < ZSVSHEET_JOB_PRIORITY_COUNT; q++)
+      running += zsvsheet_scheduler.running[q];
+    if (running + p >= limit)
+      continue;
+    if (!(zsvsheet_scheduler.queue[p].head = job->next))
+      zsvsheet_scheduler.queue[p].tail = NULL;
+    job->next = NULL;
+    return job;
+  }
+  return NULL;
+}
+
+static int zsvsheet_scheduler_queued(void) {
+  for (size_t p = 0; p < ZSVSHEET_JOB_PRIORITY_COUNT; p++)
+    if (zsvsheet_scheduler.queue[p].head)
+      return 1;
+  return 0;
+}
+
+// zsvsheet_job_unref: drop a reference to the job, and free it if it was the last. Called
+// with the mutex held
+static void zsvsheet_job_unref(struct zsvsheet_job *job) {
+  if (--job->refs == 0)
+    free(job);
+}
+
+static void *zsvsheet_scheduler_thread(void *arg) {
+  (void)(arg);
+  pthread_mutex_lock(&zsvsheet_scheduler.mutex);
+  for (;;) {
+    struct zsvsheet_job *job = zsvsheet_scheduler_next();
+    if (!job) {
+      if (zsvsheet_scheduler.stop && !zsvsheet_scheduler_queued())
+        break;
+      zsvsheet_scheduler.idle++;
+      pthread_cond_wait(&zsvsheet_scheduler.work, &zsvsheet_scheduler.mutex);
+      zsvsheet_scheduler.idle--;
+      continue;
+    }
+    zsvsheet_scheduler.running[job->priority]++;
+    pthread_mutex_unlock(&zsvsheet_scheduler.mutex);
+
+    job->run(job, job->arg);
+
+    pthread_mutex_lock(&zsvsheet_scheduler.mutex);
+    zsvsheet_scheduler.running[job->priority]--;
+    job->finished = 1;
+    zsvsheet_job_unref(job);
+    pthread_cond_broadcast(&zsvsheet_scheduler.done);
+    pthread_cond_broadcast(&zsvsheet_scheduler.work); // a job held back by its priority may now start
+  }
+  pthread_mutex_unlock(&zsvsheet_scheduler.mutex);
+  return NULL;
+}
+
+// zsvsheet_scheduler_add_thread: start another pool thread. Called with the mutex held.
+// Returns 0 on success
+static int zsvsheet_scheduler_add_thread(void) {
+  pthread_t *threads = realloc(zsvsheet_scheduler.threads, (zsvsheet_scheduler.thread_count + 1) * sizeof(*threads));
+  if (!threads)
+    return 1;
+  zsvsheet_scheduler.threads = threads;
+  if (pthread_create(&threads[zsvsheet_scheduler.thread_count], NULL, zsvsheet_scheduler_thread, NULL))
+    return 1;
+  zsvsheet_scheduler.thread_count++;
+  return 0;
+}
+
+struct zsvsheet_job *zsvsheet_job_submit(enum zsvsheet_job_priority priority, zsvsheet_job_func run, void *arg) {
+  struct zsvsheet_job *job = calloc(1, sizeof(*job));
+  if (!job)
+    return NULL;
+  job->run = run;
+  job->arg = arg;
+  job->priority = priority;
+  job->refs = 2;
+
+  pthread_mutex_lock(&zsvsheet_scheduler.mutex);
+  if (!zsvsheet_scheduler.stop && !zsvsheet_scheduler.idle &&
+      zsvsheet_scheduler.thread_count < zsvsheet_scheduler_threads())
+    zsvsheet_scheduler_add_thread(); // on failure, the job waits for a thread already started
+  if (zsvsheet_scheduler.stop || !zsvsheet_scheduler.thread_count) { // no thread will ever run it
+    pthread_mutex_unlock(&zsvsheet_scheduler.mutex);
+    free(job);
+    return NULL;
+  }
+  if (zsvsheet_scheduler.queue[priority].tail)
+    zsvsheet_scheduler.queue[priority].tail->next = job;
+  else
+    zsvsheet_scheduler.queue[priority].head = job;
+  zsvsheet_scheduler.queue[priority].tail = job;
+  pthread_cond_broadcast(&zsvsheet_scheduler.work);
+  pthread_mutex_unlock(&zsvsheet_scheduler.mutex);
+  return job;
+}
+
+void zsvsheet_job_cancel(struct zsvsheet_job *job) {
+  pthread_mutex_lock(&zsvsheet_scheduler.mutex);
+  job->cancelled = 1;
+  pthread_mutex_unlock(&zsvsheet_scheduler.mutex);
+}
+
+int zsvsheet_job_cancelled(struct zsvsheet_job *job) {
+  pthread_mutex_lock(&zsvsheet_scheduler.mutex);
+  int cancelled = job->cancelled;
+  pthread_mutex_unlock(&zsvsheet_scheduler.mutex);
+  return cancelled;
+}
+
+void zsvsheet_job_set_progress(struct zsvsheet_job *job, uint64_t done, uint64_t total) {
+  pthread_mutex_lock(&zsvsheet_scheduler.mutex);
+  job->done = done;
+  job->total = total;
+  pthread_mutex_unlock(&zsvsheet_scheduler.mutex);
+}
+
+int zsvsheet_job_progress(struct zsvsheet_job *job, uint64_t *done, uint64_t *total) {
+  pthread_mutex_lock(&zsvsheet_scheduler.mutex);
+  *done = job->done;
+  *total = job->total;
+  int finished = job->finished;
+  pthread_mutex_unlock(&zsvsheet_scheduler.mutex);
+  return finished;
+}
+
+void zsvsheet_job_wait(struct zsvsheet_job *job) {
+  pthread_mutex_lock(&zsvsheet_scheduler.mutex);
+  while (!job->finished)
+    pthread_cond_wait(&zsvsheet_scheduler.done, &zsvsheet_scheduler.mutex);
+  pthread_mutex_unlock(&zsvsheet_scheduler.mutex);
+}
+
+void zsvsheet_job_release(struct zsvsheet_job *job) {
+  if (job) {
+    pthread_mutex_lock(&zsvsheet_scheduler.mutex);
+    zsvsheet_job_unref(job);
+    pthread_mutex_unlock(&zsvsheet_scheduler.mutex);
+  }
+}
+
+void zsvsheet_scheduler_shutdown(void) {
+  pthread_mutex_lock(&zsvsheet_scheduler.mutex);
+  zsvsheet_scheduler.stop = 1;
+  pthread_cond_broadcast(&zsvsheet_scheduler.work);
+  pthread_mutex_unlock(&zsvsheet_scheduler.mutex);
+
+  for (size_t i = 0; i < zsvsheet_scheduler.thread_count; i++)
+    pthread_join(zsvsheet_scheduler.threads[i], NULL);
+
+  pthread_mutex_lock(&zsvsheet_scheduler.mutex);
+  free(zsvsheet_scheduler.threads);
+  zsvsheet_scheduler.threads = NULL;
+  zsvsheet_scheduler.thread_count = 0;
+  zsvsheet_scheduler.stop = 0;
+  pthread_mutex_unlock(&zsvsheet_scheduler.mutex);
+}
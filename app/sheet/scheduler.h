@@ -0,0 +1,72 @@
+#ifndef SHEET_SCHEDULER_H
+#define SHEET_SCHEDULER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Worker pool for the sheet's background jobs, e.g. building a row index, writing the
+ * rows of a transformation, filter or pivot, prefetching row blocks, or searching a file
+ *
+ * Jobs are run in order of priority, then in the order submitted, on up to
+ * zsvsheet_scheduler_threads() threads, which are started as jobs are submitted and kept
+ * until zsvsheet_scheduler_shutdown(). So that long jobs of lower priority can't hold
+ * every thread, one thread is kept for viewport jobs, and another for viewport or
+ * prefetch jobs
+ *
+ * A job is cancelled cooperatively: it should check zsvsheet_job_cancelled() as it runs,
+ * and return early, after releasing what it holds, once it is set
+ */
+
+enum zsvsheet_job_priority {
+  zsvsheet_job_priority_viewport = 0, // rows being shown, or a result being waited for, e.g. a filter or find
+  zsvsheet_job_priority_prefetch,     // rows likely to be shown next
+  zsvsheet_job_priority_background,   // e.g. a row index
+};
+
+struct zsvsheet_job;
+
+typedef void (*zsvsheet_job_func)(struct zsvsheet_job *job, void *arg);
+
+/**
+ * Get the number of threads in the pool: twice the number of cores, but at least 4
+ */
+size_t zsvsheet_scheduler_threads(void);
+
+/**
+ * Queue a job. It is always run, even if cancelled before it starts, so that it can free
+ * its argument. Returns NULL if it could not be queued. The caller holds a reference to
+ * the job, which must be released with zsvsheet_job_release()
+ */
+struct zsvsheet_job *zsvsheet_job_submit(enum zsvsheet_job_priority priority, zsvsheet_job_func run, void *arg);
+
+void zsvsheet_job_cancel(struct zsvsheet_job *job);
+
+int zsvsheet_job_cancelled(struct zsvsheet_job *job);
+
+/**
+ * Report how much of the job is done, in any unit, e.g. bytes read of the total to read
+ */
+void zsvsheet_job_set_progress(struct zsvsheet_job *job, uint64_t done, uint64_t total);
+
+/**
+ * Get the job's progress, as last reported. Returns non-zero if the job has finished
+ */
+int zsvsheet_job_progress(struct zsvsheet_job *job, uint64_t *done, uint64_t *total);
+
+/**
+ * Wait for the job to finish
+ */
+void zsvsheet_job_wait(struct zsvsheet_job *job);
+
+/**
+ * Release the caller's reference. A job that has not finished keeps running
+ */
+void zsvsheet_job_release(struct zsvsheet_job *job);
+
+/**
+ * Wait for all jobs to finish, and stop the pool's threads
+ */
+void zsvsheet_scheduler_shutdown(void);
+
+#endif
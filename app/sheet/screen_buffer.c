@@ -2,36 +2,47 @@
 
 #include <zsv/ext.h> // zsvsheet_cell_attr_t
 
+/*
+ * Each row's values are stored one after another, each followed by a NUL, in an arena
+ * owned by the row, and the row's offset table holds, for each column, 1 + the offset of
+ * its value in the arena, or 0 if the cell is empty. Rewriting a cell adds its new value
+ * to the arena; when the arena is full and at least half of it holds replaced values, it
+ * is compacted instead of grown.
+ *
+ * A buffer of data that can be read again from its file may hold only a window of columns
+ * (see zsvsheet_screen_buffer_set_window()), so that its size does not depend on the
+ * number of columns in the file. The header row always holds all columns
+ */
+
+struct zsvsheet_screen_buffer_row {
+  uint32_t *offsets;    // for each column held: 1 + offset of its value in data, or 0 if empty
+  size_t offset_count;  // entries allocated in offsets
+  unsigned char *data;  // values, each followed by a NUL
+  size_t data_len;      // bytes used in data
+  size_t data_capacity; // bytes allocated for data
+  size_t replaced;      // bytes used in data by values that have been overwritten
+};
+
 struct zsvsheet_screen_buffer {
   size_t cols;
-  size_t long_cell_count;
+  size_t window_first; // first column held in rows after the header row
+  size_t window_count; // columns held in rows after the header row, or 0 if all
   struct zsvsheet_screen_buffer_opts opts;
-  unsigned char *data;
+  struct zsvsheet_screen_buffer_row *rows;
   zsvsheet_cell_attr_t *cell_attrs; // used for per-cell attron() and attroff()
   // to do: add hooks for extension
 };
 
-static inline size_t buffer_data_offset(zsvsheet_screen_buffer_t buff, size_t row, size_t col) {
-  assert(row < buff->opts.rows && col < buff->cols);
-  return row * buff->cols * buff->opts.cell_buff_len + col * buff->opts.cell_buff_len;
-}
+static const unsigned char zsvsheet_screen_buffer_empty_cell[1] = {'\0'};
 
-static void set_long_cell(zsvsheet_screen_buffer_t buff, size_t offset, char *heap) {
-  char **target = (char **)(buff->data + offset);
-  *target = heap;
-  // set flag indicating that this is long cell
-  *(buff->data + offset + buff->opts.cell_buff_len - 1) = (char)1;
-}
-
-static char *get_long_cell(zsvsheet_screen_buffer_t buff, size_t offset) {
-  char **valuep = (char **)(buff->data + offset);
-  if (valuep)
-    return *valuep;
-  return NULL;
-}
-
-static inline int is_long_cell(const unsigned char *mem, size_t cell_buff_len) {
-  return *(mem + cell_buff_len - 1) != '\0';
+// buffer_row_slot: get the row's offset table entry for the given column, or -1 if the column
+// is not held
+static inline size_t buffer_row_slot(zsvsheet_screen_buffer_t buff, size_t row, size_t col) {
+  if (row == 0 || !buff->window_count)
+    return col;
+  if (col < buff->window_first || col - buff->window_first >= buff->window_count)
+    return (size_t)-1;
+  return col - buff->window_first;
 }
 
 size_t zsvsheet_screen_buffer_cols(zsvsheet_screen_buffer_t buff) {
@@ -42,25 +53,22 @@ size_t zsvsheet_screen_buffer_rows(zsvsheet_screen_buffer_t buff) {
   return buff->opts.rows;
 }
 
-static void free_long_cell(zsvsheet_screen_buffer_t buff, size_t offset) {
-  if (is_long_cell(buff->data + offset, buff->opts.cell_buff_len)) {
-    char *value_copy = get_long_cell(buff, offset);
-    free(value_copy);
-    memset(buff->data + offset, 0, buff->opts.cell_buff_len);
-    buff->long_cell_count--;
-  }
+void zsvsheet_screen_buffer_clear_row(zsvsheet_screen_buffer_t buff, size_t row) {
+  struct zsvsheet_screen_buffer_row *r = &buff->rows[row];
+  if (r->offset_count)
+    memset(r->offsets, 0, r->offset_count * sizeof(*r->offsets));
+  r->data_len = 0;
+  r->replaced = 0;
 }
 
 void zsvsheet_screen_buffer_delete(zsvsheet_screen_buffer_t buff) {
   if (buff) {
-    for (size_t i = 0; i < buff->opts.rows && buff->long_cell_count > 0; i++) {
-      for (size_t j = 0; j < buff->cols && buff->long_cell_count > 0; j++) {
-        size_t offset = buffer_data_offset(buff, i, j);
-        free_long_cell(buff, offset);
-      }
+    for (size_t i = 0; buff->rows && i < buff->opts.rows; i++) {
+      free(buff->rows[i].offsets);
+      free(buff->rows[i].data);
     }
+    free(buff->rows);
     free(buff->cell_attrs);
-    free(buff->data);
     free(buff);
   }
 }
@@ -75,65 +83,78 @@ zsvsheet_screen_buffer_t zsvsheet_screen_buffer_new(size_t cols, struct zsvsheet
     opts->rows = ZSVSHEET_SCREEN_BUFFER_DEFAULT_ROW_COUNT;
   else if (opts->rows < 256)
     opts->rows = 256;
-  if (opts->cell_buff_len == 0)
-    opts->cell_buff_len = ZSVSHEET_SCREEN_BUFFER_DEFAULT_CELL_BUFF_LEN;
   if (opts->max_cell_len == 0)
     opts->max_cell_len = ZSVSHEET_SCREEN_BUFFER_DEFAULT_MAX_CELL_LEN;
-  if (opts->cell_buff_len < sizeof(void *) * 2)
-    *stat = zsvsheet_priv_status_error;
-  else {
-    if (!opts->no_rownum_column)
-      cols++;
-    void *data = calloc(opts->rows, cols * opts->cell_buff_len);
-    if (!data)
-      *stat = zsvsheet_priv_status_memory;
-    else {
-      struct zsvsheet_screen_buffer *buff = calloc(1, sizeof(*buff));
-      if (!buff)
-        *stat = zsvsheet_priv_status_memory;
-      else {
-        buff->opts.rows = opts->rows;
-        buff->cols = cols;
-        buff->data = data;
-        buff->opts = *opts;
-        return buff;
-      }
-    }
-    free(data);
+  if (!opts->no_rownum_column)
+    cols++;
+  struct zsvsheet_screen_buffer_row *rows = calloc(opts->rows, sizeof(*rows));
+  struct zsvsheet_screen_buffer *buff = rows ? calloc(1, sizeof(*buff)) : NULL;
+  if (!buff) {
+    free(rows);
+    *stat = zsvsheet_priv_status_memory;
+    return NULL;
   }
-  return NULL;
+  buff->cols = cols;
+  buff->rows = rows;
+  buff->opts = *opts;
+  return buff;
 }
 
 enum zsvsheet_priv_status zsvsheet_screen_buffer_grow(zsvsheet_screen_buffer_t buff, size_t cols) {
-  size_t old_cols = buff->cols;
-  size_t rows = buff->opts.rows;
-  size_t cell_buff_len = buff->opts.cell_buff_len;
-  size_t old_row_len = old_cols * cell_buff_len;
-
   if (!buff->opts.no_rownum_column)
     cols++;
 
-  size_t row_len = cols * cell_buff_len;
+  assert(cols > buff->cols);
 
-  assert(cols > old_cols);
-
-  void *old_data = buff->data;
-  void *data = calloc(rows, cols * cell_buff_len);
-  if (!data)
-    return zsvsheet_priv_status_memory;
-
-  for (size_t i = 0; i < rows; i++) {
-    size_t old_row_off = i * old_row_len;
-    size_t row_off = i * row_len;
+  // offset tables are extended as cells are written
+  buff->cols = cols;
+  return zsvsheet_priv_status_ok;
+}
 
-    memcpy((char *)data + row_off, (char *)old_data + old_row_off, old_row_len);
+int zsvsheet_screen_buffer_set_window(zsvsheet_screen_buffer_t buff, size_t first_col, size_t count) {
+  if (!count)
+    first_col = 0;
+  if (first_col == buff->window_first && count == buff->window_count)
+    return 0;
+  buff->window_first = first_col;
+  buff->window_count = count;
+  for (size_t i = 1; i < buff->opts.rows; i++) {
+    struct zsvsheet_screen_buffer_row *r = &buff->rows[i];
+    if (count && r->offset_count > count) { // keep the row no larger than the window
+      free(r->offsets);
+      r->offsets = NULL;
+      r->offset_count = 0;
+    }
+    zsvsheet_screen_buffer_clear_row(buff, i);
   }
+  return 1;
+}
 
-  buff->data = data;
-  buff->cols = cols;
-
-  free(old_data);
+size_t zsvsheet_screen_buffer_window(zsvsheet_screen_buffer_t buff, size_t *first_col) {
+  *first_col = buff->window_first;
+  return buff->window_count;
+}
 
+// buffer_row_compact: copy the row's values to a new arena of the given capacity, dropping those
+// that have been overwritten
+static enum zsvsheet_priv_status buffer_row_compact(struct zsvsheet_screen_buffer_row *r, size_t capacity) {
+  unsigned char *data = malloc(capacity);
+  if (!data)
+    return zsvsheet_priv_status_memory;
+  size_t len = 0;
+  for (size_t i = 0; i < r->offset_count; i++) {
+    if (r->offsets[i]) {
+      size_t value_len = strlen((const char *)r->data + r->offsets[i] - 1) + 1;
+      memcpy(data + len, r->data + r->offsets[i] - 1, value_len);
+      r->offsets[i] = (uint32_t)(len + 1);
+      len += value_len;
+    }
+  }
+  free(r->data);
+  r->data = data;
+  r->data_len = len;
+  r->data_capacity = capacity;
+  r->replaced = 0;
   return zsvsheet_priv_status_ok;
 }
 
@@ -143,36 +164,72 @@ enum zsvsheet_priv_status zsvsheet_screen_buffer_grow(zsvsheet_screen_buffer_t b
 
 enum zsvsheet_priv_status zsvsheet_screen_buffer_write_cell_w_len(zsvsheet_screen_buffer_t buff, size_t row, size_t col,
                                                                   const unsigned char *value, size_t len) {
-  enum zsvsheet_priv_status stat = zsvsheet_priv_status_ok;
-  size_t offset = buffer_data_offset(buff, row, col);
-  free_long_cell(buff, offset);
-  if (len < buff->opts.cell_buff_len) {
-    if (len)
-      // copy into fixed-size buff
-      memcpy(buff->data + offset, value, len);
-    *(buff->data + offset + len) = '\0';
-  } else {
-    // we have a long cell
-    if (len > buff->opts.max_cell_len) {
-      len = buff->opts.max_cell_len;
-      while (len > 0 && value[len] >= 128 && UTF8_NOT_FIRST_CHAR(value[len]))
-        // we are in the middle of a multibyte char, so back up
-        len--;
-    }
+  assert(row < buff->opts.rows && col < buff->cols);
+  size_t slot = buffer_row_slot(buff, row, col);
+  if (slot == (size_t)-1)
+    return zsvsheet_priv_status_ok; // column not held
+
+  struct zsvsheet_screen_buffer_row *r = &buff->rows[row];
+  if (slot >= r->offset_count) {
+    if (!len)
+      return zsvsheet_priv_status_ok;
+    size_t limit = row && buff->window_count ? buff->window_count : buff->cols;
+    size_t count = r->offset_count ? r->offset_count : 8;
+    while (count <= slot)
+      count *= 2;
+    if (count > limit)
+      count = limit;
+    uint32_t *offsets = realloc(r->offsets, count * sizeof(*offsets));
+    if (!offsets)
+      return zsvsheet_priv_status_memory;
+    memset(offsets + r->offset_count, 0, (count - r->offset_count) * sizeof(*offsets));
+    r->offsets = offsets;
+    r->offset_count = count;
+  }
+
+  if (r->offsets[slot]) {
+    r->replaced += strlen((const char *)r->data + r->offsets[slot] - 1) + 1;
+    r->offsets[slot] = 0;
+  }
+  if (!len)
+    return zsvsheet_priv_status_ok;
+
+  if (len > buff->opts.max_cell_len) {
+    len = buff->opts.max_cell_len;
+    while (len > 0 && value[len] >= 128 && UTF8_NOT_FIRST_CHAR(value[len]))
+      // we are in the middle of a multibyte char, so back up
+      len--;
     if (!len) // the only reason len could be 0 is if our input was not valid utf8, but check to make sure anyway
-      stat = zsvsheet_priv_status_utf8;
-    else {
-      char *value_copy = malloc(1 + len);
-      if (value_copy) {
-        memcpy(value_copy, value, len);
-        value_copy[len] = '\0';
-        set_long_cell(buff, offset, value_copy);
-        buff->long_cell_count++;
-      } else
-        stat = zsvsheet_priv_status_memory;
+      return zsvsheet_priv_status_utf8;
+  }
+
+  if (r->data_len + len + 1 > r->data_capacity) {
+    size_t live = r->data_len - r->replaced;
+    size_t capacity = r->data_capacity ? r->data_capacity : 256;
+    while (capacity < live + len + 1)
+      capacity *= 2;
+    if (r->replaced * 2 < r->data_len)
+      while (capacity < r->data_len + len + 1)
+        capacity *= 2;
+    if (capacity > UINT32_MAX)
+      return zsvsheet_priv_status_memory;
+    if (r->replaced * 2 >= r->data_len) { // at least half of the arena is overwritten values
+      enum zsvsheet_priv_status stat = buffer_row_compact(r, capacity);
+      if (stat != zsvsheet_priv_status_ok)
+        return stat;
+    } else {
+      unsigned char *data = realloc(r->data, capacity);
+      if (!data)
+        return zsvsheet_priv_status_memory;
+      r->data = data;
+      r->data_capacity = capacity;
     }
   }
-  return stat;
+  memcpy(r->data + r->data_len, value, len);
+  r->data[r->data_len + len] = '\0';
+  r->offsets[slot] = (uint32_t)(r->data_len + 1);
+  r->data_len += len + 1;
+  return zsvsheet_priv_status_ok;
 }
 
 enum zsvsheet_priv_status zsvsheet_screen_buffer_write_cell(zsvsheet_screen_buffer_t buff, size_t row, size_t col,
@@ -190,14 +247,11 @@ int zsvsheet_screen_buffer_cell_attrs(zsvsheet_screen_buffer_t buff, size_t row,
 
 const unsigned char *zsvsheet_screen_buffer_cell_display(zsvsheet_screen_buffer_t buff, size_t row, size_t col) {
   if (row < buff->opts.rows && col < buff->cols) {
-    size_t offset = row * buff->cols * buff->opts.cell_buff_len + col * buff->opts.cell_buff_len;
-    const unsigned char *cell = &buff->data[offset];
-    if (!is_long_cell(cell, buff->opts.cell_buff_len))
-      return cell;
-
-    // if the fixed-length cell memory does not end with NULL,
-    // then the cell value is a pointer to memory holding the value
-    return (unsigned char *)get_long_cell(buff, offset);
+    const struct zsvsheet_screen_buffer_row *r = &buff->rows[row];
+    size_t slot = buffer_row_slot(buff, row, col);
+    if (slot < r->offset_count && r->offsets[slot])
+      return r->data + r->offsets[slot] - 1;
+    return zsvsheet_screen_buffer_empty_cell;
   }
   return NULL;
 }
@@ -1,14 +1,15 @@
 #ifndef ZSVSHEET_SCREEN_BUFFER_H
 #define ZSVSHEET_SCREEN_BUFFER_H
 
-#define ZSVSHEET_SCREEN_BUFFER_DEFAULT_CELL_BUFF_LEN 16
 #define ZSVSHEET_SCREEN_BUFFER_DEFAULT_MAX_CELL_LEN 32768 - 1
 #define ZSVSHEET_SCREEN_BUFFER_DEFAULT_ROW_COUNT 1024
 
+// columns held on either side of the displayed columns, when only a window of columns is held
+#define ZSVSHEET_SCREEN_BUFFER_WINDOW_MARGIN 32
+
 typedef struct zsvsheet_screen_buffer *zsvsheet_screen_buffer_t;
 
 struct zsvsheet_screen_buffer_opts {
-  size_t cell_buff_len;  // default = 16. must be >= 2 * sizeof(void *)
   size_t max_cell_len;   // length in bytes; defaults to 32767
   size_t rows;           // rows to buffer. cannot be < 256
   char no_rownum_column; // reserved. TO DO: if set, omit row num column
@@ -18,6 +19,25 @@ zsvsheet_screen_buffer_t zsvsheet_screen_buffer_new(size_t cols, struct zsvsheet
                                                     enum zsvsheet_priv_status *stat);
 enum zsvsheet_priv_status zsvsheet_screen_buffer_grow(zsvsheet_screen_buffer_t buff, size_t cols);
 
+/**
+ * Hold only the given range of columns for rows after the header row; cells of other columns
+ * are not stored when written, and display as empty. A count of 0 holds all columns (the
+ * default). Returns non-zero if the range changed, in which case all rows after the header
+ * row are cleared and must be written again
+ */
+int zsvsheet_screen_buffer_set_window(zsvsheet_screen_buffer_t buff, size_t first_col, size_t count);
+
+/**
+ * Get the range of columns held for rows after the header row. Returns its column count,
+ * or 0 if all columns are held
+ */
+size_t zsvsheet_screen_buffer_window(zsvsheet_screen_buffer_t buff, size_t *first_col);
+
+/**
+ * Clear the given row's cells
+ */
+void zsvsheet_screen_buffer_clear_row(zsvsheet_screen_buffer_t buff, size_t row);
+
 enum zsvsheet_priv_status zsvsheet_screen_buffer_write_cell(zsvsheet_screen_buffer_t buff, size_t row, size_t col,
                                                             const unsigned char *value);
 
@@ -0,0 +1,175 @@
+/*
+ * Sort a buffer's rows by one column, as a view of its data file
+ *
+ * Sorting reads only the sort column, into a column cache (see column_cache.c), which also
+ * holds the offset and length of each row in the file. The sorted rows are never written
+ * out: the new buffer is a row view (see row_view.c) that holds the order in which to show
+ * the data rows (4 bytes per row)
+ */
+
+#include <zsv/utils/coltype.h> // zsv_parse_number
+
+struct zsvsheet_sort_value {
+  double d;
+  uint32_t ix;
+  unsigned char type; // 0 = empty, 1 = number, 2 = text
+};
+
+static int zsvsheet_sort_value_cmp(const void *x, const void *y) {
+  const struct zsvsheet_sort_value *a = x, *b = y;
+  if (a->type != b->type)
+    return a->type < b->type ? -1 : 1;
+  if (a->type == 1 && a->d != b->d)
+    return a->d < b->d ? -1 : 1;
+  return a->ix < b->ix ? -1 : a->ix > b->ix;
+}
+
+// zsvsheet_sort_ranks: get the rank of each of the column's distinct values in the order of a
+// numeric `zsv sort` key: empty values first, then numbers, then text. Equal numbers written
+// differently (e.g. 1 and 1.0) have the same rank. Caller must free
+static uint32_t *zsvsheet_sort_ranks(zsv_column_cache cc, char desc, size_t *rank_count) {
+  size_t n = zsv_column_cache_value_count(cc);
+  struct zsvsheet_sort_value *sorted = malloc((n ? n : 1) * sizeof(*sorted));
+  uint32_t *ranks = malloc((n ? n : 1) * sizeof(*ranks));
+  if (!sorted || !ranks) {
+    free(sorted);
+    free(ranks);
+    return NULL;
+  }
+  // the values are in bytewise order, so text needs no further comparison
+  for (size_t i = 0; i < n; i++) {
+    size_t len;
+    const unsigned char *value = zsv_column_cache_value(cc, i, &len);
+    sorted[i].ix = (uint32_t)i;
+    sorted[i].type = !len ? 0 : zsv_parse_number(value, len, ZSV_NUMBER_FINITE, &sorted[i].d) == len ? 1 : 2;
+  }
+  qsort(sorted, n, sizeof(*sorted), zsvsheet_sort_value_cmp);
+  size_t rank = 0;
+  for (size_t i = 0; i < n; i++) {
+    if (i && !(sorted[i].type == 1 && sorted[i - 1].type == 1 && sorted[i].d == sorted[i - 1].d))
+      rank++;
+    ranks[sorted[i].ix] = (uint32_t)rank;
+  }
+  *rank_count = n ? rank + 1 : 0;
+  if (desc)
+    for (size_t i = 0; i < n; i++)
+      ranks[i] = (uint32_t)(*rank_count - 1 - ranks[i]);
+  free(sorted);
+  return ranks;
+}
+
+// zsvsheet_sort_rows: order the given (0-based) data rows, or if rows is NULL all of them, by the
+// ranks of their values, keeping rows with the same rank in the given order. Caller must free
+static uint32_t *zsvsheet_sort_rows(zsv_column_cache cc, const uint32_t *ranks, size_t rank_count,
+                                    const uint32_t *rows, uint64_t count) {
+  const uint32_t *row_values = zsv_column_cache_row_values(cc);
+  uint64_t *starts = calloc(rank_count + 1, sizeof(*starts));
+  uint32_t *sorted = malloc((count ? count : 1) * sizeof(*sorted));
+  if (!starts || !sorted) {
+    free(starts);
+    free(sorted);
+    return NULL;
+  }
+  for (uint64_t i = 0; i < count; i++)
+    starts[ranks[row_values[rows ? rows[i] : i]] + 1]++;
+  for (size_t i = 1; i <= rank_count; i++)
+    starts[i] += starts[i - 1];
+  for (uint64_t i = 0; i < count; i++) {
+    uint32_t row = rows ? rows[i] : (uint32_t)i;
+    sorted[starts[ranks[row_values[row]]]++] = row;
+  }
+  free(starts);
+  return sorted;
+}
+
+// zsvsheet_sort_view_rows: get the (0-based) data rows that a row view shows, in its order, or
+// NULL if any is not a row of the column cache. Caller must free
+static uint32_t *zsvsheet_sort_view_rows(const struct zsvsheet_row_view *from, zsv_column_cache cc) {
+  uint64_t row_count = zsv_column_cache_row_count(cc);
+  uint32_t *rows = malloc((from->row_count ? from->row_count : 1) * sizeof(*rows));
+  for (uint64_t i = 0; rows && i < from->row_count; i++) {
+    struct zsv_key_index_match row;
+    zsvsheet_row_view_get(from, i, &row);
+    if (!row.row || row.row > row_count) {
+      free(rows);
+      return NULL;
+    }
+    rows[i] = (uint32_t)(row.row - 1);
+  }
+  return rows;
+}
+
+// zsvsheet_sort_open: open a view of the current buffer's rows sorted by the given (0-based)
+// column of its file. If the current buffer is itself a row view, only the rows it shows are
+// sorted, and rows with equal values keep its order
+static enum zsvsheet_status zsvsheet_sort_open(struct zsvsheet_proc_context *ctx, size_t col, char desc) {
+  struct zsvsheet_sheet_context *state = (struct zsvsheet_sheet_context *)ctx->subcommand_context;
+  struct zsvsheet_display_info *di = &state->display_info;
+  struct zsvsheet_ui_buffer *uib = zsvsheet_buffer_current(ctx);
+  struct zsvsheet_row_view *from = uib->row_view;
+  struct zsvsheet_row_view *v = zsvsheet_row_view_new_from(uib, state->custom_prop_handler, 0);
+  if (!v)
+    return zsvsheet_status_error;
+  if (!(v->cc = zsvsheet_column_cache_get(uib, di->dimensions, state->custom_prop_handler, col, &v->row_opts, 1)) ||
+      zsv_column_cache_row_count(v->cc) > UINT32_MAX) {
+    zsvsheet_row_view_delete(v);
+    return zsvsheet_status_error;
+  }
+
+  size_t rank_count;
+  uint32_t *ranks = zsvsheet_sort_ranks(v->cc, desc, &rank_count);
+  uint32_t *rows = from ? zsvsheet_sort_view_rows(from, v->cc) : NULL;
+  v->row_count = from ? from->row_count : zsv_column_cache_row_count(v->cc);
+  if (!ranks || (from && !rows) || !(v->rows = zsvsheet_sort_rows(v->cc, ranks, rank_count, rows, v->row_count))) {
+    free(ranks);
+    free(rows);
+    zsvsheet_row_view_delete(v);
+    return zsvsheet_status_memory;
+  }
+  free(ranks);
+  free(rows);
+  v->reader.window = 1; // rows are read one at a time, in no particular order of offset
+
+  enum zsvsheet_status zst = zsvsheet_row_view_open(ctx, v, uib->has_row_num, zsvsheet_row_view_temp_filename(uib), 0);
+  if (zst == zsvsheet_status_ok) {
+    struct zsvsheet_ui_buffer *nbuff = zsvsheet_buffer_current(ctx);
+    nbuff->cursor_col = uib->cursor_col; // stay on the sort column
+    nbuff->buff_offset.col = uib->buff_offset.col;
+  }
+  return zst;
+}
+
+static zsvsheet_status zsvsheet_sort_handler(struct zsvsheet_proc_context *ctx) {
+  struct zsvsheet_ui_buffer *uib = zsvsheet_buffer_current(ctx);
+  if (!uib || !zsvsheet_ui_buffer_has_data_file(uib)) {
+    zsvsheet_ui_buffer_set_status(uib, "Sort only available for tabular data buffers");
+    return zsvsheet_status_ok;
+  }
+  struct zsvsheet_buffer_info_internal binfo = zsvsheet_buffer_info_internal(uib);
+  if (binfo.write_in_progress && !binfo.write_done)
+    return zsvsheet_status_busy;
+
+  struct zsvsheet_rowcol rc;
+  if (zsvsheet_buffer_get_selected_cell(uib, &rc) != zsvsheet_status_ok)
+    return zsvsheet_status_error;
+  // columns of the file follow the Row # column, if it is not data or the view shows its own
+  size_t col_offset =
+    (uib->rownum_col_offset && !uib->has_row_num ? 1 : 0) + (uib->row_view && uib->row_view->add_row_num);
+  if (rc.col < col_offset) {
+    zsvsheet_ui_buffer_set_status(uib, "Select a column to sort by");
+    return zsvsheet_status_ok;
+  }
+
+  char desc = ctx->proc_id == zsvsheet_builtin_proc_sort_desc;
+  const char *header = zsvsheet_ui_buffer_get_header(uib, rc.col);
+  char status[256];
+  snprintf(status, sizeof(status), "(sorted by %s%s) ", header ? header : "", desc ? ", descending" : "");
+  enum zsvsheet_status zst = zsvsheet_sort_open(ctx, rc.col - col_offset, desc);
+  if (zst == zsvsheet_status_ok)
+    zsvsheet_ui_buffer_set_status(zsvsheet_buffer_current(ctx), status);
+  else if (zst != zsvsheet_status_memory) {
+    zsvsheet_ui_buffer_set_status(uib, "Unable to sort");
+    zst = zsvsheet_status_ok;
+  }
+  return zst;
+}
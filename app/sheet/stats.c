@@ -0,0 +1,717 @@
+/*
+ * Column statistics
+ *
+ * The stats command opens a table with a row for each column of the current buffer's data:
+ * its count of values and of empty cells, its estimated number of distinct values, its
+ * minimum and maximum, estimated quartiles of its numbers and its most frequent values.
+ * Each column is summarized in fixed memory with mergeable sketches (see ../utils/sketch.h)
+ *
+ * A background job reads the data while the table is shown, and rewrites the table with
+ * the statistics so far about once a second. If the buffer's row index is complete, the
+ * file is split into chunks of whole index blocks that are read in parallel, each worker
+ * merging its partial statistics into the total after each chunk; otherwise the file is
+ * read from start to end by the one job
+ *
+ * The statistics of a large file as opened are saved in its cache directory, and are shown
+ * from there until the file or the options it is parsed with change
+ */
+
+#include <math.h>
+#include <time.h>
+#include <zsv/utils/cache.h> // zsv_cache_path
+#include <zsv/utils/coltype.h>
+#include "../utils/sketch.h"
+#include "../utils/hash.h"
+
+#define ZSVSHEET_STATS_CHUNK_BYTES (32 * 1024 * 1024)
+#define ZSVSHEET_STATS_TOP_VALUES 3
+#define ZSVSHEET_STATS_CACHE_NAME "stats.csv"
+#define ZSVSHEET_STATS_CACHE_MAGIC "zsv-stats,2"
+
+struct zsvsheet_stats_column {
+  uint64_t count;   // non-empty values
+  uint64_t empty;   // empty cells, including those missing from short rows
+  uint64_t numbers; // values that are numbers
+  double num_min, num_max;
+  unsigned char *min, *max; // bytewise lowest and highest values, if count
+  size_t min_len, max_len;
+  size_t min_capacity, max_capacity;
+  struct zsv_hll hll;
+  struct zsv_tdigest tdigest; // of the numbers
+  struct zsv_topk topk;
+};
+
+struct zsvsheet_stats {
+  struct zsvsheet_stats_column *cols;
+  size_t col_count;
+  uint64_t row_count;
+};
+
+// zsvsheet_stats_grow: add columns, which were empty in the rows so far
+static int zsvsheet_stats_grow(struct zsvsheet_stats *st, size_t col_count) {
+  if (col_count <= st->col_count)
+    return 0;
+  struct zsvsheet_stats_column *cols = realloc(st->cols, col_count * sizeof(*cols));
+  if (!cols)
+    return 1;
+  memset(cols + st->col_count, 0, (col_count - st->col_count) * sizeof(*cols));
+  for (size_t i = st->col_count; i < col_count; i++)
+    cols[i].empty = st->row_count;
+  st->cols = cols;
+  st->col_count = col_count;
+  return 0;
+}
+
+// zsvsheet_stats_set_value: copy a value to a column's min or max
+static int zsvsheet_stats_set_value(unsigned char **dest, size_t *dest_len, size_t *capacity,
+                                    const unsigned char *value, size_t len) {
+  if (len > *capacity) {
+    unsigned char *p = realloc(*dest, len);
+    if (!p)
+      return 1;
+    *dest = p;
+    *capacity = len;
+  }
+  memcpy(*dest, value, len);
+  *dest_len = len;
+  return 0;
+}
+
+static int zsvsheet_stats_value_cmp(const unsigned char *a, size_t alen, const unsigned char *b, size_t blen) {
+  int c = memcmp(a, b, alen < blen ? alen : blen);
+  return c ? c : alen < blen ? -1 : alen > blen;
+}
+
+// zsvsheet_stats_text_range: extend a column's bytewise min and max to include a value, or
+// the min and max of another column
+static int zsvsheet_stats_text_range(struct zsvsheet_stats_column *c, const unsigned char *min, size_t min_len,
+                                     const unsigned char *max, size_t max_len) {
+  if (!c->count || zsvsheet_stats_value_cmp(min, min_len, c->min, c->min_len) < 0)
+    if (zsvsheet_stats_set_value(&c->min, &c->min_len, &c->min_capacity, min, min_len))
+      return 1;
+  if (!c->count || zsvsheet_stats_value_cmp(max, max_len, c->max, c->max_len) > 0)
+    if (zsvsheet_stats_set_value(&c->max, &c->max_len, &c->max_capacity, max, max_len))
+      return 1;
+  return 0;
+}
+
+static int zsvsheet_stats_add_value(struct zsvsheet_stats_column *c, const unsigned char *value, size_t len) {
+  if (!len) {
+    c->empty++;
+    return 0;
+  }
+  uint64_t hash = zsv_hash(value, len);
+  if (zsv_hll_add(&c->hll, hash) || zsv_topk_add(&c->topk, value, len, hash) ||
+      zsvsheet_stats_text_range(c, value, len, value, len))
+    return 1;
+  c->count++;
+  double d;
+  if (zsv_parse_number(value, len, ZSV_NUMBER_FINITE, &d) == len) {
+    if (!c->numbers || d < c->num_min)
+      c->num_min = d;
+    if (!c->numbers || d > c->num_max)
+      c->num_max = d;
+    c->numbers++;
+    if (zsv_tdigest_add(&c->tdigest, d))
+      return 1;
+  }
+  return 0;
+}
+
+// zsvsheet_stats_add_row: add the parser's current row, skipping its first first_col cells
+static int zsvsheet_stats_add_row(struct zsvsheet_stats *st, zsv_parser parser, size_t first_col) {
+  size_t cell_count = zsv_cell_count(parser);
+  if (cell_count > first_col && zsvsheet_stats_grow(st, cell_count - first_col))
+    return 1;
+  for (size_t i = 0; i < st->col_count; i++) {
+    struct zsv_cell c = i + first_col < cell_count ? zsv_get_cell(parser, i + first_col) : (struct zsv_cell){0};
+    if (zsvsheet_stats_add_value(&st->cols[i], c.str, c.len))
+      return 1;
+  }
+  st->row_count++;
+  return 0;
+}
+
+static int zsvsheet_stats_merge(struct zsvsheet_stats *st, const struct zsvsheet_stats *other) {
+  if (zsvsheet_stats_grow(st, other->col_count))
+    return 1;
+  for (size_t i = 0; i < other->col_count; i++) {
+    struct zsvsheet_stats_column *c = &st->cols[i];
+    const struct zsvsheet_stats_column *o = &other->cols[i];
+    if (o->count && zsvsheet_stats_text_range(c, o->min, o->min_len, o->max, o->max_len))
+      return 1;
+    if (o->numbers) {
+      if (!c->numbers || o->num_min < c->num_min)
+        c->num_min = o->num_min;
+      if (!c->numbers || o->num_max > c->num_max)
+        c->num_max = o->num_max;
+    }
+    if (zsv_hll_merge(&c->hll, &o->hll) || zsv_tdigest_merge(&c->tdigest, &o->tdigest) ||
+        zsv_topk_merge(&c->topk, &o->topk))
+      return 1;
+    c->count += o->count;
+    c->empty += o->empty;
+    c->numbers += o->numbers;
+  }
+  // columns missing from all of the other's rows were empty in each of them
+  for (size_t i = other->col_count; i < st->col_count; i++)
+    st->cols[i].empty += other->row_count;
+  st->row_count += other->row_count;
+  return 0;
+}
+
+// zsvsheet_stats_clear: remove all values, keeping the memory
+static void zsvsheet_stats_clear(struct zsvsheet_stats *st) {
+  st->row_count = 0;
+  for (size_t i = 0; i < st->col_count; i++) {
+    struct zsvsheet_stats_column *c = &st->cols[i];
+    c->count = c->empty = c->numbers = 0;
+    zsv_hll_clear(&c->hll);
+    zsv_tdigest_clear(&c->tdigest);
+    zsv_topk_clear(&c->topk);
+  }
+}
+
+static void zsvsheet_stats_free(struct zsvsheet_stats *st) {
+  for (size_t i = 0; i < st->col_count; i++) {
+    struct zsvsheet_stats_column *c = &st->cols[i];
+    free(c->min);
+    free(c->max);
+    zsv_hll_free(&c->hll);
+    zsv_tdigest_free(&c->tdigest);
+    zsv_topk_free(&c->topk);
+  }
+  free(st->cols);
+  memset(st, 0, sizeof(*st));
+}
+
+struct zsvsheet_stats_run {
+  struct zsvsheet_ui_buffer *uib; // the statistics table
+  char *filename;                 // the data file
+  struct zsv_opts opts;           // to parse the data file from its start
+  struct zsv_opts row_opts;       // to parse rows read from their offsets
+  struct zsv_prop_handler *custom_prop_handler;
+  size_t first_col; // 1 if the data file has its own Row # column, which is skipped
+  char **names;
+  size_t name_count;
+  uint64_t file_size;
+  char save_cache;
+  struct zsvsheet_job *job; // the job that reads the file, and starts any others
+
+  pthread_mutex_t mutex; // guards the fields below
+  struct zsvsheet_find_chunk *chunks;
+  size_t chunk_count;
+  size_t next_chunk;
+  uint64_t bytes_read;
+  struct zsvsheet_stats total;
+  time_t refreshed;
+  char failed;
+
+  // helpers that have started, and have not finished, which the main job waits for once it has
+  // read its share. It never waits for a helper that has not started, which might not start
+  // until it returns: once closed is set, a helper that starts only drops its reference
+  size_t helpers_running;
+  pthread_cond_t helpers_done;
+  char closed;
+  size_t refs; // the main job's and each queued helper's; the last to drop it deletes the run
+};
+
+static void zsvsheet_stats_run_delete(struct zsvsheet_stats_run *run) {
+  if (run) {
+    for (size_t i = 0; i < run->name_count; i++)
+      free(run->names[i]);
+    free(run->names);
+    free(run->filename);
+    free(run->chunks);
+    zsvsheet_stats_free(&run->total);
+    pthread_cond_destroy(&run->helpers_done);
+    pthread_mutex_destroy(&run->mutex);
+    free(run);
+  }
+}
+
+// zsvsheet_stats_number: format a number, with at most the given significant digits, and without
+// an exponent unless it is very large or small
+static const char *zsvsheet_stats_number(char *buff, size_t size, double d, int digits) {
+  if (fabs(d) >= 1e6 && fabs(d) < 1e15 && digits < 15)
+    snprintf(buff, size, "%.0f", d);
+  else
+    snprintf(buff, size, "%.*g", digits, d);
+  return buff;
+}
+
+static void zsvsheet_stats_write_number(zsv_csv_writer w, double d, int digits) {
+  char buff[64];
+  zsv_writer_cell_s(w, 0, (const unsigned char *)zsvsheet_stats_number(buff, sizeof(buff), d, digits), 0);
+}
+
+// zsvsheet_stats_write_top: write the most frequent values whose estimated counts are more
+// than the error of the estimate: e / ZSV_TOPK_WIDTH of all values, with probability
+// 1 - e^-ZSV_TOPK_DEPTH. Values that occur only once are not reported
+static void zsvsheet_stats_write_top(zsv_csv_writer w, struct zsvsheet_stats_column *c) {
+  zsv_topk_sort(&c->topk);
+  uint64_t error = (uint64_t)(2.718281828 * (double)c->count / ZSV_TOPK_WIDTH);
+  char s[ZSVSHEET_STATS_TOP_VALUES * (ZSV_TOPK_MAX_VALUE_LEN + 32)];
+  size_t len = 0;
+  for (size_t i = 0, n = 0; i < c->topk.item_count && n < ZSVSHEET_STATS_TOP_VALUES; i++) {
+    const struct zsv_topk_item *item = &c->topk.items[i];
+    if (item->count > 1 && item->count > error)
+      len += snprintf(s + len, sizeof(s) - len, "%s%.*s (%" PRIu64 ")", n++ ? ", " : "", (int)item->len,
+                      item->value, item->count);
+  }
+  zsv_writer_cell(w, 0, (const unsigned char *)s, len, 1);
+}
+
+// zsvsheet_stats_write: write the statistics so far to a new temp file and index its rows.
+// Called with the run's mutex held
+static int zsvsheet_stats_write(struct zsvsheet_stats_run *run, char **filename_out, struct zsv_index **index_out) {
+  static const char *headers[] = {"Column", "Count", "Empty", "Distinct", "Min",
+                                  "Max",    "P25",   "Median", "P75",     "Top values"};
+  struct zsvsheet_stats *st = &run->total;
+  char *filename = zsv_get_temp_filename("zsvstats");
+  FILE *f = filename ? fopen(filename, "wb") : NULL;
+  struct zsv_index *index = zsv_index_new();
+  struct transformation_writer_index_ctx *ixctx = calloc(1, sizeof(*ixctx));
+  int err = 1;
+  if (f && index && ixctx) {
+    struct zsv_csv_writer_options writer_opts = zsv_writer_get_default_opts();
+    writer_opts.stream = f;
+    writer_opts.on_row = transformation_writer_index_on_row;
+    writer_opts.on_row_ctx = ixctx;
+    writer_opts.on_delete = transformation_writer_index_delete;
+    writer_opts.on_delete_ctx = ixctx;
+    ixctx->index = index;
+    zsv_csv_writer w = zsv_writer_new(&writer_opts);
+    if (w) {
+      ixctx->writer = w;
+      ixctx = NULL; // freed with the writer
+      for (size_t i = 0; i < sizeof(headers) / sizeof(*headers); i++)
+        zsv_writer_cell_s(w, i == 0, (const unsigned char *)headers[i], 0);
+      size_t col_count = st->col_count > run->name_count ? st->col_count : run->name_count;
+      for (size_t i = 0; i < col_count; i++) {
+        const char *name = i < run->name_count ? run->names[i] : "";
+        zsv_writer_cell(w, 1, (const unsigned char *)name, strlen(name), 1);
+        struct zsvsheet_stats_column *c = i < st->col_count ? &st->cols[i] : NULL;
+        if (!c || !(c->count + c->empty))
+          continue;
+        zsv_writer_cell_zu(w, 0, (size_t)c->count);
+        zsv_writer_cell_zu(w, 0, (size_t)c->empty);
+        if (!c->count)
+          continue;
+        uint64_t distinct = zsv_hll_estimate(&c->hll);
+        zsv_writer_cell_zu(w, 0, (size_t)(distinct < c->count ? distinct : c->count));
+        if (c->numbers == c->count) {
+          zsvsheet_stats_write_number(w, c->num_min, 15);
+          zsvsheet_stats_write_number(w, c->num_max, 15);
+        } else {
+          zsv_writer_cell(w, 0, c->min, c->min_len, 1);
+          zsv_writer_cell(w, 0, c->max, c->max_len, 1);
+        }
+        if (c->numbers) {
+          zsvsheet_stats_write_number(w, zsv_tdigest_quantile(&c->tdigest, 0.25), 6);
+          zsvsheet_stats_write_number(w, zsv_tdigest_quantile(&c->tdigest, 0.5), 6);
+          zsvsheet_stats_write_number(w, zsv_tdigest_quantile(&c->tdigest, 0.75), 6);
+        } else {
+          for (int j = 0; j < 3; j++)
+            zsv_writer_cell(w, 0, NULL, 0, 0);
+        }
+        zsvsheet_stats_write_top(w, c);
+      }
+      zsv_writer_delete(w);
+      err = 0;
+    }
+  }
+  free(ixctx);
+  if (f && fclose(f))
+    err = 1;
+  if (err) {
+    if (f)
+      unlink(filename);
+    free(filename);
+    zsv_index_delete(index);
+    return err;
+  }
+  zsv_index_commit_rows(index);
+  *filename_out = filename;
+  *index_out = index;
+  return 0;
+}
+
+static void zsvsheet_stats_cache_save(const char *data_filename, const struct zsv_opts *opts,
+                                      struct zsv_prop_handler *custom_prop_handler, const char *table_filename);
+
+// zsvsheet_stats_refresh: write the statistics so far and leave them for the UI thread to show.
+// If done, the table is then complete, and is saved as the file's cache if save is set. Called
+// with the run's mutex held
+static void zsvsheet_stats_refresh(struct zsvsheet_stats_run *run, char done, char save) {
+  struct zsvsheet_ui_buffer *uib = run->uib;
+  char *filename = NULL;
+  struct zsv_index *index = NULL;
+  if (zsvsheet_stats_write(run, &filename, &index))
+    run->failed = 1;
+  else if (done && save && !run->failed)
+    zsvsheet_stats_cache_save(run->filename, &run->opts, run->custom_prop_handler, filename);
+  run->refreshed = time(NULL);
+
+  pthread_mutex_lock(&uib->mutex);
+  if (filename) {
+    if (uib->pending_data_filename) { // not yet shown
+      unlink(uib->pending_data_filename);
+      free(uib->pending_data_filename);
+      zsv_index_delete(uib->pending_index);
+    }
+    uib->pending_data_filename = filename;
+    uib->pending_index = index;
+  }
+  if (done)
+    uib->write_done = 1;
+  pthread_mutex_unlock(&uib->mutex);
+
+  if (!done && run->file_size) {
+    char status[64];
+    snprintf(status, sizeof(status), "(%d%% read) ", (int)(run->bytes_read * 100 / run->file_size));
+    zsvsheet_ui_buffer_set_status(uib, status);
+  }
+}
+
+// zsvsheet_stats_progress: record that more of the file has been read, and refresh the table if
+// it was last refreshed more than a second ago. Called with the run's mutex held
+static void zsvsheet_stats_progress(struct zsvsheet_stats_run *run, uint64_t bytes_read) {
+  run->bytes_read = bytes_read;
+  if (time(NULL) > run->refreshed)
+    zsvsheet_stats_refresh(run, 0, 0);
+}
+
+// zsvsheet_stats_work: read chunks until none are left, adding each to the total. Run by the main
+// job and by the helpers it starts
+static void zsvsheet_stats_work(struct zsvsheet_job *job, void *arg) {
+  (void)(job); // every worker stops once the main job is cancelled
+  struct zsvsheet_stats_run *run = arg;
+  struct zsvsheet_stats part = {0};
+  unsigned char *data = NULL;
+  size_t data_capacity = 0;
+  FILE *fp = fopen(run->filename, "rb");
+  char failed = !fp;
+  while (!failed && !zsvsheet_job_cancelled(run->job)) {
+    pthread_mutex_lock(&run->mutex);
+    size_t i = run->next_chunk;
+    char stop = run->failed || i >= run->chunk_count;
+    if (!stop)
+      run->next_chunk++;
+    pthread_mutex_unlock(&run->mutex);
+    if (stop)
+      break;
+
+    const struct zsvsheet_find_chunk *chunk = &run->chunks[i];
+    size_t len = (size_t)(chunk->end - chunk->begin);
+    if (len > data_capacity) {
+      unsigned char *p = realloc(data, len);
+      if (!p) {
+        failed = 1;
+        break;
+      }
+      data = p;
+      data_capacity = len;
+    }
+    if (len && (fseeko(fp, (off_t)chunk->begin, SEEK_SET) || fread(data, 1, len, fp) != len)) {
+      failed = 1;
+      break;
+    }
+    struct zsvsheet_find_mem m;
+    zsv_parser parser = zsvsheet_find_chunk_parser(&run->row_opts, data, len, &m);
+    if (!parser) {
+      failed = 1;
+      break;
+    }
+    while (!failed && zsv_next_row(parser) == zsv_status_row)
+      failed = zsvsheet_stats_add_row(&part, parser, run->first_col);
+    zsv_delete(parser);
+
+    pthread_mutex_lock(&run->mutex);
+    if (failed || zsvsheet_stats_merge(&run->total, &part))
+      run->failed = 1;
+    else
+      zsvsheet_stats_progress(run, run->bytes_read + len);
+    pthread_mutex_unlock(&run->mutex);
+    zsvsheet_stats_clear(&part);
+  }
+  if (failed) {
+    pthread_mutex_lock(&run->mutex);
+    run->failed = 1;
+    pthread_mutex_unlock(&run->mutex);
+  }
+  zsvsheet_stats_free(&part);
+  free(data);
+  if (fp)
+    fclose(fp);
+}
+
+// zsvsheet_stats_scan: read the file from start to end
+static void zsvsheet_stats_scan(struct zsvsheet_stats_run *run) {
+  struct zsv_opts opts = run->opts;
+  zsv_parser parser = NULL;
+  char failed = !(opts.stream = fopen(run->filename, "rb")) ||
+                zsv_new_with_properties(&opts, run->custom_prop_handler, run->filename, &parser) != zsv_status_ok;
+  // rows are added to the total directly: no other job reads it until this one is done
+  char header_done = 0;
+  for (size_t rows = 0; !failed && zsv_next_row(parser) == zsv_status_row; rows++) {
+    if (!header_done) {
+      header_done = 1;
+      continue;
+    }
+    failed = zsvsheet_stats_add_row(&run->total, parser, run->first_col);
+    if ((rows & 0xFFFF) == 0) {
+      if (zsvsheet_job_cancelled(run->job))
+        break;
+      pthread_mutex_lock(&run->mutex);
+      zsvsheet_stats_progress(run, zsv_cum_scanned_length(parser));
+      pthread_mutex_unlock(&run->mutex);
+    }
+  }
+  zsv_delete(parser);
+  if (opts.stream)
+    fclose(opts.stream);
+  if (failed) {
+    pthread_mutex_lock(&run->mutex);
+    run->failed = 1;
+    pthread_mutex_unlock(&run->mutex);
+  }
+}
+
+// zsvsheet_stats_cache_save: save the final table, after a line that identifies the version of
+// the file it describes and the options it was parsed with
+static void zsvsheet_stats_cache_save(const char *data_filename, const struct zsv_opts *opts,
+                                      struct zsv_prop_handler *custom_prop_handler, const char *table_filename) {
+  struct stat st;
+  char *fn = (char *)zsv_cache_path((const unsigned char *)data_filename,
+                                    (const unsigned char *)ZSVSHEET_STATS_CACHE_NAME, 0);
+  char *fn_tmp = (char *)zsv_cache_path((const unsigned char *)data_filename,
+                                        (const unsigned char *)ZSVSHEET_STATS_CACHE_NAME, 1);
+  FILE *in = NULL, *out = NULL;
+  if (fn && fn_tmp && !stat(data_filename, &st) && !zsv_mkdirs(fn_tmp, 1) && (in = fopen(table_filename, "rb")) &&
+      (out = fopen(fn_tmp, "wb"))) {
+    int err = fprintf(out, ZSVSHEET_STATS_CACHE_MAGIC ",%" PRId64 ",%" PRId64 ",%016" PRIx64 "\n",
+                      (int64_t)st.st_size, (int64_t)st.st_mtime,
+                      zsv_opts_digest(opts, custom_prop_handler, data_filename)) < 0 ||
+              zsv_copy_file_ptr(in, out);
+    if (fclose(out) || err || zsv_replace_file(fn_tmp, fn))
+      unlink(fn_tmp);
+  }
+  if (in)
+    fclose(in);
+  free(fn);
+  free(fn_tmp);
+}
+
+// zsvsheet_stats_cache_open: copy the saved table of the file, if it is of the file's current
+// version and was parsed with the same options, to a new temp file. Returns its name, or NULL
+static char *zsvsheet_stats_cache_open(const char *data_filename, const struct zsv_opts *opts,
+                                       struct zsv_prop_handler *custom_prop_handler) {
+  struct stat st;
+  char *fn = (char *)zsv_cache_path((const unsigned char *)data_filename,
+                                    (const unsigned char *)ZSVSHEET_STATS_CACHE_NAME, 0);
+  FILE *in = fn && !stat(data_filename, &st) ? fopen(fn, "rb") : NULL;
+  free(fn);
+  if (!in)
+    return NULL;
+  char expected[128], line[128];
+  snprintf(expected, sizeof(expected), ZSVSHEET_STATS_CACHE_MAGIC ",%" PRId64 ",%" PRId64 ",%016" PRIx64 "\n",
+           (int64_t)st.st_size, (int64_t)st.st_mtime, zsv_opts_digest(opts, custom_prop_handler, data_filename));
+  char *filename = NULL;
+  if (fgets(line, sizeof(line), in) && !strcmp(line, expected) && (filename = zsv_get_temp_filename("zsvstats"))) {
+    FILE *out = fopen(filename, "wb");
+    int err = !out || zsv_copy_file_ptr(in, out);
+    if (out && fclose(out))
+      err = 1;
+    if (err) {
+      unlink(filename);
+      free(filename);
+      filename = NULL;
+    }
+  }
+  fclose(in);
+  return filename;
+}
+
+static void zsvsheet_stats_run_release(struct zsvsheet_stats_run *run) {
+  pthread_mutex_lock(&run->mutex);
+  char last = !--run->refs;
+  pthread_mutex_unlock(&run->mutex);
+  if (last)
+    zsvsheet_stats_run_delete(run);
+}
+
+// zsvsheet_stats_helper: read chunks alongside the main job, unless it has already finished its share
+static void zsvsheet_stats_helper(struct zsvsheet_job *job, void *arg) {
+  struct zsvsheet_stats_run *run = arg;
+  pthread_mutex_lock(&run->mutex);
+  char closed = run->closed;
+  if (!closed)
+    run->helpers_running++;
+  pthread_mutex_unlock(&run->mutex);
+  if (!closed) {
+    zsvsheet_stats_work(job, run);
+    pthread_mutex_lock(&run->mutex);
+    if (!--run->helpers_running)
+      pthread_cond_signal(&run->helpers_done);
+    pthread_mutex_unlock(&run->mutex);
+  }
+  zsvsheet_stats_run_release(run);
+}
+
+static void zsvsheet_stats_run_job(struct zsvsheet_job *job, void *arg) {
+  struct zsvsheet_stats_run *run = arg;
+  struct zsvsheet_ui_buffer *uib = run->uib;
+  run->job = job;
+  if (run->chunk_count) {
+    size_t helper_count = zsv_get_number_of_cores();
+    if (helper_count > run->chunk_count)
+      helper_count = run->chunk_count;
+    for (size_t i = 1; i < helper_count; i++) {
+      pthread_mutex_lock(&run->mutex);
+      run->refs++;
+      pthread_mutex_unlock(&run->mutex);
+      struct zsvsheet_job *helper = zsvsheet_job_submit(zsvsheet_job_priority_background, zsvsheet_stats_helper, run);
+      if (!helper) {
+        zsvsheet_stats_run_release(run);
+        break;
+      }
+      zsvsheet_job_release(helper);
+    }
+    zsvsheet_stats_work(job, run);
+    pthread_mutex_lock(&run->mutex);
+    run->closed = 1;
+    while (run->helpers_running)
+      pthread_cond_wait(&run->helpers_done, &run->mutex);
+    pthread_mutex_unlock(&run->mutex);
+  } else
+    zsvsheet_stats_scan(run);
+
+  char cancelled = zsvsheet_job_cancelled(job);
+  pthread_mutex_lock(&run->mutex);
+  zsvsheet_stats_refresh(run, 1, run->save_cache && !cancelled);
+  char failed = run->failed;
+  pthread_mutex_unlock(&run->mutex);
+  if (failed)
+    zsvsheet_ui_buffer_set_status(uib, "Statistics incomplete: unable to read the file, or out of memory");
+  else if (cancelled)
+    zsvsheet_ui_buffer_set_status(uib, "Statistics incomplete: cancelled");
+  else
+    zsvsheet_ui_buffer_set_status(uib, NULL);
+  zsvsheet_stats_run_release(run);
+}
+
+// zsvsheet_stats_open: open the table in the given file, which the buffer then owns. If
+// index is NULL, the table is complete and is indexed as any other file
+static struct zsvsheet_ui_buffer *zsvsheet_stats_open(struct zsvsheet_proc_context *ctx, char *filename,
+                                                      struct zsv_index *index) {
+  struct zsvsheet_ui_buffer_opts uibopts = {0};
+  uibopts.data_filename = filename;
+  uibopts.write_after_open = index != NULL;
+  if (zsvsheet_open_file_opts(ctx, &uibopts) != zsvsheet_status_ok) {
+    unlink(filename);
+    free(filename);
+    zsv_index_delete(index);
+    return NULL;
+  }
+  free(filename); // the buffer has its own copy, and removes the file when closed
+
+  struct zsvsheet_ui_buffer *uib = zsvsheet_buffer_current(ctx);
+  if (index) {
+    uib->index = index;
+    uib->index_started = 1;
+    uib->index_ready = 1;
+  }
+  return uib;
+}
+
+static zsvsheet_status zsvsheet_stats_handler(struct zsvsheet_proc_context *ctx) {
+  struct zsvsheet_sheet_context *state = (struct zsvsheet_sheet_context *)ctx->subcommand_context;
+  struct zsvsheet_ui_buffer *uib = zsvsheet_buffer_current(ctx);
+  if (!uib || !zsvsheet_ui_buffer_has_data_file(uib)) {
+    zsvsheet_ui_buffer_set_status(uib, "Statistics only available for tabular data buffers");
+    return zsvsheet_status_ok;
+  }
+  pthread_mutex_lock(&uib->mutex);
+  char writing = uib->write_in_progress && !uib->write_done;
+  pthread_mutex_unlock(&uib->mutex);
+  if (writing && !uib->row_view) {
+    zsvsheet_ui_buffer_set_status(uib, "Statistics available once the buffer is complete");
+    return zsvsheet_status_ok;
+  }
+
+  struct zsv_opts row_opts;
+  char cacheable = zsvsheet_column_cache_usable(uib, state->custom_prop_handler, &row_opts);
+  if (cacheable) {
+    struct zsv_opts opts = zsvsheet_buffer_get_zsv_opts(uib);
+    char *cached = zsvsheet_stats_cache_open(uib->filename, &opts, state->custom_prop_handler);
+    if (cached)
+      return zsvsheet_stats_open(ctx, cached, NULL) ? zsvsheet_status_ok : zsvsheet_status_error;
+  }
+
+  const char *data_filename = zsvsheet_buffer_data_filename(uib);
+  struct zsvsheet_stats_run *run = data_filename ? calloc(1, sizeof(*run)) : NULL;
+  if (!run || !(run->filename = strdup(data_filename))) {
+    zsvsheet_stats_run_delete(run);
+    return zsvsheet_status_memory;
+  }
+  pthread_mutex_init(&run->mutex, NULL);
+  pthread_cond_init(&run->helpers_done, NULL);
+  run->refs = 1;
+  run->opts = zsvsheet_buffer_get_zsv_opts(uib);
+  run->opts.errprintf = zsv_no_printf;
+  run->opts.errf = NULL;
+  run->custom_prop_handler = state->custom_prop_handler;
+  run->first_col = uib->has_row_num ? 1 : 0;
+  run->save_cache = cacheable;
+  struct stat st;
+  run->file_size = stat(data_filename, &st) ? 0 : (uint64_t)st.st_size;
+
+  // column names, from the header row
+  size_t col_offset = uib->rownum_col_offset && !uib->has_row_num ? 1 : 0;
+  size_t screen_cols = zsvsheet_screen_buffer_cols(uib->buffer);
+  size_t name_count = screen_cols > col_offset + run->first_col ? screen_cols - col_offset - run->first_col : 0;
+  if (name_count && !(run->names = calloc(name_count, sizeof(*run->names)))) {
+    zsvsheet_stats_run_delete(run);
+    return zsvsheet_status_memory;
+  }
+  for (; run->name_count < name_count; run->name_count++) {
+    const char *name = zsvsheet_ui_buffer_get_header(uib, run->name_count + run->first_col + col_offset);
+    if (!(run->names[run->name_count] = strdup(name ? name : ""))) {
+      zsvsheet_stats_run_delete(run);
+      return zsvsheet_status_memory;
+    }
+  }
+
+  // read chunks in parallel if the rows can be read from their offsets in the index
+  if (!uib->row_view && !zsvsheet_ui_buffer_seek_opts(uib, state->custom_prop_handler, &run->row_opts)) {
+    pthread_mutex_lock(&uib->mutex);
+    if (zsvsheet_ui_buffer_index_complete(uib))
+      run->chunks =
+        zsvsheet_find_chunks(uib->index, 0, run->file_size, ZSVSHEET_STATS_CHUNK_BYTES, &run->chunk_count);
+    pthread_mutex_unlock(&uib->mutex);
+  }
+
+  // show the column names until the first statistics are ready
+  char *filename = NULL;
+  struct zsv_index *index = NULL;
+  if (zsvsheet_stats_write(run, &filename, &index)) {
+    zsvsheet_stats_run_delete(run);
+    return zsvsheet_status_memory;
+  }
+  struct zsvsheet_ui_buffer *table = zsvsheet_stats_open(ctx, filename, index);
+  if (!table) {
+    zsvsheet_stats_run_delete(run);
+    return zsvsheet_status_error;
+  }
+  run->uib = table;
+  run->refreshed = time(NULL);
+  zsvsheet_ui_buffer_set_status(table, "(0% read) ");
+  if (zsvsheet_ui_buffer_start_job(table, &table->worker, zsvsheet_job_priority_background, zsvsheet_stats_run_job,
+                                   run)) {
+    table->write_done = 1;
+    zsvsheet_ui_buffer_set_status(table, "Statistics incomplete: unable to start worker");
+    zsvsheet_stats_run_delete(run);
+  }
+  return zsvsheet_status_ok;
+}
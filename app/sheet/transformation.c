@@ -166,7 +166,7 @@ void *zsvsheet_transformation_user_context(zsvsheet_transformation trn) {
   return trn->user_context;
 }
 
-static void *zsvsheet_run_buffer_transformation(void *arg) {
+static void zsvsheet_run_buffer_transformation(struct zsvsheet_job *job, void *arg) {
   struct zsvsheet_transformation *trn = arg;
   struct zsvsheet_ui_buffer *uib = trn->ui_buffer;
   zsv_parser parser = trn->parser;
@@ -176,8 +176,8 @@ static void *zsvsheet_run_buffer_transformation(void *arg) {
 
   char cancelled = 0;
   while (!cancelled && (zst = zsv_parse_more(parser)) == zsv_status_ok) {
+    cancelled = zsvsheet_job_cancelled(job);
     pthread_mutex_lock(mutex);
-    cancelled = uib->worker_cancelled;
     if (trn->writer_wrote) {
       trn->writer_wrote = 0;
       zsv_index_commit_rows(uib->index);
@@ -207,8 +207,6 @@ static void *zsvsheet_run_buffer_transformation(void *arg) {
 
   if (buff_status_old == default_status)
     free(buff_status_old);
-
-  return NULL;
 }
 
 // Write a static (in-memory) buffer's cells to a new temp CSV so a transformation
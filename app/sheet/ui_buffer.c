@@ -1,7 +1,10 @@
 #include <unistd.h> // unlink()
 #include <pthread.h>
+#include <zsv/utils/os.h> // zsv_replace_file
 #include "../utils/index.h"
 #include "index.h"
+#include "block_cache.h"
+#include "scheduler.h"
 
 struct uib_parse_errs {
   size_t count;
@@ -36,8 +39,16 @@ struct zsvsheet_ui_buffer {
   struct zsvsheet_input_dimensions dimensions;
   struct zsv_index *index;
   struct zsvsheet_index_opts *ixopts;
+  struct zsvsheet_block_cache *block_cache; // parsed row blocks; created on first use of the index
+  struct zsvsheet_row_view *row_view;       // if set, rows of filename are shown from their offsets (see row_view.c)
+
+  // a worker that rewrites the data file as it refines its results (e.g. pivot) leaves each new
+  // version and its row index here, for the UI thread to swap in between reads
+  char *pending_data_filename;
+  struct zsv_index *pending_index;
   pthread_mutex_t mutex;
-  pthread_t worker_thread;
+  struct zsvsheet_job *worker;    // job writing the buffer's data, e.g. a transformation, filter or pivot
+  struct zsvsheet_job *index_job; // job building the row index
 
   // input_offset: location within the input from which the buffer is read
   // i.e. if row = 5, col = 3, the buffer data starts from cell D6
@@ -67,23 +78,32 @@ struct zsvsheet_ui_buffer {
   unsigned char mutex_inited : 1;
   unsigned char write_in_progress : 1;
   unsigned char write_done : 1;
-  unsigned char worker_active : 1;
-  unsigned char worker_cancelled : 1;
   // status is the "(building index) " placeholder the index worker must
   // restore on completion; cleared by whoever replaces (and frees) status
   // first, so the string is never freed twice
   unsigned char status_is_index_placeholder : 1;
+  unsigned char block_cache_off : 1; // rows can't be read in blocks, e.g. the file has overwrites
+  unsigned char temp_filename : 1;   // filename is another buffer's temporary data file, e.g. for a row view
   unsigned char _ : 6;
 };
 
-int zsvsheet_ui_buffer_create_worker(struct zsvsheet_ui_buffer *ub, void *(*start_func)(void *), void *arg) {
-  assert(!ub->worker_active);
+static void zsvsheet_row_view_delete(struct zsvsheet_row_view *v);
+
+// zsvsheet_ui_buffer_start_job: submit a job that the buffer waits for, or cancels, when it is
+// deleted. Returns 0 on success, in which case the job will run even if cancelled, so it alone
+// must free arg
+static int zsvsheet_ui_buffer_start_job(struct zsvsheet_ui_buffer *ub, struct zsvsheet_job **jobp,
+                                        enum zsvsheet_job_priority priority, zsvsheet_job_func run, void *arg) {
+  (void)(ub);
+  assert(!*jobp);
   assert(ub->mutex_inited);
 
-  int rc = pthread_create(&ub->worker_thread, NULL, start_func, arg);
-  if (rc == 0) // on failure, worker_thread is indeterminate and must never be joined
-    ub->worker_active = 1;
-  return rc;
+  *jobp = zsvsheet_job_submit(priority, run, arg);
+  return *jobp ? 0 : -1;
+}
+
+int zsvsheet_ui_buffer_create_worker(struct zsvsheet_ui_buffer *ub, zsvsheet_job_func run, void *arg) {
+  return zsvsheet_ui_buffer_start_job(ub, &ub->worker, zsvsheet_job_priority_viewport, run, arg);
 }
 
 void zsvsheet_ui_buffer_set_status(struct zsvsheet_ui_buffer *ub, const char *status) {
@@ -106,23 +126,62 @@ int zsvsheet_ui_buffer_index_ready(struct zsvsheet_ui_buffer *ub, char skip_lock
   return rc;
 }
 
+// zsvsheet_ui_buffer_index_complete: whether the row index covers the whole data file, i.e. the
+// indexer or writer has finished. Caller must hold the mutex
+static int zsvsheet_ui_buffer_index_complete(struct zsvsheet_ui_buffer *ub) {
+  return ub->index && ub->index_ready && (ub->write_in_progress ? ub->write_done : ub->index_started && !ub->ixopts);
+}
+
+// zsvsheet_ui_buffer_swap_pending_data: replace the data file and row index with the version a
+// worker left pending, if any. Called from the UI thread with the mutex held. Returns non-zero if
+// the data changed, in which case the caller must drop the block cache once the mutex is released
+static int zsvsheet_ui_buffer_swap_pending_data(struct zsvsheet_ui_buffer *ub) {
+  if (!ub->pending_data_filename)
+    return 0;
+  int swapped = ub->data_filename && !zsv_replace_file(ub->pending_data_filename, ub->data_filename);
+  if (swapped) {
+    zsv_index_delete(ub->index);
+    ub->index = ub->pending_index;
+    ub->index_started = 1;
+    ub->index_ready = 1;
+
+    // rows may have moved, and empty cells are not written when the buffer is read again
+    zsvsheet_screen_buffer_t buffer = ub->buffer;
+    for (size_t row = 1; row < zsvsheet_screen_buffer_rows(buffer); row++)
+      zsvsheet_screen_buffer_clear_row(buffer, row);
+  } else {
+    unlink(ub->pending_data_filename);
+    zsv_index_delete(ub->pending_index);
+  }
+  free(ub->pending_data_filename);
+  ub->pending_data_filename = NULL;
+  ub->pending_index = NULL;
+  return swapped;
+}
+
 void zsvsheet_ui_buffer_join_worker(struct zsvsheet_ui_buffer *ub) {
-  assert(ub->worker_active);
+  assert(ub->worker);
   assert(ub->mutex_inited);
 
-  pthread_join(ub->worker_thread, NULL);
-  ub->worker_active = 0;
+  zsvsheet_job_wait(ub->worker);
+  zsvsheet_job_release(ub->worker);
+  ub->worker = NULL;
 }
 
 void zsvsheet_ui_buffer_delete(struct zsvsheet_ui_buffer *ub) {
   if (ub) {
-    if (ub->worker_active) {
-      pthread_mutex_lock(&ub->mutex);
-      ub->worker_cancelled = 1;
-      pthread_mutex_unlock(&ub->mutex);
-
-      zsvsheet_ui_buffer_join_worker(ub);
+    struct zsvsheet_job *jobs[] = {ub->worker, ub->index_job};
+    for (size_t i = 0; i < sizeof(jobs) / sizeof(*jobs); i++)
+      if (jobs[i])
+        zsvsheet_job_cancel(jobs[i]);
+    for (size_t i = 0; i < sizeof(jobs) / sizeof(*jobs); i++) {
+      if (jobs[i]) {
+        zsvsheet_job_wait(jobs[i]);
+        zsvsheet_job_release(jobs[i]);
+      }
     }
+    zsvsheet_block_cache_delete(ub->block_cache); // stops its prefetch job, which uses the mutex and index
+    zsvsheet_row_view_delete(ub->row_view);
     if (ub->ext_on_close)
       ub->ext_on_close(ub->ext_ctx);
     zsvsheet_screen_buffer_delete(ub->buffer);
@@ -131,6 +190,11 @@ void zsvsheet_ui_buffer_delete(struct zsvsheet_ui_buffer *ub) {
     if (ub->ixopts)
       ub->ixopts->uib = NULL;
     zsv_index_delete(ub->index);
+    if (ub->pending_data_filename) {
+      unlink(ub->pending_data_filename);
+      free(ub->pending_data_filename);
+    }
+    zsv_index_delete(ub->pending_index);
     free(ub->status);
     if (ub->data_filename)
       unlink(ub->data_filename);
@@ -271,6 +335,11 @@ int zsvsheet_ui_buffer_pop(struct zsvsheet_ui_buffer **base, struct zsvsheet_ui_
   return 0;
 }
 
+// zsvsheet_ui_buffer_has_data_file: whether the buffer shows a data file, rather than static content
+static int zsvsheet_ui_buffer_has_data_file(struct zsvsheet_ui_buffer *ub) {
+  return ub->data_filename || ub->filename;
+}
+
 static const char *zsvsheet_ui_buffer_get_header(struct zsvsheet_ui_buffer *uib, size_t col) {
   struct zsvsheet_screen_buffer *sb = uib->buffer;
 
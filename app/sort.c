@@ -0,0 +1,272 @@
+/*
+ * Copyright (C) 2021 Liquidaty and zsv contributors. All rights reserved.
+ *
+ * This file is part of zsv/lib, distributed under the MIT license as defined at
+ * https://opensource.org/licenses/MIT
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define ZSV_COMMAND sort
+#include "zsv_command.h"
+
+#include <zsv/utils/writer.h>
+#include <zsv/utils/mem.h>
+#include <zsv/utils/string.h>
+#include <zsv/utils/arg.h>
+#include <zsv/utils/os.h>
+#include "utils/sort.h"
+
+const char *zsv_sort_usage_msg[] = {
+  ZSV_USAGE_PROG " " APPNAME ": sort csv rows by one or more columns",
+  "",
+  "Usage: " ZSV_USAGE_PROG " " APPNAME " [options] [filename]",
+  "",
+  "Rows are sorted in memory and, if they exceed the memory limit, spilled to temporary",
+  "files that are then merged. The sort is stable, and the header row is output first.",
+  "",
+  "Options:",
+  "  -k,--key <col>[:n|:s][:desc]: sort by the given column, which may be a column name",
+  "                                (case-insensitive) or #N for the Nth column (1-based).",
+  "                                :n sorts numerically (empty values first, then numbers,",
+  "                                then other text); :s sorts as text (default);",
+  "                                :desc sorts in descending order. May be repeated.",
+  "                                If no keys are given, rows are sorted by all columns",
+  "  -o,--output <filename>      : output file",
+  "  -b                          : output with BOM",
+  "  --max-memory <MB>           : memory limit before spilling to temporary files",
+  "                                (default: 1024)",
+#ifndef ZSV_NO_PARALLEL
+  "  -j,--jobs <n>               : number of threads used to sort",
+  "  --parallel                  : use all available cores",
+#endif
+  NULL,
+};
+
+static int zsv_sort_usage(void) {
+  zsv_print_usage(zsv_sort_usage_msg);
+  return 0;
+}
+
+struct zsv_sort_key_arg {
+  const char *arg;
+  unsigned char *name; // column name, or NULL if index is used
+  size_t index;        // 1-based
+};
+
+/**
+ * Parse a key argument of the form <col>[:n|:s][:desc|:asc]. Suffixes are removed from
+ * the right so that column names may themselves contain ':'
+ */
+static int zsv_sort_parse_key_arg(const char *arg, struct zsv_sort_key_arg *karg, struct zsv_sort_key *key) {
+  size_t len = strlen(arg);
+  char have_type = 0, have_order = 0;
+  const char *colon;
+  karg->arg = arg;
+  while ((colon = memchr(arg, ':', len)) != NULL) {
+    const char *last = arg + len;
+    while (last > arg && last[-1] != ':')
+      last--;
+    size_t suffix_len = len - (size_t)(last - arg);
+    if (!have_order && suffix_len == 4 && !memcmp(last, "desc", 4))
+      key->desc = 1, have_order = 1;
+    else if (!have_order && suffix_len == 3 && !memcmp(last, "asc", 3))
+      have_order = 1;
+    else if (!have_type && suffix_len == 1 && (*last == 'n' || *last == 's'))
+      key->numeric = *last == 'n', have_type = 1;
+    else
+      break;
+    len -= suffix_len + 1;
+  }
+  if (!len) {
+    fprintf(stderr, "Invalid sort key: %s\n", karg->arg);
+    return 1;
+  }
+  if (*arg == '#' && len > 1 && strspn(arg + 1, "0123456789") >= len - 1) {
+    karg->index = (size_t)strtoul(arg + 1, NULL, 10);
+    if (!karg->index) {
+      fprintf(stderr, "Invalid column index: %s\n", karg->arg);
+      return 1;
+    }
+  } else if (!(karg->name = (unsigned char *)zsv_memdup(arg, len)))
+    return 1;
+  return 0;
+}
+
+// resolve key column names against the header row
+static int zsv_sort_resolve_keys(zsv_parser parser, struct zsv_sort_key_arg *kargs, struct zsv_sort_key *keys,
+                                 size_t key_count) {
+  size_t cell_count = zsv_cell_count(parser);
+  for (size_t i = 0; i < key_count; i++) {
+    if (!kargs[i].name) {
+      keys[i].col = kargs[i].index - 1;
+      continue;
+    }
+    size_t name_len = strlen((const char *)kargs[i].name);
+    size_t j;
+    for (j = 0; j < cell_count; j++) {
+      struct zsv_cell c = zsv_get_cell(parser, j);
+      if (!zsv_strincmp(c.str, c.len, kargs[i].name, name_len))
+        break;
+    }
+    if (j == cell_count) {
+      fprintf(stderr, "Column not found: %s\n", kargs[i].name);
+      return 1;
+    }
+    keys[i].col = j;
+  }
+  return 0;
+}
+
+static void zsv_sort_write_row(zsv_csv_writer w, struct zsv_cell *cells, size_t count) {
+  size_t i;
+  for (i = 0; i < count && !cells[i].quoted; i++)
+    ;
+  if (i == count)
+    zsv_writer_row_raw(w, cells, (unsigned int)count);
+  else
+    for (i = 0; i < count; i++)
+      zsv_writer_cell(w, i == 0, cells[i].str, cells[i].len, cells[i].quoted != 0);
+}
+
+int ZSV_MAIN_FUNC(ZSV_COMMAND)(int argc, const char *argv[], struct zsv_opts *opts,
+                               struct zsv_prop_handler *custom_prop_handler) {
+  if (argc > 1 && (!strcmp(argv[1], "-h") || !strcmp(argv[1], "--help")))
+    return zsv_sort_usage();
+
+  int err = 0;
+  const char *input_path = NULL;
+  struct zsv_csv_writer_options writer_opts = zsv_writer_get_default_opts();
+  struct zsv_sort_opts sort_opts = {0};
+  struct zsv_sort_key_arg *kargs = calloc(argc, sizeof(*kargs));
+  struct zsv_sort_key *keys = calloc(argc, sizeof(*keys));
+  zsv_csv_writer writer = NULL;
+  zsv_sorter sorter = NULL;
+  zsv_parser parser = NULL;
+  writer_opts.stream = stdout;
+  if (!kargs || !keys) {
+    fprintf(stderr, "Out of memory!\n");
+    err = 1;
+  }
+
+  for (int arg_i = 1; !err && arg_i < argc; arg_i++) {
+    const char *arg = argv[arg_i];
+    if (!strcmp(arg, "-k") || !strcmp(arg, "--key")) {
+      if (++arg_i >= argc) {
+        fprintf(stderr, "%s option requires a value\n", arg);
+        err = 1;
+      } else if (zsv_sort_parse_key_arg(argv[arg_i], &kargs[sort_opts.key_count], &keys[sort_opts.key_count]))
+        err = 1;
+      else
+        sort_opts.key_count++;
+    } else if (!strcmp(arg, "-b"))
+      writer_opts.with_bom = 1;
+    else if (!strcmp(arg, "-o") || !strcmp(arg, "--output")) {
+      if (++arg_i >= argc) {
+        fprintf(stderr, "%s option requires a filename\n", arg);
+        err = 1;
+      } else if (writer_opts.stream != stdout) {
+        fprintf(stderr, "Output may not be specified more than once\n");
+        err = 1;
+      } else if (!(writer_opts.stream = fopen(argv[arg_i], "wb"))) {
+        writer_opts.stream = stdout;
+        fprintf(stderr, "Unable to open file for writing: %s\n", argv[arg_i]);
+        err = 1;
+      }
+    } else if (!strcmp(arg, "--max-memory")) {
+      if (++arg_i >= argc || atoi(argv[arg_i]) <= 0) {
+        fprintf(stderr, "%s option requires a positive number of MB\n", arg);
+        err = 1;
+      } else
+        sort_opts.max_memory = (size_t)atoi(argv[arg_i]) * 1024 * 1024;
+#ifndef ZSV_NO_PARALLEL
+    } else if (!strcmp(arg, "-j") || !strcmp(arg, "--jobs")) {
+      if (++arg_i >= argc || atoi(argv[arg_i]) <= 0) {
+        fprintf(stderr, "%s option requires a positive number\n", arg);
+        err = 1;
+      } else
+        sort_opts.threads = (unsigned int)atoi(argv[arg_i]);
+    } else if (!strcmp(arg, "--parallel")) {
+      sort_opts.threads = zsv_get_number_of_cores();
+      if (sort_opts.threads < 2) {
+        fprintf(stderr, "Warning: --parallel specified but only one core found; using -j 4 instead\n");
+        sort_opts.threads = 4;
+      }
+#endif
+    } else if (zsv_arg_is_option(arg)) {
+      fprintf(stderr, "Unrecognized option: %s\n", arg);
+      err = 1;
+    } else if (input_path) {
+      fprintf(stderr, "Input may not be specified more than once\n");
+      err = 1;
+    } else
+      input_path = arg;
+  }
+
+  if (!err && input_path && strcmp(input_path, "-") && !(opts->stream = fopen(input_path, "rb"))) {
+    fprintf(stderr, "Unable to open for reading: %s\n", input_path);
+    err = 1;
+  }
+#ifdef NO_STDIN
+  if (!err && (!opts->stream || opts->stream == stdin)) {
+    fprintf(stderr, "Please specify an input file\n");
+    err = 1;
+  }
+#endif
+
+  if (!err) {
+    sort_opts.keys = keys;
+    sort_opts.verbose = opts->verbose;
+    if (!(writer = zsv_writer_new(&writer_opts)) || !(sorter = zsv_sorter_new(&sort_opts))) {
+      fprintf(stderr, "Out of memory!\n");
+      err = 1;
+    } else if (zsv_new_with_properties(opts, custom_prop_handler, input_path, &parser) != zsv_status_ok) {
+      fprintf(stderr, "Unable to initialize parser\n");
+      err = 1;
+    }
+  }
+
+  if (!err && zsv_next_row(parser) == zsv_status_row) {
+    err = zsv_sort_resolve_keys(parser, kargs, keys, sort_opts.key_count);
+    size_t cell_count = err ? 0 : zsv_cell_count(parser);
+    for (size_t i = 0; i < cell_count; i++) {
+      struct zsv_cell c = zsv_get_cell(parser, i);
+      zsv_writer_cell(writer, i == 0, c.str, c.len, 1);
+    }
+
+    enum zsv_sort_status stat = zsv_sort_status_ok;
+    while (!err && stat == zsv_sort_status_ok && zsv_next_row(parser) == zsv_status_row)
+      stat = zsv_sorter_add_row(sorter, parser);
+    if (!err && stat == zsv_sort_status_ok)
+      stat = zsv_sorter_finish(sorter);
+    if (!err && stat == zsv_sort_status_ok) {
+      struct zsv_cell *cells;
+      size_t count;
+      int rc;
+      while ((rc = zsv_sorter_next(sorter, &cells, &count)) > 0)
+        zsv_sort_write_row(writer, cells, count);
+      if (rc < 0)
+        stat = zsv_sort_status_error;
+    }
+    if (!err && stat != zsv_sort_status_ok) {
+      fprintf(stderr, stat == zsv_sort_status_memory ? "Out of memory!\n" : "Error sorting rows\n");
+      err = 1;
+    }
+  }
+
+  zsv_delete(parser);
+  zsv_sorter_delete(sorter);
+  zsv_writer_delete(writer);
+  if (writer_opts.stream && writer_opts.stream != stdout)
+    fclose(writer_opts.stream);
+  if (opts->stream && opts->stream != stdin)
+    fclose(opts->stream);
+  if (kargs)
+    for (int i = 0; i < argc; i++)
+      free(kargs[i].name);
+  free(kargs);
+  free(keys);
+  return err;
+}
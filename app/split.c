@@ -0,0 +1,680 @@
+/*
+ * Copyright (C) 2021 Liquidaty and zsv contributors. All rights reserved.
+ *
+ * This file is part of zsv/lib, distributed under the MIT license as defined at
+ * https://opensource.org/licenses/MIT
+ */
+
+/*
+ * Split input rows into several files, each with the header row.
+ *
+ * The main thread parses the input and copies each row's cells into a batch;
+ * a writer thread routes each row of a batch to its output file and writes it,
+ * while the main thread fills the next batch. With --by, the number of output
+ * files is unbounded, so at most --max-open of them are kept open: the least
+ * recently used one is closed to make room, and reopened for appending if it
+ * receives more rows
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <ctype.h>
+#ifndef ZSV_NO_PARALLEL
+#include <pthread.h>
+#endif
+
+#define ZSV_COMMAND split
+#include "zsv_command.h"
+
+#include <zsv/utils/writer.h>
+#include <zsv/utils/string.h>
+#include <zsv/utils/arg.h>
+#include "utils/buff.h"
+#include "utils/column.h"
+#include "utils/hash.h"
+
+#define ZSV_SPLIT_DEFAULT_MAX_OPEN 64
+#define ZSV_SPLIT_BATCH_SZ (1024 * 1024)
+
+const char *zsv_split_usage_msg[] = {
+  ZSV_USAGE_PROG " " APPNAME ": split rows into several files",
+  "",
+  "Usage: " ZSV_USAGE_PROG " " APPNAME " <--rows N | --bytes N | --by <col> | --hash <col>:<K>> [options] [filename]",
+  "",
+  "Each output file starts with the header row, and rows are output in input order.",
+  "",
+  "Options:",
+  "  --rows <N>               : start a new file every N rows",
+  "  --bytes <N>[k|m|g]       : start a new file before one would exceed N bytes",
+  "                             (each file gets at least one row)",
+  "  --by <col>               : output rows to one file per distinct value of <col>",
+  "  --hash <col>:<K>         : output rows to K files by a hash of the value of <col>",
+  "                             <col> may be a column name (case-insensitive) or #N",
+  "                             for the Nth column (1-based)",
+  "  -o,--output <prefix>     : output to <prefix>-<n>.csv (--rows, --bytes: n = 1, 2, ...;",
+  "                             --hash: n = 0 ... K-1) or <prefix>-<value>.csv (--by),",
+  "                             where characters of <value> other than letters, digits,",
+  "                             '-', '_' and '.' are replaced with '_'. Defaults to the",
+  "                             input filename without its extension, or \"split\" for stdin",
+  "  --max-open <n>           : maximum number of files to keep open (default: 64)",
+  "  -b                       : output with BOM",
+  NULL,
+};
+
+static int zsv_split_usage(void) {
+  zsv_print_usage(zsv_split_usage_msg);
+  return 0;
+}
+
+enum zsv_split_mode {
+  zsv_split_mode_none = 0,
+  zsv_split_mode_rows,
+  zsv_split_mode_bytes,
+  zsv_split_mode_by,
+  zsv_split_mode_hash
+};
+
+struct zsv_split_file {
+  char *name;
+  FILE *stream;
+  zsv_csv_writer writer; // NULL if closed
+  char created;          // reopen for appending, after the file was closed
+  uint64_t rows;
+  size_t bytes;
+  struct zsv_split_file *lru_prev, *lru_next; // open files, most recently used first
+};
+
+/*
+ * a batch of rows; each row is [u32 cell count] followed by, for each cell,
+ * [u8 quoted][u32 length][bytes]
+ */
+struct zsv_split_batch {
+  struct zsv_buff buff;
+  size_t rows;
+};
+
+struct zsv_split {
+  enum zsv_split_mode mode;
+  uint64_t max_rows;
+  size_t max_bytes;
+  unsigned int hash_count;
+  const char *col_arg;
+  size_t col; // --by / --hash column
+  const char *prefix;
+  unsigned int max_open;
+  char with_bom;
+  char verbose;
+
+  zsv_parser parser;
+  struct zsv_split_batch header; // the header row
+  struct zsv_cell *header_cells;
+  size_t header_count;
+  size_t header_bytes;
+  struct zsv_split_batch batches[2]; // filled by the main thread, alternately
+  unsigned int current;              // batch being filled
+
+  // used by the writer
+  struct zsv_split_file **files;
+  size_t file_count;
+  size_t file_capacity;
+  struct zsv_split_file *lru_head, *lru_tail;
+  unsigned int open_count;
+  zsv_hash_set values; // --by: column value -> file index
+  zsv_hash_set names;  // --by: file name -> file index
+  size_t current_file;         // --rows, --bytes: file being written, if file_count > 0
+  struct zsv_cell *cells;
+  size_t cells_capacity;
+  unsigned char *quote_buff;
+  size_t quote_buff_size;
+
+#ifndef ZSV_NO_PARALLEL
+  pthread_t writer_thread;
+  char writer_started;
+  pthread_mutex_t mutex;
+  pthread_cond_t cond;
+  char ready[2]; // batch is filled, waiting for the writer
+  char done;     // no more batches will be filled
+#endif
+  int writer_err;
+  int err;
+};
+
+// get the file index of s, or NULL if s was not found
+static size_t *zsv_split_map_get(zsv_hash_set m, const unsigned char *s, size_t len) {
+  size_t ix = m ? zsv_hash_set_find(m, zsv_hash(s, len), s, len) : ZSV_HASH_SET_NONE;
+  return ix == ZSV_HASH_SET_NONE ? NULL : zsv_hash_set_value(m, ix);
+}
+
+static int zsv_split_map_set(zsv_hash_set *m, const unsigned char *s, size_t len, size_t idx) {
+  size_t ix;
+  if ((!*m && !(*m = zsv_hash_set_new(sizeof(size_t)))) ||
+      (ix = zsv_hash_set_add(*m, zsv_hash(s, len), s, len, NULL)) == ZSV_HASH_SET_NONE)
+    return 1;
+  *(size_t *)zsv_hash_set_value(*m, ix) = idx;
+  return 0;
+}
+
+/* batches */
+
+static int zsv_split_batch_add_row(struct zsv_split_batch *b, zsv_parser parser) {
+  uint32_t cell_count = (uint32_t)zsv_cell_count(parser);
+  if (zsv_buff_append(&b->buff, &cell_count, sizeof(cell_count)))
+    return 1;
+  for (uint32_t i = 0; i < cell_count; i++) {
+    struct zsv_cell c = zsv_get_cell(parser, i);
+    unsigned char quoted = c.quoted != 0;
+    if (zsv_buff_append(&b->buff, &quoted, 1) || zsv_buff_append_cell(&b->buff, c.str, c.len))
+      return 1;
+  }
+  b->rows++;
+  return 0;
+}
+
+// read the row at *pos into d->cells; return the number of cells, or -1 on error
+static long zsv_split_batch_read_row(struct zsv_split *d, const struct zsv_split_batch *b, size_t *pos) {
+  const unsigned char *s = b->buff.s + *pos;
+  uint32_t cell_count = zsv_buff_u32(s);
+  s += sizeof(cell_count);
+  if (cell_count > d->cells_capacity) {
+    struct zsv_cell *cells = realloc(d->cells, cell_count * sizeof(*cells));
+    if (!cells)
+      return -1;
+    d->cells = cells;
+    d->cells_capacity = cell_count;
+  }
+  for (uint32_t i = 0; i < cell_count; i++) {
+    d->cells[i].quoted = *s++;
+    d->cells[i].len = zsv_buff_u32(s);
+    d->cells[i].str = (unsigned char *)s + sizeof(uint32_t);
+    s += sizeof(uint32_t) + d->cells[i].len;
+  }
+  *pos = (size_t)(s - b->buff.s);
+  return (long)cell_count;
+}
+
+/* output files */
+
+// number of bytes a row will take in the output, excluding its line end
+static size_t zsv_split_row_bytes(struct zsv_split *d, const struct zsv_cell *cells, size_t count) {
+  size_t bytes = count ? count - 1 : 0;
+  for (size_t i = 0; i < count; i++) {
+    unsigned char *q = cells[i].quoted ? zsv_csv_quote(cells[i].str, cells[i].len, d->quote_buff, d->quote_buff_size)
+                                       : NULL;
+    if (!q)
+      bytes += cells[i].len;
+    else {
+      bytes += strlen((char *)q);
+      if (q != d->quote_buff)
+        free(q);
+    }
+  }
+  return bytes;
+}
+
+static void zsv_split_write_row(zsv_csv_writer w, const struct zsv_cell *cells, size_t count) {
+  size_t i;
+  for (i = 0; i < count && !cells[i].quoted; i++)
+    ;
+  if (i == count)
+    zsv_writer_row_raw(w, cells, (unsigned int)count);
+  else
+    for (i = 0; i < count; i++)
+      zsv_writer_cell(w, i == 0, cells[i].str, cells[i].len, cells[i].quoted != 0);
+}
+
+static void zsv_split_lru_unlink(struct zsv_split *d, struct zsv_split_file *f) {
+  if (f->lru_prev)
+    f->lru_prev->lru_next = f->lru_next;
+  else
+    d->lru_head = f->lru_next;
+  if (f->lru_next)
+    f->lru_next->lru_prev = f->lru_prev;
+  else
+    d->lru_tail = f->lru_prev;
+  f->lru_prev = f->lru_next = NULL;
+}
+
+static void zsv_split_lru_push(struct zsv_split *d, struct zsv_split_file *f) {
+  f->lru_next = d->lru_head;
+  if (d->lru_head)
+    d->lru_head->lru_prev = f;
+  d->lru_head = f;
+  if (!d->lru_tail)
+    d->lru_tail = f;
+}
+
+static int zsv_split_file_close(struct zsv_split *d, struct zsv_split_file *f) {
+  if (!f->writer)
+    return 0;
+  zsv_split_lru_unlink(d, f);
+  d->open_count--;
+  enum zsv_writer_status stat = zsv_writer_delete(f->writer);
+  int err = fclose(f->stream);
+  f->writer = NULL;
+  f->stream = NULL;
+  return stat != zsv_writer_status_ok || err;
+}
+
+// get an open writer for the file, closing the least recently used one if needed
+static zsv_csv_writer zsv_split_file_writer(struct zsv_split *d, struct zsv_split_file *f) {
+  if (f->writer) {
+    if (d->lru_head != f) {
+      zsv_split_lru_unlink(d, f);
+      zsv_split_lru_push(d, f);
+    }
+    return f->writer;
+  }
+  if (d->open_count >= d->max_open && zsv_split_file_close(d, d->lru_tail))
+    return NULL;
+
+  struct zsv_csv_writer_options writer_opts = zsv_writer_get_default_opts();
+  if (!(writer_opts.stream = fopen(f->name, f->created ? "ab" : "wb"))) {
+    perror(f->name);
+    return NULL;
+  }
+  writer_opts.with_bom = d->with_bom && !f->created;
+  if (!(f->writer = zsv_writer_new(&writer_opts))) {
+    fclose(writer_opts.stream);
+    return NULL;
+  }
+  f->stream = writer_opts.stream;
+  zsv_writer_set_temp_buff(f->writer, d->quote_buff, d->quote_buff_size);
+  d->open_count++;
+  zsv_split_lru_push(d, f);
+  if (!f->created) {
+    zsv_split_write_row(f->writer, d->header_cells, d->header_count);
+    f->created = 1;
+    f->bytes = d->header_bytes + 1;
+    if (d->verbose)
+      fprintf(stderr, "Created %s\n", f->name);
+  }
+  return f->writer;
+}
+
+// add a file named <prefix>-<suffix>.csv
+static struct zsv_split_file *zsv_split_file_new(struct zsv_split *d, const char *suffix, size_t suffix_len) {
+  if (d->file_count == d->file_capacity) {
+    size_t capacity = d->file_capacity ? d->file_capacity * 2 : 64;
+    struct zsv_split_file **files = realloc(d->files, capacity * sizeof(*files));
+    if (!files)
+      return NULL;
+    d->files = files;
+    d->file_capacity = capacity;
+  }
+  struct zsv_split_file *f = calloc(1, sizeof(*f));
+  if (!f || asprintf(&f->name, "%s-%.*s.csv", d->prefix, (int)suffix_len, suffix) == -1) {
+    free(f);
+    return NULL;
+  }
+  d->files[d->file_count++] = f;
+  return f;
+}
+
+// --by: get the file for a column value, adding it if new
+static struct zsv_split_file *zsv_split_file_by_value(struct zsv_split *d, const struct zsv_cell *c) {
+  const size_t *idx = zsv_split_map_get(d->values, c->str, c->len);
+  if (idx)
+    return d->files[*idx];
+
+  // file name suffix: the value, with special characters replaced
+  char *suffix = malloc(c->len + 32);
+  if (!suffix)
+    return NULL;
+  size_t len = 0;
+  for (size_t i = 0; i < c->len; i++)
+    suffix[len++] = isalnum(c->str[i]) || c->str[i] == '-' || c->str[i] == '_' || c->str[i] == '.' ? c->str[i] : '_';
+  if (!len)
+    suffix[len++] = '_';
+  // distinct values may have the same suffix; if so, add the file number
+  if (zsv_split_map_get(d->names, (unsigned char *)suffix, len))
+    len += (size_t)sprintf(suffix + len, "~%zu", d->file_count + 1);
+  struct zsv_split_file *f = zsv_split_file_new(d, suffix, len);
+  if (f && (zsv_split_map_set(&d->values, c->str, c->len, d->file_count - 1) ||
+            zsv_split_map_set(&d->names, (unsigned char *)suffix, len, d->file_count - 1)))
+    f = NULL;
+  free(suffix);
+  return f;
+}
+
+static struct zsv_split_file *zsv_split_file_by_number(struct zsv_split *d, size_t n) {
+  char suffix[32];
+  while (d->file_count <= n) {
+    int len = snprintf(suffix, sizeof(suffix), "%zu", d->mode == zsv_split_mode_hash ? d->file_count : d->file_count + 1);
+    if (!zsv_split_file_new(d, suffix, (size_t)len))
+      return NULL;
+  }
+  return d->files[n];
+}
+
+static int zsv_split_write_batch(struct zsv_split *d, const struct zsv_split_batch *b) {
+  size_t pos = 0;
+  for (size_t r = 0; r < b->rows; r++) {
+    long count = zsv_split_batch_read_row(d, b, &pos);
+    if (count < 0)
+      return 1;
+    struct zsv_split_file *f = NULL;
+    struct zsv_cell empty = {0};
+    const struct zsv_cell *c = d->col < (size_t)count ? &d->cells[d->col] : &empty;
+    size_t row_bytes = 0;
+    switch (d->mode) {
+    case zsv_split_mode_rows:
+    case zsv_split_mode_bytes:
+      // one file at a time
+      if (d->mode == zsv_split_mode_bytes)
+        row_bytes = zsv_split_row_bytes(d, d->cells, (size_t)count) + 1;
+      f = zsv_split_file_by_number(d, d->current_file);
+      if (f && f->rows &&
+          (d->mode == zsv_split_mode_rows ? f->rows == d->max_rows : f->bytes + row_bytes > d->max_bytes)) {
+        if (zsv_split_file_close(d, f))
+          return 1;
+        f = zsv_split_file_by_number(d, ++d->current_file);
+      }
+      break;
+    case zsv_split_mode_by:
+      f = zsv_split_file_by_value(d, c);
+      break;
+    case zsv_split_mode_hash:
+      f = zsv_split_file_by_number(d, (size_t)(zsv_hash(c->str, c->len) % d->hash_count));
+      break;
+    case zsv_split_mode_none:
+      break;
+    }
+
+    zsv_csv_writer w;
+    if (!f || !(w = zsv_split_file_writer(d, f)))
+      return 1;
+    zsv_split_write_row(w, d->cells, (size_t)count);
+    f->rows++;
+    f->bytes += row_bytes;
+  }
+  return 0;
+}
+
+#ifndef ZSV_NO_PARALLEL
+static void *zsv_split_writer_main(void *arg) {
+  struct zsv_split *d = arg;
+  for (unsigned int i = 0;; i = !i) {
+    pthread_mutex_lock(&d->mutex);
+    while (!d->ready[i] && !d->done)
+      pthread_cond_wait(&d->cond, &d->mutex);
+    char ready = d->ready[i];
+    pthread_mutex_unlock(&d->mutex);
+    if (!ready)
+      break;
+
+    int err = d->writer_err ? 0 : zsv_split_write_batch(d, &d->batches[i]);
+    pthread_mutex_lock(&d->mutex);
+    if (err)
+      d->writer_err = 1;
+    d->ready[i] = 0;
+    pthread_cond_signal(&d->cond);
+    pthread_mutex_unlock(&d->mutex);
+  }
+  return NULL;
+}
+#endif
+
+// hand the current batch to the writer and start filling the other one
+static int zsv_split_flush_batch(struct zsv_split *d) {
+  struct zsv_split_batch *b = &d->batches[d->current];
+  if (!b->rows)
+    return 0;
+#ifndef ZSV_NO_PARALLEL
+  pthread_mutex_lock(&d->mutex);
+  d->ready[d->current] = 1;
+  pthread_cond_signal(&d->cond);
+  d->current = !d->current;
+  while (d->ready[d->current])
+    pthread_cond_wait(&d->cond, &d->mutex);
+  int err = d->writer_err;
+  pthread_mutex_unlock(&d->mutex);
+#else
+  int err = d->writer_err = zsv_split_write_batch(d, b);
+#endif
+  d->batches[d->current].buff.len = 0;
+  d->batches[d->current].rows = 0;
+  return err;
+}
+
+static void zsv_split_row(void *ctx) {
+  struct zsv_split *d = ctx;
+  struct zsv_split_batch *b = &d->batches[d->current];
+  if (zsv_split_batch_add_row(b, d->parser) || (b->buff.len >= ZSV_SPLIT_BATCH_SZ && zsv_split_flush_batch(d))) {
+    d->err = 1;
+    zsv_abort(d->parser);
+  }
+}
+
+static void zsv_split_header(void *ctx) {
+  struct zsv_split *d = ctx;
+  if (d->col_arg) {
+    if (zsv_find_column(d->parser, d->col_arg, &d->col)) {
+      fprintf(stderr, "Column not found: %s\n", d->col_arg);
+      d->err = 1;
+      zsv_abort(d->parser);
+      return;
+    }
+  }
+  if (zsv_split_batch_add_row(&d->header, d->parser)) {
+    d->err = 1;
+    zsv_abort(d->parser);
+    return;
+  }
+  size_t pos = 0;
+  long count = zsv_split_batch_read_row(d, &d->header, &pos);
+  if (count < 0 || !(d->header_cells = malloc((size_t)count * sizeof(*d->header_cells) + 1))) {
+    d->err = 1;
+    zsv_abort(d->parser);
+    return;
+  }
+  d->header_count = (size_t)count;
+  memcpy(d->header_cells, d->cells, d->header_count * sizeof(*d->header_cells));
+  d->header_bytes = zsv_split_row_bytes(d, d->header_cells, d->header_count);
+
+#ifndef ZSV_NO_PARALLEL
+  if (pthread_create(&d->writer_thread, NULL, zsv_split_writer_main, d) != 0) {
+    fprintf(stderr, "Error creating writer thread\n");
+    d->err = 1;
+    zsv_abort(d->parser);
+    return;
+  }
+  d->writer_started = 1;
+#endif
+  zsv_set_row_handler(d->parser, zsv_split_row);
+}
+
+// parse a size such as 100, 64k or 2M
+static size_t zsv_split_parse_bytes(const char *s) {
+  char *end;
+  unsigned long long n = strtoull(s, &end, 10);
+  switch (*end) {
+  case 'k':
+  case 'K':
+    n *= 1024, end++;
+    break;
+  case 'm':
+  case 'M':
+    n *= 1024 * 1024, end++;
+    break;
+  case 'g':
+  case 'G':
+    n *= 1024 * 1024 * 1024, end++;
+    break;
+  }
+  return *end ? 0 : (size_t)n;
+}
+
+int ZSV_MAIN_FUNC(ZSV_COMMAND)(int argc, const char *argv[], struct zsv_opts *opts,
+                               struct zsv_prop_handler *custom_prop_handler) {
+  if (argc < 2 || !strcmp(argv[1], "-h") || !strcmp(argv[1], "--help"))
+    return zsv_split_usage();
+
+  int err = 0;
+  const char *input_path = NULL;
+  char *hash_col = NULL;
+  struct zsv_split d = {0};
+  d.max_open = ZSV_SPLIT_DEFAULT_MAX_OPEN;
+  d.verbose = opts->verbose;
+
+  for (int arg_i = 1; !err && arg_i < argc; arg_i++) {
+    const char *arg = argv[arg_i];
+    enum zsv_split_mode mode = zsv_split_mode_none;
+    if (!strcmp(arg, "--rows"))
+      mode = zsv_split_mode_rows;
+    else if (!strcmp(arg, "--bytes"))
+      mode = zsv_split_mode_bytes;
+    else if (!strcmp(arg, "--by"))
+      mode = zsv_split_mode_by;
+    else if (!strcmp(arg, "--hash"))
+      mode = zsv_split_mode_hash;
+
+    if (mode) {
+      if (d.mode) {
+        fprintf(stderr, "Only one of --rows, --bytes, --by or --hash may be specified\n");
+        err = 1;
+      } else if (++arg_i >= argc || !*argv[arg_i]) {
+        fprintf(stderr, "%s option requires a value\n", arg);
+        err = 1;
+      } else {
+        const char *value = argv[arg_i];
+        const char *colon;
+        d.mode = mode;
+        if (mode == zsv_split_mode_rows && (d.max_rows = (uint64_t)strtoull(value, NULL, 10)) == 0)
+          err = 1;
+        else if (mode == zsv_split_mode_bytes && (d.max_bytes = zsv_split_parse_bytes(value)) == 0)
+          err = 1;
+        else if (mode == zsv_split_mode_by)
+          d.col_arg = value;
+        else if (mode == zsv_split_mode_hash) {
+          if (!(colon = strrchr(value, ':')) || colon == value || atoi(colon + 1) <= 0 ||
+              !(hash_col = malloc((size_t)(colon - value) + 1)))
+            err = 1;
+          else {
+            d.hash_count = (unsigned int)atoi(colon + 1);
+            memcpy(hash_col, value, (size_t)(colon - value));
+            hash_col[colon - value] = '\0';
+            d.col_arg = hash_col;
+          }
+        }
+        if (err)
+          fprintf(stderr, "Invalid %s value: %s\n", arg, value);
+      }
+    } else if (!strcmp(arg, "-o") || !strcmp(arg, "--output")) {
+      if (++arg_i >= argc || !*argv[arg_i]) {
+        fprintf(stderr, "%s option requires a filename prefix\n", arg);
+        err = 1;
+      } else
+        d.prefix = argv[arg_i];
+    } else if (!strcmp(arg, "--max-open")) {
+      if (++arg_i >= argc || atoi(argv[arg_i]) <= 0) {
+        fprintf(stderr, "%s option requires a positive number\n", arg);
+        err = 1;
+      } else
+        d.max_open = (unsigned int)atoi(argv[arg_i]);
+    } else if (!strcmp(arg, "-b"))
+      d.with_bom = 1;
+    else if (zsv_arg_is_option(arg)) {
+      fprintf(stderr, "Unrecognized option: %s\n", arg);
+      err = 1;
+    } else if (input_path) {
+      fprintf(stderr, "Input may not be specified more than once\n");
+      err = 1;
+    } else
+      input_path = arg;
+  }
+  if (!err && !d.mode) {
+    fprintf(stderr, "Please specify --rows, --bytes, --by or --hash\n");
+    err = 1;
+  }
+
+  // default output prefix: the input filename without its extension
+  char *default_prefix = NULL;
+  if (!err && !d.prefix) {
+    if (!input_path || !strcmp(input_path, "-"))
+      d.prefix = "split";
+    else if ((default_prefix = strdup(input_path))) {
+      char *dot = strrchr(default_prefix, '.');
+      if (dot && dot > default_prefix && !strchr(dot, '/') && !strchr(dot, '\\'))
+        *dot = '\0';
+      d.prefix = default_prefix;
+    } else
+      err = 1;
+  }
+
+  FILE *f_in = NULL;
+  if (!err) {
+    if (!input_path || !strcmp(input_path, "-")) {
+#ifdef NO_STDIN
+      fprintf(stderr, "Please specify an input file\n");
+      err = 1;
+#else
+      f_in = stdin;
+      input_path = NULL;
+#endif
+    } else if (!(f_in = fopen(input_path, "rb"))) {
+      fprintf(stderr, "Unable to open for reading: %s\n", input_path);
+      err = 1;
+    }
+  }
+
+  d.quote_buff_size = 1024;
+  if (!err && !(d.quote_buff = malloc(d.quote_buff_size)))
+    err = 1;
+
+  if (!err) {
+#ifndef ZSV_NO_PARALLEL
+    pthread_mutex_init(&d.mutex, NULL);
+    pthread_cond_init(&d.cond, NULL);
+#endif
+    opts->stream = f_in;
+    opts->row_handler = zsv_split_header;
+    opts->ctx = &d;
+    if (zsv_new_with_properties(opts, custom_prop_handler, input_path, &d.parser) != zsv_status_ok)
+      err = 1;
+    else {
+      while (!d.err && zsv_parse_more(d.parser) == zsv_status_ok)
+        ;
+      if (!d.err)
+        zsv_finish(d.parser);
+      zsv_delete(d.parser);
+    }
+    if (!d.err && zsv_split_flush_batch(&d))
+      d.err = 1;
+#ifndef ZSV_NO_PARALLEL
+    if (d.writer_started) {
+      pthread_mutex_lock(&d.mutex);
+      d.done = 1;
+      pthread_cond_signal(&d.cond);
+      pthread_mutex_unlock(&d.mutex);
+      pthread_join(d.writer_thread, NULL);
+    }
+    pthread_mutex_destroy(&d.mutex);
+    pthread_cond_destroy(&d.cond);
+#endif
+    if (d.err || d.writer_err)
+      err = 1;
+  }
+
+  for (size_t i = 0; i < d.file_count; i++) {
+    if (zsv_split_file_close(&d, d.files[i]))
+      err = 1;
+    free(d.files[i]->name);
+    free(d.files[i]);
+  }
+  free(d.files);
+  zsv_hash_set_delete(d.values);
+  zsv_hash_set_delete(d.names);
+  free(d.header.buff.s);
+  free(d.header_cells);
+  free(d.batches[0].buff.s);
+  free(d.batches[1].buff.s);
+  free(d.cells);
+  free(d.quote_buff);
+  free(default_prefix);
+  free(hash_col);
+  if (f_in && f_in != stdin)
+    fclose(f_in);
+  return err;
+}
@@ -26,6 +26,13 @@
 
 #include <unistd.h> // unlink
 
+#include <zsv/utils/os.h> // zsv_get_number_of_cores
+
+#include "sql_join.c"
+#ifndef ZSV_NO_PARALLEL
+#include "sql_agg.c"
+#endif
+
 #ifndef STRING_LIST
 #define STRING_LIST
 struct string_list {
@@ -57,6 +64,16 @@ const char *zsv_sql_usage_msg[] = {
   "                          of the join. For example, if joining two files that, respectively, have columns",
   "                          A,B,C,D and X,B,C,A,Y then `--join-indexes 1,3` will join on columns A and C.",
   "                          When using this option, do not include an sql statement",
+  "  --join-max-memory <MB>: memory budget for the native join used when --join-indexes is given without",
+  "                          an sql statement (default: 1024). Larger inputs are",
+  "                          partitioned to temporary files",
+#ifndef ZSV_NO_PARALLEL
+  "  -j,--jobs <n>         : number of parallel threads to use for a simple aggregate query on a single",
+  "                          CSV file, i.e. `select` of group by columns and count/sum/total/avg/min/max",
+  "                          of columns, `from data` with an optional `group by`. Other queries are",
+  "                          run by sqlite as usual",
+  "  --parallel            : same as -j, using all available cores",
+#endif
   "  -b                    : output with BOM",
   "  -C,--max-cols <n>     : change the maximum allowable columns. must be > 0 and < 2000",
   "  -o <filename>         : filename to save output to",
@@ -66,6 +83,8 @@ const char *zsv_sql_usage_msg[] = {
   "                          comparison is case-insensitive",
   "  --rename-duplicate-columns : (default; retained for back-compat) auto-rename duplicate input",
   "                          column names to a, a_2, a_3, ... A one-line summary is printed to stderr",
+  "  --infer-types         : declare columns whose sampled values are all integers (or numbers) as",
+  "                          INTEGER (or REAL), so that they sort, compare and aggregate numerically",
   NULL,
 };
 
@@ -81,10 +100,13 @@ struct zsv_sql_data {
   char *sql_dynamic;  // will hold contents of sql file, if any
   char *join_indexes; // will hold contents of join_indexes arg, prefixed and suffixed with a comma
   struct string_list *join_column_names;
+  size_t join_max_memory_mb;
+  unsigned int num_chunks;
   unsigned char in_memory : 1;
   unsigned char rename_dup_cols : 1;   // back-compat alias for the default (auto-disambiguate); a no-op
   unsigned char error_on_dup_cols : 1; // opt-out: error on duplicate input columns instead of renaming
-  unsigned char _ : 5;
+  unsigned char infer_types : 1;
+  unsigned char _ : 4;
 };
 
 static void zsv_sql_finalize(struct zsv_sql_data *data) {
@@ -120,6 +142,124 @@ static char is_select_sql(const char *s) {
                                                         (const unsigned char *)s, strlen("select "));
 }
 
+/*
+ * run a --join-indexes join without sqlite (see sql_join.c). Column names (after
+ * any de-duplication) are taken from each input's table, so that output is the
+ * same as that of the generated join sql
+ *
+ * @return 0 on success, positive on error, or -1 if the join should be run in sqlite
+ */
+static int zsv_sql_join_native(struct zsv_sqlite3_db *zdb, struct zsv_sql_data *data, const char *csv_filename,
+                               struct zsv_opts *opts, struct zsv_prop_handler *custom_prop_handler,
+                               zsv_csv_writer cw) {
+  struct zsv_join j = {0};
+  j.opts = opts;
+  j.custom_prop_handler = custom_prop_handler;
+  j.max_memory = (data->join_max_memory_mb ? data->join_max_memory_mb : ZSV_JOIN_DEFAULT_MAX_MEMORY_MB) * 1024 * 1024;
+  for (struct string_list *sl = data->join_column_names; sl; sl = sl->next)
+    j.key_count++;
+  j.input_count = 1;
+  for (struct string_list *sl = data->more_input_filenames; sl; sl = sl->next)
+    j.input_count++;
+  if (!(j.inputs = calloc(j.input_count, sizeof(*j.inputs))))
+    return 1;
+
+  int rc = 0;
+  sqlite3_stmt **stmts = calloc(j.input_count, sizeof(*stmts));
+  if (!stmts)
+    rc = 1;
+  struct string_list *sl = data->more_input_filenames;
+  for (unsigned int i = 0; !rc && i < j.input_count; i++) {
+    struct zsv_join_input *in = &j.inputs[i];
+    in->filename = i ? sl->value : csv_filename;
+    if (i)
+      sl = sl->next;
+
+    char *select = i ? sqlite3_mprintf("select * from data%u", i + 1) : sqlite3_mprintf("select * from data");
+    if (!select || sqlite3_prepare_v2(zdb->db, select, -1, &stmts[i], NULL) != SQLITE_OK)
+      rc = -1;
+    else if (!(in->key_ixs = calloc(j.key_count ? j.key_count : 1, sizeof(*in->key_ixs))))
+      rc = 1;
+    else {
+      in->col_count = (unsigned int)sqlite3_column_count(stmts[i]);
+      unsigned int k = 0;
+      for (struct string_list *key = data->join_column_names; !rc && key; key = key->next, k++) {
+        unsigned int c = 0;
+        while (c < in->col_count && sqlite3_stricmp(sqlite3_column_name(stmts[i], (int)c), key->value))
+          c++;
+        if (c == in->col_count)
+          rc = -1;
+        in->key_ixs[k] = c;
+      }
+    }
+    sqlite3_free(select);
+  }
+
+  if (!rc) {
+    // write header row
+    for (unsigned int i = 0, n = 0; i < j.input_count; i++) {
+      for (unsigned int c = 0; c < j.inputs[i].col_count; c++, n++) {
+        const char *colname = sqlite3_column_name(stmts[i], (int)c);
+        zsv_writer_cell(cw, !n, (const unsigned char *)colname, colname ? strlen(colname) : 0, 1);
+      }
+    }
+    if (opts->verbose)
+      fprintf(stderr, "Joining %u inputs without sql\n", j.input_count);
+    rc = zsv_join_run(&j, cw);
+  }
+
+  for (unsigned int i = 0; stmts && i < j.input_count; i++)
+    sqlite3_finalize(stmts[i]);
+  free(stmts);
+  for (unsigned int i = 0; i < j.input_count; i++)
+    free(j.inputs[i].key_ixs);
+  zsv_join_clear(&j);
+  free(j.inputs);
+  return rc;
+}
+
+#ifndef ZSV_NO_PARALLEL
+/*
+ * run a simple aggregate query in parallel without sqlite (see sql_agg.c)
+ *
+ * @return 0 on success, positive on error, or -1 if the query should be run in sqlite
+ */
+static int zsv_sql_agg_native(struct zsv_sqlite3_db *zdb, const char *sql, const char *csv_filename,
+                              unsigned int num_chunks, struct zsv_opts *opts,
+                              struct zsv_prop_handler *custom_prop_handler, zsv_csv_writer cw) {
+  if (zsv_chunkable(csv_filename, opts) != zsv_chunk_status_ok)
+    return -1;
+
+  // the statement is prepared to validate it, and for its column names, but is not run
+  int rc = -1;
+  sqlite3_stmt *data_stmt = NULL, *stmt = NULL;
+  char **colnames = NULL;
+  struct zsv_sql_agg_query q = {0};
+  if (sqlite3_prepare_v2(zdb->db, "select * from data", -1, &data_stmt, NULL) == SQLITE_OK &&
+      sqlite3_prepare_v2(zdb->db, sql, -1, &stmt, NULL) == SQLITE_OK) {
+    unsigned int col_count = (unsigned int)sqlite3_column_count(data_stmt);
+    if ((colnames = calloc(col_count ? col_count : 1, sizeof(*colnames)))) {
+      for (unsigned int i = 0; i < col_count; i++)
+        colnames[i] = (char *)sqlite3_column_name(data_stmt, (int)i);
+      if (!zsv_sql_agg_parse(sql, colnames, col_count, &q) && (unsigned int)sqlite3_column_count(stmt) == q.out_count) {
+        for (int i = 0; i < (int)q.out_count; i++) {
+          const char *colname = sqlite3_column_name(stmt, i);
+          zsv_writer_cell(cw, !i, (const unsigned char *)colname, colname ? strlen(colname) : 0, 1);
+        }
+        if (opts->verbose)
+          fprintf(stderr, "Running aggregate query with %u threads\n", num_chunks);
+        rc = zsv_sql_agg_run(&q, csv_filename, num_chunks, NULL, opts, custom_prop_handler, cw);
+      }
+    }
+  }
+  zsv_sql_agg_query_clear(&q);
+  free(colnames);
+  sqlite3_finalize(stmt);
+  sqlite3_finalize(data_stmt);
+  return rc;
+}
+#endif
+
 int ZSV_MAIN_FUNC(ZSV_COMMAND)(int argc, const char *argv[], struct zsv_opts *opts,
                                struct zsv_prop_handler *custom_prop_handler) {
   /**
@@ -205,6 +345,30 @@ int ZSV_MAIN_FUNC(ZSV_COMMAND)(int argc, const char *argv[], struct zsv_opts *op
         data.rename_dup_cols = 1;
       else if (!strcmp(arg, "--error-on-duplicate-columns"))
         data.error_on_dup_cols = 1;
+      else if (!strcmp(arg, "--infer-types"))
+        data.infer_types = 1;
+#ifndef ZSV_NO_PARALLEL
+      else if (!strcmp(arg, "-j") || !strcmp(arg, "--jobs")) {
+        const char *value = zsv_next_arg(++arg_i, argc, argv, &err);
+        if (value && atoi(value) <= 0)
+          fprintf(stderr, "%s option requires a positive number\n", arg), err = 1;
+        else if (value)
+          data.num_chunks = (unsigned)atoi(value);
+      } else if (!strcmp(arg, "--parallel")) {
+        data.num_chunks = zsv_get_number_of_cores();
+        if (data.num_chunks < 2) {
+          fprintf(stderr, "Warning: --parallel specified but only one core found; using -j 4 instead\n");
+          data.num_chunks = 4;
+        }
+      }
+#endif
+      else if (!strcmp(arg, "--join-max-memory")) {
+        const char *value = zsv_next_arg(++arg_i, argc, argv, &err);
+        if (value && !(atoi(value) > 0))
+          fprintf(stderr, "%s value must be a positive number of megabytes\n", arg), err = 1;
+        else if (value)
+          data.join_max_memory_mb = (size_t)atoi(value);
+      }
       else if (!strcmp(arg, "-b"))
         writer_opts.with_bom = 1;
       else if (!zsv_arg_is_option(arg)) {
@@ -317,6 +481,7 @@ int ZSV_MAIN_FUNC(ZSV_COMMAND)(int argc, const char *argv[], struct zsv_opts *op
         .in_memory = data.in_memory,
         .dedupe_cols = dedupe,
         .warn_dupe_rename = dedupe, // non-interactive: emit one-line rename summary on stderr
+        .infer_types = data.infer_types,
       };
       struct zsv_sqlite3_db *zdb = zsv_sqlite3_db_new(&dbopts);
       if (zdb && zdb->rc == SQLITE_OK) {
@@ -324,7 +489,9 @@ int ZSV_MAIN_FUNC(ZSV_COMMAND)(int argc, const char *argv[], struct zsv_opts *op
 
         // for simplicity, we assume the same opts and custom_prop_handler for every input
         // it may be desirable later to make this customizable for each input
+        zdb->infer_types_no_cache = tmpfn != NULL; // no point caching types of a temp copy of stdin
         if (zsv_sqlite3_add_csv(zdb, csv_filename, opts, custom_prop_handler) == SQLITE_OK) {
+          zdb->infer_types_no_cache = 0;
           for (struct string_list *sl = data.more_input_filenames; sl; sl = sl->next)
             if (zsv_sqlite3_add_csv(zdb, sl->value, opts, custom_prop_handler) != SQLITE_OK)
               break;
@@ -336,6 +503,17 @@ int ZSV_MAIN_FUNC(ZSV_COMMAND)(int argc, const char *argv[], struct zsv_opts *op
         if (zdb->rc == SQLITE_OK)
           sqlite3_set_authorizer(zdb->db, zsv_sql_authorizer, NULL);
 
+#ifndef ZSV_NO_PARALLEL
+        if (zdb->rc == SQLITE_OK && !err && my_sql && data.num_chunks > 1 && !data.join_indexes &&
+            !data.more_input_filenames && !data.infer_types) {
+          int rc = zsv_sql_agg_native(zdb, my_sql, csv_filename, data.num_chunks, opts, custom_prop_handler, cw);
+          if (rc >= 0) {
+            err = rc;
+            my_sql = NULL;
+          }
+        }
+#endif
+
         if (zdb->rc == SQLITE_OK && data.join_indexes) { // get column names, and construct the sql
           // sql template:
           // select t1.*, t2.*, t3.* from t1 left join (select * from t2 group by a) t2 left join (select * from t3
@@ -426,7 +604,16 @@ int ZSV_MAIN_FUNC(ZSV_COMMAND)(int argc, const char *argv[], struct zsv_opts *op
               }
 
               my_sql = data.sql_dynamic;
-              if (opts->verbose)
+              if (!prefix_end && !data.infer_types) {
+                // no custom sql: join natively instead (unless a key is missing from an input,
+                // in which case let sqlite run the sql and report the error)
+                int rc = zsv_sql_join_native(zdb, &data, csv_filename, opts, custom_prop_handler, cw);
+                if (rc >= 0) {
+                  err = rc;
+                  my_sql = NULL;
+                }
+              }
+              if (my_sql && opts->verbose)
                 fprintf(stderr, "Join sql:\n%s\n", my_sql);
               sqlite3_free(sqlite3_str_finish(select_clause));
               sqlite3_free(sqlite3_str_finish(from_clause));
@@ -463,15 +650,13 @@ int ZSV_MAIN_FUNC(ZSV_COMMAND)(int argc, const char *argv[], struct zsv_opts *op
             sqlite3_finalize(stmt);
           }
         }
-        err = 1;
+        // keep any error already set, e.g. by a native aggregation or join
         if (zdb->err_msg)
-          fprintf(stderr, "Error: %s\n", zdb->err_msg);
+          fprintf(stderr, "Error: %s\n", zdb->err_msg), err = 1;
         else if (!zdb->db)
-          fprintf(stderr, "Error (unable to open db, code %i): %s\n", zdb->rc, sqlite3_errstr(zdb->rc));
+          fprintf(stderr, "Error (unable to open db, code %i): %s\n", zdb->rc, sqlite3_errstr(zdb->rc)), err = 1;
         else if (zdb->rc != SQLITE_OK)
-          fprintf(stderr, "Error (code %i): %s\n", zdb->rc, sqlite3_errstr(zdb->rc));
-        else
-          err = 0;
+          fprintf(stderr, "Error (code %i): %s\n", zdb->rc, sqlite3_errstr(zdb->rc)), err = 1;
 
         zsv_sqlite3_db_delete(zdb);
       }
@@ -0,0 +1,1175 @@
+/*
+ * Copyright (C) 2021 Liquidaty and the zsv/lib contributors
+ * All rights reserved
+ *
+ * This file is part of zsv/lib, distributed under the license defined at
+ * https://opensource.org/licenses/MIT
+ */
+
+/*
+ * Parallel evaluation of simple aggregate queries for `sql -j <n>` and `agg`
+ *
+ * A query of the form
+ *   select <key or aggregate>, ... from data [group by <column>, ...]
+ * where each aggregate is count(*), or count, count distinct, sum, total, avg,
+ * min or max of a column, is evaluated without sqlite: the input is split into
+ * chunks, each chunk is aggregated by its own thread into its own hash table of
+ * groups, and the tables are then merged in chunk order. Groups are output in
+ * key order, as sqlite does.
+ *
+ * If the tables outgrow the memory budget, their groups are sorted and spilled
+ * to temp files ("runs"), which are then merged by key. Only the distinct
+ * values of a single count(distinct) group must fit in memory.
+ *
+ * Values are treated as sqlite treats the (untyped) csv vtab columns: text
+ * whose numeric value, for sum/total/avg, follows sqlite's numeric affinity,
+ * and which is compared bytewise for grouping and for min/max. A cell that is
+ * missing from a short row is NULL. Sums that include non-integers are
+ * compensated (Kahan-Babuska-Neumaier) as in sqlite, though merging chunks
+ * may change the result in its last digit
+ */
+
+#include <ctype.h>
+#include <math.h>
+#include <pthread.h>
+#include <sys/stat.h>
+#include <zsv/utils/coltype.h>
+#include "utils/chunk.h"
+#include "utils/buff.h"
+#include "utils/hash.h"
+
+#define ZSV_SQL_AGG_MAX_COLUMNS 2000 // same default as the csv vtab
+#define ZSV_SQL_AGG_PARALLEL_MIN_BYTES (1024 * 1024 * 2)
+#define ZSV_SQL_AGG_MIN_CHUNK_BYTES (1024 * 1024) // smallest chunk worth a thread and a share of the memory
+#define ZSV_SQL_AGG_DEFAULT_MAX_MEMORY_MB 1024
+
+enum zsv_sql_agg_fn {
+  zsv_sql_agg_fn_key = 0, // not an aggregate: a group by column
+  zsv_sql_agg_fn_count_star,
+  zsv_sql_agg_fn_count,
+  zsv_sql_agg_fn_sum,
+  zsv_sql_agg_fn_total,
+  zsv_sql_agg_fn_avg,
+  zsv_sql_agg_fn_min,
+  zsv_sql_agg_fn_max,
+  zsv_sql_agg_fn_count_distinct
+};
+
+struct zsv_sql_agg_col {
+  enum zsv_sql_agg_fn fn;
+  unsigned int col;    // input column index (unused for count(*))
+  unsigned int key_ix; // if fn is key: index into the group by columns
+};
+
+struct zsv_sql_agg_query {
+  unsigned int key_count;
+  unsigned int *keys; // input column index of each group by column
+  unsigned int out_count;
+  struct zsv_sql_agg_col *out;
+};
+
+static void zsv_sql_agg_query_clear(struct zsv_sql_agg_query *q) {
+  free(q->keys);
+  free(q->out);
+  memset(q, 0, sizeof(*q));
+}
+
+#ifndef ZSV_SQL_AGG_NO_PARSER // agg builds its queries directly
+
+/* query recognition */
+
+struct zsv_sql_agg_token {
+  const char *s;
+  size_t len;
+  char type; // 'i': identifier, 'q': quoted identifier (s excludes the quotes), 'p': punctuation, 0: end, -1: error
+};
+
+static inline int zsv_sql_agg_ident_char(unsigned char c) {
+  return isalnum(c) || c == '_' || c == '$' || c >= 0x80;
+}
+
+static struct zsv_sql_agg_token zsv_sql_agg_next_token(const char **sp) {
+  struct zsv_sql_agg_token t = {0};
+  const char *s = *sp;
+  while (isspace((unsigned char)*s))
+    s++;
+  if (!*s)
+    ;
+  else if (strchr("(),*.;", *s)) {
+    t.type = 'p';
+    t.s = s++;
+    t.len = 1;
+  } else if (*s == '"' || *s == '`' || *s == '[') {
+    char close = *s == '[' ? ']' : *s;
+    const char *end = strchr(s + 1, close);
+    if (!end || end[1] == close) // escaped quotes are not supported
+      t.type = -1;
+    else {
+      t.type = 'q';
+      t.s = s + 1;
+      t.len = (size_t)(end - t.s);
+      s = end + 1;
+    }
+  } else if (zsv_sql_agg_ident_char((unsigned char)*s) && !isdigit((unsigned char)*s)) {
+    t.type = 'i';
+    t.s = s;
+    while (zsv_sql_agg_ident_char((unsigned char)*s))
+      s++;
+    t.len = (size_t)(s - t.s);
+  } else
+    t.type = -1; // anything else (literals, operators, comments...) is not supported
+  *sp = s;
+  return t;
+}
+
+static inline int zsv_sql_agg_is(struct zsv_sql_agg_token t, const char *word) {
+  return t.type == 'i' && t.len == strlen(word) && !zsv_strincmp((const unsigned char *)t.s, t.len,
+                                                                  (const unsigned char *)word, t.len);
+}
+
+static inline int zsv_sql_agg_is_punct(struct zsv_sql_agg_token t, char c) {
+  return t.type == 'p' && *t.s == c;
+}
+
+/*
+ * parse a column reference ([data.]name), starting at token t, into its index in colnames
+ * return 0 on success
+ */
+static int zsv_sql_agg_column(struct zsv_sql_agg_token t, const char **sp, char **colnames, unsigned int col_count,
+                              unsigned int *col) {
+  const char *s = *sp;
+  if ((t.type == 'i' || t.type == 'q') && t.len == 4 && !zsv_strincmp((const unsigned char *)t.s, 4,
+                                                                        (const unsigned char *)"data", 4)) {
+    struct zsv_sql_agg_token dot = zsv_sql_agg_next_token(&s);
+    if (zsv_sql_agg_is_punct(dot, '.')) {
+      t = zsv_sql_agg_next_token(&s);
+      *sp = s;
+    }
+  }
+  if (t.type != 'i' && t.type != 'q')
+    return 1;
+  if (t.type == 'i' && (zsv_sql_agg_is(t, "distinct") || zsv_sql_agg_is(t, "all")))
+    return 1;
+  for (unsigned int i = 0; i < col_count; i++) {
+    if (colnames[i] && strlen(colnames[i]) == t.len &&
+        !zsv_strincmp((const unsigned char *)colnames[i], t.len, (const unsigned char *)t.s, t.len)) {
+      *col = i;
+      return 0;
+    }
+  }
+  return 1;
+}
+
+/*
+ * recognize a query that can be aggregated natively
+ * return 0 if the query was recognized, in which case q must be cleared by the caller
+ */
+static int zsv_sql_agg_parse(const char *sql, char **colnames, unsigned int col_count, struct zsv_sql_agg_query *q) {
+  static const struct {
+    const char *name;
+    enum zsv_sql_agg_fn fn;
+  } fns[] = {{"count", zsv_sql_agg_fn_count}, {"sum", zsv_sql_agg_fn_sum}, {"total", zsv_sql_agg_fn_total},
+             {"avg", zsv_sql_agg_fn_avg},     {"min", zsv_sql_agg_fn_min}, {"max", zsv_sql_agg_fn_max}};
+
+  memset(q, 0, sizeof(*q));
+  const char *s = sql;
+  struct zsv_sql_agg_token t = zsv_sql_agg_next_token(&s);
+  if (!zsv_sql_agg_is(t, "select"))
+    return 1;
+
+  // select list
+  int err = 0;
+  unsigned int aggregate_count = 0;
+  do {
+    struct zsv_sql_agg_col c = {0};
+    t = zsv_sql_agg_next_token(&s);
+    const char *after_name = s;
+    struct zsv_sql_agg_token paren = zsv_sql_agg_next_token(&after_name);
+    if (t.type == 'i' && zsv_sql_agg_is_punct(paren, '(')) {
+      s = after_name;
+      unsigned int f = 0;
+      while (f < sizeof(fns) / sizeof(*fns) && !zsv_sql_agg_is(t, fns[f].name))
+        f++;
+      if (f == sizeof(fns) / sizeof(*fns))
+        err = 1;
+      else {
+        c.fn = fns[f].fn;
+        t = zsv_sql_agg_next_token(&s);
+        if (c.fn == zsv_sql_agg_fn_count && zsv_sql_agg_is(t, "distinct")) {
+          c.fn = zsv_sql_agg_fn_count_distinct;
+          t = zsv_sql_agg_next_token(&s);
+        }
+        if (zsv_sql_agg_is_punct(t, '*')) {
+          if (c.fn == zsv_sql_agg_fn_count)
+            c.fn = zsv_sql_agg_fn_count_star;
+          else
+            err = 1;
+        } else
+          err = zsv_sql_agg_column(t, &s, colnames, col_count, &c.col);
+        if (!err && !zsv_sql_agg_is_punct(zsv_sql_agg_next_token(&s), ')'))
+          err = 1;
+        aggregate_count++;
+      }
+    } else
+      err = zsv_sql_agg_column(t, &s, colnames, col_count, &c.col);
+
+    if (!err) {
+      struct zsv_sql_agg_col *tmp = realloc(q->out, (q->out_count + 1) * sizeof(*q->out));
+      if (!tmp)
+        err = 1;
+      else {
+        q->out = tmp;
+        q->out[q->out_count++] = c;
+      }
+    }
+
+    // optional alias
+    t = zsv_sql_agg_next_token(&s);
+    if (!err && zsv_sql_agg_is(t, "as")) {
+      t = zsv_sql_agg_next_token(&s);
+      if (t.type != 'i' && t.type != 'q')
+        err = 1;
+      t = zsv_sql_agg_next_token(&s);
+    } else if (!err && (t.type == 'q' || (t.type == 'i' && !zsv_sql_agg_is(t, "from"))))
+      t = zsv_sql_agg_next_token(&s);
+  } while (!err && zsv_sql_agg_is_punct(t, ','));
+
+  // from data
+  if (!err && !zsv_sql_agg_is(t, "from"))
+    err = 1;
+  if (!err) {
+    t = zsv_sql_agg_next_token(&s);
+    if ((t.type != 'i' && t.type != 'q') || t.len != 4 ||
+        zsv_strincmp((const unsigned char *)t.s, 4, (const unsigned char *)"data", 4))
+      err = 1;
+    t = zsv_sql_agg_next_token(&s);
+  }
+
+  // group by
+  if (!err && zsv_sql_agg_is(t, "group")) {
+    if (!zsv_sql_agg_is(zsv_sql_agg_next_token(&s), "by"))
+      err = 1;
+    do {
+      unsigned int col;
+      if (!err && !(err = zsv_sql_agg_column(zsv_sql_agg_next_token(&s), &s, colnames, col_count, &col))) {
+        unsigned int *tmp = realloc(q->keys, (q->key_count + 1) * sizeof(*q->keys));
+        if (!tmp)
+          err = 1;
+        else {
+          q->keys = tmp;
+          q->keys[q->key_count++] = col;
+        }
+      }
+      if (!err)
+        t = zsv_sql_agg_next_token(&s);
+    } while (!err && zsv_sql_agg_is_punct(t, ','));
+  }
+  if (!err && zsv_sql_agg_is_punct(t, ';'))
+    t = zsv_sql_agg_next_token(&s);
+  if (!err && t.type != 0)
+    err = 1;
+
+  // every non-aggregate must be a group by column
+  if (!err && !aggregate_count)
+    err = 1;
+  for (unsigned int i = 0; !err && i < q->out_count; i++) {
+    if (q->out[i].fn == zsv_sql_agg_fn_key) {
+      unsigned int k = 0;
+      while (k < q->key_count && q->keys[k] != q->out[i].col)
+        k++;
+      if (k == q->key_count)
+        err = 1;
+      q->out[i].key_ix = k;
+    }
+  }
+
+  if (err)
+    zsv_sql_agg_query_clear(q);
+  return err;
+}
+#endif
+
+/* aggregate state */
+
+struct zsv_sql_agg_state {
+  int64_t cnt;
+  int64_t isum;
+  double rsum, rerr;
+  unsigned char approx : 1;
+  unsigned char ovrfl : 1;
+  unsigned char has_real : 1; // a non-integer was summed
+  unsigned char _ : 5;
+  unsigned char *text; // min / max
+  size_t text_len;
+  zsv_hash_set distinct; // count(distinct)
+};
+
+/*
+ * numeric value of a text value, per sqlite's numeric affinity (see sqlite3AtoF()):
+ * return SQLITE_INTEGER or SQLITE_FLOAT if the value, less any surrounding whitespace,
+ * is a number; otherwise return SQLITE_TEXT and set *d to the value of its longest
+ * numeric prefix (or 0), as sqlite3_value_double() does
+ */
+static int zsv_sql_agg_numeric(const unsigned char *s, size_t len, int64_t *i, double *d) {
+  size_t start = 0;
+  while (start < len && isspace(s[start]))
+    start++;
+  while (len > start && isspace(s[len - 1]))
+    len--;
+  *d = 0;
+  size_t n = zsv_parse_number(s + start, len - start, 0, d);
+  if (!n)
+    return SQLITE_TEXT;
+  if (start + n < len)
+    return SQLITE_TEXT; // *d is the value of the numeric prefix
+
+  size_t q = start + (s[start] == '+' || s[start] == '-');
+  if (!memchr(s + q, '.', len - q) && !memchr(s + q, 'e', len - q) && !memchr(s + q, 'E', len - q)) {
+    uint64_t u = 0, max = (uint64_t)INT64_MAX + (s[start] == '-');
+    for (; q < len && u <= max; q++)
+      u = (u > (UINT64_MAX - 9) / 10) ? UINT64_MAX : u * 10 + (uint64_t)(s[q] - '0');
+    if (u <= max) {
+      *i = s[start] == '-' ? (int64_t)(0 - u) : (int64_t)u;
+      return SQLITE_INTEGER;
+    }
+  }
+  return SQLITE_FLOAT;
+}
+
+// Kahan-Babuska-Neumaier summation, as in sqlite's sum()
+static void zsv_sql_agg_kbn_step(struct zsv_sql_agg_state *st, double r) {
+  volatile double s = st->rsum;
+  volatile double t = s + r;
+  if (fabs(s) > fabs(r))
+    st->rerr += (s - t) + r;
+  else
+    st->rerr += (r - t) + s;
+  st->rsum = t;
+}
+
+#define ZSV_SQL_AGG_KBN_INT_LIMIT 4503599627370496LL // 2^52
+
+static void zsv_sql_agg_kbn_step_int64(struct zsv_sql_agg_state *st, int64_t i) {
+  if (i <= -ZSV_SQL_AGG_KBN_INT_LIMIT || i >= ZSV_SQL_AGG_KBN_INT_LIMIT) {
+    int64_t small = i % 16384;
+    zsv_sql_agg_kbn_step(st, (double)(i - small));
+    zsv_sql_agg_kbn_step(st, (double)small);
+  } else
+    zsv_sql_agg_kbn_step(st, (double)i);
+}
+
+static void zsv_sql_agg_kbn_init(struct zsv_sql_agg_state *st, int64_t i) {
+  if (i <= -ZSV_SQL_AGG_KBN_INT_LIMIT || i >= ZSV_SQL_AGG_KBN_INT_LIMIT) {
+    int64_t small = i % 16384;
+    st->rsum = (double)(i - small);
+    st->rerr = (double)small;
+  } else {
+    st->rsum = (double)i;
+    st->rerr = 0;
+  }
+}
+
+static inline int zsv_sql_agg_add_int64(int64_t *sum, int64_t i) {
+  if ((i > 0 && *sum > INT64_MAX - i) || (i < 0 && *sum < INT64_MIN - i))
+    return 1;
+  *sum += i;
+  return 0;
+}
+
+static void zsv_sql_agg_sum_step(struct zsv_sql_agg_state *st, const unsigned char *s, size_t len) {
+  int64_t i;
+  double d;
+  st->cnt++;
+  if (zsv_sql_agg_numeric(s, len, &i, &d) == SQLITE_INTEGER) {
+    if (st->approx)
+      zsv_sql_agg_kbn_step_int64(st, i);
+    else if (zsv_sql_agg_add_int64(&st->isum, i)) {
+      st->ovrfl = 1;
+      st->approx = 1;
+      zsv_sql_agg_kbn_init(st, st->isum);
+      zsv_sql_agg_kbn_step_int64(st, i);
+    }
+  } else {
+    if (!st->approx) {
+      zsv_sql_agg_kbn_init(st, st->isum);
+      st->approx = 1;
+    }
+    st->ovrfl = 0;
+    st->has_real = 1;
+    zsv_sql_agg_kbn_step(st, d);
+  }
+}
+
+// merge the state of a later chunk (b) into that of an earlier one (a)
+static void zsv_sql_agg_sum_merge(struct zsv_sql_agg_state *a, const struct zsv_sql_agg_state *b) {
+  a->cnt += b->cnt;
+  if (!a->approx && !b->approx) {
+    int64_t i = a->isum;
+    if (zsv_sql_agg_add_int64(&a->isum, b->isum)) {
+      a->ovrfl = 1;
+      a->approx = 1;
+      zsv_sql_agg_kbn_init(a, i);
+      zsv_sql_agg_kbn_step_int64(a, b->isum);
+    }
+    return;
+  }
+  if (!a->approx) {
+    zsv_sql_agg_kbn_init(a, a->isum);
+    a->approx = 1;
+  }
+  if (!b->approx)
+    zsv_sql_agg_kbn_step_int64(a, b->isum);
+  else {
+    zsv_sql_agg_kbn_step(a, b->rsum);
+    if (isfinite(b->rerr))
+      zsv_sql_agg_kbn_step(a, b->rerr);
+    else
+      a->rerr = b->rerr; // the sum overflowed, and its error term is no longer used
+    a->ovrfl = b->ovrfl || (a->ovrfl && !b->has_real);
+  }
+  a->has_real |= b->has_real;
+}
+
+static inline int zsv_sql_agg_text_cmp(const unsigned char *a, size_t a_len, const unsigned char *b, size_t b_len) {
+  int c = memcmp(a, b, a_len < b_len ? a_len : b_len);
+  return c ? c : a_len < b_len ? -1 : a_len > b_len ? 1 : 0;
+}
+
+/*
+ * min / max: keep s if it is the first value or sorts before (min) or after (max) the current one
+ * *bytes is adjusted by the change in memory used
+ */
+static int zsv_sql_agg_minmax_step(struct zsv_sql_agg_state *st, enum zsv_sql_agg_fn fn, const unsigned char *s,
+                                   size_t len, size_t *bytes) {
+  if (st->cnt) {
+    int c = zsv_sql_agg_text_cmp(s, len, st->text, st->text_len);
+    if (fn == zsv_sql_agg_fn_min ? c >= 0 : c <= 0)
+      return 0;
+  }
+  unsigned char *tmp = realloc(st->text, len + 1);
+  if (!tmp)
+    return 1;
+  memcpy(tmp, s, len);
+  *bytes += len;
+  if (st->text)
+    *bytes -= st->text_len;
+  else
+    *bytes += 1;
+  st->text = tmp;
+  st->text_len = len;
+  st->cnt = 1;
+  return 0;
+}
+
+/* count(distinct): a set of the distinct non-NULL values */
+
+// add s, if new, to the distinct values of st; *bytes is increased by the memory allocated
+static int zsv_sql_agg_set_add(struct zsv_sql_agg_state *st, uint64_t hash, const unsigned char *s, size_t len,
+                               size_t *bytes) {
+  if (!st->distinct && !(st->distinct = zsv_hash_set_new(0)))
+    return 1;
+  size_t before = zsv_hash_set_bytes(st->distinct);
+  if (zsv_hash_set_add(st->distinct, hash, s, len, NULL) == ZSV_HASH_SET_NONE)
+    return 1;
+  *bytes += zsv_hash_set_bytes(st->distinct) - before;
+  return 0;
+}
+
+/* groups */
+
+struct zsv_sql_agg_group {
+  unsigned char *key; // per group by column: [u8 not null][u32 length][value]
+  size_t key_len;
+  struct zsv_sql_agg_state states[]; // one per output column
+};
+
+// the groups of a chunk, keyed by their keys, with a pointer to each group (allocated in
+// the set's arena) as the value of its key
+struct zsv_sql_agg_table {
+  zsv_hash_set groups;
+  size_t bytes; // approximate memory used by the table and its groups
+};
+
+// a group read from a run, with its own copy of its key
+static struct zsv_sql_agg_group *zsv_sql_agg_group_new(unsigned int state_count, const unsigned char *key,
+                                                       size_t key_len) {
+  struct zsv_sql_agg_group *g = calloc(1, sizeof(*g) + state_count * sizeof(*g->states) + key_len);
+  if (g) {
+    g->key = (unsigned char *)&g->states[state_count];
+    if (key_len)
+      memcpy(g->key, key, key_len);
+    g->key_len = key_len;
+  }
+  return g;
+}
+
+static void zsv_sql_agg_group_states_free(struct zsv_sql_agg_group *g, unsigned int state_count) {
+  for (unsigned int j = 0; j < state_count; j++) {
+    free(g->states[j].text);
+    zsv_hash_set_delete(g->states[j].distinct);
+  }
+}
+
+static void zsv_sql_agg_group_delete(struct zsv_sql_agg_group *g, unsigned int state_count) {
+  if (g) {
+    zsv_sql_agg_group_states_free(g, state_count);
+    free(g);
+  }
+}
+
+static size_t zsv_sql_agg_table_count(const struct zsv_sql_agg_table *t) {
+  return t->groups ? zsv_hash_set_count(t->groups) : 0;
+}
+
+static struct zsv_sql_agg_group *zsv_sql_agg_table_group(const struct zsv_sql_agg_table *t, size_t ix) {
+  return *(struct zsv_sql_agg_group **)zsv_hash_set_value(t->groups, ix);
+}
+
+static void zsv_sql_agg_table_clear(struct zsv_sql_agg_table *t, unsigned int state_count) {
+  for (size_t i = 0, n = zsv_sql_agg_table_count(t); i < n; i++) {
+    struct zsv_sql_agg_group *g = zsv_sql_agg_table_group(t, i);
+    if (g) // NULL if out of memory when it was added
+      zsv_sql_agg_group_states_free(g, state_count);
+  }
+  zsv_hash_set_delete(t->groups);
+  memset(t, 0, sizeof(*t));
+}
+
+// return the group with the given key, adding it if new
+static struct zsv_sql_agg_group *zsv_sql_agg_table_get(struct zsv_sql_agg_table *t, unsigned int state_count,
+                                                       uint64_t hash, const unsigned char *key, size_t key_len) {
+  if (!t->groups && !(t->groups = zsv_hash_set_new(sizeof(struct zsv_sql_agg_group *))))
+    return NULL;
+  size_t before = zsv_hash_set_bytes(t->groups);
+  char added = 0;
+  size_t ix = zsv_hash_set_add(t->groups, hash, key, key_len, &added);
+  if (ix == ZSV_HASH_SET_NONE)
+    return NULL;
+  struct zsv_sql_agg_group **gp = zsv_hash_set_value(t->groups, ix);
+  if (added) {
+    size_t size = sizeof(**gp) + state_count * sizeof((*gp)->states[0]);
+    if (!(*gp = zsv_hash_set_alloc(t->groups, size)))
+      return NULL;
+    memset(*gp, 0, size);
+    (*gp)->key = (unsigned char *)zsv_hash_set_key(t->groups, ix, &(*gp)->key_len);
+    t->bytes += zsv_hash_set_bytes(t->groups) - before;
+  }
+  return *gp;
+}
+
+static int zsv_sql_agg_group_cmp(const void *x, const void *y) {
+  const struct zsv_sql_agg_group *a = *(struct zsv_sql_agg_group *const *)x;
+  const struct zsv_sql_agg_group *b = *(struct zsv_sql_agg_group *const *)y;
+  const unsigned char *ak = a->key, *bk = b->key, *a_end = a->key + a->key_len;
+  while (ak < a_end) {
+    uint32_t a_len = zsv_buff_u32(ak + 1), b_len = zsv_buff_u32(bk + 1);
+    if (*ak != *bk) // NULL sorts first
+      return *ak < *bk ? -1 : 1;
+    int c = zsv_sql_agg_text_cmp(ak + 5, a_len, bk + 5, b_len);
+    if (c)
+      return c;
+    ak += 5 + a_len;
+    bk += 5 + b_len;
+  }
+  return 0;
+}
+
+// merge the states of group b, from a later chunk or run, into those of group a; *bytes as for zsv_sql_agg_set_add()
+static int zsv_sql_agg_group_merge(const struct zsv_sql_agg_query *q, struct zsv_sql_agg_group *a,
+                                   const struct zsv_sql_agg_group *b, size_t *bytes) {
+  for (unsigned int j = 0; j < q->out_count; j++) {
+    struct zsv_sql_agg_state *x = &a->states[j];
+    const struct zsv_sql_agg_state *y = &b->states[j];
+    switch (q->out[j].fn) {
+    case zsv_sql_agg_fn_key:
+      break;
+    case zsv_sql_agg_fn_count_star:
+    case zsv_sql_agg_fn_count:
+      x->cnt += y->cnt;
+      break;
+    case zsv_sql_agg_fn_sum:
+    case zsv_sql_agg_fn_total:
+    case zsv_sql_agg_fn_avg:
+      zsv_sql_agg_sum_merge(x, y);
+      break;
+    case zsv_sql_agg_fn_count_distinct:
+      for (size_t i = 0, n = y->distinct ? zsv_hash_set_count(y->distinct) : 0; i < n; i++) {
+        size_t len;
+        const unsigned char *v = zsv_hash_set_key(y->distinct, i, &len);
+        if (zsv_sql_agg_set_add(x, zsv_hash_set_hash(y->distinct, i), v, len, bytes))
+          return 1;
+      }
+      break;
+    default:
+      if (y->cnt && zsv_sql_agg_minmax_step(x, q->out[j].fn, y->text, y->text_len, bytes))
+        return 1;
+      break;
+    }
+  }
+  return 0;
+}
+
+/*
+ * runs: groups spilled to a temp file in key order, each as a record of
+ *   [u32 record length][u32 key length][key][state]...
+ * where each state is
+ *   [i64 cnt][i64 isum][f64 rsum][f64 rerr][u8 flags][u32 text length][text]
+ *   [u64 distinct count]([u32 length][value])...
+ */
+
+static int zsv_sql_agg_group_write(const struct zsv_sql_agg_query *q, const struct zsv_sql_agg_group *g,
+                                   struct zsv_buff *rec, FILE *f) {
+  uint32_t len32 = 0;
+  rec->len = 0;
+  int err = zsv_buff_append(rec, &len32, sizeof(len32)) || zsv_buff_append_cell(rec, g->key, g->key_len);
+  for (unsigned int j = 0; !err && j < q->out_count; j++) {
+    const struct zsv_sql_agg_state *st = &g->states[j];
+    unsigned char flags = (unsigned char)(st->approx | (st->ovrfl << 1) | (st->has_real << 2));
+    uint64_t distinct_count = st->distinct ? zsv_hash_set_count(st->distinct) : 0;
+    err = zsv_buff_append(rec, &st->cnt, sizeof(st->cnt)) ||
+          zsv_buff_append(rec, &st->isum, sizeof(st->isum)) ||
+          zsv_buff_append(rec, &st->rsum, sizeof(st->rsum)) ||
+          zsv_buff_append(rec, &st->rerr, sizeof(st->rerr)) || zsv_buff_append(rec, &flags, 1) ||
+          zsv_buff_append_cell(rec, st->text, st->text_len) ||
+          zsv_buff_append(rec, &distinct_count, sizeof(distinct_count));
+    for (size_t i = 0; !err && i < distinct_count; i++) {
+      size_t len;
+      const unsigned char *v = zsv_hash_set_key(st->distinct, i, &len);
+      err = zsv_buff_append_cell(rec, v, len);
+    }
+  }
+  if (err)
+    return 1;
+  len32 = (uint32_t)(rec->len - sizeof(len32));
+  memcpy(rec->s, &len32, sizeof(len32));
+  return fwrite(rec->s, 1, rec->len, f) != rec->len;
+}
+
+// read the next group of a run into *gp; return 1 on success, 0 at the end of the run or -1 on error
+static int zsv_sql_agg_group_read(const struct zsv_sql_agg_query *q, FILE *f, struct zsv_buff *rec,
+                                  struct zsv_sql_agg_group **gp) {
+  uint32_t len32;
+  *gp = NULL;
+  if (fread(&len32, 1, sizeof(len32), f) != sizeof(len32))
+    return feof(f) ? 0 : -1;
+  rec->len = 0;
+  if (zsv_buff_extend(rec, len32) || fread(rec->s, 1, len32, f) != len32)
+    return -1;
+
+  const unsigned char *p = rec->s;
+  uint32_t key_len = zsv_buff_u32(p);
+  struct zsv_sql_agg_group *g = zsv_sql_agg_group_new(q->out_count, p + sizeof(key_len), key_len);
+  if (!g)
+    return -1;
+  p += sizeof(key_len) + key_len;
+  size_t bytes = 0; // not tracked during the merge
+  int err = 0;
+  for (unsigned int j = 0; !err && j < q->out_count; j++) {
+    struct zsv_sql_agg_state *st = &g->states[j];
+    memcpy(&st->cnt, p, sizeof(st->cnt));
+    p += sizeof(st->cnt);
+    memcpy(&st->isum, p, sizeof(st->isum));
+    p += sizeof(st->isum);
+    memcpy(&st->rsum, p, sizeof(st->rsum));
+    p += sizeof(st->rsum);
+    memcpy(&st->rerr, p, sizeof(st->rerr));
+    p += sizeof(st->rerr);
+    st->approx = *p & 1;
+    st->ovrfl = (*p >> 1) & 1;
+    st->has_real = (*p >> 2) & 1;
+    p++;
+
+    uint32_t text_len = zsv_buff_u32(p);
+    p += sizeof(text_len);
+    if (st->cnt && (q->out[j].fn == zsv_sql_agg_fn_min || q->out[j].fn == zsv_sql_agg_fn_max)) {
+      if (!(st->text = malloc(text_len + 1)))
+        err = 1;
+      else {
+        memcpy(st->text, p, text_len);
+        st->text_len = text_len;
+      }
+    }
+    p += text_len;
+
+    uint64_t distinct_count;
+    memcpy(&distinct_count, p, sizeof(distinct_count));
+    p += sizeof(distinct_count);
+    for (uint64_t i = 0; !err && i < distinct_count; i++) {
+      uint32_t len = zsv_buff_u32(p);
+      p += sizeof(len);
+      err = zsv_sql_agg_set_add(st, zsv_hash(p, len), p, len, &bytes);
+      p += len;
+    }
+  }
+  if (err) {
+    zsv_sql_agg_group_delete(g, q->out_count);
+    return -1;
+  }
+  *gp = g;
+  return 1;
+}
+
+/* execution */
+
+struct zsv_sql_agg;
+
+struct zsv_sql_agg_chunk {
+  struct zsv_chunk chunk;
+  int status;
+
+  struct zsv_sql_agg *agg; // shared, read-only while workers run
+  struct zsv_sql_agg_table table;
+  struct zsv_buff key;
+
+  zsv_parser parser;
+  size_t limit_len; // where this chunk's parser should stop
+  char cancelled;
+
+  FILE **runs; // groups spilled when the table outgrew its share of the memory budget
+  char **run_fns;
+  unsigned int run_count;
+  struct zsv_buff rec; // run record being written
+};
+
+/* options for zsv_sql_agg_run() */
+struct zsv_sql_agg_run_opts {
+  size_t max_memory; // bytes; 0 for the default
+  // if set, called with the header row before any other row; return non-zero to stop
+  int (*header)(void *ctx, zsv_parser parser);
+  void *header_ctx;
+};
+
+struct zsv_sql_agg {
+  struct zsv_sql_agg_query *q;
+  const char *input_path;
+  struct zsv_opts *opts; // template for worker parsers
+  unsigned int num_chunks;
+  struct zsv_sql_agg_chunk *chunks; // chunks[0] is processed by the main thread
+  struct zsv_chunk_runner runner;
+  char parallel; // workers were started
+  const struct zsv_sql_agg_run_opts *run_opts;
+  size_t chunk_max_memory; // memory budget of each chunk's table
+  char header_done;
+  int err;
+};
+
+// sort the groups of c's table and write them to a new run of c, then clear the table
+static int zsv_sql_agg_spill(struct zsv_sql_agg_chunk *c) {
+  const struct zsv_sql_agg_query *q = c->agg->q;
+  struct zsv_sql_agg_table *t = &c->table;
+  size_t count = zsv_sql_agg_table_count(t);
+  struct zsv_sql_agg_group **groups = malloc((count ? count : 1) * sizeof(*groups));
+  FILE **runs = realloc(c->runs, (c->run_count + 1) * sizeof(*runs));
+  if (runs)
+    c->runs = runs;
+  char **run_fns = realloc(c->run_fns, (c->run_count + 1) * sizeof(*run_fns));
+  if (run_fns)
+    c->run_fns = run_fns;
+  int err = !groups || !runs || !run_fns;
+  FILE *f = NULL;
+  if (!err) {
+    c->run_fns[c->run_count] = NULL;
+    f = c->runs[c->run_count] = zsv_buff_temp_file("zsvagg", &c->run_fns[c->run_count]);
+    c->run_count++;
+    err = !f;
+  }
+  if (!err) {
+    size_t n = count;
+    for (size_t i = 0; i < n; i++)
+      groups[i] = zsv_sql_agg_table_group(t, i);
+    qsort(groups, n, sizeof(*groups), zsv_sql_agg_group_cmp);
+    for (size_t i = 0; !err && i < n; i++)
+      err = zsv_sql_agg_group_write(q, groups[i], &c->rec, f);
+    if (!err && fflush(f))
+      err = 1;
+    if (c->agg->opts->verbose)
+      fprintf(stderr, "Chunk %u: spilled %zu groups to %s\n", c->chunk.id + 1, n, c->run_fns[c->run_count - 1]);
+  }
+  free(groups);
+  zsv_sql_agg_table_clear(t, q->out_count);
+  return err;
+}
+
+static void zsv_sql_agg_row(struct zsv_sql_agg_chunk *c) {
+  const struct zsv_sql_agg_query *q = c->agg->q;
+  zsv_parser parser = c->parser;
+  if (c->status)
+    return;
+
+  c->key.len = 0;
+  for (unsigned int i = 0; i < q->key_count; i++) {
+    struct zsv_cell cell = zsv_get_cell(parser, q->keys[i]);
+    unsigned char not_null = cell.str != NULL;
+    if (zsv_buff_append(&c->key, &not_null, 1) || zsv_buff_append_cell(&c->key, cell.str, cell.len)) {
+      c->status = 1;
+      return;
+    }
+  }
+  struct zsv_sql_agg_group *g = zsv_sql_agg_table_get(&c->table, q->out_count, zsv_hash(c->key.s, c->key.len),
+                                                      c->key.s, c->key.len);
+  if (!g) {
+    c->status = 1;
+    return;
+  }
+
+  for (unsigned int i = 0; i < q->out_count; i++) {
+    struct zsv_sql_agg_state *st = &g->states[i];
+    enum zsv_sql_agg_fn fn = q->out[i].fn;
+    if (fn == zsv_sql_agg_fn_key)
+      continue;
+    if (fn == zsv_sql_agg_fn_count_star) {
+      st->cnt++;
+      continue;
+    }
+    struct zsv_cell cell = zsv_get_cell(parser, q->out[i].col);
+    if (!cell.str) // NULL
+      continue;
+    switch (fn) {
+    case zsv_sql_agg_fn_count:
+      st->cnt++;
+      break;
+    case zsv_sql_agg_fn_sum:
+    case zsv_sql_agg_fn_total:
+    case zsv_sql_agg_fn_avg:
+      zsv_sql_agg_sum_step(st, cell.str, cell.len);
+      break;
+    case zsv_sql_agg_fn_count_distinct:
+      if (zsv_sql_agg_set_add(st, zsv_hash(cell.str, cell.len), cell.str, cell.len, &c->table.bytes))
+        c->status = 1;
+      break;
+    default: // min, max
+      if (zsv_sql_agg_minmax_step(st, fn, cell.str, cell.len, &c->table.bytes))
+        c->status = 1;
+      break;
+    }
+  }
+  if (!c->status && c->table.bytes > c->agg->chunk_max_memory)
+    c->status = zsv_sql_agg_spill(c);
+}
+
+static void zsv_sql_agg_row_done(void *ctx) {
+  struct zsv_sql_agg_chunk *c = ctx;
+  // absolute offset of the start of the next row
+  c->chunk.actual_next_row_start =
+    c->chunk.start_offset + zsv_cum_scanned_length(c->parser) - zsv_row_length_raw_bytes(c->parser);
+  zsv_abort(c->parser);
+  c->cancelled = 1;
+}
+
+static void zsv_sql_agg_row_handler(void *ctx) {
+  struct zsv_sql_agg_chunk *c = ctx;
+  zsv_sql_agg_row(c);
+  if (UNLIKELY(c->limit_len && zsv_cum_scanned_length(c->parser) >= c->limit_len))
+    zsv_set_row_handler(c->parser, zsv_sql_agg_row_done);
+}
+
+static void *zsv_sql_agg_process_chunk(void *arg) {
+  struct zsv_sql_agg_chunk *c = arg;
+  // in case we are re-running due to incorrect chunk start
+  zsv_sql_agg_table_clear(&c->table, c->agg->q->out_count);
+  zsv_buff_temp_files_delete(c->runs, c->run_fns, c->run_count);
+  c->runs = NULL;
+  c->run_fns = NULL;
+  c->run_count = 0;
+  c->status = 0;
+  c->cancelled = 0;
+  if (c->chunk.start_offset >= c->chunk.end_offset) {
+    c->chunk.actual_next_row_start = c->chunk.start_offset;
+    return NULL;
+  }
+  c->limit_len = c->chunk.end_offset - c->chunk.start_offset;
+
+  FILE *f = fopen(c->agg->input_path, "rb");
+  if (!f || fseeko(f, (off_t)c->chunk.start_offset, SEEK_SET) != 0)
+    c->status = 1;
+  else {
+    struct zsv_opts opts;
+    zsv_chunk_opts(&opts, c->agg->opts, NULL, NULL, f);
+    opts.row_handler = zsv_sql_agg_row_handler;
+    opts.ctx = c;
+    if (!(c->parser = zsv_new(&opts)))
+      c->status = 1;
+    else {
+      enum zsv_status status = zsv_status_ok;
+      while (status == zsv_status_ok && !c->cancelled)
+        status = zsv_parse_more(c->parser);
+      if (!c->cancelled) { // reached eof
+        zsv_finish(c->parser);
+        c->chunk.actual_next_row_start = c->chunk.start_offset + zsv_cum_scanned_length(c->parser);
+      }
+      zsv_delete(c->parser);
+      c->parser = NULL;
+    }
+  }
+  if (f)
+    fclose(f);
+  return NULL;
+}
+
+// process the header row, then split the rest of the input into chunks and start a worker for each after the first
+static void zsv_sql_agg_header(void *ctx) {
+  struct zsv_sql_agg_chunk *c0 = ctx;
+  struct zsv_sql_agg *agg = c0->agg;
+  zsv_set_row_handler(c0->parser, zsv_sql_agg_row_handler);
+  agg->header_done = 1;
+  if (agg->run_opts && agg->run_opts->header && agg->run_opts->header(agg->run_opts->header_ctx, c0->parser)) {
+    agg->err = 1;
+    zsv_abort(c0->parser);
+    c0->cancelled = 1;
+    return;
+  }
+  for (unsigned int i = 1; i < agg->num_chunks; i++)
+    agg->chunks[i].agg = agg;
+  agg->runner.chunks = agg->chunks;
+  agg->runner.chunk_size = sizeof(*agg->chunks);
+  agg->runner.chunk_count = agg->num_chunks;
+  agg->runner.process = zsv_sql_agg_process_chunk;
+  if (zsv_chunks_start(&agg->runner, agg->input_path, ZSV_SQL_AGG_PARALLEL_MIN_BYTES,
+                       zsv_cum_scanned_length(c0->parser), agg->opts) == 0) {
+    agg->parallel = 1;
+    c0->limit_len = c0->chunk.end_offset;
+  }
+}
+
+static void zsv_sql_agg_write_double(zsv_csv_writer cw, char first, double r) {
+  char buff[64];
+  sqlite3_snprintf(sizeof(buff), buff, "%!.15g", r);
+  zsv_writer_cell(cw, first, (const unsigned char *)buff, strlen(buff), 0);
+}
+
+// write one output row for group g; return non-zero on error
+static int zsv_sql_agg_write_group(const struct zsv_sql_agg_query *q, const struct zsv_sql_agg_group *g,
+                                   zsv_csv_writer cw) {
+  char buff[32];
+  for (unsigned int i = 0; i < q->out_count; i++) {
+    const struct zsv_sql_agg_state *st = &g->states[i];
+    const unsigned char *s = NULL;
+    size_t len = 0;
+    double r = st->approx ? (isfinite(st->rerr) ? st->rsum + st->rerr : st->rsum) : (double)st->isum;
+    switch (q->out[i].fn) {
+    case zsv_sql_agg_fn_key: {
+      const unsigned char *k = g->key;
+      for (unsigned int j = 0; j < q->out[i].key_ix; j++)
+        k += 5 + zsv_buff_u32(k + 1);
+      len = zsv_buff_u32(k + 1);
+      s = k + 5;
+    } break;
+    case zsv_sql_agg_fn_count_star:
+    case zsv_sql_agg_fn_count:
+      snprintf(buff, sizeof(buff), "%lld", (long long)st->cnt);
+      s = (const unsigned char *)buff;
+      len = strlen(buff);
+      break;
+    case zsv_sql_agg_fn_count_distinct:
+      snprintf(buff, sizeof(buff), "%zu", st->distinct ? zsv_hash_set_count(st->distinct) : 0);
+      s = (const unsigned char *)buff;
+      len = strlen(buff);
+      break;
+    case zsv_sql_agg_fn_sum:
+      if (!st->cnt)
+        break;
+      if (st->approx && st->ovrfl) {
+        fprintf(stderr, "Error: integer overflow\n");
+        return 1;
+      }
+      if (st->approx) {
+        zsv_sql_agg_write_double(cw, i == 0, r);
+        continue;
+      }
+      snprintf(buff, sizeof(buff), "%lld", (long long)st->isum);
+      s = (const unsigned char *)buff;
+      len = strlen(buff);
+      break;
+    case zsv_sql_agg_fn_total:
+      zsv_sql_agg_write_double(cw, i == 0, r);
+      continue;
+    case zsv_sql_agg_fn_avg:
+      if (st->cnt) {
+        zsv_sql_agg_write_double(cw, i == 0, r / (double)st->cnt);
+        continue;
+      }
+      break;
+    case zsv_sql_agg_fn_min:
+    case zsv_sql_agg_fn_max:
+      s = st->text;
+      len = st->text_len;
+      break;
+    }
+    zsv_writer_cell(cw, i == 0, s, len, 1);
+  }
+  return 0;
+}
+
+// merge the runs of all chunks, in chunk order, combining groups with equal keys, and write the result
+static int zsv_sql_agg_merge_runs(struct zsv_sql_agg *agg, zsv_csv_writer cw) {
+  const struct zsv_sql_agg_query *q = agg->q;
+  unsigned int run_count = 0;
+  for (unsigned int i = 0; i < agg->num_chunks; i++)
+    run_count += agg->chunks[i].run_count;
+  FILE **runs = calloc(run_count ? run_count : 1, sizeof(*runs));
+  struct zsv_sql_agg_group **heads = calloc(run_count ? run_count : 1, sizeof(*heads));
+  struct zsv_buff rec = {0};
+  size_t bytes = 0; // not limited: each merged group is written as soon as it is complete
+  int err = !runs || !heads;
+  for (unsigned int i = 0, n = 0; !err && i < agg->num_chunks; i++)
+    for (unsigned int r = 0; r < agg->chunks[i].run_count; r++)
+      runs[n++] = agg->chunks[i].runs[r];
+  for (unsigned int r = 0; !err && r < run_count; r++)
+    err = fseeko(runs[r], 0, SEEK_SET) || zsv_sql_agg_group_read(q, runs[r], &rec, &heads[r]) < 0;
+
+  while (!err) {
+    unsigned int m = run_count;
+    for (unsigned int r = 0; r < run_count; r++)
+      if (heads[r] && (m == run_count || zsv_sql_agg_group_cmp(&heads[r], &heads[m]) < 0))
+        m = r;
+    if (m == run_count)
+      break;
+    struct zsv_sql_agg_group *g = heads[m];
+    err = zsv_sql_agg_group_read(q, runs[m], &rec, &heads[m]) < 0;
+    for (unsigned int r = m + 1; !err && r < run_count; r++) {
+      if (heads[r] && !zsv_sql_agg_group_cmp(&g, &heads[r])) {
+        err = zsv_sql_agg_group_merge(q, g, heads[r], &bytes);
+        zsv_sql_agg_group_delete(heads[r], q->out_count);
+        if (zsv_sql_agg_group_read(q, runs[r], &rec, &heads[r]) < 0)
+          err = 1;
+      }
+    }
+    if (!err)
+      err = zsv_sql_agg_write_group(q, g, cw);
+    zsv_sql_agg_group_delete(g, q->out_count);
+  }
+
+  for (unsigned int r = 0; heads && r < run_count; r++)
+    zsv_sql_agg_group_delete(heads[r], q->out_count);
+  free(heads);
+  free(runs);
+  free(rec.s);
+  return err;
+}
+
+/*
+ * run query q on input_path (or stdin, if NULL), writing the results (not the header) to cw
+ * if num_chunks > 1, the caller should first check that the input is chunkable (see zsv_chunkable())
+ * run_opts may be NULL
+ * return 0 on success
+ */
+static int zsv_sql_agg_run(struct zsv_sql_agg_query *q, const char *input_path, unsigned int num_chunks,
+                           const struct zsv_sql_agg_run_opts *run_opts, struct zsv_opts *opts,
+                           struct zsv_prop_handler *custom_prop_handler, zsv_csv_writer cw) {
+  struct zsv_opts popts = *opts;
+  if (!popts.max_columns)
+    popts.max_columns = ZSV_SQL_AGG_MAX_COLUMNS;
+  // each chunk gets a thread and an equal share of the memory budget, so use no more chunks
+  // than the input has room for
+  struct stat st;
+  if (input_path && !stat(input_path, &st) && num_chunks > (uint64_t)st.st_size / ZSV_SQL_AGG_MIN_CHUNK_BYTES)
+    num_chunks = (unsigned int)((uint64_t)st.st_size / ZSV_SQL_AGG_MIN_CHUNK_BYTES);
+  if (!num_chunks)
+    num_chunks = 1;
+
+  struct zsv_sql_agg agg = {0};
+  agg.q = q;
+  agg.input_path = input_path;
+  agg.opts = &popts;
+  agg.num_chunks = num_chunks;
+  agg.run_opts = run_opts;
+  agg.chunk_max_memory = (run_opts && run_opts->max_memory ? run_opts->max_memory
+                                                            : (size_t)ZSV_SQL_AGG_DEFAULT_MAX_MEMORY_MB * 1024 * 1024) /
+                         num_chunks;
+  agg.chunks = calloc(num_chunks, sizeof(*agg.chunks));
+  FILE *f = NULL;
+  struct zsv_sql_agg_chunk *c0 = agg.chunks;
+  if (!agg.chunks)
+    agg.err = 1;
+  else if (!(f = input_path ? fopen(input_path, "rb") : stdin)) {
+    fprintf(stderr, "Unable to open for reading: %s\n", input_path);
+    agg.err = 1;
+  } else {
+    c0->agg = &agg;
+    popts.stream = f;
+    popts.row_handler = zsv_sql_agg_header;
+    popts.ctx = c0;
+    if (zsv_new_with_properties(&popts, custom_prop_handler, input_path, &c0->parser) != zsv_status_ok)
+      agg.err = 1;
+    else {
+      // chunk 0: main thread, from the start of the input (incl. the header row)
+      while (!c0->cancelled && zsv_parse_more(c0->parser) == zsv_status_ok)
+        ;
+      if (!c0->cancelled) {
+        zsv_finish(c0->parser);
+        c0->chunk.actual_next_row_start = zsv_cum_scanned_length(c0->parser);
+      }
+      zsv_delete(c0->parser);
+      c0->parser = NULL;
+      if (c0->status)
+        agg.err = 1;
+    }
+    if (f != stdin)
+      fclose(f);
+  }
+
+  // wait for workers, reprocess any chunk whose guessed start was wrong, and merge in chunk order
+  size_t prev_end = agg.chunks ? c0->chunk.actual_next_row_start : 0;
+  char spilled = agg.chunks && c0->run_count;
+  for (unsigned int i = 1; agg.parallel && i < num_chunks; i++) {
+    struct zsv_sql_agg_chunk *c = zsv_chunks_next(&agg.runner, i, &prev_end);
+    if (c->status)
+      agg.err = 1;
+    if (c->run_count)
+      spilled = 1;
+
+    if (agg.err)
+      ;
+    else if (spilled) { // once anything has spilled, so does every later table, so that runs stay in chunk order
+      if (zsv_sql_agg_table_count(&c->table))
+        agg.err = zsv_sql_agg_spill(c);
+    } else {
+      for (size_t s = 0, n = zsv_sql_agg_table_count(&c->table); !agg.err && s < n; s++) {
+        struct zsv_sql_agg_group *g = zsv_sql_agg_table_group(&c->table, s);
+        struct zsv_sql_agg_group *g0 = zsv_sql_agg_table_get(
+          &c0->table, q->out_count, zsv_hash_set_hash(c->table.groups, s), g->key, g->key_len);
+        if (!g0 || zsv_sql_agg_group_merge(q, g0, g, &c0->table.bytes))
+          agg.err = 1;
+      }
+      if (!agg.err && c0->table.bytes > agg.chunk_max_memory) {
+        agg.err = zsv_sql_agg_spill(c0);
+        spilled = 1;
+      }
+    }
+    zsv_sql_agg_table_clear(&c->table, q->out_count);
+  }
+
+  if (agg.err || (run_opts && run_opts->header && !agg.header_done))
+    ; // error, or no header row and hence no output
+  else if (spilled) {
+    if (zsv_sql_agg_table_count(&c0->table))
+      agg.err = zsv_sql_agg_spill(c0);
+    if (!agg.err)
+      agg.err = zsv_sql_agg_merge_runs(&agg, cw);
+  } else {
+    // output groups in key order; with no group by, there is always exactly one row
+    size_t count = zsv_sql_agg_table_count(&c0->table), n = 0;
+    struct zsv_sql_agg_group **groups = calloc(count ? count : 1, sizeof(*groups));
+    if (!groups)
+      agg.err = 1;
+    for (; groups && n < count; n++)
+      groups[n] = zsv_sql_agg_table_group(&c0->table, n);
+    if (groups && n > 1)
+      qsort(groups, n, sizeof(*groups), zsv_sql_agg_group_cmp);
+    if (groups && !n && !q->key_count)
+      groups[n++] = zsv_sql_agg_table_get(&c0->table, q->out_count, zsv_hash(NULL, 0), NULL, 0);
+    for (size_t i = 0; !agg.err && i < n; i++)
+      agg.err = !groups[i] || zsv_sql_agg_write_group(q, groups[i], cw);
+    free(groups);
+  }
+
+  for (unsigned int i = 0; agg.chunks && i < num_chunks; i++) {
+    zsv_sql_agg_table_clear(&agg.chunks[i].table, q->out_count);
+    zsv_buff_temp_files_delete(agg.chunks[i].runs, agg.chunks[i].run_fns, agg.chunks[i].run_count);
+    free(agg.chunks[i].key.s);
+    free(agg.chunks[i].rec.s);
+  }
+  free(agg.chunks);
+  zsv_chunks_free(&agg.runner);
+  return agg.err;
+}
@@ -8,6 +8,7 @@ struct zsv_sqlite3_db *zsv_sqlite3_db_new(struct zsv_sqlite3_dbopts *dbopts) {
   }
   zdb->dedupe_cols = dbopts && dbopts->dedupe_cols;
   zdb->warn_dupe_rename = dbopts && dbopts->warn_dupe_rename;
+  zdb->infer_types = dbopts && dbopts->infer_types;
   const char *db_url = dbopts && dbopts->in_memory ? "file::memory:" : "";
   int flags = SQLITE_OPEN_URI | SQLITE_OPEN_READWRITE;
   zdb->rc = sqlite3_open_v2(db_url, &zdb->db, flags, NULL);
@@ -35,7 +36,8 @@ void zsv_sqlite3_db_delete(struct zsv_sqlite3_db *zdb) {
 }
 
 static int create_virtual_csv_table(const char *fname, sqlite3 *db, // int max_columns,
-                                    char **err_msgp, int table_ix, int dedupe_cols, int warn_dupe_rename) {
+                                    char **err_msgp, int table_ix, int dedupe_cols, int warn_dupe_rename,
+                                    int infer_types) {
   // TO DO: set customizable maximum number of columns to prevent
   // runaway in case no line ends found
   char *sql = NULL;
@@ -48,8 +50,12 @@ static int create_virtual_csv_table(const char *fname, sqlite3 *db, // int max_c
   else
     snprintf(table_name_suffix, sizeof(table_name_suffix), "%i", table_ix + 1);
 
-  sql = sqlite3_mprintf("CREATE VIRTUAL TABLE data%s USING csv(filename=%Q%s%s)", table_name_suffix, fname,
-                        dedupe_cols ? ",dedupe=1" : "", dedupe_cols && warn_dupe_rename ? ",warn_renames=1" : "");
+  // infer_types: 1 = infer and cache column types; 2 = infer without caching
+  sql = sqlite3_mprintf("CREATE VIRTUAL TABLE data%s USING csv(filename=%Q%s%s%s)", table_name_suffix, fname,
+                        dedupe_cols ? ",dedupe=1" : "", dedupe_cols && warn_dupe_rename ? ",warn_renames=1" : "",
+                        infer_types == 1   ? ",infer_types=1"
+                        : infer_types == 2 ? ",infer_types=2"
+                                           : "");
 
   char *err_msg_tmp;
   int rc = sqlite3_exec(db, sql, NULL, NULL, &err_msg_tmp);
@@ -81,7 +87,8 @@ int zsv_sqlite3_add_csv(struct zsv_sqlite3_db *zdb, const char *csv_filename, st
       // it below on failure would leave a dangling pointer in zdb->csv_files,
       // causing a use-after-free / double-free in zsv_sqlite3_db_delete().
       zdb->rc = create_virtual_csv_table(csv_filename, zdb->db, &zdb->err_msg, zdb->table_count, zdb->dedupe_cols,
-                                         zdb->warn_dupe_rename);
+                                         zdb->warn_dupe_rename,
+                                         zdb->infer_types ? 1 + zdb->infer_types_no_cache : 0);
       if (zdb->rc == SQLITE_OK) {
         zcf->next = zdb->csv_files;
         zdb->csv_files = zcf;
@@ -25,6 +25,8 @@ struct zsv_sqlite3_db {
   int rc;
   unsigned char dedupe_cols : 1;      // auto-rename duplicate input column names (a, a_2, ...)
   unsigned char warn_dupe_rename : 1; // note each such rename on stderr (off for curses UIs)
+  unsigned char infer_types : 1;      // declare numeric columns as INTEGER/REAL (see zsv_coltypes_get)
+  unsigned char infer_types_no_cache : 1; // don't cache inferred types (e.g. for temp files)
 };
 
 #include "../include/zsv/utils/sql.h"
@@ -0,0 +1,428 @@
+/*
+ * Copyright (C) 2021 Liquidaty and the zsv/lib contributors
+ * All rights reserved
+ *
+ * This file is part of zsv/lib, distributed under the license defined at
+ * https://opensource.org/licenses/MIT
+ */
+
+/*
+ * Native hash join for `sql --join-indexes` when no sql statement is given.
+ *
+ * Produces the same rows as the statement that would otherwise be generated:
+ *   select data.*, data2.*, ... from data
+ *     left join (select * from data2 group by <keys>) data2 using (<keys>) ...
+ * i.e. each row of the first input, in input order, followed by the first row
+ * of each other input that has an equal key, or blanks if there is none.
+ *
+ * Each other input is loaded into a hash set of its distinct keys (see
+ * utils/hash.h), with each key's pre-quoted output cells stored in the set's
+ * arena. If a table would exceed the memory budget, that input is instead split
+ * by key hash into partition files that are joined one at a time, each writing
+ * its matches (in first-input order) to a result file that the final pass reads
+ * back in step (see zsv_join_spill())
+ */
+
+#include <sys/stat.h>
+#include "utils/buff.h"
+#include "utils/hash.h"
+
+#define ZSV_JOIN_VTAB_MAX_COLUMNS 2000 // same default as the csv vtab
+
+#define ZSV_JOIN_DEFAULT_MAX_MEMORY_MB 1024
+#define ZSV_JOIN_MAX_PARTITIONS 256
+
+/*
+ * A record is [u32 key length][key][u32 payload length][payload] where key is
+ * the length-prefixed key cells and payload is the length-prefixed output cells,
+ * already quoted for CSV output
+ */
+
+// the distinct keys of an input, each with a pointer to its record's
+// [u32 payload length][payload], which is stored in the set's arena
+struct zsv_join_table {
+  zsv_hash_set keys;
+  size_t bytes;
+};
+
+static void zsv_join_table_clear(struct zsv_join_table *t) {
+  zsv_hash_set_delete(t->keys);
+  memset(t, 0, sizeof(*t));
+}
+
+// get the payload of the record with the given key, or NULL if there is none
+static const unsigned char *zsv_join_table_get(struct zsv_join_table *t, uint64_t hash, const unsigned char *key,
+                                               size_t key_len, uint32_t *len) {
+  size_t ix = t->keys ? zsv_hash_set_find(t->keys, hash, key, key_len) : ZSV_HASH_SET_NONE;
+  if (ix == ZSV_HASH_SET_NONE)
+    return NULL;
+  const unsigned char *p = *(const unsigned char **)zsv_hash_set_value(t->keys, ix);
+  *len = zsv_buff_u32(p);
+  return p + sizeof(uint32_t);
+}
+
+// add a record unless its key is already present (the first row for a key wins)
+static int zsv_join_table_add(struct zsv_join_table *t, uint64_t hash, const unsigned char *rec, size_t rec_len) {
+  if (!t->keys && !(t->keys = zsv_hash_set_new(sizeof(const unsigned char *))))
+    return 1;
+  uint32_t key_len = zsv_buff_u32(rec);
+  size_t payload_offset = sizeof(key_len) + key_len;
+  char added = 0;
+  size_t ix = zsv_hash_set_add(t->keys, hash, rec + sizeof(key_len), key_len, &added);
+  if (ix == ZSV_HASH_SET_NONE)
+    return 1;
+  if (added) {
+    unsigned char *copy = zsv_hash_set_alloc(t->keys, rec_len - payload_offset);
+    if (!copy)
+      return 1;
+    memcpy(copy, rec + payload_offset, rec_len - payload_offset);
+    *(const unsigned char **)zsv_hash_set_value(t->keys, ix) = copy;
+    t->bytes = zsv_hash_set_bytes(t->keys);
+  }
+  return 0;
+}
+
+struct zsv_join_input {
+  const char *filename;
+  unsigned int col_count;
+  unsigned int *key_ixs; // 0-based, one per join key
+
+  struct zsv_join_table table;
+
+  // if spilled: one result file per partition, read back during the final pass
+  unsigned int partition_count;
+  FILE **results;
+  char **result_fns;
+};
+
+struct zsv_join {
+  struct zsv_opts *opts;
+  struct zsv_prop_handler *custom_prop_handler;
+  size_t max_memory;
+  unsigned int key_count;
+  struct zsv_join_input *inputs; // inputs[0] is the first ("data") input
+  unsigned int input_count;
+  struct zsv_buff key;
+  struct zsv_buff rec;
+};
+
+/* open an input and position it at its first data row */
+static zsv_parser zsv_join_open(struct zsv_join *j, const char *filename, FILE **f, char *delimiter) {
+  struct zsv_opts opts = *j->opts;
+  zsv_parser parser = NULL;
+  if (!opts.max_columns)
+    opts.max_columns = ZSV_JOIN_VTAB_MAX_COLUMNS;
+  if (!(opts.stream = *f = fopen(filename, "rb")))
+    perror(filename);
+  else if (zsv_new_with_properties(&opts, j->custom_prop_handler, filename, &parser) != zsv_status_ok) {
+    fclose(*f);
+    *f = NULL;
+    return NULL;
+  }
+  if (delimiter)
+    *delimiter = opts.delimiter ? opts.delimiter : ',';
+  zsv_next_row(parser); // skip the header
+  return parser;
+}
+
+static void zsv_join_close(zsv_parser parser, FILE *f) {
+  if (parser)
+    zsv_delete(parser);
+  if (f)
+    fclose(f);
+}
+
+static inline struct zsv_cell zsv_join_get_cell(zsv_parser parser, size_t cell_count, unsigned int ix) {
+  if (ix < cell_count)
+    return zsv_get_cell(parser, ix);
+  struct zsv_cell c = {0};
+  return c;
+}
+
+/*
+ * encode the current row's key into j->key and return its hash. A key cell that
+ * is missing from a short row is NULL to sqlite, and NULL never equals anything,
+ * so such a key sets *is_null and must not match
+ */
+static int zsv_join_row_key(struct zsv_join *j, zsv_parser parser, const unsigned int *key_ixs, uint64_t *hash,
+                            char *is_null) {
+  size_t cell_count = zsv_cell_count(parser);
+  j->key.len = 0;
+  *is_null = 0;
+  for (unsigned int i = 0; i < j->key_count; i++) {
+    if (key_ixs[i] >= cell_count)
+      *is_null = 1;
+    struct zsv_cell c = zsv_join_get_cell(parser, cell_count, key_ixs[i]);
+    if (zsv_buff_append_cell(&j->key, c.str, c.len))
+      return 1;
+  }
+  *hash = zsv_hash(j->key.s, j->key.len);
+  return 0;
+}
+
+// encode the current row of input `in` into j->rec and return its key hash
+static int zsv_join_row_rec(struct zsv_join *j, struct zsv_join_input *in, zsv_parser parser, uint64_t *hash,
+                            char *is_null) {
+  if (zsv_join_row_key(j, parser, in->key_ixs, hash, is_null))
+    return 1;
+
+  uint32_t key_len = (uint32_t)j->key.len, payload_len = 0;
+  j->rec.len = 0;
+  if (zsv_buff_append(&j->rec, &key_len, sizeof(key_len)) || zsv_buff_append(&j->rec, j->key.s, key_len) ||
+      zsv_buff_append(&j->rec, &payload_len, sizeof(payload_len)))
+    return 1;
+
+  size_t payload_start = j->rec.len;
+  size_t cell_count = zsv_cell_count(parser);
+  for (unsigned int i = 0; i < in->col_count; i++) {
+    struct zsv_cell c = zsv_join_get_cell(parser, cell_count, i);
+    unsigned char *quoted = c.len ? zsv_csv_quote(c.str, c.len, NULL, 0) : NULL;
+    int err = quoted ? zsv_buff_append_cell(&j->rec, quoted, strlen((char *)quoted))
+                     : zsv_buff_append_cell(&j->rec, c.str, c.len);
+    free(quoted);
+    if (err)
+      return 1;
+  }
+  payload_len = (uint32_t)(j->rec.len - payload_start);
+  memcpy(j->rec.s + payload_start - sizeof(payload_len), &payload_len, sizeof(payload_len));
+  return 0;
+}
+
+static inline unsigned int zsv_join_partition(uint64_t hash, unsigned int partition_count) {
+  return (unsigned int)((hash >> 32) % partition_count); // low bits pick the hash slot
+}
+
+/*
+ * load an input into its hash table
+ * return 0 on success, 1 if the memory budget was exceeded, -1 on error
+ */
+static int zsv_join_load(struct zsv_join *j, struct zsv_join_input *in) {
+  FILE *f;
+  zsv_parser parser = zsv_join_open(j, in->filename, &f, NULL);
+  if (!parser)
+    return -1;
+  int rc = 0;
+  uint64_t hash;
+  char is_null;
+  while (!rc && zsv_next_row(parser) == zsv_status_row) {
+    if (zsv_join_row_rec(j, in, parser, &hash, &is_null))
+      rc = -1;
+    else if (!is_null && zsv_join_table_add(&in->table, hash, j->rec.s, j->rec.len))
+      rc = -1;
+    else if (in->table.bytes > j->max_memory)
+      rc = 1;
+  }
+  zsv_join_close(parser, f);
+  return rc;
+}
+
+/*
+ * join an input that is too large to hold in memory:
+ * 1. split its records into partition files by key hash
+ * 2. for each partition: load it, then pass over the first input and, for each
+ *    row whose key falls in this partition, write the matched payload (or a
+ *    miss) to the partition's result file. Results are thus in first-input
+ *    order within each partition, so that the final pass can read them in step
+ */
+static int zsv_join_spill(struct zsv_join *j, struct zsv_join_input *in) {
+  struct stat st;
+  size_t size = stat(in->filename, &st) ? 0 : (size_t)st.st_size;
+  unsigned int count = (unsigned int)(2 * (size / j->max_memory) + 2);
+  if (count > ZSV_JOIN_MAX_PARTITIONS)
+    count = ZSV_JOIN_MAX_PARTITIONS;
+
+  int err = 0;
+  FILE **parts = calloc(count, sizeof(*parts));
+  char **part_fns = calloc(count, sizeof(*part_fns));
+  in->partition_count = count;
+  in->results = calloc(count, sizeof(*in->results));
+  in->result_fns = calloc(count, sizeof(*in->result_fns));
+  if (!parts || !part_fns || !in->results || !in->result_fns)
+    err = 1;
+  for (unsigned int i = 0; !err && i < count; i++)
+    if (!(parts[i] = zsv_buff_temp_file("zsvjoin", &part_fns[i])) || !(in->results[i] = zsv_buff_temp_file("zsvjoin", &in->result_fns[i])))
+      err = 1;
+
+  if (!err && j->opts->verbose)
+    fprintf(stderr, "Join: %s exceeds memory budget; using %u partitions\n", in->filename, count);
+
+  // 1. partition
+  FILE *f = NULL;
+  zsv_parser parser = err ? NULL : zsv_join_open(j, in->filename, &f, NULL);
+  uint64_t hash;
+  char is_null;
+  if (!parser)
+    err = 1;
+  while (!err && zsv_next_row(parser) == zsv_status_row) {
+    if (zsv_join_row_rec(j, in, parser, &hash, &is_null))
+      err = 1;
+    else if (!is_null && fwrite(j->rec.s, 1, j->rec.len, parts[zsv_join_partition(hash, count)]) != j->rec.len)
+      err = 1;
+  }
+  zsv_join_close(parser, f);
+
+  // 2. join each partition
+  for (unsigned int p = 0; !err && p < count; p++) {
+    zsv_join_table_clear(&in->table);
+    rewind(parts[p]);
+    uint32_t lens[2];
+    while (!err && fread(&lens[0], sizeof(lens[0]), 1, parts[p]) == 1) {
+      j->rec.len = 0;
+      if (zsv_buff_append(&j->rec, &lens[0], sizeof(lens[0])) ||
+          zsv_buff_extend(&j->rec, lens[0] + sizeof(lens[1])) ||
+          fread(j->rec.s + sizeof(lens[0]), 1, lens[0] + sizeof(lens[1]), parts[p]) != lens[0] + sizeof(lens[1])) {
+        err = 1;
+        break;
+      }
+      memcpy(&lens[1], j->rec.s + sizeof(lens[0]) + lens[0], sizeof(lens[1]));
+      size_t at = j->rec.len;
+      if (zsv_buff_extend(&j->rec, lens[1]) || fread(j->rec.s + at, 1, lens[1], parts[p]) != lens[1])
+        err = 1;
+      else if (zsv_join_table_add(&in->table, zsv_hash(j->rec.s + sizeof(lens[0]), lens[0]), j->rec.s,
+                                  j->rec.len))
+        err = 1;
+    }
+    fclose(parts[p]);
+    parts[p] = NULL;
+    unlink(part_fns[p]);
+
+    if (!err && !(parser = zsv_join_open(j, j->inputs[0].filename, &f, NULL)))
+      err = 1;
+    while (!err && zsv_next_row(parser) == zsv_status_row) {
+      if (zsv_join_row_key(j, parser, j->inputs[0].key_ixs, &hash, &is_null))
+        err = 1;
+      else if (!is_null && zsv_join_partition(hash, count) == p) {
+        uint32_t plen = 0;
+        const unsigned char *payload = zsv_join_table_get(&in->table, hash, j->key.s, j->key.len, &plen);
+        unsigned char matched = payload ? 1 : 0;
+        if (fwrite(&matched, 1, 1, in->results[p]) != 1 ||
+            (matched && (fwrite(&plen, sizeof(plen), 1, in->results[p]) != 1 ||
+                         fwrite(payload, 1, plen, in->results[p]) != plen)))
+          err = 1;
+      }
+    }
+    zsv_join_close(parser, f);
+    parser = NULL;
+    rewind(in->results[p]);
+  }
+  zsv_join_table_clear(&in->table);
+  zsv_buff_temp_files_delete(parts, part_fns, count);
+  return err;
+}
+
+// read the next result of a spilled input into b; return -1 on error, else whether it matched
+static int zsv_join_read_result(FILE *f, struct zsv_buff *b) {
+  unsigned char matched;
+  uint32_t plen;
+  if (fread(&matched, 1, 1, f) != 1)
+    return -1;
+  if (!matched)
+    return 0;
+  b->len = 0;
+  if (fread(&plen, sizeof(plen), 1, f) != 1 || zsv_buff_extend(b, plen) || fread(b->s, 1, plen, f) != plen)
+    return -1;
+  return 1;
+}
+
+/*
+ * write the joined rows (not the header) of j's inputs to cw
+ */
+static int zsv_join_run(struct zsv_join *j, zsv_csv_writer cw) {
+  int err = 0;
+  for (unsigned int i = 1; !err && i < j->input_count; i++) {
+    struct zsv_join_input *in = &j->inputs[i];
+    int rc = zsv_join_load(j, in);
+    if (rc > 0) {
+      zsv_join_table_clear(&in->table);
+      rc = zsv_join_spill(j, in);
+    }
+    if (rc)
+      err = 1;
+  }
+
+  size_t out_count = 0;
+  for (unsigned int i = 0; i < j->input_count; i++)
+    out_count += j->inputs[i].col_count;
+  struct zsv_cell *cells = calloc(out_count ? out_count : 1, sizeof(*cells));
+  if (!cells)
+    err = 1;
+
+  // payloads of the current output row, which cells[] point into
+  struct zsv_buff *spilled = calloc(j->input_count, sizeof(*spilled));
+  if (!spilled)
+    err = 1;
+
+  char delimiter = ',';
+  FILE *f = NULL;
+  zsv_parser parser = err ? NULL : zsv_join_open(j, j->inputs[0].filename, &f, &delimiter);
+  if (!parser)
+    err = 1;
+  uint64_t hash;
+  char is_null;
+  while (!err && zsv_next_row(parser) == zsv_status_row) {
+    size_t cell_count = zsv_cell_count(parser);
+    char raw = delimiter == ',';
+    size_t n = 0;
+    for (unsigned int i = 0; i < j->inputs[0].col_count; i++, n++) {
+      cells[n] = zsv_join_get_cell(parser, cell_count, i);
+      if (cells[n].quoted)
+        raw = 0;
+    }
+
+    if (zsv_join_row_key(j, parser, j->inputs[0].key_ixs, &hash, &is_null)) {
+      err = 1;
+      break;
+    }
+    for (unsigned int i = 1; !err && i < j->input_count; i++) {
+      struct zsv_join_input *in = &j->inputs[i];
+      const unsigned char *payload = NULL;
+      if (is_null)
+        ; // no match, and no spilled result was written for this row
+      else if (!in->partition_count) {
+        uint32_t plen;
+        payload = zsv_join_table_get(&in->table, hash, j->key.s, j->key.len, &plen);
+      } else {
+        int rc = zsv_join_read_result(in->results[zsv_join_partition(hash, in->partition_count)], &spilled[i]);
+        if (rc < 0)
+          err = 1;
+        else if (rc > 0)
+          payload = spilled[i].s;
+      }
+      for (unsigned int c = 0; c < in->col_count; c++, n++) {
+        memset(&cells[n], 0, sizeof(cells[n]));
+        if (payload) {
+          cells[n].len = zsv_buff_u32(payload);
+          cells[n].str = (unsigned char *)payload + sizeof(uint32_t);
+          payload += sizeof(uint32_t) + cells[n].len;
+        }
+      }
+    }
+    if (err)
+      break;
+
+    if (raw)
+      zsv_writer_row_raw(cw, cells, (unsigned int)n);
+    else {
+      // first-input cells may need quoting; other inputs' cells are already quoted
+      for (size_t i = 0; i < n; i++)
+        zsv_writer_cell(cw, i == 0, cells[i].str, cells[i].len, i < j->inputs[0].col_count);
+    }
+  }
+  zsv_join_close(parser, f);
+
+  for (unsigned int i = 0; spilled && i < j->input_count; i++)
+    free(spilled[i].s);
+  free(spilled);
+  free(cells);
+  return err;
+}
+
+static void zsv_join_clear(struct zsv_join *j) {
+  for (unsigned int i = 0; i < j->input_count; i++) {
+    struct zsv_join_input *in = &j->inputs[i];
+    zsv_join_table_clear(&in->table);
+    zsv_buff_temp_files_delete(in->results, in->result_fns, in->partition_count);
+  }
+  free(j->key.s);
+  free(j->rec.s);
+}
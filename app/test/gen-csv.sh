@@ -0,0 +1,95 @@
+#!/bin/sh -eu
+
+# Write the named generated CSV input to stdout
+#
+# These are the inputs that are too large to check in: tests that compare a parallel or
+# spilling run of a command with a serial run, and check the output of the serial run
+# against a checksum in expected/
+#
+# Pseudo-random values come from rnd() below rather than awk's rand(), whose sequence
+# differs between awk implementations, so that the data (and so each checksum) is the same
+# everywhere. Values that are summed as floats are multiples of 1/4, so that their sums are
+# exact in any order
+
+# rnd(n): pseudo-random integer in [0, n), from a Park-Miller generator seeded with `seed`.
+# Its products stay below 2^53, so awk's double arithmetic is exact
+RND='function rnd(n) { seed = (seed * 16807) % 2147483647; return int(seed / 2147483647 * n) }'
+
+case "${1:-}" in
+  2db-parallel)
+    awk 'BEGIN{print "id,name,note"; for(i=1;i<=200000;i++){ if(i%7==0) printf "%d,\"n,%d\",\"l1\nl2 %d\"\n",i,i,i;
+      else if(i%11==0) printf ",,\n"; else printf "%d,name%d,note %d\n",i,i,i}}'
+    ;;
+  echo-tail)
+    awk "$RND"'BEGIN{seed=5; print "id,t"; for(i=1;i<=50000;i++){ r=rnd(100); if(r<10) printf "%d,\"multi\nline, \"\"q\"\" %d\"\n",i,i;
+      else if(r<15) printf "%d,\"\n\"\r\n",i; else printf "%d,plain%d\n",i,i }}'
+    ;;
+  sql-rowid)
+    awk 'BEGIN{print "id,txt"; for(i=1;i<=5000;i++){ if(i%7==0) printf "%d,\"a\nb%d\"\n",i,i; else if(i%13==0) printf "\n";
+      else printf "%d,t%d\n",i,i}}'
+    ;;
+  join-left)
+    awk 'BEGIN{print "k,v"; for(i=1;i<=30000;i++) printf "%d,l%d\n",(i*7919)%40000,i}'
+    ;;
+  join-right)
+    awk 'BEGIN{print "K,w,z"; for(i=1;i<=60000;i++) printf "%d,r%d,\"x,%d\"\n",i%35000,i,i}'
+    ;;
+  sql-agg)
+    awk "$RND"'BEGIN{seed=7; print "k,g,v,w,t"; for(i=1;i<=150000;i++){ if(i%1000==0){print ""; continue}
+      if(i%777==0){printf "k%d,x\n",i%50; continue}
+      printf "k%d,%s,%d,%.2f,%s\n",i%50,(i%3?"a":"b"),rnd(1000)-500,rnd(400)/4,(i%11?"t" i%97:(i%2?"12abc":" 7 "))}}'
+    ;;
+  sort)
+    awk "$RND"'BEGIN{seed=3; print "id,k,v,t"; for(i=1;i<=60000;i++)
+      printf "%d,%d,%.2f,\"w%d, %s\"\n",i,rnd(1000),(rnd(100000)-50000)/100,rnd(100),(i%7?"x":"y\nz")}'
+    ;;
+  compare-1)
+    awk 'BEGIN{print "id,name,amount"; for(i=0;i<150000;i++){ if(i%1000==7) printf "K%07d,\"multi\nline %d\",%d\n",i,i,i;
+      else printf "K%07d,name %d,%d\n",i,i,i}}'
+    ;;
+  compare-2)
+    awk 'BEGIN{print "id,amount,name,extra"; for(i=0;i<150000;i++){ if(i%97==5) continue;
+      printf "K%07d,%d,%s,x%d\n",i,(i%53 ? i : i+1),(i%1000==7 ? "\"multi\nline " i "\"" : "name " i),i%5}
+      for(i=0;i<500;i++) printf "K9%06d,1,extra,1\n",i}'
+    ;;
+  compare-3) # compare-1 with one row out of order
+    "$0" compare-1 | awk 'NR==60001{hold=$0; next} {print} NR==90000{print hold}'
+    ;;
+  agg)
+    awk "$RND"'BEGIN{seed=11; print "k,g,v,w,t"; for(i=1;i<=150000;i++){ if(i%777==0){printf "k%d,x\n",i%500; continue}
+      printf "k%d,%s,%d,%.2f,\"%s\"\n",i%500,(i%3?"a":"b"),rnd(1000)-500,rnd(400)/4,(i%11?"t" rnd(3000):"1,\n2")}}'
+    ;;
+  dedup)
+    awk "$RND"'BEGIN{seed=7; print "k,g,v"; for(i=1;i<=300000;i++) printf "k%d,%s,%d\n",rnd(60000),(i%3?"a":"b"),i%97}'
+    ;;
+  split)
+    awk "$RND"'BEGIN{seed=3; print "id,k,v"; for(i=1;i<=100000;i++) printf "%d,k%d,\"x,%d\"\n",i,rnd(300),i}'
+    ;;
+  sample)
+    awk "$RND"'BEGIN{seed=11; print "id,k,v"; for(i=1;i<=100000;i++) printf "%d,k%d,\"x,%s\"\"%d\"\n",i,rnd(300),(i%5?"":"\n"),i}'
+    ;;
+  lookup)
+    awk "$RND"'BEGIN{seed=7; print "id,k,v"; for(i=1;i<=50000;i++) printf "%d,k%d,\"x,%s\"\"%d\"\n",i,rnd(3000),(i%7?"":"\n"),i}'
+    ;;
+  desc)
+    awk "$RND"'BEGIN{seed=7; print "id,c,s,t,n"; for(i=1;i<=200000;i++)
+      printf "%d,%s,%s,%s,%d\n",i,(rnd(2)?"Ab":"aB"),(i<20000?i%3:i%7),(i<20000?i%3:i),rnd(500)}'
+    ;;
+  sheet-find) # about 20MB, with the rows to find after the first 16MB
+    awk 'BEGIN{print "id,name,note,filler"; for(i=1;i<=200000;i++){
+      note=(i==180000 ? "needle-a" : (i==190000 ? "\"say \"\"hi\"\"\"" : "note " i))
+      printf "%d,name %d,%s,%070d\n",i,i,note,i}}'
+    ;;
+  sheet-column-cache) # about 36MB, more than the size for which the sheet caches a column
+    awk 'BEGIN{print "id,k,v,filler"; for(i=1;i<=400000;i++)
+      printf "%d,x%02d,%s,%070d\n",i,i%50,(i%13 ? "v" i : "\"l1\nl2 " i "\""),i}'
+    ;;
+  sheet-wide) # more columns than the sheet holds around those it shows
+    awk 'BEGIN{for(c=1;c<=200;c++) printf "%sc%03d",(c>1?",":""),c; print ""
+      for(i=1;i<=3000;i++) for(c=1;c<=200;c++) printf "%sr%dc%d%s",(c>1?",":""),i,c,(c<200?"":"\n")}'
+    ;;
+  *)
+    echo "Usage: $0 <name>" >&2
+    exit 1
+    ;;
+esac
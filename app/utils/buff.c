@@ -0,0 +1,57 @@
+// /src/app/utils/buff.c: implements /src/app/utils/buff.h
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h> // unlink
+
+#include <zsv/utils/file.h>
+#include "buff.h"
+
+int zsv_buff_extend(struct zsv_buff *b, size_t len) {
+  if (b->len + len > b->capacity) {
+    size_t capacity = b->capacity ? b->capacity * 2 : 256;
+    while (capacity < b->len + len)
+      capacity *= 2;
+    unsigned char *tmp = realloc(b->s, capacity);
+    if (!tmp)
+      return 1;
+    b->s = tmp;
+    b->capacity = capacity;
+  }
+  b->len += len;
+  return 0;
+}
+
+int zsv_buff_append(struct zsv_buff *b, const void *s, size_t len) {
+  if (zsv_buff_extend(b, len))
+    return 1;
+  if (len)
+    memcpy(b->s + b->len - len, s, len);
+  return 0;
+}
+
+int zsv_buff_append_cell(struct zsv_buff *b, const unsigned char *s, size_t len) {
+  uint32_t len32 = (uint32_t)len;
+  return zsv_buff_append(b, &len32, sizeof(len32)) || zsv_buff_append(b, s, len);
+}
+
+FILE *zsv_buff_temp_file(const char *prefix, char **fn) {
+  FILE *f = NULL;
+  if (!(*fn = zsv_get_temp_filename(prefix)) || !(f = fopen(*fn, "w+b")))
+    fprintf(stderr, "Unable to create temp file %s\n", *fn ? *fn : "");
+  return f;
+}
+
+void zsv_buff_temp_files_delete(FILE **files, char **fns, unsigned int count) {
+  for (unsigned int i = 0; i < count; i++) {
+    if (files && files[i])
+      fclose(files[i]);
+    if (fns && fns[i]) {
+      unlink(fns[i]);
+      free(fns[i]);
+    }
+  }
+  free(files);
+  free(fns);
+}
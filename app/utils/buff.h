@@ -0,0 +1,47 @@
+#ifndef ZSV_UTILS_BUFF_H
+#define ZSV_UTILS_BUFF_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+/**
+ * Growable byte buffer, used to encode keys, rows and records that are held in memory
+ * or spilled to temporary files. Initialize by zeroing; free its `s` member when done.
+ * Functions that allocate return non-zero if out of memory
+ */
+struct zsv_buff {
+  unsigned char *s;
+  size_t len;
+  size_t capacity;
+};
+
+// extend b by len uninitialized bytes
+int zsv_buff_extend(struct zsv_buff *b, size_t len);
+
+int zsv_buff_append(struct zsv_buff *b, const void *s, size_t len);
+
+// append a cell as its 32-bit length followed by its bytes
+int zsv_buff_append_cell(struct zsv_buff *b, const unsigned char *s, size_t len);
+
+// read a 32-bit length, as written by zsv_buff_append_cell()
+static inline uint32_t zsv_buff_u32(const unsigned char *s) {
+  uint32_t u;
+  memcpy(&u, s, sizeof(u));
+  return u;
+}
+
+/**
+ * Create and open a temporary file for reading and writing. Its name, which the caller
+ * must free, is returned in *fn. On error, prints a message and returns NULL
+ */
+FILE *zsv_buff_temp_file(const char *prefix, char **fn);
+
+/**
+ * Close, delete and free the first count of the given temporary files and their names,
+ * and free both arrays. Either array may be NULL, as may any of their entries
+ */
+void zsv_buff_temp_files_delete(FILE **files, char **fns, unsigned int count);
+
+#endif
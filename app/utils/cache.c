@@ -24,6 +24,8 @@ static const char *zsv_cache_type_name(enum zsv_cache_type t) {
     return "tag.json";
   case zsv_cache_type_overwrite:
     return "overwrite.sqlite3";
+  case zsv_cache_type_coltypes:
+    return "coltypes.json";
   default:
     return NULL;
   }
@@ -5,6 +5,8 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include <zsv.h>
+#include <zsv/utils/prop.h>
 #include "chunk.h"
 
 /**
@@ -25,7 +27,7 @@ static int zsv_is_newline(char c) {
  * @param only_crlf If non-zero, only treat \r\n as a newline.
  * @return zsv_file_pos The position after the newline sequence, or -1 if not found.
  */
-static zsv_file_pos zsv_find_chunk_start(FILE *fp, zsv_file_pos initial_offset, zsv_file_pos boundary, int only_crlf) {
+zsv_file_pos zsv_find_chunk_start(FILE *fp, zsv_file_pos initial_offset, zsv_file_pos boundary, int only_crlf) {
   char c;
   // Seek to the initial offset.
   if (fseek(fp, initial_offset, SEEK_SET) != 0) {
@@ -208,6 +210,277 @@ struct zsv_chunk_position *zsv_guess_file_chunks(const char *filename, uint64_t
   return chunks;
 }
 
+#define ZSV_TAIL_BLOCK_SIZE (64 * 1024)
+
+zsv_file_pos *zsv_guess_tail_rows(FILE *fp, zsv_file_pos initial_offset, uint64_t *n, int only_crlf) {
+  uint64_t want = *n;
+  *n = 0;
+  struct stat st;
+  if (fstat(fileno(fp), &st) == -1 || initial_offset > (zsv_file_pos)st.st_size)
+    return NULL;
+  zsv_file_pos size = (zsv_file_pos)st.st_size;
+
+  // row starts are filled in from the back of the array
+  zsv_file_pos *starts = malloc((want ? want : 1) * sizeof(*starts));
+  char *buff = malloc(ZSV_TAIL_BLOCK_SIZE);
+  if (!starts || !buff) {
+    free(starts);
+    free(buff);
+    return NULL;
+  }
+
+  uint64_t count = 0;
+  uint64_t quotes = 0;      // number of quote chars between the current position and the end of the file
+  zsv_file_pos pending = 0; // start of a row after a \n, if the \n may be the end of \r\n
+  int err = 0;
+  for (zsv_file_pos end = size; !err && count < want && end > initial_offset;) {
+    zsv_file_pos start = end - initial_offset > ZSV_TAIL_BLOCK_SIZE ? end - ZSV_TAIL_BLOCK_SIZE : initial_offset;
+    size_t len = (size_t)(end - start);
+    if (fseeko(fp, start, SEEK_SET) != 0 || fread(buff, 1, len, fp) != len) {
+      err = 1;
+      break;
+    }
+    for (size_t i = len; i-- > 0 && count < want;) {
+      char c = buff[i];
+      zsv_file_pos row_start = 0;
+      if (pending) { // the previous char was \n
+        if (c == '\r')
+          row_start = pending;
+        else {
+          if (!only_crlf)
+            row_start = pending;
+          i++; // reprocess c
+        }
+        pending = 0;
+      } else if (c == '"')
+        quotes++;
+      else if (!(quotes & 1)) { // outside of quotes
+        if (c == '\n')
+          pending = start + (zsv_file_pos)i + 1;
+        else if (c == '\r' && !only_crlf)
+          row_start = start + (zsv_file_pos)i + 1;
+      }
+      // a newline at the very end of the file ends the last row rather than starting one
+      if (row_start && row_start < size)
+        starts[want - 1 - count++] = row_start;
+    }
+    end = start;
+  }
+  if (!err && pending && !only_crlf && count < want && pending < size)
+    starts[want - 1 - count++] = pending;
+
+  // the first row, if any, starts at initial_offset
+  if (!err && count < want && initial_offset < (count ? starts[want - count] : size))
+    starts[want - 1 - count++] = initial_offset;
+  free(buff);
+  if (err) {
+    free(starts);
+    return NULL;
+  }
+  memmove(starts, starts + (want - count), count * sizeof(*starts));
+  *n = count;
+  return starts;
+}
+
+static int zsv_is_cell_end(char c, char delimiter) {
+  return c == delimiter || zsv_is_newline(c);
+}
+
+int zsv_find_row_bounds(FILE *fp, zsv_file_pos offset, zsv_file_pos lower, zsv_file_pos upper, char delimiter,
+                        int only_crlf, size_t max_window, zsv_file_pos *start, zsv_file_pos *end) {
+  if (offset < lower || offset >= upper)
+    return -1;
+  if (!delimiter)
+    delimiter = ',';
+  int rc = 1;
+  for (size_t window = 16 * 1024; rc == 1; window *= 2) {
+    zsv_file_pos lo = offset - lower > (zsv_file_pos)window ? offset - (zsv_file_pos)window : lower;
+    zsv_file_pos hi = upper - offset > (zsv_file_pos)window ? offset + (zsv_file_pos)window : upper;
+    size_t len = (size_t)(hi - lo);
+    char *buff = malloc(len);
+    if (!buff || fseeko(fp, lo, SEEK_SET) != 0 || fread(buff, 1, len, fp) != len) {
+      free(buff);
+      return -1;
+    }
+    size_t o = (size_t)(offset - lo);
+    if (buff[o] == '\n' && o > 0 && buff[o - 1] == '\r')
+      o--; // treat \r\n as one line end
+
+    // is offset inside quotes? test both possibilities against the following quote chars
+    char out_ok = 1, in_ok = 1; // whether each is consistent so far
+    unsigned int parity = 0;
+    for (size_t i = o; i < len && out_ok && in_ok; i++) {
+      if (buff[i] != '"')
+        continue;
+      char open_ok = i == 0 || buff[i - 1] == '"' || zsv_is_cell_end(buff[i - 1], delimiter);
+      char close_ok = i + 1 == len ? 1 : buff[i + 1] == '"' || zsv_is_cell_end(buff[i + 1], delimiter);
+      if (!(parity ? close_ok : open_ok))
+        out_ok = 0;
+      if (!(parity ? open_ok : close_ok))
+        in_ok = 0;
+      parity ^= 1;
+    }
+    unsigned int in_quotes = !out_ok && in_ok;
+
+    // forward to the end of the row
+    size_t row_end = 0;
+    parity = in_quotes;
+    for (size_t i = o; i < len && !row_end; i++) {
+      if (buff[i] == '"')
+        parity ^= 1;
+      else if (!parity && zsv_is_newline(buff[i])) {
+        if (buff[i] == '\r' && i + 1 < len && buff[i + 1] == '\n')
+          row_end = i + 2;
+        else if (!only_crlf)
+          row_end = i + 1;
+      }
+    }
+    // backward to its start
+    size_t row_start = 0;
+    char row_start_found = 0;
+    parity = in_quotes;
+    for (size_t i = o; i > 0 && !row_start_found; i--) {
+      char c = buff[i - 1];
+      if (c == '"')
+        parity ^= 1;
+      else if (!parity && (c == '\n' ? !only_crlf || (i > 1 && buff[i - 2] == '\r') : c == '\r' && !only_crlf))
+        row_start = i, row_start_found = 1;
+    }
+
+    if ((row_end || hi == upper) && (row_start_found || lo == lower)) {
+      *start = lo + (zsv_file_pos)row_start;
+      *end = row_end ? lo + (zsv_file_pos)row_end : upper;
+      rc = 0;
+    }
+    free(buff);
+    if (rc && (window >= max_window || (lo == lower && hi == upper)))
+      break;
+  }
+  return rc;
+}
+
+int zsv_chunk_opts(struct zsv_opts *opts, const struct zsv_opts *tmpl, struct zsv_prop_handler *custom_prop_handler,
+                   const char *input_path, FILE *stream) {
+  *opts = *tmpl;
+  if (opts->stdin_filename && input_path && !strcmp(input_path, "-"))
+    input_path = opts->stdin_filename;
+  if (input_path) {
+    // merge the saved properties as zsv_new_with_properties() does. The header and skip
+    // properties are cleared below, so let them load without a conflict warning
+    opts->option_overrides.skip_head = 0;
+    opts->option_overrides.header_row_span = 0;
+    struct zsv_file_properties fp = zsv_cache_load_props(input_path, opts, custom_prop_handler);
+    if (fp.stat != zsv_status_ok)
+      return 1;
+    if (opts->delimiter == 0)
+      opts->delimiter = zsv_tab_ext_delim(input_path);
+  }
+  opts->row_handler = NULL;
+  opts->cell_handler = NULL;
+  opts->overflow_row_handler = NULL;
+  opts->ctx = NULL;
+  opts->stream = stream;
+  opts->buff = NULL;
+  opts->buffsize = 0;
+  opts->insert_header_row = NULL;
+  opts->header_span = 0;
+  opts->rows_to_ignore = 0;
+  // not at a header row, so do not skip blank rows as if before one
+  opts->keep_empty_header_rows = 1;
+  memset(&opts->progress, 0, sizeof(opts->progress));
+  memset(&opts->completed, 0, sizeof(opts->completed));
+  opts->max_rows = 0;
+  opts->overwrite_auto = 0;
+  memset(&opts->overwrite, 0, sizeof(opts->overwrite));
+  return 0;
+}
+
+size_t zsv_chunk_row_offset(zsv_parser parser, char finishing) {
+  size_t end = zsv_cum_scanned_length(parser) + (finishing ? zsv_scanned_length(parser) : 0);
+  return end - zsv_row_length_raw_bytes(parser);
+}
+
+#ifndef ZSV_NO_PARALLEL
+static inline struct zsv_chunk *zsv_chunks_get(struct zsv_chunk_runner *r, unsigned int i) {
+  return (struct zsv_chunk *)((char *)r->chunks + i * r->chunk_size);
+}
+
+int zsv_chunks_split(struct zsv_chunk_runner *r, const char *input_path, uint64_t min_size, size_t header_end,
+                     const struct zsv_opts *opts) {
+  r->verbose = opts->verbose;
+  if (r->chunk_count < 2)
+    return 1;
+  struct zsv_chunk_position *offsets = zsv_guess_file_chunks(input_path, r->chunk_count, min_size, header_end
+#ifndef ZSV_NO_ONLY_CRLF
+                                                             ,
+                                                             opts->only_crlf_rowend
+#endif
+  );
+  if (!offsets)
+    return 1; // too small to split
+
+  if (r->verbose) {
+    for (unsigned int i = 0; i < r->chunk_count; i++)
+      fprintf(stderr, "Chunk %u: %lld - %lld\n", i + 1, (long long)offsets[i].start, (long long)offsets[i].end);
+  }
+  for (unsigned int i = 0; i < r->chunk_count; i++) {
+    struct zsv_chunk *c = zsv_chunks_get(r, i);
+    c->id = i;
+    c->start_offset = i ? (size_t)offsets[i].start : 0; // the first chunk is read with the header row
+    c->end_offset = (size_t)offsets[i].end;
+  }
+  zsv_free_chunks(offsets);
+  return 0;
+}
+
+int zsv_chunks_start(struct zsv_chunk_runner *r, const char *input_path, uint64_t min_size, size_t header_end,
+                     const struct zsv_opts *opts) {
+  if (zsv_chunks_split(r, input_path, min_size, header_end, opts))
+    return 1;
+  return zsv_chunks_run(r);
+}
+
+int zsv_chunks_run(struct zsv_chunk_runner *r) {
+  if (!r->threads && !(r->threads = calloc(r->chunk_count, sizeof(*r->threads)))) {
+    fprintf(stderr, "Out of memory!\n");
+    return 1;
+  }
+  for (unsigned int i = 1; i < r->chunk_count; i++) {
+    if (pthread_create(&r->threads[i], NULL, r->process, zsv_chunks_get(r, i)) != 0) {
+      fprintf(stderr, "Error creating thread %u\n", i);
+      // the caller will not use the workers, so just wait for those already started
+      while (--i > 0)
+        pthread_join(r->threads[i], NULL);
+      zsv_chunks_free(r);
+      return 1;
+    }
+  }
+  return 0;
+}
+
+void *zsv_chunks_next(struct zsv_chunk_runner *r, unsigned int i, size_t *prev_end) {
+  struct zsv_chunk *c = zsv_chunks_get(r, i);
+  if (r->threads)
+    pthread_join(r->threads[i], NULL);
+  else // no workers were started
+    r->process(c);
+  if (*prev_end > c->start_offset) {
+    if (r->verbose)
+      fprintf(stderr, "Overlap detected at chunk %u (expected %zu, got %zu). Reprocessing.\n", i, c->start_offset,
+              *prev_end);
+    c->start_offset = *prev_end;
+    r->process(c);
+  }
+  *prev_end = c->actual_next_row_start;
+  return c;
+}
+
+void zsv_chunks_free(struct zsv_chunk_runner *r) {
+  free(r->threads);
+  r->threads = NULL;
+}
+#endif
+
 void zsv_free_chunks(struct zsv_chunk_position *chunks) {
   if (chunks) {
     free(chunks);
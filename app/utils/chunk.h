@@ -2,10 +2,13 @@
 #define ZSV_CHUNK_H
 
 #include <zsv/common.h> // struct zsv_opts
+#include <stdio.h>      // For FILE
 #include <stddef.h>     // For size_t
 #include <stdint.h>     // For uint64_t
 #include <sys/types.h>  // For off_t
 
+struct zsv_prop_handler;
+
 #if defined(_WIN32) || defined(__MINGW32__)
 typedef off64_t zsv_file_pos;
 #else
@@ -41,12 +44,183 @@ struct zsv_chunk_position *zsv_guess_file_chunks(const char *filename, uint64_t
 #endif
 );
 
+/**
+ * @brief Scan forward from an offset to the first position after a newline sequence.
+ *
+ * @param fp The open file pointer.
+ * @param initial_offset The starting point of the search.
+ * @param boundary The maximum position to scan to (usually the file size).
+ * @param only_crlf If non-zero, only treat \r\n as a newline.
+ * @return zsv_file_pos The position after the newline sequence, or -1 if not found.
+ */
+zsv_file_pos zsv_find_chunk_start(FILE *fp, zsv_file_pos initial_offset, zsv_file_pos boundary, int only_crlf);
+
+/**
+ * @brief Scan backward from the end of a file for the start of each of its last N rows.
+ *
+ * Reads blocks from the end of the file. A newline ends a row if it is followed by an
+ * even number of quote characters (i.e. it is not inside a quoted cell, as counted back
+ * from the end of the file, which is never inside quotes). Quote characters inside
+ * unquoted cells can make this wrong, so the caller should verify the result, e.g. by
+ * parsing forward from the first row start and checking that it finds the same rows.
+ *
+ * @param fp The open file pointer.
+ * @param initial_offset Position of the first row that may be returned (e.g. after the header).
+ * @param n On input, the number of rows to find (N). On output, the number found, which is
+ * less than N if the file has fewer rows after initial_offset.
+ * @param only_crlf If non-zero, only treat \r\n as a newline.
+ * @return zsv_file_pos* An array of the *n row start offsets, in file order (must be freed by
+ * caller), or NULL on error.
+ */
+zsv_file_pos *zsv_guess_tail_rows(FILE *fp, zsv_file_pos initial_offset, uint64_t *n, int only_crlf);
+
+/**
+ * @brief Find the start and end of the row that contains a given offset.
+ *
+ * Whether the offset is inside a quoted cell is not known, so both possibilities are
+ * tested against the quote characters that follow it: a quote that opens a cell must
+ * follow a delimiter, line end or quote, and one that closes a cell must be followed by
+ * one. If both remain consistent, the offset is assumed to be outside of quotes. Rows
+ * are then found by quote parity, reading a window around the offset that grows as needed.
+ *
+ * @param fp The open file pointer.
+ * @param offset The offset whose row to find.
+ * @param lower The start of the first row (e.g. after the header).
+ * @param upper The end of the file.
+ * @param delimiter The cell delimiter (0 for comma).
+ * @param only_crlf If non-zero, only treat \r\n as a newline.
+ * @param max_window Maximum number of bytes to read on either side of offset.
+ * @param start Set to the start of the row.
+ * @param end Set to the start of the next row (or upper).
+ * @return 0 on success, 1 if the row is longer than max_window, -1 on error
+ */
+int zsv_find_row_bounds(FILE *fp, zsv_file_pos offset, zsv_file_pos lower, zsv_file_pos upper, char delimiter,
+                        int only_crlf, size_t max_window, zsv_file_pos *start, zsv_file_pos *end);
+
 /**
  * @brief Frees the memory allocated by zsv_guess_file_chunks. (DRY Cleanup)
  * @param chunks The pointer to the allocated chunk array.
  */
 void zsv_free_chunks(struct zsv_chunk_position *chunks);
 
+/**
+ * @brief Get the options for a parser that starts mid-file, at a data row.
+ *
+ * The options are those of tmpl, merged, if input_path is given, with the file's saved
+ * properties as by zsv_new_with_properties() (tmpl is then typically the command-line
+ * options). Anything that applies only to the start of the input or to tmpl's own parser
+ * is then cleared: the header and rows to skip, the handlers and their context, the
+ * buffer, progress and completion callbacks, the row limit and overwrites.
+ *
+ * @param opts Set to the options, with opts->stream set to stream.
+ * @param tmpl The options to start from.
+ * @param custom_prop_handler As for zsv_new_with_properties().
+ * @param input_path The input, whose saved properties to merge, or NULL if tmpl already includes them.
+ * @param stream The stream to read, already positioned at a row start.
+ * @return 0 on success, or non-zero if the properties could not be loaded.
+ */
+int zsv_chunk_opts(struct zsv_opts *opts, const struct zsv_opts *tmpl, struct zsv_prop_handler *custom_prop_handler,
+                   const char *input_path, FILE *stream);
+
+/**
+ * @brief Get the offset of the start of the current row, from a row handler.
+ *
+ * Once the parser is finished, zsv_cum_scanned_length() no longer includes the current
+ * buffer, so a row handler must know whether its rows are being reported by zsv_finish().
+ *
+ * @param parser The parser whose row handler is running.
+ * @param finishing Non-zero if the row is being reported by zsv_finish().
+ * @return The offset of the row's first byte, relative to where the parser started reading.
+ */
+size_t zsv_chunk_row_offset(zsv_parser parser, char finishing);
+
+#ifndef ZSV_NO_PARALLEL
+#include <pthread.h>
+
+/**
+ * Parallel reading of an input in chunks. The caller reads the first chunk from the start
+ * of the input, including its header row, on its own thread, and a worker thread reads each
+ * other chunk from its guessed first row. As a guess may be wrong (e.g. a newline inside a
+ * quoted cell), each chunk after the first is checked once the chunks before it are done,
+ * and re-read from where the previous chunk actually ended if they overlap.
+ *
+ * Each chunk's struct must begin with a struct zsv_chunk. The caller's process function
+ * reads a chunk after the first from its start_offset until the row that crosses its
+ * end_offset, and sets its actual_next_row_start
+ */
+struct zsv_chunk {
+  unsigned int id;              // 0 for the first chunk
+  size_t start_offset;          // where the chunk's first row starts
+  size_t end_offset;            // the chunk ends with the row that crosses this offset
+  size_t actual_next_row_start; // once read: where the row after the chunk's last row starts
+};
+
+struct zsv_chunk_runner {
+  void *chunks;                  // the caller's chunk structs
+  size_t chunk_size;             // size of each
+  unsigned int chunk_count;      // number of chunks to split the input into
+  void *(*process)(void *chunk); // read a chunk after the first, on a worker or, to re-read it, the caller's thread
+
+  // set by zsv_chunks_split() and zsv_chunks_run()
+  pthread_t *threads;
+  char verbose;
+};
+
+/**
+ * @brief Split the input after its header row into chunks, without starting any workers.
+ *
+ * Sets the id, start_offset and end_offset of each chunk, including the first, which
+ * starts at 0 as it is read from the start of the input.
+ *
+ * @param r The runner, with the members before threads set.
+ * @param input_path The input.
+ * @param min_size The minimum size, after the header row, to split the input.
+ * @param header_end Where the header row ends.
+ * @param opts The parser options, for only_crlf_rowend and verbose.
+ * @return 0 if the input was split, or 1 if it is too small to split.
+ */
+int zsv_chunks_split(struct zsv_chunk_runner *r, const char *input_path, uint64_t min_size, size_t header_end,
+                     const struct zsv_opts *opts);
+
+/**
+ * @brief Start a worker for each chunk after the first.
+ *
+ * Also used for another pass over chunks that were already collected with
+ * zsv_chunks_next(), e.g. a second pass over the input.
+ *
+ * @param r The runner, after zsv_chunks_split().
+ * @return 0 if the workers were started, or 1 if not, in which case none are running and
+ * zsv_chunks_next() reads each chunk on the caller's thread.
+ */
+int zsv_chunks_run(struct zsv_chunk_runner *r);
+
+/**
+ * @brief zsv_chunks_split() then zsv_chunks_run().
+ *
+ * @return 0 if the workers were started, or 1 if the input was not split (too small, or
+ * a worker could not be started), in which case the caller reads it all.
+ */
+int zsv_chunks_start(struct zsv_chunk_runner *r, const char *input_path, uint64_t min_size, size_t header_end,
+                     const struct zsv_opts *opts);
+
+/**
+ * @brief Wait for a chunk after the first, in order, and re-read it if it overlaps the
+ * previous chunk. If no workers are running, read the chunk on the caller's thread.
+ *
+ * @param r The runner.
+ * @param i The chunk, from 1 to r->chunk_count - 1.
+ * @param prev_end Where the previous chunk actually ended: for chunk 1, the first chunk's
+ * actual_next_row_start. Set to where chunk i actually ended.
+ * @return The chunk.
+ */
+void *zsv_chunks_next(struct zsv_chunk_runner *r, unsigned int i, size_t *prev_end);
+
+/**
+ * @brief Free the memory allocated by zsv_chunks_run(), once all workers are finished.
+ */
+void zsv_chunks_free(struct zsv_chunk_runner *r);
+#endif
+
 enum zsv_chunk_status {
   zsv_chunk_status_ok = 0,
   zsv_chunk_status_no_file_input,
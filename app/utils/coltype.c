@@ -0,0 +1,511 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <math.h>
+#include <sys/stat.h>
+#include <unistd.h> // unlink
+
+#include <zsv.h>
+#include <zsv/utils/coltype.h>
+#include <zsv/utils/cache.h>
+#include <zsv/utils/file.h>
+#include <zsv/utils/os.h>
+#include <zsv/utils/prop.h>
+#include <zsv/utils/string.h>
+#include <yajl_helper/yajl_helper.h>
+
+/**
+ * Very basic test to check if a string looks like a number:
+ * - ignore leading whitespace and currency
+ * - ignore trailing whitespace
+ * - ignore leading dash or plus
+ * - len < 1 or > 30 => not a number
+ * - scan characters one by one:
+ *     if the char isn't a digit, comma or period, it's not a number
+ *     digits are ignored
+ *     commas are counted (we ignore the requirement for them to be spaced out e.g. every 3 digits)
+ *     periods are counted
+ *     if at any point we have more than 1 comma AND more than 1 digit, it's not a number
+ * @param s     input string
+ * @param len   length of input
+ * @param flags reserved for future use
+ * @return      1 if it looks like a number, else 0
+ */
+char zsv_looks_like_num(const unsigned char *s, size_t len, unsigned flags) {
+  (void)(flags);
+  // trim
+  s = zsv_strtrim(s, &len);
+
+  // strip +/- sign, if any
+  size_t sign = zsv_strnext_is_sign(s, len);
+  if (sign) {
+    s += sign;
+    len -= sign;
+    s = zsv_strtrim_left(s, &len);
+  }
+
+  // strip currency, if any
+  size_t currency = zsv_strnext_is_currency(s, len);
+  if (currency) {
+    s += currency;
+    len -= currency;
+    s = zsv_strtrim_left(s, &len);
+  }
+
+  // strip +/- sign, if we didn't find one earlier
+  if (!sign && (sign = zsv_strnext_is_sign(s, len))) {
+    s += sign;
+    len -= sign;
+    s = zsv_strtrim_left(s, &len);
+  }
+
+  if (len < 1 || len > 30)
+    return 0;
+
+  unsigned digits = 0;
+  unsigned period = 0;
+  for (size_t i = 0; i < len; i++) {
+    unsigned char c = s[i];
+    if (c >= '0' && c <= '9') // to do: allow utf8 digits, commas, periods?
+      digits++;
+    else if (c == ',' && i > 0 && period == 0) { // comma can't be first char, or follow a period
+      // do nothing. to do: check that the last comma was either 3 or 4 numbers away?
+    } else if (c == '.' && period == 0) // only 1 period allowed (to do: relax this as it isn't true in all localities)
+      period++;
+    else
+      return 0;
+  }
+  return digits > 0 && period < 2;
+}
+
+/**
+ * Super crude "test" to check if a string looks like a date or timestamp:
+ * we are just going to disqualify if len < 5 or len > 30
+ * or any chars are not digits, slash, dash, colon, space
+ * or in any of the following which is made up of chars from the English months, plus am/pm
+ *   abcdefghijlmnoprstuvy
+ * @param s     input string
+ * @param len   length of input
+ * @param flags reserved for future use
+ * @return      1 if it looks like a date, else 0
+ */
+char zsv_looks_like_date(const unsigned char *s, size_t len, unsigned flags) {
+  (void)(flags);
+  // trim
+  s = zsv_strtrim(s, &len);
+  if (len <= 5 || len > 30)
+    return 0;
+#define LOOKS_LIKE_DATE_CHARS "0123456789-/:, abcdefghijlmnoprstuvy"
+  for (size_t i = 0; i < len; i++)
+    if (!memchr(LOOKS_LIKE_DATE_CHARS, s[i], strlen(LOOKS_LIKE_DATE_CHARS)))
+      return 0;
+  return 1;
+}
+
+/**
+ * Very basic test to check if a string looks like a bool:
+ * - ignore leading and trailing whitespace
+ * - look for true, false, yes, no, T, F, 1, 0, Y, N
+ * - to do: add localization options?
+ * @param s     input string
+ * @param len   length of input
+ * @param flags reserved for future use
+ * @return      1 if it looks like a bool, else 0
+ */
+char zsv_looks_like_bool(const unsigned char *s, size_t len, unsigned flags) {
+  (void)(flags);
+  // trim
+  s = zsv_strtrim(s, &len);
+
+  if (!len)
+    return 0;
+
+  if (len == 1)
+    return strchr("TtFf10YyNn", *s) ? 1 : 0;
+
+  if (len <= 5) {
+    char *lower = (char *)zsv_strtolowercase(s, &len);
+    if (lower) {
+      char result = 0;
+      switch (len) {
+      case 2:
+        result = !strcmp(lower, "no");
+        break;
+      case 3:
+        result = !strcmp(lower, "yes");
+        break;
+      case 4:
+        result = !strcmp(lower, "true");
+        break;
+      case 5:
+        result = !strcmp(lower, "false");
+        break;
+      }
+      free(lower);
+      return result;
+    }
+  }
+  return 0;
+}
+
+unsigned int zsv_type_detect(const unsigned char *s, size_t slen) {
+  unsigned int result = 0;
+  if (slen == 0) {
+    result += ZSV_TYPE_CHECK_NULL;
+    return result;
+  }
+  if (zsv_looks_like_num(s, slen, 0))
+    result += ZSV_TYPE_CHECK_NUM;
+  if (zsv_looks_like_date(s, slen, 0))
+    result += ZSV_TYPE_CHECK_DATE;
+  if (zsv_looks_like_bool(s, slen, 0))
+    result += ZSV_TYPE_CHECK_BOOL;
+  return result;
+}
+
+int zsv_parse_int64(const unsigned char *s, size_t len, int64_t *out) {
+  size_t i = 0;
+  char neg = 0;
+  if (len && *s == '-')
+    neg = 1, i = 1;
+  size_t digits = len - i;
+  // 19 digits always fit in a uint64_t; reject leading zeros and "-0"
+  if (digits == 0 || digits > 19 || (s[i] == '0' && (digits > 1 || neg)))
+    return 0;
+  uint64_t v = 0;
+  for (; i < len; i++) {
+    unsigned d = (unsigned)s[i] - '0';
+    if (d > 9)
+      return 0;
+    v = v * 10 + d;
+  }
+  if (neg) {
+    if (v > (uint64_t)INT64_MAX + 1)
+      return 0;
+    *out = v == (uint64_t)INT64_MAX + 1 ? INT64_MIN : -(int64_t)v;
+  } else {
+    if (v > (uint64_t)INT64_MAX)
+      return 0;
+    *out = (int64_t)v;
+  }
+  return 1;
+}
+
+size_t zsv_parse_number(const unsigned char *s, size_t len, unsigned flags, double *out) {
+  static const double pow10[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                                 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+  const char strict = (flags & ZSV_NUMBER_STRICT) != 0;
+  size_t i = 0;
+  char neg = 0;
+  if (len && (*s == '-' || (*s == '+' && !strict)))
+    neg = *s == '-', i = 1;
+  if (i == len || (strict && len > 64))
+    return 0;
+
+  // mantissa digits, with at most one decimal point
+  uint64_t mantissa = 0;
+  unsigned mantissa_digits = 0, int_digits = 0, frac_digits = 0;
+  char truncated = 0, period = 0;
+  if (strict && s[i] == '0' && i + 1 < len && s[i + 1] >= '0' && s[i + 1] <= '9')
+    return 0; // leading zero
+  for (; i < len; i++) {
+    unsigned d = (unsigned)s[i] - '0';
+    if (d <= 9) {
+      if (period)
+        frac_digits++;
+      else
+        int_digits++;
+      if (mantissa || d) {
+        if (mantissa_digits < 19) {
+          mantissa = mantissa * 10 + d;
+          mantissa_digits++;
+        } else
+          truncated = 1;
+      }
+    } else if (s[i] == '.' && !period)
+      period = 1;
+    else
+      break;
+  }
+  if (!int_digits && !frac_digits)
+    return 0;
+  if (strict && ((period && !frac_digits) || (neg && !mantissa && !truncated)))
+    return 0; // reject "1." and negative zero
+
+  // optional exponent, which is not part of the number unless it has digits
+  int exp10 = 0;
+  if (i < len && (s[i] == 'e' || s[i] == 'E')) {
+    size_t j = i + 1;
+    if (j < len && (s[j] == '-' || s[j] == '+'))
+      j++;
+    if (j < len && s[j] >= '0' && s[j] <= '9') {
+      char exp_neg = s[j - 1] == '-';
+      for (; j < len && s[j] >= '0' && s[j] <= '9'; j++)
+        if (exp10 < 10000)
+          exp10 = exp10 * 10 + (int)(s[j] - '0');
+      if (exp_neg)
+        exp10 = -exp10;
+      i = j;
+    } else if (strict)
+      return 0;
+  }
+
+  // fast path: mantissa and power of ten are both exactly representable, so
+  // a single multiply or divide is correctly rounded
+  if (!truncated && mantissa <= ((uint64_t)1 << 53)) {
+    int e = exp10 - (int)frac_digits;
+    if (e >= -22 && e <= 22) {
+      double d = (double)mantissa;
+      d = e < 0 ? d / pow10[-e] : d * pow10[e];
+      *out = neg ? -d : d;
+      return i;
+    }
+  }
+
+  // slow path
+  char buff[72];
+  char *tmp = i < sizeof(buff) ? buff : malloc(i + 1);
+  if (!tmp)
+    return 0;
+  memcpy(tmp, s, i);
+  tmp[i] = '\0';
+  errno = 0;
+  double d = strtod(tmp, NULL);
+  int range_err = errno == ERANGE;
+  if (tmp != buff)
+    free(tmp);
+  if (strict && range_err)
+    return 0;
+  if ((flags & ZSV_NUMBER_FINITE) && !isfinite(d))
+    return 0;
+  *out = d;
+  return i;
+}
+
+int zsv_parse_double(const unsigned char *s, size_t len, double *out) {
+  return len && zsv_parse_number(s, len, ZSV_NUMBER_STRICT, out) == len;
+}
+
+const char *zsv_coltype_name(enum zsv_coltype t) {
+  switch (t) {
+  case zsv_coltype_integer:
+    return "integer";
+  case zsv_coltype_real:
+    return "real";
+  default:
+    return "text";
+  }
+}
+
+struct zsv_coltypes_sample {
+  zsv_parser parser;
+  size_t rows;
+  size_t count;
+  unsigned char *types;
+  unsigned char *seen;
+  enum zsv_status stat;
+};
+
+static void zsv_coltypes_sample_row(void *ctx) {
+  struct zsv_coltypes_sample *d = ctx;
+  size_t n = zsv_cell_count(d->parser);
+  if (!d->types) { // header row
+    if (!(d->count = n)) {
+      zsv_abort(d->parser);
+      return;
+    }
+    d->types = malloc(n);
+    d->seen = calloc(n, 1);
+    if (!d->types || !d->seen) {
+      d->stat = zsv_status_memory;
+      zsv_abort(d->parser);
+      return;
+    }
+    memset(d->types, zsv_coltype_integer, n);
+    return;
+  }
+
+  if (n > d->count)
+    n = d->count;
+  for (size_t i = 0; i < n; i++) {
+    if (d->types[i] == zsv_coltype_text)
+      continue;
+    struct zsv_cell c = zsv_get_cell(d->parser, i);
+    if (!c.len)
+      continue;
+    d->seen[i] = 1;
+    int64_t i64;
+    double dbl;
+    if (d->types[i] == zsv_coltype_integer && zsv_parse_int64(c.str, c.len, &i64))
+      continue;
+    if (zsv_parse_double(c.str, c.len, &dbl))
+      d->types[i] = zsv_coltype_real;
+    else
+      d->types[i] = zsv_coltype_text;
+  }
+  if (++d->rows >= ZSV_COLTYPE_SAMPLE_ROWS)
+    zsv_abort(d->parser);
+}
+
+static enum zsv_status zsv_coltypes_sample(const char *data_filepath, const struct zsv_opts *optsp,
+                                           struct zsv_prop_handler *custom_prop, unsigned char **types_out,
+                                           size_t *count_out) {
+  struct zsv_coltypes_sample d = {0};
+  struct zsv_opts opts = *optsp;
+  if (!(opts.stream = fopen(data_filepath, "rb"))) {
+    perror(data_filepath);
+    return zsv_status_error;
+  }
+  opts.row_handler = zsv_coltypes_sample_row;
+  opts.ctx = &d;
+  if (zsv_new_with_properties(&opts, custom_prop, data_filepath, &d.parser) != zsv_status_ok)
+    d.stat = zsv_status_error;
+  else {
+    while (zsv_parse_more(d.parser) == zsv_status_ok)
+      ;
+    zsv_finish(d.parser);
+    zsv_delete(d.parser);
+  }
+  fclose(opts.stream);
+
+  if (d.stat == zsv_status_ok) {
+    // a column with no sampled values has nothing to suggest it is not text
+    for (size_t i = 0; i < d.count; i++)
+      if (!d.seen[i])
+        d.types[i] = zsv_coltype_text;
+    *types_out = d.types;
+    *count_out = d.count;
+  } else
+    free(d.types);
+  free(d.seen);
+  return d.stat;
+}
+
+/* cache file, e.g. {"size":1234,"mtime":1700000000,"options":"9e3779b97f4a7c15","columns":["integer","text"]},
+ * where options is the digest of the parser options (see zsv_opts_digest()) */
+
+struct zsv_coltypes_cache {
+  long long size;
+  long long mtime;
+  uint64_t options;
+  unsigned char *types;
+  size_t count;
+  size_t capacity;
+  char err;
+};
+
+static int zsv_coltypes_cache_process_value(yajl_helper_t yh, struct json_value *value) {
+  struct zsv_coltypes_cache *c = yajl_helper_ctx(yh);
+  int err = 0;
+  if (yajl_helper_got_path(yh, 1, "{size"))
+    c->size = json_value_long(value, &err);
+  else if (yajl_helper_got_path(yh, 1, "{mtime"))
+    c->mtime = json_value_long(value, &err);
+  else if (yajl_helper_got_path(yh, 1, "{options")) {
+    const unsigned char *s;
+    size_t len;
+    char hex[17];
+    json_value_default_string(value, &s, &len);
+    if (len && len < sizeof(hex)) {
+      memcpy(hex, s, len);
+      hex[len] = '\0';
+      c->options = strtoull(hex, NULL, 16);
+    }
+  } else if (yajl_helper_got_path(yh, 2, "{columns[")) {
+    const unsigned char *s;
+    size_t len;
+    json_value_default_string(value, &s, &len);
+    if (c->count == c->capacity) {
+      size_t capacity = c->capacity ? c->capacity * 2 : 64;
+      unsigned char *types = realloc(c->types, capacity);
+      if (!types)
+        return 0;
+      c->types = types;
+      c->capacity = capacity;
+    }
+    if (len == 7 && !memcmp(s, "integer", 7))
+      c->types[c->count++] = zsv_coltype_integer;
+    else if (len == 4 && !memcmp(s, "real", 4))
+      c->types[c->count++] = zsv_coltype_real;
+    else
+      c->types[c->count++] = zsv_coltype_text;
+  }
+  if (err)
+    c->err = 1;
+  return 1;
+}
+
+static int zsv_coltypes_cache_load(const char *cache_fn, struct zsv_coltypes_cache *c) {
+  FILE *f = fopen(cache_fn, "rb");
+  if (!f)
+    return 1;
+  yajl_helper_t yh = yajl_helper_new(8, NULL, NULL, NULL, NULL, NULL, zsv_coltypes_cache_process_value, c);
+  if (!yh)
+    c->err = 1;
+  else {
+    unsigned char buff[1024];
+    size_t bytes_read;
+    while (!c->err && (bytes_read = fread(buff, 1, sizeof(buff), f)))
+      if (yajl_parse(yajl_helper_yajl(yh), buff, bytes_read) != yajl_status_ok)
+        c->err = 1;
+    if (!c->err && yajl_complete_parse(yajl_helper_yajl(yh)) != yajl_status_ok)
+      c->err = 1;
+    yajl_helper_delete(yh);
+  }
+  fclose(f);
+  return c->err;
+}
+
+static void zsv_coltypes_cache_save(const char *data_filepath, const struct stat *st, uint64_t options,
+                                    const unsigned char *types, size_t count) {
+  unsigned char *fn = zsv_cache_filepath((const unsigned char *)data_filepath, zsv_cache_type_coltypes, 0, 0);
+  unsigned char *fn_tmp = zsv_cache_filepath((const unsigned char *)data_filepath, zsv_cache_type_coltypes, 1, 1);
+  FILE *f = fn && fn_tmp ? fopen((char *)fn_tmp, "wb") : NULL;
+  if (f) {
+    fprintf(f, "{\n  \"size\": %lld,\n  \"mtime\": %lld,\n  \"options\": \"%016llx\",\n  \"columns\": [",
+            (long long)st->st_size, (long long)st->st_mtime, (unsigned long long)options);
+    for (size_t i = 0; i < count; i++)
+      fprintf(f, "%s\"%s\"", i ? "," : "", zsv_coltype_name(types[i]));
+    fprintf(f, "]\n}\n");
+    // the cache is an optimization only, so failure to save it is not an error
+    if (fclose(f) || zsv_replace_file((char *)fn_tmp, (char *)fn))
+      unlink((char *)fn_tmp);
+  }
+  free(fn);
+  free(fn_tmp);
+}
+
+enum zsv_status zsv_coltypes_get(const char *data_filepath, const struct zsv_opts *opts,
+                                 struct zsv_prop_handler *custom_prop, char use_cache, unsigned char **types_out,
+                                 size_t *count_out) {
+  *types_out = NULL;
+  *count_out = 0;
+
+  struct stat st;
+  if (!data_filepath || stat(data_filepath, &st)) {
+    perror(data_filepath);
+    return zsv_status_error;
+  }
+
+  // the types depend on how the file is parsed, so a cache built with other options is not used
+  uint64_t options = use_cache ? zsv_opts_digest(opts, custom_prop, data_filepath) : 0;
+  if (use_cache) {
+    unsigned char *cache_fn = zsv_cache_filepath((const unsigned char *)data_filepath, zsv_cache_type_coltypes, 0, 0);
+    struct zsv_coltypes_cache c = {0};
+    if (cache_fn && !zsv_coltypes_cache_load((char *)cache_fn, &c) && c.count && c.size == (long long)st.st_size &&
+        c.mtime == (long long)st.st_mtime && c.options == options) {
+      free(cache_fn);
+      *types_out = c.types;
+      *count_out = c.count;
+      return zsv_status_ok;
+    }
+    free(c.types);
+    free(cache_fn);
+  }
+
+  enum zsv_status stat = zsv_coltypes_sample(data_filepath, opts, custom_prop, types_out, count_out);
+  if (stat == zsv_status_ok && use_cache && *count_out)
+    zsv_coltypes_cache_save(data_filepath, &st, options, *types_out, *count_out);
+  return stat;
+}
@@ -0,0 +1,27 @@
+// /src/app/utils/column.c: implements /src/app/utils/column.h
+
+#include <stdlib.h>
+#include <string.h>
+#include <zsv/utils/string.h>
+#include "column.h"
+
+int zsv_find_column(zsv_parser parser, const char *arg, size_t *col) {
+  size_t cell_count = zsv_cell_count(parser);
+  size_t len = strlen(arg);
+  if (*arg == '#' && len > 1 && strspn(arg + 1, "0123456789") == len - 1) {
+    size_t n = (size_t)strtoul(arg + 1, NULL, 10);
+    if (n > 0 && n <= cell_count) {
+      *col = n - 1;
+      return 0;
+    }
+    return 1;
+  }
+  for (size_t i = 0; i < cell_count; i++) {
+    struct zsv_cell c = zsv_get_cell(parser, i);
+    if (!zsv_strincmp(c.str, c.len, (const unsigned char *)arg, len)) {
+      *col = i;
+      return 0;
+    }
+  }
+  return 1;
+}
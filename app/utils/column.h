@@ -0,0 +1,15 @@
+#ifndef ZSV_UTILS_COLUMN_H
+#define ZSV_UTILS_COLUMN_H
+
+#include <stddef.h>
+
+#include <zsv.h>
+
+/**
+ * Get the 0-based number of the column given by #N (1-based) or by name (case-insensitive),
+ * from the header row that the parser has just read. Returns 0 on success, or 1 if there is
+ * no such column
+ */
+int zsv_find_column(zsv_parser parser, const char *arg, size_t *col);
+
+#endif
@@ -0,0 +1,439 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h> // unlink
+#include <zsv.h>
+#include <zsv/utils/prop.h>
+#include <zsv/utils/cache.h>
+#include <zsv/utils/dirs.h>
+#include <zsv/utils/os.h>
+#include "chunk.h" // zsv_file_pos
+#include "hash.h"
+#include "column_cache.h"
+
+#define ZSV_COLUMN_CACHE_MAGIC "ZSVCOL02"
+#define ZSV_COLUMN_CACHE_BYTE_ORDER 0x01020304
+#define ZSV_COLUMN_CACHE_PROGRESS_ROWS (64 * 1024)
+
+struct zsv_column_cache_header {
+  char magic[8];
+  uint32_t byte_order;
+  uint32_t col;
+  int64_t data_size;
+  int64_t data_mtime;
+  uint64_t options; // zsv_opts_digest() of the options the file was parsed with
+  uint64_t row_count;
+  uint64_t value_count;
+  uint64_t values_len;
+};
+
+struct zsv_column_cache {
+  struct zsv_column_cache_header header;
+  unsigned char *data; // everything after the header
+  const uint64_t *value_offsets;
+  const unsigned char *values;
+  const uint32_t *row_values;
+  const uint64_t *row_offsets;
+  const uint32_t *row_lens;
+};
+
+static inline size_t zsv_column_cache_pad(size_t len) {
+  return (8 - (len & 7)) & 7;
+}
+
+static int zsv_column_cache_cmp(const unsigned char *a, size_t alen, const unsigned char *b, size_t blen) {
+  int c = memcmp(a, b, alen < blen ? alen : blen);
+  return c ? c : alen < blen ? -1 : alen > blen;
+}
+
+char *zsv_column_cache_filepath(const char *data_filepath, size_t col, char temp_file) {
+  char name[64];
+  snprintf(name, sizeof(name), "col-%zu.zcol", col + 1);
+  return (char *)zsv_cache_path((const unsigned char *)data_filepath, (const unsigned char *)name, temp_file);
+}
+
+// zsv_column_cache_layout: get the sizes of the arrays that follow the header
+static void zsv_column_cache_layout(const struct zsv_column_cache_header *h, uint64_t *offsets_len,
+                                    uint64_t *values_len, uint64_t *row_values_len, uint64_t *data_len) {
+  *offsets_len = (h->value_count + 1) * sizeof(uint64_t);
+  *values_len = h->values_len + zsv_column_cache_pad(h->values_len);
+  *row_values_len = h->row_count * sizeof(uint32_t) + zsv_column_cache_pad(h->row_count * sizeof(uint32_t));
+  *data_len = *offsets_len + *values_len + *row_values_len + h->row_count * (sizeof(uint64_t) + sizeof(uint32_t));
+}
+
+// zsv_column_cache_set_arrays: point the arrays into the data that follows the header
+static void zsv_column_cache_set_arrays(struct zsv_column_cache *cc) {
+  uint64_t offsets_len, values_len, row_values_len, data_len;
+  zsv_column_cache_layout(&cc->header, &offsets_len, &values_len, &row_values_len, &data_len);
+  cc->value_offsets = (const uint64_t *)cc->data;
+  cc->values = cc->data + offsets_len;
+  cc->row_values = (const uint32_t *)(cc->values + values_len);
+  cc->row_offsets = (const uint64_t *)((const unsigned char *)cc->row_values + row_values_len);
+  cc->row_lens = (const uint32_t *)(cc->row_offsets + cc->header.row_count);
+}
+
+// zsv_column_cache_new_from: create a column cache in memory from the given arrays
+static zsv_column_cache zsv_column_cache_new_from(const struct zsv_column_cache_header *h,
+                                                  const unsigned char *const *values, const size_t *value_lens,
+                                                  const uint32_t *row_values, const uint64_t *row_offsets,
+                                                  const uint32_t *row_lens) {
+  uint64_t offsets_len, values_len, row_values_len, data_len;
+  zsv_column_cache_layout(h, &offsets_len, &values_len, &row_values_len, &data_len);
+  struct zsv_column_cache *cc = data_len > SIZE_MAX ? NULL : calloc(1, sizeof(*cc));
+  if (!cc || !(cc->data = calloc(1, (size_t)data_len))) {
+    free(cc);
+    return NULL;
+  }
+  cc->header = *h;
+  uint64_t *offsets = (uint64_t *)cc->data;
+  unsigned char *v = cc->data + offsets_len;
+  uint64_t offset = 0;
+  for (uint64_t i = 0; i < h->value_count; i++) {
+    offsets[i] = offset;
+    if (value_lens[i])
+      memcpy(v + offset, values[i], value_lens[i]);
+    offset += value_lens[i];
+  }
+  offsets[h->value_count] = offset;
+  zsv_column_cache_set_arrays(cc);
+  if (h->row_count) {
+    memcpy((void *)cc->row_values, row_values, h->row_count * sizeof(*row_values));
+    memcpy((void *)cc->row_offsets, row_offsets, h->row_count * sizeof(*row_offsets));
+    memcpy((void *)cc->row_lens, row_lens, h->row_count * sizeof(*row_lens));
+  }
+  return cc;
+}
+
+static enum zsv_column_cache_status zsv_column_cache_write(zsv_column_cache cc, const char *data_filepath) {
+  uint64_t offsets_len, values_len, row_values_len, data_len;
+  zsv_column_cache_layout(&cc->header, &offsets_len, &values_len, &row_values_len, &data_len);
+  enum zsv_column_cache_status stat = zsv_column_cache_status_error;
+  char *fn = zsv_column_cache_filepath(data_filepath, cc->header.col, 0);
+  char *fn_tmp = zsv_column_cache_filepath(data_filepath, cc->header.col, 1);
+  FILE *f = NULL;
+  if (fn && fn_tmp && !zsv_mkdirs(fn_tmp, 1) && (f = fopen(fn_tmp, "wb"))) {
+    int err = fwrite(&cc->header, sizeof(cc->header), 1, f) != 1 || fwrite(cc->data, (size_t)data_len, 1, f) != 1;
+    if (fclose(f) || err || zsv_replace_file(fn_tmp, fn))
+      unlink(fn_tmp);
+    else
+      stat = zsv_column_cache_status_ok;
+  }
+  free(fn);
+  free(fn_tmp);
+  return stat;
+}
+
+static void zsv_column_cache_header_init(struct zsv_column_cache_header *h, const struct stat *st, size_t col,
+                                         uint64_t options) {
+  memset(h, 0, sizeof(*h));
+  memcpy(h->magic, ZSV_COLUMN_CACHE_MAGIC, sizeof(h->magic));
+  h->byte_order = ZSV_COLUMN_CACHE_BYTE_ORDER;
+  h->col = (uint32_t)col;
+  h->data_size = (int64_t)st->st_size;
+  h->data_mtime = (int64_t)st->st_mtime;
+  h->options = options;
+}
+
+enum zsv_column_cache_status zsv_column_cache_save(const char *data_filepath, const struct zsv_opts *opts,
+                                                   struct zsv_prop_handler *custom_prop, size_t col,
+                                                   size_t value_count, const unsigned char *const *values,
+                                                   const size_t *value_lens, uint64_t row_count,
+                                                   const uint32_t *row_values, const uint64_t *row_offsets,
+                                                   const uint32_t *row_lens) {
+  struct stat st;
+  if (stat(data_filepath, &st))
+    return zsv_column_cache_status_error;
+  if (value_count >= UINT32_MAX)
+    return zsv_column_cache_status_too_many_values;
+
+  struct zsv_column_cache_header h;
+  zsv_column_cache_header_init(&h, &st, col, zsv_opts_digest(opts, custom_prop, data_filepath));
+  h.row_count = row_count;
+  h.value_count = value_count;
+  for (size_t i = 0; i < value_count; i++)
+    h.values_len += value_lens[i];
+  zsv_column_cache cc = zsv_column_cache_new_from(&h, values, value_lens, row_values, row_offsets, row_lens);
+  if (!cc)
+    return zsv_column_cache_status_memory;
+  enum zsv_column_cache_status stat = zsv_column_cache_write(cc, data_filepath);
+  zsv_column_cache_close(cc);
+  return stat;
+}
+
+struct zsv_column_cache_builder {
+  zsv_parser parser;
+  size_t col;
+  char header_done;
+  char finishing; // rows are being reported by zsv_finish()
+
+  zsv_hash_set values; // distinct values, numbered in order of first appearance
+  size_t values_len;
+
+  // rows
+  uint32_t *row_values;
+  uint64_t *row_offsets;
+  uint32_t *row_lens;
+  uint64_t row_count;
+  uint64_t rows_capacity;
+
+  int (*on_progress)(void *ctx, uint64_t bytes_read);
+  void *progress_ctx;
+  enum zsv_column_cache_status stat;
+};
+
+// return the number of the given value, adding it if new, or UINT32_MAX on error
+static uint32_t zsv_column_cache_builder_value(struct zsv_column_cache_builder *b, const unsigned char *s,
+                                               size_t len) {
+  char added = 0;
+  size_t ix = zsv_hash_set_add(b->values, zsv_hash(s, len), s, len, &added);
+  if (ix == ZSV_HASH_SET_NONE) {
+    b->stat = zsv_hash_set_count(b->values) >= UINT32_MAX - 1 ? zsv_column_cache_status_too_many_values
+                                                                : zsv_column_cache_status_memory;
+    return UINT32_MAX;
+  }
+  if (added)
+    b->values_len += len;
+  return (uint32_t)ix;
+}
+
+static void zsv_column_cache_build_row(void *ctx) {
+  struct zsv_column_cache_builder *b = ctx;
+  if (!b->header_done) {
+    b->header_done = 1;
+    return;
+  }
+  if (b->row_count == b->rows_capacity) {
+    uint64_t capacity = b->rows_capacity ? b->rows_capacity * 2 : 1024;
+    uint32_t *row_values = realloc(b->row_values, capacity * sizeof(*row_values));
+    if (row_values)
+      b->row_values = row_values;
+    uint64_t *row_offsets = realloc(b->row_offsets, capacity * sizeof(*row_offsets));
+    if (row_offsets)
+      b->row_offsets = row_offsets;
+    uint32_t *row_lens = realloc(b->row_lens, capacity * sizeof(*row_lens));
+    if (row_lens)
+      b->row_lens = row_lens;
+    if (!row_values || !row_offsets || !row_lens) {
+      b->stat = zsv_column_cache_status_memory;
+      zsv_abort(b->parser);
+      return;
+    }
+    b->rows_capacity = capacity;
+  }
+  struct zsv_cell c = b->col < zsv_cell_count(b->parser) ? zsv_get_cell(b->parser, b->col) : (struct zsv_cell){0};
+  uint32_t value = zsv_column_cache_builder_value(b, c.str, c.len);
+  size_t len = zsv_row_length_raw_bytes(b->parser);
+  if (value == UINT32_MAX || len > UINT32_MAX) {
+    if (b->stat == zsv_column_cache_status_ok)
+      b->stat = zsv_column_cache_status_error;
+    zsv_abort(b->parser);
+    return;
+  }
+  size_t offset = zsv_chunk_row_offset(b->parser, b->finishing);
+  b->row_values[b->row_count] = value;
+  b->row_offsets[b->row_count] = offset;
+  b->row_lens[b->row_count] = (uint32_t)len;
+  if (++b->row_count % ZSV_COLUMN_CACHE_PROGRESS_ROWS == 0 && b->on_progress &&
+      b->on_progress(b->progress_ctx, offset + len)) {
+    b->stat = zsv_column_cache_status_cancelled;
+    zsv_abort(b->parser);
+  }
+}
+
+struct zsv_column_cache_sorted_value {
+  const unsigned char *value;
+  size_t len;
+  uint32_t ix; // number in order of first appearance
+};
+
+static int zsv_column_cache_sorted_value_cmp(const void *x, const void *y) {
+  const struct zsv_column_cache_sorted_value *a = x, *b = y;
+  return zsv_column_cache_cmp(a->value, a->len, b->value, b->len);
+}
+
+// sort the values, renumber the rows' values to match, and create the column cache
+static zsv_column_cache zsv_column_cache_builder_finish(struct zsv_column_cache_builder *b,
+                                                        const struct stat *st, uint64_t options) {
+  size_t n = zsv_hash_set_count(b->values);
+  struct zsv_column_cache_sorted_value *sorted = malloc((n ? n : 1) * sizeof(*sorted));
+  uint32_t *rank = malloc((n ? n : 1) * sizeof(*rank));
+  const unsigned char **values = malloc((n ? n : 1) * sizeof(*values));
+  size_t *value_lens = malloc((n ? n : 1) * sizeof(*value_lens));
+  zsv_column_cache cc = NULL;
+  if (sorted && rank && values && value_lens) {
+    struct zsv_column_cache_header h;
+    zsv_column_cache_header_init(&h, st, b->col, options);
+    h.row_count = b->row_count;
+    h.value_count = n;
+    h.values_len = b->values_len;
+    for (size_t i = 0; i < n; i++) {
+      sorted[i].value = zsv_hash_set_key(b->values, i, &sorted[i].len);
+      sorted[i].ix = (uint32_t)i;
+    }
+    qsort(sorted, n, sizeof(*sorted), zsv_column_cache_sorted_value_cmp);
+    for (size_t i = 0; i < n; i++) {
+      rank[sorted[i].ix] = (uint32_t)i;
+      values[i] = sorted[i].value;
+      value_lens[i] = sorted[i].len;
+    }
+    for (uint64_t i = 0; i < b->row_count; i++)
+      b->row_values[i] = rank[b->row_values[i]];
+    cc = zsv_column_cache_new_from(&h, values, value_lens, b->row_values, b->row_offsets, b->row_lens);
+  }
+  if (!cc)
+    b->stat = zsv_column_cache_status_memory;
+  free(sorted);
+  free(rank);
+  free(values);
+  free(value_lens);
+  return cc;
+}
+
+zsv_column_cache zsv_column_cache_new(const char *data_filepath, const struct zsv_opts *opts,
+                                      struct zsv_prop_handler *custom_prop, size_t col,
+                                      int (*on_progress)(void *ctx, uint64_t bytes_read), void *progress_ctx,
+                                      enum zsv_column_cache_status *statp) {
+  struct stat st;
+  struct zsv_column_cache_builder b = {0};
+  b.col = col;
+  b.on_progress = on_progress;
+  b.progress_ctx = progress_ctx;
+  b.stat = zsv_column_cache_status_error;
+  struct zsv_opts o = *opts;
+  if (!(b.values = zsv_hash_set_new(0))) {
+    *statp = zsv_column_cache_status_memory;
+    return NULL;
+  }
+  if (stat(data_filepath, &st) || !(o.stream = fopen(data_filepath, "rb"))) {
+    zsv_hash_set_delete(b.values);
+    *statp = zsv_column_cache_status_error;
+    return NULL;
+  }
+  o.row_handler = zsv_column_cache_build_row;
+  o.ctx = &b;
+  if (zsv_new_with_properties(&o, custom_prop, data_filepath, &b.parser) == zsv_status_ok) {
+    b.stat = zsv_column_cache_status_ok;
+    enum zsv_status zst;
+    while ((zst = zsv_parse_more(b.parser)) == zsv_status_ok)
+      ;
+    if (b.stat == zsv_column_cache_status_ok) {
+      if (zst == zsv_status_no_more_input) {
+        b.finishing = 1;
+        zsv_finish(b.parser);
+      } else
+        b.stat = zsv_column_cache_status_error;
+    }
+    zsv_delete(b.parser);
+  }
+  fclose(o.stream);
+
+  zsv_column_cache cc = NULL;
+  if (b.stat == zsv_column_cache_status_ok)
+    cc = zsv_column_cache_builder_finish(&b, &st, zsv_opts_digest(opts, custom_prop, data_filepath));
+  zsv_hash_set_delete(b.values);
+  free(b.row_values);
+  free(b.row_offsets);
+  free(b.row_lens);
+  *statp = b.stat;
+  return cc;
+}
+
+enum zsv_column_cache_status zsv_column_cache_build(const char *data_filepath, const struct zsv_opts *opts,
+                                                    struct zsv_prop_handler *custom_prop, size_t col,
+                                                    int (*on_progress)(void *ctx, uint64_t bytes_read),
+                                                    void *progress_ctx) {
+  enum zsv_column_cache_status stat;
+  zsv_column_cache cc = zsv_column_cache_new(data_filepath, opts, custom_prop, col, on_progress, progress_ctx, &stat);
+  if (cc) {
+    stat = zsv_column_cache_write(cc, data_filepath);
+    zsv_column_cache_close(cc);
+  }
+  return stat;
+}
+
+zsv_column_cache zsv_column_cache_open(const char *data_filepath, const struct zsv_opts *opts,
+                                       struct zsv_prop_handler *custom_prop, size_t col) {
+  struct stat st;
+  char *fn = stat(data_filepath, &st) ? NULL : zsv_column_cache_filepath(data_filepath, col, 0);
+  FILE *f = fn ? fopen(fn, "rb") : NULL;
+  free(fn);
+  if (!f)
+    return NULL;
+
+  struct zsv_column_cache *cc = calloc(1, sizeof(*cc));
+  struct zsv_column_cache_header *h = cc ? &cc->header : NULL;
+  zsv_file_pos end;
+  if (!cc || fread(h, sizeof(*h), 1, f) != 1 || memcmp(h->magic, ZSV_COLUMN_CACHE_MAGIC, sizeof(h->magic)) ||
+      h->byte_order != ZSV_COLUMN_CACHE_BYTE_ORDER || h->col != col || h->data_size != (int64_t)st.st_size ||
+      h->data_mtime != (int64_t)st.st_mtime || h->options != zsv_opts_digest(opts, custom_prop, data_filepath) ||
+      h->value_count >= UINT32_MAX || fseeko(f, 0, SEEK_END) ||
+      (end = ftello(f)) < 0)
+    goto fail;
+
+  // check that the file size matches the header before loading it
+  uint64_t offsets_len, values_len, row_values_len, data_len;
+  zsv_column_cache_layout(h, &offsets_len, &values_len, &row_values_len, &data_len);
+  if ((uint64_t)end != sizeof(*h) + data_len || data_len > SIZE_MAX || !(cc->data = malloc((size_t)data_len)) ||
+      fseeko(f, (zsv_file_pos)sizeof(*h), SEEK_SET) || fread(cc->data, 1, (size_t)data_len, f) != (size_t)data_len)
+    goto fail;
+  fclose(f);
+
+  zsv_column_cache_set_arrays(cc);
+  if (cc->value_offsets[h->value_count] != h->values_len) {
+    zsv_column_cache_close(cc);
+    return NULL;
+  }
+  return cc;
+
+fail:
+  fclose(f);
+  zsv_column_cache_close(cc);
+  return NULL;
+}
+
+uint64_t zsv_column_cache_row_count(zsv_column_cache cc) {
+  return cc->header.row_count;
+}
+
+size_t zsv_column_cache_value_count(zsv_column_cache cc) {
+  return (size_t)cc->header.value_count;
+}
+
+const unsigned char *zsv_column_cache_value(zsv_column_cache cc, size_t value_ix, size_t *len) {
+  *len = (size_t)(cc->value_offsets[value_ix + 1] - cc->value_offsets[value_ix]);
+  return cc->values + cc->value_offsets[value_ix];
+}
+
+int64_t zsv_column_cache_find(zsv_column_cache cc, const unsigned char *value, size_t len) {
+  size_t lo = 0, hi = (size_t)cc->header.value_count;
+  while (lo < hi) {
+    size_t mid = lo + (hi - lo) / 2;
+    size_t mid_len;
+    const unsigned char *mid_value = zsv_column_cache_value(cc, mid, &mid_len);
+    int c = zsv_column_cache_cmp(mid_value, mid_len, value, len);
+    if (c == 0)
+      return (int64_t)mid;
+    if (c < 0)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+  return -1;
+}
+
+const uint32_t *zsv_column_cache_row_values(zsv_column_cache cc) {
+  return cc->row_values;
+}
+
+void zsv_column_cache_row(zsv_column_cache cc, uint64_t row_ix, uint64_t *offset, uint64_t *len) {
+  *offset = cc->row_offsets[row_ix];
+  *len = cc->row_lens[row_ix];
+}
+
+void zsv_column_cache_close(zsv_column_cache cc) {
+  if (cc) {
+    free(cc->data);
+    free(cc);
+  }
+}
@@ -0,0 +1,109 @@
+#ifndef ZSV_UTILS_COLUMN_CACHE_H
+#define ZSV_UTILS_COLUMN_CACHE_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "zsv/common.h"
+
+/**
+ * Persisted copy of one column of a file, for operations on that column that would
+ * otherwise parse every column of every row
+ *
+ * The column's distinct values are stored once, in ascending (bytewise) order, and each
+ * data row is stored as the number of its value in that order, plus the offset and
+ * length of the row in the file, so that rows selected by their value can be read
+ * directly. It is saved in the file's cache directory (.zsv/data/<file>/col-<N>.zcol,
+ * where N is the 1-based column number) and is only used while the file's size and
+ * modification time, and the options it is parsed with, are unchanged. An open column
+ * cache is held in memory.
+ *
+ * The file is a header followed by the value offsets (value_count + 1 x u64), the values,
+ * the row value numbers (row_count x u32), the row offsets (row_count x u64) and the row
+ * lengths (row_count x u32), each array aligned to 8 bytes
+ */
+
+struct zsv_prop_handler;
+
+enum zsv_column_cache_status {
+  zsv_column_cache_status_ok = 0,
+  zsv_column_cache_status_memory,
+  zsv_column_cache_status_error,
+  zsv_column_cache_status_cancelled,
+  zsv_column_cache_status_too_many_values,
+};
+
+typedef struct zsv_column_cache *zsv_column_cache;
+
+/**
+ * Get the path of the cache of the given (0-based) column. Caller must free
+ */
+char *zsv_column_cache_filepath(const char *data_filepath, size_t col, char temp_file);
+
+/**
+ * Build and save the cache of the given (0-based) column, in one pass over the file.
+ * If on_progress is not NULL, it is called as the file is read with the number of bytes
+ * read so far, and the build is cancelled if it returns non-zero
+ */
+enum zsv_column_cache_status zsv_column_cache_build(const char *data_filepath, const struct zsv_opts *opts,
+                                                    struct zsv_prop_handler *custom_prop, size_t col,
+                                                    int (*on_progress)(void *ctx, uint64_t bytes_read),
+                                                    void *progress_ctx);
+
+/**
+ * Read the given (0-based) column into a column cache held only in memory, as
+ * zsv_column_cache_build() does without saving it. Returns NULL on error, and sets *statp
+ */
+zsv_column_cache zsv_column_cache_new(const char *data_filepath, const struct zsv_opts *opts,
+                                      struct zsv_prop_handler *custom_prop, size_t col,
+                                      int (*on_progress)(void *ctx, uint64_t bytes_read), void *progress_ctx,
+                                      enum zsv_column_cache_status *statp);
+
+/**
+ * Save the cache of the given (0-based) column from values already collected: the
+ * distinct values in ascending bytewise order, and for each data row the number of its
+ * value, and its offset and length in the file
+ */
+enum zsv_column_cache_status zsv_column_cache_save(const char *data_filepath, const struct zsv_opts *opts,
+                                                   struct zsv_prop_handler *custom_prop, size_t col,
+                                                   size_t value_count, const unsigned char *const *values,
+                                                   const size_t *value_lens, uint64_t row_count,
+                                                   const uint32_t *row_values, const uint64_t *row_offsets,
+                                                   const uint32_t *row_lens);
+
+/**
+ * Load the cache of the given (0-based) column. Returns NULL if there is no cache, or
+ * if the file or the options it is parsed with (see zsv_opts_digest()) have changed
+ * since it was built
+ */
+zsv_column_cache zsv_column_cache_open(const char *data_filepath, const struct zsv_opts *opts,
+                                       struct zsv_prop_handler *custom_prop, size_t col);
+
+uint64_t zsv_column_cache_row_count(zsv_column_cache cc);
+
+size_t zsv_column_cache_value_count(zsv_column_cache cc);
+
+/**
+ * Get the value with the given number, in ascending order
+ */
+const unsigned char *zsv_column_cache_value(zsv_column_cache cc, size_t value_ix, size_t *len);
+
+/**
+ * Get the number of the given value, or -1 if no row has it
+ */
+int64_t zsv_column_cache_find(zsv_column_cache cc, const unsigned char *value, size_t len);
+
+/**
+ * Get the value number of each data row (row_count entries)
+ */
+const uint32_t *zsv_column_cache_row_values(zsv_column_cache cc);
+
+/**
+ * Get the offset of the given (0-based) data row's first byte in the file, and its length
+ * excluding its line end
+ */
+void zsv_column_cache_row(zsv_column_cache cc, uint64_t row_ix, uint64_t *offset, uint64_t *len);
+
+void zsv_column_cache_close(zsv_column_cache cc);
+
+#endif
@@ -0,0 +1,225 @@
+// /src/app/utils/hash.c: implements /src/app/utils/hash.h
+
+#include <stdlib.h>
+#include <string.h>
+#include "hash.h"
+
+static inline uint64_t zsv_hash_rotl64(uint64_t x, int r) {
+  return (x << r) | (x >> (64 - r));
+}
+
+void zsv_hash128(const void *data, size_t len, uint64_t h[2]) {
+  const unsigned char *s = data;
+  const uint64_t c1 = 0x87c37b91114253d5ULL, c2 = 0x4cf5ad432745937fULL;
+  uint64_t h1 = 0, h2 = 0, k1, k2;
+  size_t nblocks = len / 16;
+  for (size_t i = 0; i < nblocks; i++) {
+    memcpy(&k1, s + i * 16, sizeof(k1));
+    memcpy(&k2, s + i * 16 + 8, sizeof(k2));
+    k1 *= c1, k1 = zsv_hash_rotl64(k1, 31), k1 *= c2, h1 ^= k1;
+    h1 = zsv_hash_rotl64(h1, 27), h1 += h2, h1 = h1 * 5 + 0x52dce729;
+    k2 *= c2, k2 = zsv_hash_rotl64(k2, 33), k2 *= c1, h2 ^= k2;
+    h2 = zsv_hash_rotl64(h2, 31), h2 += h1, h2 = h2 * 5 + 0x38495ab5;
+  }
+
+  const unsigned char *tail = s + nblocks * 16;
+  size_t rem = len & 15;
+  k1 = k2 = 0;
+  for (size_t i = rem; i > 8; i--)
+    k2 ^= (uint64_t)tail[i - 1] << ((i - 9) * 8);
+  for (size_t i = rem < 8 ? rem : 8; i > 0; i--)
+    k1 ^= (uint64_t)tail[i - 1] << ((i - 1) * 8);
+  if (rem > 8)
+    k2 *= c2, k2 = zsv_hash_rotl64(k2, 33), k2 *= c1, h2 ^= k2;
+  if (rem)
+    k1 *= c1, k1 = zsv_hash_rotl64(k1, 31), k1 *= c2, h1 ^= k1;
+
+  h1 ^= (uint64_t)len, h2 ^= (uint64_t)len;
+  h1 += h2, h2 += h1;
+  h1 = zsv_hash_mix(h1), h2 = zsv_hash_mix(h2);
+  h1 += h2, h2 += h1;
+  h[0] = h1;
+  h[1] = h2;
+}
+
+uint64_t zsv_hash(const void *s, size_t len) {
+  uint64_t h[2];
+  zsv_hash128(s, len, h);
+  return h[0];
+}
+
+/* set of interned keys */
+
+#define ZSV_HASH_SET_BLOCK_MIN 4096
+#define ZSV_HASH_SET_BLOCK_MAX (1024 * 1024)
+
+struct zsv_hash_set_block {
+  struct zsv_hash_set_block *next;
+  size_t size;
+  size_t used;
+  unsigned char data[];
+};
+
+struct zsv_hash_set_entry {
+  uint64_t hash;
+  const unsigned char *key; // in the arena
+  size_t len;
+};
+
+struct zsv_hash_set {
+  uint32_t *slots;     // 1 + number of the key in each slot, or 0 if empty
+  size_t slot_count;   // power of 2
+  struct zsv_hash_set_entry *entries;
+  unsigned char *values;
+  size_t count;
+  size_t capacity;     // of entries and values
+  size_t value_size;
+  struct zsv_hash_set_block *blocks;
+  size_t bytes;
+};
+
+zsv_hash_set zsv_hash_set_new(size_t value_size) {
+  struct zsv_hash_set *s = calloc(1, sizeof(*s));
+  if (s) {
+    s->value_size = value_size;
+    s->bytes = sizeof(*s);
+  }
+  return s;
+}
+
+void zsv_hash_set_delete(zsv_hash_set s) {
+  if (s) {
+    for (struct zsv_hash_set_block *next, *b = s->blocks; b; b = next) {
+      next = b->next;
+      free(b);
+    }
+    free(s->slots);
+    free(s->entries);
+    free(s->values);
+    free(s);
+  }
+}
+
+void *zsv_hash_set_alloc(zsv_hash_set s, size_t n) {
+  struct zsv_hash_set_block *b = s->blocks;
+  n = (n + sizeof(void *) - 1) & ~(sizeof(void *) - 1); // keep allocations aligned
+  if (!b || b->size - b->used < n) {
+    // blocks grow with the set, so that many small sets stay small
+    size_t size = b ? b->size * 2 : ZSV_HASH_SET_BLOCK_MIN;
+    if (size > ZSV_HASH_SET_BLOCK_MAX)
+      size = ZSV_HASH_SET_BLOCK_MAX;
+    if (size < n)
+      size = n;
+    if (!(b = malloc(sizeof(*b) + size)))
+      return NULL;
+    b->size = size;
+    b->used = 0;
+    b->next = s->blocks;
+    s->blocks = b;
+    s->bytes += sizeof(*b) + size;
+  }
+  void *p = b->data + b->used;
+  b->used += n;
+  return p;
+}
+
+// return the slot holding the given key, or the empty slot where it belongs
+static uint32_t *zsv_hash_set_slot(const struct zsv_hash_set *s, uint64_t hash, const void *key, size_t len) {
+  size_t mask = s->slot_count - 1;
+  for (size_t i = hash & mask;; i = (i + 1) & mask) {
+    uint32_t *slot = &s->slots[i];
+    if (!*slot)
+      return slot;
+    const struct zsv_hash_set_entry *e = &s->entries[*slot - 1];
+    if (e->hash == hash && e->len == len && (!len || !memcmp(e->key, key, len)))
+      return slot;
+  }
+}
+
+static int zsv_hash_set_grow(struct zsv_hash_set *s) {
+  if ((s->count + 1) * 2 > s->slot_count) {
+    size_t slot_count = s->slot_count ? s->slot_count * 2 : 16;
+    uint32_t *slots = calloc(slot_count, sizeof(*slots));
+    if (!slots)
+      return 1;
+    for (size_t i = 0; i < s->count; i++) {
+      size_t j = s->entries[i].hash & (slot_count - 1);
+      while (slots[j])
+        j = (j + 1) & (slot_count - 1);
+      slots[j] = (uint32_t)(i + 1);
+    }
+    free(s->slots);
+    s->bytes += (slot_count - s->slot_count) * sizeof(*slots);
+    s->slots = slots;
+    s->slot_count = slot_count;
+  }
+  if (s->count == s->capacity) {
+    size_t capacity = s->capacity ? s->capacity * 2 : 8;
+    struct zsv_hash_set_entry *entries = realloc(s->entries, capacity * sizeof(*entries));
+    if (!entries)
+      return 1;
+    s->entries = entries;
+    if (s->value_size) {
+      unsigned char *values = realloc(s->values, capacity * s->value_size);
+      if (!values)
+        return 1;
+      s->values = values;
+    }
+    s->bytes += (capacity - s->capacity) * (sizeof(*entries) + s->value_size);
+    s->capacity = capacity;
+  }
+  return 0;
+}
+
+size_t zsv_hash_set_find(zsv_hash_set s, uint64_t hash, const void *key, size_t len) {
+  if (!s->count)
+    return ZSV_HASH_SET_NONE;
+  uint32_t *slot = zsv_hash_set_slot(s, hash, key, len);
+  return *slot ? *slot - 1 : ZSV_HASH_SET_NONE;
+}
+
+size_t zsv_hash_set_add(zsv_hash_set s, uint64_t hash, const void *key, size_t len, char *added) {
+  if (s->count) {
+    uint32_t *slot = zsv_hash_set_slot(s, hash, key, len);
+    if (*slot)
+      return *slot - 1;
+  }
+  if (s->count >= UINT32_MAX - 1 || zsv_hash_set_grow(s))
+    return ZSV_HASH_SET_NONE;
+  unsigned char *k = len ? zsv_hash_set_alloc(s, len) : NULL;
+  if (len && !k)
+    return ZSV_HASH_SET_NONE;
+  if (len)
+    memcpy(k, key, len);
+  struct zsv_hash_set_entry *e = &s->entries[s->count];
+  e->hash = hash;
+  e->key = k ? k : (const unsigned char *)"";
+  e->len = len;
+  if (s->value_size)
+    memset(s->values + s->count * s->value_size, 0, s->value_size);
+  *zsv_hash_set_slot(s, hash, key, len) = (uint32_t)++s->count;
+  if (added)
+    *added = 1;
+  return s->count - 1;
+}
+
+size_t zsv_hash_set_count(zsv_hash_set s) {
+  return s->count;
+}
+
+const unsigned char *zsv_hash_set_key(zsv_hash_set s, size_t ix, size_t *len) {
+  *len = s->entries[ix].len;
+  return s->entries[ix].key;
+}
+
+uint64_t zsv_hash_set_hash(zsv_hash_set s, size_t ix) {
+  return s->entries[ix].hash;
+}
+
+void *zsv_hash_set_value(zsv_hash_set s, size_t ix) {
+  return s->values + ix * s->value_size;
+}
+
+size_t zsv_hash_set_bytes(zsv_hash_set s) {
+  return s->bytes;
+}
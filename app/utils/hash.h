@@ -0,0 +1,76 @@
+#ifndef ZSV_UTILS_HASH_H
+#define ZSV_UTILS_HASH_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * Hashing of keys and values, shared by all commands so that each uses the same,
+ * well-mixed hash: MurmurHash3 x64_128 (which is in the public domain)
+ */
+
+/**
+ * 128-bit hash of the given bytes, for keys that are identified by their hash alone
+ */
+void zsv_hash128(const void *s, size_t len, uint64_t h[2]);
+
+/**
+ * 64-bit hash of the given bytes (the first half of their 128-bit hash)
+ */
+uint64_t zsv_hash(const void *s, size_t len);
+
+/**
+ * Mix the bits of a 64-bit value, e.g. to combine hashes
+ */
+static inline uint64_t zsv_hash_mix(uint64_t k) {
+  k ^= k >> 33;
+  k *= 0xff51afd7ed558ccdULL;
+  k ^= k >> 33;
+  k *= 0xc4ceb9fe1a85ec53ULL;
+  k ^= k >> 33;
+  return k;
+}
+
+/**
+ * Set of interned keys: an open-addressing hash table whose keys are copied once into an
+ * arena. Keys are numbered from 0 in the order in which they are added, and each has a
+ * value of the set's value_size bytes, zero-filled when its key is added, for the caller's
+ * data about it. Keys stay in place until the set is deleted, but values may move when a
+ * key is added. A set holds at most UINT32_MAX - 1 keys
+ */
+typedef struct zsv_hash_set *zsv_hash_set;
+
+#define ZSV_HASH_SET_NONE SIZE_MAX
+
+zsv_hash_set zsv_hash_set_new(size_t value_size);
+void zsv_hash_set_delete(zsv_hash_set s);
+
+/**
+ * Get the number of the given key, or ZSV_HASH_SET_NONE if it is not in the set. hash is
+ * the key's zsv_hash()
+ */
+size_t zsv_hash_set_find(zsv_hash_set s, uint64_t hash, const void *key, size_t len);
+
+/**
+ * Get the number of the given key, adding it if it is new, in which case *added (if not
+ * NULL) is set to 1. Returns ZSV_HASH_SET_NONE if out of memory or if the set is full
+ */
+size_t zsv_hash_set_add(zsv_hash_set s, uint64_t hash, const void *key, size_t len, char *added);
+
+size_t zsv_hash_set_count(zsv_hash_set s);
+const unsigned char *zsv_hash_set_key(zsv_hash_set s, size_t ix, size_t *len);
+uint64_t zsv_hash_set_hash(zsv_hash_set s, size_t ix);
+void *zsv_hash_set_value(zsv_hash_set s, size_t ix);
+
+/**
+ * Allocate memory in the set's arena, e.g. for data that a value refers to. It is freed
+ * when the set is deleted. Returns NULL if out of memory
+ */
+void *zsv_hash_set_alloc(zsv_hash_set s, size_t n);
+
+/**
+ * Bytes of memory that the set uses
+ */
+size_t zsv_hash_set_bytes(zsv_hash_set s);
+
+#endif
@@ -0,0 +1,403 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h> // unlink
+#include <zsv.h>
+#include <zsv/utils/prop.h>
+#include <zsv/utils/cache.h>
+#include <zsv/utils/dirs.h>
+#include <zsv/utils/os.h>
+#include <zsv/utils/string.h>
+#include "chunk.h" // zsv_file_pos
+#include "column.h"
+#include "key_index.h"
+#include "sort.h"
+
+#define ZSV_KEY_INDEX_MAGIC "ZSVKIX01"
+#define ZSV_KEY_INDEX_BYTE_ORDER 0x01020304
+
+struct zsv_key_index_header {
+  char magic[8];
+  uint32_t byte_order;
+  uint32_t col;
+  int64_t data_size;
+  int64_t data_mtime;
+  uint64_t row_count;
+  uint64_t block_count;
+  uint64_t fence_offset;
+};
+
+struct zsv_key_index {
+  FILE *f;
+  struct zsv_key_index_header header;
+  unsigned char *fences; // [u64 offset][u32 key length][key] per block
+  uint64_t *block_offsets;
+  const unsigned char **first_keys;
+  uint32_t *first_key_lens;
+  unsigned char *block;
+  size_t block_capacity;
+};
+
+static int zsv_key_index_cmp(const unsigned char *a, size_t alen, const unsigned char *b, size_t blen) {
+  int c = memcmp(a, b, alen < blen ? alen : blen);
+  return c ? c : alen < blen ? -1 : alen > blen;
+}
+
+static inline uint32_t zsv_key_index_u32(const unsigned char *s) {
+  uint32_t u;
+  memcpy(&u, s, sizeof(u));
+  return u;
+}
+
+static inline uint64_t zsv_key_index_u64(const unsigned char *s) {
+  uint64_t u;
+  memcpy(&u, s, sizeof(u));
+  return u;
+}
+
+char *zsv_key_index_filepath(const char *data_filepath, size_t col, char temp_file) {
+  char name[64];
+  snprintf(name, sizeof(name), "key-%zu.zidx", col + 1);
+  return (char *)zsv_cache_path((const unsigned char *)data_filepath, (const unsigned char *)name, temp_file);
+}
+
+struct zsv_key_index_column_ctx {
+  zsv_parser parser;
+  const char *name;
+  size_t col;
+  char found;
+};
+
+static void zsv_key_index_column_header(void *ctx) {
+  struct zsv_key_index_column_ctx *c = ctx;
+  c->found = !zsv_find_column(c->parser, c->name, &c->col);
+  zsv_abort(c->parser);
+}
+
+enum zsv_key_index_status zsv_key_index_column(const char *data_filepath, const struct zsv_opts *opts,
+                                               struct zsv_prop_handler *custom_prop, const char *name, size_t *col) {
+  struct zsv_key_index_column_ctx c = {0};
+  c.name = name;
+  struct zsv_opts o = *opts;
+  if (!(o.stream = fopen(data_filepath, "rb")))
+    return zsv_key_index_status_error;
+  o.row_handler = zsv_key_index_column_header;
+  o.ctx = &c;
+  enum zsv_key_index_status stat = zsv_key_index_status_error;
+  if (zsv_new_with_properties(&o, custom_prop, data_filepath, &c.parser) == zsv_status_ok) {
+    while (zsv_parse_more(c.parser) == zsv_status_ok)
+      ;
+    zsv_delete(c.parser);
+    stat = c.found ? zsv_key_index_status_ok : zsv_key_index_status_no_column;
+  }
+  fclose(o.stream);
+  *col = c.col;
+  return stat;
+}
+
+struct zsv_key_index_builder {
+  zsv_parser parser;
+  zsv_sorter sorter; // entries, in the format in which they are written, sorted by key and row
+  size_t col;
+  char header_done;
+  char finishing; // rows are being reported by zsv_finish()
+  unsigned char *entry;
+  size_t entry_capacity;
+  uint64_t count;
+  enum zsv_key_index_status stat;
+};
+
+static void zsv_key_index_build_row(void *ctx) {
+  struct zsv_key_index_builder *b = ctx;
+  if (!b->header_done) {
+    b->header_done = 1;
+    return;
+  }
+  struct zsv_cell c = b->col < zsv_cell_count(b->parser) ? zsv_get_cell(b->parser, b->col) : (struct zsv_cell){0};
+  size_t entry_len = sizeof(uint32_t) + c.len + 3 * sizeof(uint64_t);
+  if (entry_len > b->entry_capacity) {
+    unsigned char *tmp = realloc(b->entry, entry_len);
+    if (!tmp) {
+      b->stat = zsv_key_index_status_memory;
+      zsv_abort(b->parser);
+      return;
+    }
+    b->entry = tmp;
+    b->entry_capacity = entry_len;
+  }
+
+  uint32_t key_len = (uint32_t)c.len;
+  uint64_t row = ++b->count;
+  uint64_t len = zsv_row_length_raw_bytes(b->parser);
+  uint64_t offset = zsv_chunk_row_offset(b->parser, b->finishing);
+  unsigned char *p = b->entry;
+  memcpy(p, &key_len, sizeof(key_len));
+  p += sizeof(key_len);
+  if (c.len)
+    memcpy(p, c.str, c.len);
+  p += c.len;
+  memcpy(p, &row, sizeof(row));
+  memcpy(p + sizeof(row), &offset, sizeof(offset));
+  memcpy(p + sizeof(row) + sizeof(offset), &len, sizeof(len));
+
+  enum zsv_sort_status stat = zsv_sorter_add_data(b->sorter, b->parser, b->entry, entry_len);
+  if (stat != zsv_sort_status_ok) {
+    b->stat = stat == zsv_sort_status_memory ? zsv_key_index_status_memory : zsv_key_index_status_error;
+    zsv_abort(b->parser);
+  }
+}
+
+// write the sorted entries in blocks, followed by the fence pointers
+static int zsv_key_index_write(FILE *f, struct zsv_key_index_header *h, zsv_sorter sorter) {
+  // fences are collected as [u64 offset][u32 key length][key]
+  unsigned char *fences = NULL;
+  size_t fences_len = 0, fences_capacity = 0;
+  uint64_t pos = sizeof(*h);
+  uint64_t block_len = 0;
+  int err = fwrite(h, sizeof(*h), 1, f) != 1;
+  const unsigned char *entry;
+  size_t entry_len;
+  int rc = 0;
+  for (uint64_t i = 0; !err && (rc = zsv_sorter_next_data(sorter, &entry, &entry_len)) > 0; i++) {
+    uint32_t key_len = zsv_key_index_u32(entry);
+    if (i == 0 || block_len + entry_len > ZSV_KEY_INDEX_BLOCK_SIZE) {
+      size_t fence_len = sizeof(uint64_t) + sizeof(uint32_t) + key_len;
+      if (fences_len + fence_len > fences_capacity) {
+        size_t capacity = fences_capacity ? fences_capacity * 2 : 4096;
+        while (capacity < fences_len + fence_len)
+          capacity *= 2;
+        unsigned char *tmp = realloc(fences, capacity);
+        if (!tmp) {
+          err = 1;
+          break;
+        }
+        fences = tmp;
+        fences_capacity = capacity;
+      }
+      memcpy(fences + fences_len, &pos, sizeof(pos));
+      memcpy(fences + fences_len + sizeof(pos), entry, sizeof(uint32_t) + key_len);
+      fences_len += fence_len;
+      h->block_count++;
+      block_len = 0;
+    }
+    err = fwrite(entry, entry_len, 1, f) != 1;
+    block_len += entry_len;
+    pos += entry_len;
+  }
+  if (rc < 0)
+    err = 1;
+  h->fence_offset = pos;
+  if (!err && fences_len && fwrite(fences, fences_len, 1, f) != 1)
+    err = 1;
+  free(fences);
+  // rewrite the header with the block count and fence offset
+  if (!err && (fseeko(f, 0, SEEK_SET) || fwrite(h, sizeof(*h), 1, f) != 1))
+    err = 1;
+  return err;
+}
+
+enum zsv_key_index_status zsv_key_index_build(const char *data_filepath, const struct zsv_opts *opts,
+                                              struct zsv_prop_handler *custom_prop, size_t col,
+                                              uint64_t *row_count_out) {
+  struct stat st;
+  if (stat(data_filepath, &st))
+    return zsv_key_index_status_error;
+
+  // keys are compared as bytes, and rows with the same key are kept in row order
+  struct zsv_sort_key key = {.col = col};
+  struct zsv_sort_opts sort_opts = {.keys = &key, .key_count = 1, .max_memory = (size_t)ZSV_KEY_INDEX_MAX_MEMORY_MB * 1024 * 1024};
+  struct zsv_key_index_builder b = {0};
+  b.col = col;
+  b.stat = zsv_key_index_status_error;
+  if (!(b.sorter = zsv_sorter_new(&sort_opts)))
+    return zsv_key_index_status_memory;
+  struct zsv_opts o = *opts;
+  if (!(o.stream = fopen(data_filepath, "rb"))) {
+    zsv_sorter_delete(b.sorter);
+    return zsv_key_index_status_error;
+  }
+  o.row_handler = zsv_key_index_build_row;
+  o.ctx = &b;
+  if (zsv_new_with_properties(&o, custom_prop, data_filepath, &b.parser) == zsv_status_ok) {
+    b.stat = zsv_key_index_status_ok;
+    enum zsv_status zst;
+    while ((zst = zsv_parse_more(b.parser)) == zsv_status_ok)
+      ;
+    if (b.stat == zsv_key_index_status_ok) {
+      if (zst == zsv_status_no_more_input) {
+        b.finishing = 1;
+        zsv_finish(b.parser);
+      } else
+        b.stat = zsv_key_index_status_error;
+    }
+    zsv_delete(b.parser);
+  }
+  fclose(o.stream);
+  free(b.entry);
+
+  if (b.stat == zsv_key_index_status_ok) {
+    enum zsv_sort_status sstat = zsv_sorter_finish(b.sorter);
+    if (sstat != zsv_sort_status_ok)
+      b.stat = sstat == zsv_sort_status_memory ? zsv_key_index_status_memory : zsv_key_index_status_error;
+  }
+  if (b.stat == zsv_key_index_status_ok) {
+    char *fn = zsv_key_index_filepath(data_filepath, col, 0);
+    char *fn_tmp = zsv_key_index_filepath(data_filepath, col, 1);
+    FILE *f = NULL;
+    b.stat = zsv_key_index_status_error;
+    if (fn && fn_tmp && !zsv_mkdirs(fn_tmp, 1) && (f = fopen(fn_tmp, "w+b"))) {
+      struct zsv_key_index_header h = {0};
+      memcpy(h.magic, ZSV_KEY_INDEX_MAGIC, sizeof(h.magic));
+      h.byte_order = ZSV_KEY_INDEX_BYTE_ORDER;
+      h.col = (uint32_t)col;
+      h.data_size = (int64_t)st.st_size;
+      h.data_mtime = (int64_t)st.st_mtime;
+      h.row_count = b.count;
+      int err = zsv_key_index_write(f, &h, b.sorter);
+      if (fclose(f) || err || zsv_replace_file(fn_tmp, fn))
+        unlink(fn_tmp);
+      else {
+        b.stat = zsv_key_index_status_ok;
+        if (row_count_out)
+          *row_count_out = b.count;
+      }
+    } else if (fn_tmp)
+      perror(fn_tmp);
+    free(fn);
+    free(fn_tmp);
+  }
+  zsv_sorter_delete(b.sorter);
+  return b.stat;
+}
+
+zsv_key_index zsv_key_index_open(const char *data_filepath, size_t col) {
+  struct stat st;
+  char *fn = stat(data_filepath, &st) ? NULL : zsv_key_index_filepath(data_filepath, col, 0);
+  FILE *f = fn ? fopen(fn, "rb") : NULL;
+  free(fn);
+  if (!f)
+    return NULL;
+
+  struct zsv_key_index *ix = calloc(1, sizeof(*ix));
+  struct zsv_key_index_header *h = ix ? &ix->header : NULL;
+  zsv_file_pos end;
+  if (!ix || fread(h, sizeof(*h), 1, f) != 1 || memcmp(h->magic, ZSV_KEY_INDEX_MAGIC, sizeof(h->magic)) ||
+      h->byte_order != ZSV_KEY_INDEX_BYTE_ORDER || h->col != col || h->data_size != (int64_t)st.st_size ||
+      h->data_mtime != (int64_t)st.st_mtime || fseeko(f, 0, SEEK_END) || (end = ftello(f)) < 0 ||
+      (uint64_t)end < h->fence_offset)
+    goto fail;
+
+  // load the fences
+  size_t fences_len = (size_t)((uint64_t)end - h->fence_offset);
+  if (h->block_count) {
+    if (!(ix->fences = malloc(fences_len)) || !(ix->block_offsets = malloc(h->block_count * sizeof(uint64_t))) ||
+        !(ix->first_keys = malloc(h->block_count * sizeof(*ix->first_keys))) ||
+        !(ix->first_key_lens = malloc(h->block_count * sizeof(uint32_t))) ||
+        fseeko(f, (zsv_file_pos)h->fence_offset, SEEK_SET) || fread(ix->fences, 1, fences_len, f) != fences_len)
+      goto fail;
+    const unsigned char *s = ix->fences, *s_end = ix->fences + fences_len;
+    for (uint64_t i = 0; i < h->block_count; i++) {
+      if (s + sizeof(uint64_t) + sizeof(uint32_t) > s_end)
+        goto fail;
+      ix->block_offsets[i] = zsv_key_index_u64(s);
+      ix->first_key_lens[i] = zsv_key_index_u32(s + sizeof(uint64_t));
+      ix->first_keys[i] = s + sizeof(uint64_t) + sizeof(uint32_t);
+      s = ix->first_keys[i] + ix->first_key_lens[i];
+      if (s > s_end)
+        goto fail;
+    }
+  }
+  ix->f = f;
+  return ix;
+
+fail:
+  fclose(f);
+  zsv_key_index_close(ix);
+  return NULL;
+}
+
+enum zsv_key_index_status zsv_key_index_find(zsv_key_index ix, const unsigned char *key, size_t len,
+                                             struct zsv_key_index_match **matches, size_t *count) {
+  *matches = NULL;
+  *count = 0;
+  // the key can first appear in the last block whose first key is less than it
+  uint64_t lo = 0, hi = ix->header.block_count;
+  int c;
+  while (lo < hi) {
+    uint64_t mid = lo + (hi - lo) / 2;
+    if (zsv_key_index_cmp(ix->first_keys[mid], ix->first_key_lens[mid], key, len) < 0)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+  enum zsv_key_index_status stat = zsv_key_index_status_ok;
+  size_t capacity = 0;
+  char done = 0;
+  for (uint64_t i = lo ? lo - 1 : 0; i < ix->header.block_count && !done; i++) {
+    uint64_t block_end = i + 1 < ix->header.block_count ? ix->block_offsets[i + 1] : ix->header.fence_offset;
+    size_t block_len = (size_t)(block_end - ix->block_offsets[i]);
+    if (block_len > ix->block_capacity) {
+      unsigned char *tmp = realloc(ix->block, block_len);
+      if (!tmp) {
+        stat = zsv_key_index_status_memory;
+        break;
+      }
+      ix->block = tmp;
+      ix->block_capacity = block_len;
+    }
+    if (fseeko(ix->f, (zsv_file_pos)ix->block_offsets[i], SEEK_SET) ||
+        fread(ix->block, 1, block_len, ix->f) != block_len) {
+      stat = zsv_key_index_status_error;
+      break;
+    }
+    for (const unsigned char *s = ix->block, *end = ix->block + block_len; s < end && !done;) {
+      uint32_t key_len = zsv_key_index_u32(s);
+      const unsigned char *k = s + sizeof(key_len);
+      if ((s = k + key_len + 3 * sizeof(uint64_t)) > end) {
+        stat = zsv_key_index_status_error;
+        done = 1;
+      } else if ((c = zsv_key_index_cmp(k, key_len, key, len)) > 0)
+        done = 1;
+      else if (c == 0) {
+        if (*count == capacity) {
+          capacity = capacity ? capacity * 2 : 16;
+          struct zsv_key_index_match *tmp = realloc(*matches, capacity * sizeof(*tmp));
+          if (!tmp) {
+            stat = zsv_key_index_status_memory;
+            done = 1;
+            break;
+          }
+          *matches = tmp;
+        }
+        struct zsv_key_index_match *m = &(*matches)[(*count)++];
+        m->row = zsv_key_index_u64(k + key_len);
+        m->offset = zsv_key_index_u64(k + key_len + sizeof(uint64_t));
+        m->len = zsv_key_index_u64(k + key_len + 2 * sizeof(uint64_t));
+      }
+    }
+  }
+  if (stat != zsv_key_index_status_ok) {
+    free(*matches);
+    *matches = NULL;
+    *count = 0;
+  }
+  return stat;
+}
+
+uint64_t zsv_key_index_row_count(zsv_key_index ix) {
+  return ix->header.row_count;
+}
+
+void zsv_key_index_close(zsv_key_index ix) {
+  if (ix) {
+    if (ix->f)
+      fclose(ix->f);
+    free(ix->fences);
+    free(ix->block_offsets);
+    free(ix->first_keys);
+    free(ix->first_key_lens);
+    free(ix->block);
+    free(ix);
+  }
+}
@@ -0,0 +1,87 @@
+#ifndef ZSV_UTILS_KEY_INDEX_H
+#define ZSV_UTILS_KEY_INDEX_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "zsv/common.h"
+
+/**
+ * Persisted index of the values of one column
+ *
+ * The index maps each value of a key column to the rows that contain it, so that rows
+ * can be fetched by value without reading the whole file. It is saved in the file's
+ * cache directory (.zsv/data/<file>/key-<N>.zidx, where N is the 1-based column
+ * number) and is only used while the file's size and modification time are unchanged.
+ *
+ * The index file is a sorted array of entries ([u32 key length][key][u64 row]
+ * [u64 offset][u64 length]) split into blocks of about ZSV_KEY_INDEX_BLOCK_SIZE bytes,
+ * followed by fence pointers: the offset and first key of each block. A lookup loads
+ * the fences, binary-searches them for the first block that can hold the key, and
+ * reads only from there on.
+ */
+
+#define ZSV_KEY_INDEX_BLOCK_SIZE 4096
+
+// memory used to sort the entries while an index is built, beyond which they are spilled to
+// temporary files
+#define ZSV_KEY_INDEX_MAX_MEMORY_MB 256
+
+struct zsv_prop_handler;
+
+enum zsv_key_index_status {
+  zsv_key_index_status_ok = 0,
+  zsv_key_index_status_memory,
+  zsv_key_index_status_error,
+  zsv_key_index_status_no_column,
+};
+
+struct zsv_key_index_match {
+  uint64_t row;    // 1-based data row number
+  uint64_t offset; // offset of the row's first byte in the file
+  uint64_t len;    // length of the row in bytes, excluding its line end
+};
+
+typedef struct zsv_key_index *zsv_key_index;
+
+/**
+ * Get the path of the index of the given (0-based) column. Caller must free
+ */
+char *zsv_key_index_filepath(const char *data_filepath, size_t col, char temp_file);
+
+/**
+ * Get the 0-based column number of a column name (case-insensitive) or of #N (1-based)
+ */
+enum zsv_key_index_status zsv_key_index_column(const char *data_filepath, const struct zsv_opts *opts,
+                                               struct zsv_prop_handler *custom_prop, const char *name, size_t *col);
+
+/**
+ * Build and save the index of the given (0-based) column, in one pass over the file.
+ * The entries are sorted with an external sort (see sort.h) that holds at most
+ * ZSV_KEY_INDEX_MAX_MEMORY_MB in memory
+ */
+enum zsv_key_index_status zsv_key_index_build(const char *data_filepath, const struct zsv_opts *opts,
+                                              struct zsv_prop_handler *custom_prop, size_t col,
+                                              uint64_t *row_count_out);
+
+/**
+ * Open the index of the given (0-based) column. Returns NULL if there is no index, or
+ * if the file has changed since it was built
+ */
+zsv_key_index zsv_key_index_open(const char *data_filepath, size_t col);
+
+/**
+ * Find the rows whose key equals the given value, in row order. On success, *matches
+ * is set to an array of *count matches (or NULL if none), which the caller must free
+ */
+enum zsv_key_index_status zsv_key_index_find(zsv_key_index ix, const unsigned char *key, size_t len,
+                                             struct zsv_key_index_match **matches, size_t *count);
+
+/**
+ * Number of data rows in the file when the index was built
+ */
+uint64_t zsv_key_index_row_count(zsv_key_index ix);
+
+void zsv_key_index_close(zsv_key_index ix);
+
+#endif
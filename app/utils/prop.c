@@ -9,6 +9,7 @@
 #include <zsv/utils/overwrite.h>
 #include <zsv/utils/string.h>
 #include <yajl_helper/yajl_helper.h>
+#include "hash.h"
 
 #ifndef ZSVTLS
 #ifndef NO_THREADING
@@ -141,8 +142,16 @@ enum zsv_status zsv_properties_parser_destroy(struct zsv_properties_parser *pars
  * @param custom_prop_handler (optional) handler for custom properties
  * @return zsv_status_ok on success
  */
+static struct zsv_file_properties zsv_cache_load_props_(const char *data_filepath, struct zsv_opts *opts,
+                                                        struct zsv_prop_handler *custom_prop_handler, char warn);
+
 struct zsv_file_properties zsv_cache_load_props(const char *data_filepath, struct zsv_opts *opts,
                                                 struct zsv_prop_handler *custom_prop_handler) {
+  return zsv_cache_load_props_(data_filepath, opts, custom_prop_handler, 1);
+}
+
+static struct zsv_file_properties zsv_cache_load_props_(const char *data_filepath, struct zsv_opts *opts,
+                                                        struct zsv_prop_handler *custom_prop_handler, char warn) {
   // we need some memory to save the parsed properties
   // if the caller did not provide that, use our own
   struct zsv_file_properties tmp = {0};
@@ -196,15 +205,17 @@ struct zsv_file_properties zsv_cache_load_props(const char *data_filepath, struc
   if (tmp.stat == zsv_status_ok) {
     // warn if the loaded properties conflict with command-line options
     if (fp->skip_specified) {
-      if (opts && opts->option_overrides.skip_head && opts->rows_to_ignore != fp->skip)
-        fprintf(stderr, "Warning: file property 'skip-head' overridden by command option\n");
-      else if (opts)
+      if (opts && opts->option_overrides.skip_head && opts->rows_to_ignore != fp->skip) {
+        if (warn)
+          fprintf(stderr, "Warning: file property 'skip-head' overridden by command option\n");
+      } else if (opts)
         opts->rows_to_ignore = fp->skip;
     }
     if (fp->header_span_specified) {
-      if (opts && opts->option_overrides.header_row_span && opts->header_span != fp->header_span)
-        fprintf(stderr, "Warning: file property 'header-row-span' overridden by command option\n");
-      else if (opts)
+      if (opts && opts->option_overrides.header_row_span && opts->header_span != fp->header_span) {
+        if (warn)
+          fprintf(stderr, "Warning: file property 'header-row-span' overridden by command option\n");
+      } else if (opts)
         opts->header_span = fp->header_span;
     }
   }
@@ -258,7 +269,7 @@ static int zsv_properties_parse_process_value(yajl_helper_t yh, struct json_valu
  * unless compiled out via ZSV_NO_TAB_AUTO_RECOGNIZE (configure
  * --disable-tab-auto-recognize).
  */
-static char zsv_tab_ext_delim(const char *path) {
+char zsv_tab_ext_delim(const char *path) {
   size_t n = path ? strlen(path) : 0;
   if (n >= 4) {
     const unsigned char *ext = (const unsigned char *)path + (n - 4);
@@ -272,6 +283,43 @@ static char zsv_tab_ext_delim(const char *path) {
   return 0;
 }
 
+/**
+ * zsv_opts_digest(): return a hash of the options that determine how `input_path`
+ * is parsed, after merging its saved properties as zsv_new_with_properties() does,
+ * so that a cache derived from parsing the file can tell if it was built with other
+ * options (e.g. a different delimiter, or skip-head property)
+ */
+uint64_t zsv_opts_digest(const struct zsv_opts *opts, struct zsv_prop_handler *custom_prop_handler,
+                         const char *input_path) {
+  struct zsv_opts o = *opts;
+  if (o.stdin_filename && (!input_path || !strcmp(input_path, "-")))
+    input_path = o.stdin_filename;
+  if (input_path) {
+    // the parse that built the cache has already reported any property conflict
+    zsv_cache_load_props_(input_path, &o, custom_prop_handler, 0);
+    if (o.delimiter == 0)
+      o.delimiter = zsv_tab_ext_delim(input_path);
+  }
+  // hash fixed-width values, so that the digest does not depend on struct layout
+  uint64_t v[] = {
+    (unsigned char)(o.delimiter ? o.delimiter : ','),
+    (unsigned char)o.no_quotes,
+#ifndef ZSV_NO_ONLY_CRLF
+    (unsigned char)o.only_crlf_rowend,
+#else
+    0,
+#endif
+    o.max_columns,
+    o.max_row_size,
+    o.header_span,
+    o.rows_to_ignore,
+    o.keep_empty_header_rows,
+    (unsigned char)o.malformed_utf8_replace,
+    o.insert_header_row ? zsv_hash(o.insert_header_row, strlen(o.insert_header_row)) : 0,
+  };
+  return zsv_hash(v, sizeof(v));
+}
+
 /**
  * zsv_new_with_properties(): use in lieu of zsv_new() to also merge zsv options
  * with any saved properties (such as rows_to_ignore or header_span) for the
@@ -0,0 +1,316 @@
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+#include "sketch.h"
+
+/* HyperLogLog */
+
+int zsv_hll_add(struct zsv_hll *h, uint64_t hash) {
+  if (!h->registers && !(h->registers = calloc(ZSV_HLL_REGISTERS, sizeof(*h->registers))))
+    return 1;
+  size_t ix = (size_t)(hash >> (64 - ZSV_HLL_PRECISION));
+  uint64_t rest = hash << ZSV_HLL_PRECISION;
+  uint8_t rank = 1; // position of the first 1 bit in the rest of the hash
+  while (rank <= 64 - ZSV_HLL_PRECISION && !(rest & 0x8000000000000000ULL)) {
+    rest <<= 1;
+    rank++;
+  }
+  if (rank > h->registers[ix])
+    h->registers[ix] = rank;
+  return 0;
+}
+
+int zsv_hll_merge(struct zsv_hll *h, const struct zsv_hll *other) {
+  if (!other->registers)
+    return 0;
+  if (!h->registers && !(h->registers = calloc(ZSV_HLL_REGISTERS, sizeof(*h->registers))))
+    return 1;
+  for (size_t i = 0; i < ZSV_HLL_REGISTERS; i++)
+    if (other->registers[i] > h->registers[i])
+      h->registers[i] = other->registers[i];
+  return 0;
+}
+
+uint64_t zsv_hll_estimate(const struct zsv_hll *h) {
+  if (!h->registers)
+    return 0;
+  const double m = ZSV_HLL_REGISTERS;
+  double sum = 0;
+  size_t zeros = 0;
+  for (size_t i = 0; i < ZSV_HLL_REGISTERS; i++) {
+    sum += ldexp(1.0, -(int)h->registers[i]);
+    zeros += h->registers[i] == 0;
+  }
+  double estimate = 0.7213 / (1 + 1.079 / m) * m * m / sum;
+  if (estimate <= 2.5 * m && zeros) // few values: count the registers still empty instead
+    estimate = m * log(m / (double)zeros);
+  return (uint64_t)(estimate + 0.5);
+}
+
+void zsv_hll_clear(struct zsv_hll *h) {
+  if (h->registers)
+    memset(h->registers, 0, ZSV_HLL_REGISTERS * sizeof(*h->registers));
+}
+
+void zsv_hll_free(struct zsv_hll *h) {
+  free(h->registers);
+  h->registers = NULL;
+}
+
+/* t-digest */
+
+// zsv_tdigest_sort: sort centroids by mean. This is most of the cost of adding a value, so it is
+// an inline quicksort rather than qsort(), whose comparison callback would take as long as the
+// rest of the sort
+static void zsv_tdigest_sort(struct zsv_tdigest_centroid *c, size_t n) {
+  while (n > 16) {
+    double pivot = c[n / 2].mean;
+    size_t i = 0, j = n - 1;
+    for (;;) {
+      while (c[i].mean < pivot)
+        i++;
+      while (c[j].mean > pivot)
+        j--;
+      if (i >= j)
+        break;
+      struct zsv_tdigest_centroid tmp = c[i];
+      c[i++] = c[j];
+      c[j--] = tmp;
+    }
+    // recurse into the smaller part, and loop on the larger
+    size_t left = j + 1;
+    if (left < n - left) {
+      zsv_tdigest_sort(c, left);
+      c += left;
+      n -= left;
+    } else {
+      zsv_tdigest_sort(c + left, n - left);
+      n = left;
+    }
+  }
+  for (size_t i = 1; i < n; i++) {
+    struct zsv_tdigest_centroid x = c[i];
+    size_t j = i;
+    for (; j > 0 && c[j - 1].mean > x.mean; j--)
+      c[j] = c[j - 1];
+    c[j] = x;
+  }
+}
+
+// zsv_tdigest_k: the scale function, which maps a quantile to the range [-compression / 4,
+// compression / 4]. Each centroid may span at most 1 on this scale, so there are at most
+// about compression / 2 of them, and they are smallest near the extremes, which are then
+// the most accurate
+static double zsv_tdigest_k(double q) {
+  return ZSV_TDIGEST_COMPRESSION / (2 * M_PI) * asin(2 * q - 1);
+}
+
+static double zsv_tdigest_k_inverse(double k) {
+  if (k >= ZSV_TDIGEST_COMPRESSION / 4.0)
+    return 1;
+  return (sin(k * 2 * M_PI / ZSV_TDIGEST_COMPRESSION) + 1) / 2;
+}
+
+// zsv_tdigest_compress: merge adjacent centroids, in order of mean, as long as each stays
+// within 1 on the scale function
+static void zsv_tdigest_compress(struct zsv_tdigest *t) {
+  if (t->count == t->merged || !t->count)
+    return;
+  zsv_tdigest_sort(t->centroids, t->count);
+  size_t out = 0;
+  double before = 0; // weight of the centroids before the current one
+  double limit = t->weight * zsv_tdigest_k_inverse(zsv_tdigest_k(0) + 1);
+  for (size_t i = 1; i < t->count; i++) {
+    struct zsv_tdigest_centroid *cur = &t->centroids[out];
+    const struct zsv_tdigest_centroid *c = &t->centroids[i];
+    if (before + cur->weight + c->weight <= limit) {
+      cur->mean += (c->mean - cur->mean) * c->weight / (cur->weight + c->weight);
+      cur->weight += c->weight;
+    } else {
+      before += cur->weight;
+      limit = t->weight * zsv_tdigest_k_inverse(zsv_tdigest_k(before / t->weight) + 1);
+      t->centroids[++out] = *c;
+    }
+  }
+  t->count = t->merged = out + 1;
+}
+
+// zsv_tdigest_push: add a centroid, to be merged at the next compression
+static int zsv_tdigest_push(struct zsv_tdigest *t, double mean, double weight) {
+  if (!t->centroids && !(t->centroids = malloc(ZSV_TDIGEST_CAPACITY * sizeof(*t->centroids))))
+    return 1;
+  if (!t->count)
+    t->min = t->max = mean;
+  if (t->count == ZSV_TDIGEST_CAPACITY)
+    zsv_tdigest_compress(t);
+  t->centroids[t->count].mean = mean;
+  t->centroids[t->count].weight = weight;
+  t->count++;
+  t->weight += weight;
+  return 0;
+}
+
+int zsv_tdigest_add(struct zsv_tdigest *t, double value) {
+  if (zsv_tdigest_push(t, value, 1))
+    return 1;
+  if (value < t->min)
+    t->min = value;
+  if (value > t->max)
+    t->max = value;
+  return 0;
+}
+
+int zsv_tdigest_merge(struct zsv_tdigest *t, const struct zsv_tdigest *other) {
+  if (!other->count)
+    return 0;
+  char empty = !t->count;
+  for (size_t i = 0; i < other->count; i++)
+    if (zsv_tdigest_push(t, other->centroids[i].mean, other->centroids[i].weight))
+      return 1;
+  if (empty || other->min < t->min)
+    t->min = other->min;
+  if (empty || other->max > t->max)
+    t->max = other->max;
+  return 0;
+}
+
+double zsv_tdigest_quantile(struct zsv_tdigest *t, double q) {
+  zsv_tdigest_compress(t);
+  if (q <= 0 || t->count == 0)
+    return t->min;
+  if (q >= 1)
+    return t->max;
+  if (t->count == 1)
+    return t->centroids[0].mean;
+
+  // each centroid's mean is taken to be at the middle of its weight
+  double target = q * t->weight;
+  const struct zsv_tdigest_centroid *c = t->centroids;
+  if (target < c[0].weight / 2)
+    return t->min + (c[0].mean - t->min) * target / (c[0].weight / 2);
+  double at = c[0].weight / 2;
+  for (size_t i = 1; i < t->count; i++) {
+    double next = at + (c[i - 1].weight + c[i].weight) / 2;
+    if (target < next)
+      return c[i - 1].mean + (c[i].mean - c[i - 1].mean) * (target - at) / (next - at);
+    at = next;
+  }
+  const struct zsv_tdigest_centroid *last = &c[t->count - 1];
+  return last->mean + (t->max - last->mean) * (target - at) / (last->weight / 2);
+}
+
+void zsv_tdigest_clear(struct zsv_tdigest *t) {
+  t->count = t->merged = 0;
+  t->weight = 0;
+}
+
+void zsv_tdigest_free(struct zsv_tdigest *t) {
+  free(t->centroids);
+  memset(t, 0, sizeof(*t));
+}
+
+/* top values */
+
+// zsv_topk_count: add n to the value's counters, and get its estimated count: the lowest
+// of its counters, each of which may also have been added to by other values
+static uint64_t zsv_topk_count(struct zsv_topk *t, uint64_t hash, uint32_t n) {
+  uint64_t estimate = UINT64_MAX;
+  for (size_t d = 0; d < ZSV_TOPK_DEPTH; d++, hash >>= ZSV_TOPK_WIDTH_BITS) { // separate bits for each row
+    uint32_t *counter = &t->counts[d * ZSV_TOPK_WIDTH + (hash & (ZSV_TOPK_WIDTH - 1))];
+    *counter = *counter > UINT32_MAX - n ? UINT32_MAX : *counter + n;
+    if (*counter < estimate)
+      estimate = *counter;
+  }
+  return estimate;
+}
+
+static struct zsv_topk_item *zsv_topk_find(struct zsv_topk *t, const unsigned char *value, size_t len,
+                                           uint64_t hash) {
+  for (size_t i = 0; i < t->item_count; i++)
+    if (t->items[i].hash == hash && t->items[i].len == len && !memcmp(t->items[i].value, value, len))
+      return &t->items[i];
+  return NULL;
+}
+
+// zsv_topk_offer: keep the value as an item if its count is among the highest
+static void zsv_topk_offer(struct zsv_topk *t, const unsigned char *value, size_t len, uint64_t hash,
+                           uint64_t count) {
+  struct zsv_topk_item *item = zsv_topk_find(t, value, len, hash);
+  if (item) {
+    item->count = count;
+    return;
+  }
+  if (t->item_count < ZSV_TOPK_K)
+    item = &t->items[t->item_count++];
+  else {
+    item = &t->items[0];
+    for (size_t i = 1; i < ZSV_TOPK_K; i++)
+      if (t->items[i].count < item->count)
+        item = &t->items[i];
+    if (item->count >= count)
+      return;
+  }
+  item->hash = hash;
+  item->count = count;
+  item->len = len;
+  if (len)
+    memcpy(item->value, value, len);
+}
+
+static int zsv_topk_alloc(struct zsv_topk *t) {
+  return !t->counts && !(t->counts = calloc(ZSV_TOPK_DEPTH * ZSV_TOPK_WIDTH, sizeof(*t->counts)));
+}
+
+int zsv_topk_add(struct zsv_topk *t, const unsigned char *value, size_t len, uint64_t hash) {
+  if (zsv_topk_alloc(t))
+    return 1;
+  uint64_t count = zsv_topk_count(t, hash, 1);
+  if (len <= ZSV_TOPK_MAX_VALUE_LEN)
+    zsv_topk_offer(t, value, len, hash, count);
+  return 0;
+}
+
+int zsv_topk_merge(struct zsv_topk *t, const struct zsv_topk *other) {
+  if (!other->counts)
+    return 0;
+  if (zsv_topk_alloc(t))
+    return 1;
+  for (size_t i = 0; i < ZSV_TOPK_DEPTH * ZSV_TOPK_WIDTH; i++)
+    t->counts[i] = t->counts[i] > UINT32_MAX - other->counts[i] ? UINT32_MAX : t->counts[i] + other->counts[i];
+
+  // estimate the items of both again, from the merged counters
+  for (size_t i = 0; i < t->item_count; i++)
+    t->items[i].count = zsv_topk_count(t, t->items[i].hash, 0);
+  for (size_t i = 0; i < other->item_count; i++) {
+    const struct zsv_topk_item *item = &other->items[i];
+    zsv_topk_offer(t, item->value, item->len, item->hash, zsv_topk_count(t, item->hash, 0));
+  }
+  return 0;
+}
+
+static int zsv_topk_item_cmp(const void *x, const void *y) {
+  const struct zsv_topk_item *a = x, *b = y;
+  if (a->count != b->count)
+    return a->count > b->count ? -1 : 1;
+  size_t len = a->len < b->len ? a->len : b->len;
+  int c = memcmp(a->value, b->value, len);
+  return c ? c : a->len < b->len ? -1 : a->len > b->len;
+}
+
+void zsv_topk_sort(struct zsv_topk *t) {
+  qsort(t->items, t->item_count, sizeof(*t->items), zsv_topk_item_cmp);
+}
+
+void zsv_topk_clear(struct zsv_topk *t) {
+  if (t->counts)
+    memset(t->counts, 0, ZSV_TOPK_DEPTH * ZSV_TOPK_WIDTH * sizeof(*t->counts));
+  t->item_count = 0;
+}
+
+void zsv_topk_free(struct zsv_topk *t) {
+  free(t->counts);
+  memset(t, 0, sizeof(*t));
+}
@@ -0,0 +1,95 @@
+#ifndef ZSV_UTILS_SKETCH_H
+#define ZSV_UTILS_SKETCH_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+/**
+ * Fixed-size summaries of a stream of values, for profiling columns of large files
+ *
+ * Each sketch is built from part of the data and can be merged with another sketch of
+ * the same kind built from another part, so that parts of a file can be read in parallel:
+ * - zsv_hll: HyperLogLog estimate of the number of distinct values, with a standard
+ *   error of about 1.6%
+ * - zsv_tdigest: t-digest of numeric values, for estimates of quantiles such as the
+ *   median, most accurate near the extremes
+ * - zsv_topk: count-min sketch of value frequencies, with the values seen so far that
+ *   have the highest estimated counts. An estimate is never less than the true count
+ *
+ * A sketch is initialized by zeroing it, allocates its memory when the first value is
+ * added, and is freed with its _free() function. Functions that allocate return non-zero
+ * if out of memory. Values are added to zsv_hll and zsv_topk by their zsv_hash() (see hash.h)
+ */
+
+#define ZSV_HLL_PRECISION 12
+#define ZSV_HLL_REGISTERS (1 << ZSV_HLL_PRECISION)
+
+struct zsv_hll {
+  uint8_t *registers; // ZSV_HLL_REGISTERS entries
+};
+
+int zsv_hll_add(struct zsv_hll *h, uint64_t hash);
+int zsv_hll_merge(struct zsv_hll *h, const struct zsv_hll *other);
+uint64_t zsv_hll_estimate(const struct zsv_hll *h);
+void zsv_hll_clear(struct zsv_hll *h); // remove all values, keeping the memory
+void zsv_hll_free(struct zsv_hll *h);
+
+#define ZSV_TDIGEST_COMPRESSION 100
+#define ZSV_TDIGEST_CAPACITY (5 * ZSV_TDIGEST_COMPRESSION) // centroids, including those not yet merged
+
+struct zsv_tdigest_centroid {
+  double mean;
+  double weight;
+};
+
+struct zsv_tdigest {
+  struct zsv_tdigest_centroid *centroids; // ZSV_TDIGEST_CAPACITY entries
+  size_t count;                           // centroids used
+  size_t merged;                          // the first merged centroids are compressed, in order of mean
+  double weight;                          // number of values
+  double min, max;
+};
+
+int zsv_tdigest_add(struct zsv_tdigest *t, double value);
+int zsv_tdigest_merge(struct zsv_tdigest *t, const struct zsv_tdigest *other);
+
+/**
+ * Estimate the value at the given quantile, from 0 (the minimum) to 1 (the maximum).
+ * The digest must not be empty
+ */
+double zsv_tdigest_quantile(struct zsv_tdigest *t, double q);
+
+void zsv_tdigest_clear(struct zsv_tdigest *t);
+void zsv_tdigest_free(struct zsv_tdigest *t);
+
+#define ZSV_TOPK_DEPTH 4
+#define ZSV_TOPK_WIDTH_BITS 10
+#define ZSV_TOPK_WIDTH (1 << ZSV_TOPK_WIDTH_BITS) // DEPTH x WIDTH_BITS must not exceed the 64 bits of a hash
+#define ZSV_TOPK_K 8
+#define ZSV_TOPK_MAX_VALUE_LEN 64 // longer values are counted, but never reported as top values
+
+struct zsv_topk_item {
+  uint64_t hash;
+  uint64_t count; // estimated
+  size_t len;
+  unsigned char value[ZSV_TOPK_MAX_VALUE_LEN];
+};
+
+struct zsv_topk {
+  uint32_t *counts; // ZSV_TOPK_DEPTH rows of ZSV_TOPK_WIDTH counters
+  struct zsv_topk_item items[ZSV_TOPK_K];
+  size_t item_count;
+};
+
+int zsv_topk_add(struct zsv_topk *t, const unsigned char *value, size_t len, uint64_t hash);
+int zsv_topk_merge(struct zsv_topk *t, const struct zsv_topk *other);
+
+/**
+ * Order the items by estimated count, highest first
+ */
+void zsv_topk_sort(struct zsv_topk *t);
+
+void zsv_topk_clear(struct zsv_topk *t);
+void zsv_topk_free(struct zsv_topk *t);
+
+#endif
@@ -0,0 +1,776 @@
+// /src/app/utils/sort.c: implements /src/app/utils/sort.h
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <inttypes.h>
+#include <unistd.h>
+#ifndef ZSV_NO_PARALLEL
+#include <pthread.h>
+#endif
+
+#include <zsv.h>
+#include <zsv/utils/file.h>
+#include <zsv/utils/string.h>
+#include <zsv/utils/coltype.h>
+#include "sort.h"
+
+#define ZSV_SORT_ARENA_BLOCK_SIZE (1024 * 1024)
+
+// maximum number of runs merged at once; when there are more, runs are first merged
+// into larger runs
+#define ZSV_SORT_MAX_FANIN 128
+
+/**
+ * Each row is stored as a record that starts with a header of two u32 values, the key length
+ * and the payload length, followed by the key and then the payload. The payload is the
+ * cell count followed by each cell as [u32 length][u8 quoted flags][bytes], or, for rows added
+ * with zsv_sorter_add_data(), the caller's data.
+ * Run files consist of the same records, in sorted order
+ */
+#define ZSV_SORT_REC_HEADER_LEN 8
+
+struct zsv_sort_entry {
+  uint64_t prefix; // first 8 key bytes, big-endian
+  unsigned char *rec;
+};
+
+struct zsv_sort_block {
+  struct zsv_sort_block *next;
+  size_t used;
+  size_t size;
+  unsigned char data[];
+};
+
+struct zsv_sort_run {
+  char *filename;
+  FILE *f;
+};
+
+struct zsv_sort_source {
+  // in-memory source
+  struct zsv_sort_entry *entries;
+  struct zsv_sort_entry *entries_end;
+
+  // file source
+  FILE *f;
+  unsigned char *buff;
+  size_t buff_size;
+
+  // current record, or NULL if exhausted
+  const unsigned char *rec;
+};
+
+struct zsv_sort_merge {
+  struct zsv_sort_source *sources;
+  size_t count;
+  size_t *tree; // tree[0] is the winner; other nodes hold losers
+};
+
+struct zsv_sorter {
+  struct zsv_sort_opts opts;
+  size_t max_memory;
+  unsigned int threads;
+
+  struct zsv_sort_block *blocks;
+  size_t arena_bytes; // bytes used by records
+
+  struct zsv_sort_entry *entries;
+  size_t entry_count;
+  size_t entry_capacity;
+
+  uint64_t row_count;
+
+  unsigned char *key;
+  size_t key_len;
+  size_t key_capacity;
+
+  unsigned char *fold; // lowercased text, for fold_case keys
+  size_t fold_capacity;
+
+  struct zsv_sort_run *runs;
+  size_t run_count;
+
+  // final merge
+  struct zsv_sort_merge merge;
+  char advance_winner;
+
+  struct zsv_cell *cells;
+  size_t cells_capacity;
+};
+
+static inline void zsv_sort_put_u32(unsigned char *p, uint32_t v) {
+  memcpy(p, &v, sizeof(v));
+}
+
+static inline uint32_t zsv_sort_get_u32(const unsigned char *p) {
+  uint32_t v;
+  memcpy(&v, p, sizeof(v));
+  return v;
+}
+
+static inline size_t zsv_sort_rec_len(const unsigned char *rec) {
+  return ZSV_SORT_REC_HEADER_LEN + (size_t)zsv_sort_get_u32(rec) + (size_t)zsv_sort_get_u32(rec + 4);
+}
+
+static int zsv_sort_key_reserve(struct zsv_sorter *s, size_t more) {
+  if (s->key_len + more > s->key_capacity) {
+    size_t cap = s->key_capacity ? s->key_capacity : 256;
+    while (cap < s->key_len + more)
+      cap *= 2;
+    unsigned char *k = realloc(s->key, cap);
+    if (!k)
+      return 1;
+    s->key = k;
+    s->key_capacity = cap;
+  }
+  return 0;
+}
+
+/**
+ * Append a text value to the key so that memcmp() on encoded values gives the same order
+ * as on the original values, and no encoded value is a prefix of another: each 0x00 byte
+ * becomes 0x00 0xFF and the value is terminated by 0x00 0x00
+ */
+static int zsv_sort_key_add_text(struct zsv_sorter *s, const unsigned char *str, size_t len) {
+  if (zsv_sort_key_reserve(s, len * 2 + 2))
+    return 1;
+  unsigned char *k = s->key + s->key_len;
+  const unsigned char *zero;
+  while (len && (zero = memchr(str, 0, len))) {
+    size_t n = (size_t)(zero - str);
+    memcpy(k, str, n);
+    k += n;
+    *k++ = 0;
+    *k++ = 0xFF;
+    str = zero + 1;
+    len -= n + 1;
+  }
+  if (len) {
+    memcpy(k, str, len);
+    k += len;
+  }
+  *k++ = 0;
+  *k++ = 0;
+  s->key_len = (size_t)(k - s->key);
+  return 0;
+}
+
+// append lowercased text, as compared by zsv_strincmp()
+static int zsv_sort_key_add_folded(struct zsv_sorter *s, const unsigned char *str, size_t len) {
+  size_t i;
+  for (i = 0; i < len && str[i] < 128; i++)
+    ;
+  if (i == len) { // ascii
+    if (len > s->fold_capacity) {
+      unsigned char *fold = realloc(s->fold, len);
+      if (!fold)
+        return 1;
+      s->fold = fold;
+      s->fold_capacity = len;
+    }
+    for (i = 0; i < len; i++)
+      s->fold[i] = (unsigned char)tolower(str[i]);
+    return zsv_sort_key_add_text(s, s->fold, len);
+  }
+  unsigned char *lc = zsv_strtolowercase(str, &len);
+  if (!lc)
+    return 1;
+  int rc = zsv_sort_key_add_text(s, lc, len);
+  free(lc);
+  return rc;
+}
+
+/**
+ * Numeric keys start with a class byte: empty values sort first, then numbers, then any
+ * other text. Numbers are encoded as their IEEE-754 bits, flipped so that the unsigned
+ * big-endian value has the same order as the number
+ */
+static int zsv_sort_key_add(struct zsv_sorter *s, const struct zsv_sort_key *key, const unsigned char *str,
+                            size_t len) {
+  size_t start = s->key_len;
+  if (key->trim && len)
+    str = zsv_strtrim(str, &len);
+  if (key->numeric) {
+    double d;
+    if (zsv_sort_key_reserve(s, 9))
+      return 1;
+    if (!len)
+      s->key[s->key_len++] = 0;
+    else if (zsv_parse_number(str, len, ZSV_NUMBER_FINITE, &d) == len) {
+      uint64_t bits;
+      if (d == 0)
+        d = 0; // -0.0 == 0.0
+      memcpy(&bits, &d, sizeof(bits));
+      if (bits & ((uint64_t)1 << 63))
+        bits = ~bits;
+      else
+        bits |= (uint64_t)1 << 63;
+      s->key[s->key_len++] = 1;
+      for (int i = 7; i >= 0; i--)
+        s->key[s->key_len++] = (unsigned char)(bits >> (i * 8));
+    } else {
+      s->key[s->key_len++] = 2;
+      if (key->fold_case ? zsv_sort_key_add_folded(s, str, len) : zsv_sort_key_add_text(s, str, len))
+        return 1;
+    }
+  } else if (key->fold_case ? zsv_sort_key_add_folded(s, str, len) : zsv_sort_key_add_text(s, str, len))
+    return 1;
+
+  if (key->desc)
+    for (size_t i = start; i < s->key_len; i++)
+      s->key[i] = ~s->key[i];
+  return 0;
+}
+
+static int zsv_sort_make_key(struct zsv_sorter *s, zsv_parser parser, size_t cell_count) {
+  s->key_len = 0;
+  if (s->opts.key_count) {
+    for (size_t i = 0; i < s->opts.key_count; i++) {
+      const struct zsv_sort_key *key = &s->opts.keys[i];
+      struct zsv_cell c = key->col < cell_count ? zsv_get_cell(parser, key->col) : (struct zsv_cell){0};
+      if (zsv_sort_key_add(s, key, c.str, c.len))
+        return 1;
+    }
+  } else {
+    // all columns as text; each cell is preceded by 0x01 and the row ends with 0x00 so that
+    // a row sorts before any longer row that it is a prefix of
+    for (size_t i = 0; i < cell_count; i++) {
+      struct zsv_cell c = zsv_get_cell(parser, i);
+      if (zsv_sort_key_reserve(s, 1))
+        return 1;
+      s->key[s->key_len++] = 1;
+      if (zsv_sort_key_add_text(s, c.str, c.len))
+        return 1;
+    }
+    if (zsv_sort_key_reserve(s, 1))
+      return 1;
+    s->key[s->key_len++] = 0;
+  }
+
+  // the row number breaks ties, so that the sort is stable and every key is unique
+  if (zsv_sort_key_reserve(s, 8))
+    return 1;
+  for (int i = 7; i >= 0; i--)
+    s->key[s->key_len++] = (unsigned char)(s->row_count >> (i * 8));
+  return 0;
+}
+
+static unsigned char *zsv_sort_arena_alloc(struct zsv_sorter *s, size_t len) {
+  struct zsv_sort_block *b = s->blocks;
+  if (!b || b->size - b->used < len) {
+    size_t size = len > ZSV_SORT_ARENA_BLOCK_SIZE ? len : ZSV_SORT_ARENA_BLOCK_SIZE;
+    b = malloc(sizeof(*b) + size);
+    if (!b)
+      return NULL;
+    b->next = s->blocks;
+    b->used = 0;
+    b->size = size;
+    s->blocks = b;
+  }
+  unsigned char *p = b->data + b->used;
+  b->used += len;
+  s->arena_bytes += len;
+  return p;
+}
+
+static void zsv_sort_arena_clear(struct zsv_sorter *s) {
+  for (struct zsv_sort_block *next, *b = s->blocks; b; b = next) {
+    next = b->next;
+    free(b);
+  }
+  s->blocks = NULL;
+  s->arena_bytes = 0;
+}
+
+static uint64_t zsv_sort_prefix(const unsigned char *key, size_t len) {
+  uint64_t prefix = 0;
+  for (size_t i = 0; i < 8; i++)
+    prefix = (prefix << 8) | (i < len ? key[i] : 0);
+  return prefix;
+}
+
+static int zsv_sort_rec_cmp(const unsigned char *a, const unsigned char *b) {
+  size_t alen = zsv_sort_get_u32(a);
+  size_t blen = zsv_sort_get_u32(b);
+  int cmp = memcmp(a + ZSV_SORT_REC_HEADER_LEN, b + ZSV_SORT_REC_HEADER_LEN, alen < blen ? alen : blen);
+  if (cmp)
+    return cmp;
+  return alen < blen ? -1 : alen > blen;
+}
+
+static int zsv_sort_entry_cmp(const void *x, const void *y) {
+  return zsv_sort_rec_cmp(((const struct zsv_sort_entry *)x)->rec, ((const struct zsv_sort_entry *)y)->rec);
+}
+
+/**
+ * LSD radix sort on the 8-byte key prefixes, followed by a comparison sort of each group
+ * of entries whose prefixes are equal. tmp must have room for n entries
+ */
+static void zsv_sort_entries(struct zsv_sort_entry *entries, size_t n, struct zsv_sort_entry *tmp) {
+  struct zsv_sort_entry *src = entries, *dst = tmp;
+  for (unsigned int shift = 0; shift < 64; shift += 8) {
+    size_t counts[256] = {0};
+    for (size_t i = 0; i < n; i++)
+      counts[(src[i].prefix >> shift) & 0xFF]++;
+    if (n == 0 || counts[(src[0].prefix >> shift) & 0xFF] == n)
+      continue; // every entry has the same byte
+    size_t pos = 0;
+    for (size_t i = 0; i < 256; i++) {
+      size_t c = counts[i];
+      counts[i] = pos;
+      pos += c;
+    }
+    for (size_t i = 0; i < n; i++)
+      dst[counts[(src[i].prefix >> shift) & 0xFF]++] = src[i];
+    struct zsv_sort_entry *swap = src;
+    src = dst;
+    dst = swap;
+  }
+  if (src != entries)
+    memcpy(entries, src, n * sizeof(*entries));
+
+  for (size_t i = 0; i < n;) {
+    size_t j = i + 1;
+    while (j < n && entries[j].prefix == entries[i].prefix)
+      j++;
+    if (j - i > 1)
+      qsort(entries + i, j - i, sizeof(*entries), zsv_sort_entry_cmp);
+    i = j;
+  }
+}
+
+struct zsv_sort_slice {
+  struct zsv_sort_entry *entries;
+  struct zsv_sort_entry *tmp;
+  size_t n;
+};
+
+#ifndef ZSV_NO_PARALLEL
+static void *zsv_sort_slice_thread(void *arg) {
+  struct zsv_sort_slice *slice = arg;
+  zsv_sort_entries(slice->entries, slice->n, slice->tmp);
+  return NULL;
+}
+#endif
+
+/**
+ * Sort the in-memory entries as one or more consecutive slices. Returns the number of
+ * slices, each of which is sorted, or 0 on error
+ */
+static size_t zsv_sort_slices(struct zsv_sorter *s, struct zsv_sort_slice *slices) {
+  size_t slice_count = s->threads;
+  if (slice_count > s->entry_count)
+    slice_count = s->entry_count ? s->entry_count : 1;
+  struct zsv_sort_entry *tmp = malloc((s->entry_count ? s->entry_count : 1) * sizeof(*tmp));
+  if (!tmp)
+    return 0;
+  size_t per_slice = s->entry_count / slice_count;
+  for (size_t i = 0, start = 0; i < slice_count; i++) {
+    slices[i].entries = s->entries + start;
+    slices[i].tmp = tmp + start;
+    slices[i].n = i + 1 < slice_count ? per_slice : s->entry_count - start;
+    start += slices[i].n;
+  }
+
+#ifndef ZSV_NO_PARALLEL
+  if (slice_count > 1) {
+    pthread_t *threads = calloc(slice_count, sizeof(*threads));
+    char *started = calloc(slice_count, 1);
+    if (threads && started) {
+      for (size_t i = 1; i < slice_count; i++)
+        started[i] = pthread_create(&threads[i], NULL, zsv_sort_slice_thread, &slices[i]) == 0;
+      zsv_sort_entries(slices[0].entries, slices[0].n, slices[0].tmp);
+      for (size_t i = 1; i < slice_count; i++) {
+        if (started[i])
+          pthread_join(threads[i], NULL);
+        else
+          zsv_sort_entries(slices[i].entries, slices[i].n, slices[i].tmp);
+      }
+    } else {
+      for (size_t i = 0; i < slice_count; i++)
+        zsv_sort_entries(slices[i].entries, slices[i].n, slices[i].tmp);
+    }
+    free(threads);
+    free(started);
+  } else
+#endif
+    zsv_sort_entries(slices[0].entries, slices[0].n, slices[0].tmp);
+
+  free(tmp);
+  return slice_count;
+}
+
+static int zsv_sort_source_advance(struct zsv_sort_source *src) {
+  if (src->f) {
+    unsigned char header[ZSV_SORT_REC_HEADER_LEN];
+    if (fread(header, 1, sizeof(header), src->f) != sizeof(header)) {
+      src->rec = NULL;
+      return 0;
+    }
+    size_t len = zsv_sort_rec_len(header);
+    if (len > src->buff_size) {
+      size_t size = src->buff_size ? src->buff_size : 4096;
+      while (size < len)
+        size *= 2;
+      unsigned char *b = realloc(src->buff, size);
+      if (!b) {
+        src->rec = NULL;
+        return 1;
+      }
+      src->buff = b;
+      src->buff_size = size;
+    }
+    memcpy(src->buff, header, sizeof(header));
+    if (fread(src->buff + sizeof(header), 1, len - sizeof(header), src->f) != len - sizeof(header)) {
+      src->rec = NULL;
+      return 1;
+    }
+    src->rec = src->buff;
+  } else if (src->entries < src->entries_end)
+    src->rec = (src->entries++)->rec;
+  else
+    src->rec = NULL;
+  return 0;
+}
+
+// index `count` is a virtual source that beats all others; it is only used to initialize the tree
+static int zsv_sort_merge_less(struct zsv_sort_merge *m, size_t a, size_t b) {
+  if (a == m->count)
+    return 1;
+  if (b == m->count)
+    return 0;
+  const unsigned char *ra = m->sources[a].rec;
+  const unsigned char *rb = m->sources[b].rec;
+  if (!ra)
+    return 0;
+  if (!rb)
+    return 1;
+  return zsv_sort_rec_cmp(ra, rb) < 0;
+}
+
+static void zsv_sort_merge_adjust(struct zsv_sort_merge *m, size_t winner) {
+  for (size_t t = (winner + m->count) / 2; t > 0; t /= 2) {
+    if (zsv_sort_merge_less(m, m->tree[t], winner)) {
+      size_t loser = winner;
+      winner = m->tree[t];
+      m->tree[t] = loser;
+    }
+  }
+  m->tree[0] = winner;
+}
+
+/**
+ * Initialize a loser tree over the given sources, reading the first record of each
+ */
+static int zsv_sort_merge_init(struct zsv_sort_merge *m, struct zsv_sort_source *sources, size_t count) {
+  m->sources = sources;
+  m->count = count;
+  m->tree = malloc((count ? count : 1) * sizeof(*m->tree));
+  if (!m->tree)
+    return 1;
+  int err = 0;
+  for (size_t i = 0; i < count; i++) {
+    m->tree[i] = count;
+    err |= zsv_sort_source_advance(&sources[i]);
+  }
+  if (!count)
+    m->tree[0] = 0;
+  for (size_t i = count; i > 0; i--)
+    zsv_sort_merge_adjust(m, i - 1);
+  return err;
+}
+
+static const unsigned char *zsv_sort_merge_peek(struct zsv_sort_merge *m) {
+  return m->count ? m->sources[m->tree[0]].rec : NULL;
+}
+
+static int zsv_sort_merge_pop(struct zsv_sort_merge *m) {
+  size_t winner = m->tree[0];
+  int err = zsv_sort_source_advance(&m->sources[winner]);
+  zsv_sort_merge_adjust(m, winner);
+  return err;
+}
+
+static void zsv_sort_merge_free(struct zsv_sort_merge *m) {
+  if (m->sources)
+    for (size_t i = 0; i < m->count; i++)
+      free(m->sources[i].buff);
+  free(m->sources);
+  free(m->tree);
+  memset(m, 0, sizeof(*m));
+}
+
+static struct zsv_sort_run *zsv_sort_new_run(struct zsv_sorter *s) {
+  struct zsv_sort_run *runs = realloc(s->runs, (s->run_count + 1) * sizeof(*runs));
+  if (!runs)
+    return NULL;
+  s->runs = runs;
+  struct zsv_sort_run *run = &runs[s->run_count];
+  memset(run, 0, sizeof(*run));
+  if (!(run->filename = zsv_get_temp_filename("zss")) || !(run->f = fopen(run->filename, "w+b"))) {
+    if (run->filename)
+      perror(run->filename);
+    free(run->filename);
+    return NULL;
+  }
+  s->run_count++;
+  return run;
+}
+
+static void zsv_sort_close_run(struct zsv_sort_run *run) {
+  if (run->f)
+    fclose(run->f);
+  if (run->filename) {
+    unlink(run->filename);
+    free(run->filename);
+  }
+  memset(run, 0, sizeof(*run));
+}
+
+// merge all sources to the given run file
+static int zsv_sort_merge_to_run(struct zsv_sort_merge *m, struct zsv_sort_run *run) {
+  const unsigned char *rec;
+  int err = 0;
+  while (!err && (rec = zsv_sort_merge_peek(m))) {
+    size_t len = zsv_sort_rec_len(rec);
+    if (fwrite(rec, 1, len, run->f) != len)
+      err = 1;
+    else
+      err = zsv_sort_merge_pop(m);
+  }
+  if (!err && (fflush(run->f) || fseek(run->f, 0, SEEK_SET)))
+    err = 1;
+  return err;
+}
+
+/**
+ * Add sources for the sorted slices of the in-memory entries to the given array
+ */
+static size_t zsv_sort_add_slice_sources(struct zsv_sort_source *sources, struct zsv_sort_slice *slices,
+                                         size_t slice_count) {
+  for (size_t i = 0; i < slice_count; i++) {
+    memset(&sources[i], 0, sizeof(sources[i]));
+    sources[i].entries = slices[i].entries;
+    sources[i].entries_end = slices[i].entries + slices[i].n;
+  }
+  return slice_count;
+}
+
+// sort the in-memory entries and write them to a new run
+static enum zsv_sort_status zsv_sort_spill(struct zsv_sorter *s) {
+  struct zsv_sort_slice *slices = calloc(s->threads, sizeof(*slices));
+  struct zsv_sort_source *sources = calloc(s->threads, sizeof(*sources));
+  enum zsv_sort_status stat = zsv_sort_status_memory;
+  size_t slice_count;
+  if (slices && sources && (slice_count = zsv_sort_slices(s, slices))) {
+    struct zsv_sort_run *run = zsv_sort_new_run(s);
+    struct zsv_sort_merge m = {0};
+    stat = zsv_sort_status_error;
+    if (run) {
+      if (!zsv_sort_merge_init(&m, sources, zsv_sort_add_slice_sources(sources, slices, slice_count)) &&
+          !zsv_sort_merge_to_run(&m, run))
+        stat = zsv_sort_status_ok;
+      sources = NULL; // now owned by m
+      zsv_sort_merge_free(&m);
+    }
+    if (s->opts.verbose)
+      fprintf(stderr, "zsv sort: wrote run %zu (%zu rows)\n", s->run_count, s->entry_count);
+  }
+  free(sources);
+  free(slices);
+  zsv_sort_arena_clear(s);
+  s->entry_count = 0;
+  return stat;
+}
+
+zsv_sorter zsv_sorter_new(const struct zsv_sort_opts *opts) {
+  struct zsv_sorter *s = calloc(1, sizeof(*s));
+  if (s) {
+    s->opts = *opts;
+    s->max_memory = opts->max_memory ? opts->max_memory : (size_t)ZSV_SORT_DEFAULT_MAX_MEMORY_MB * 1024 * 1024;
+    s->threads = opts->threads ? opts->threads : 1;
+#ifdef ZSV_NO_PARALLEL
+    s->threads = 1;
+#endif
+  }
+  return s;
+}
+
+// make the key of the parser's current row, and allocate its record, with room for a payload of
+// the given length. Returns the payload's address, or NULL with *stat set
+static unsigned char *zsv_sort_add_rec(struct zsv_sorter *s, zsv_parser parser, size_t cell_count, size_t payload_len,
+                                       enum zsv_sort_status *stat) {
+  *stat = zsv_sort_status_memory;
+  if (zsv_sort_make_key(s, parser, cell_count))
+    return NULL;
+  if (s->key_len > UINT32_MAX || payload_len > UINT32_MAX) {
+    fprintf(stderr, "zsv sort: row %" PRIu64 " is too large\n", s->row_count + 1);
+    *stat = zsv_sort_status_error;
+    return NULL;
+  }
+
+  if (s->entry_count == s->entry_capacity) {
+    size_t cap = s->entry_capacity ? s->entry_capacity * 2 : 1024;
+    struct zsv_sort_entry *entries = realloc(s->entries, cap * sizeof(*entries));
+    if (!entries)
+      return NULL;
+    s->entries = entries;
+    s->entry_capacity = cap;
+  }
+
+  unsigned char *rec = zsv_sort_arena_alloc(s, ZSV_SORT_REC_HEADER_LEN + s->key_len + payload_len);
+  if (!rec)
+    return NULL;
+  zsv_sort_put_u32(rec, (uint32_t)s->key_len);
+  zsv_sort_put_u32(rec + 4, (uint32_t)payload_len);
+  memcpy(rec + ZSV_SORT_REC_HEADER_LEN, s->key, s->key_len);
+  s->entries[s->entry_count].prefix = zsv_sort_prefix(s->key, s->key_len);
+  s->entries[s->entry_count].rec = rec;
+  s->entry_count++;
+  s->row_count++;
+  *stat = zsv_sort_status_ok;
+  return rec + ZSV_SORT_REC_HEADER_LEN + s->key_len;
+}
+
+// spill the in-memory records once they reach the memory budget
+static enum zsv_sort_status zsv_sort_added(struct zsv_sorter *s) {
+  // the radix sort needs a second entry array
+  if (s->arena_bytes + s->entry_capacity * sizeof(*s->entries) * 2 >= s->max_memory)
+    return zsv_sort_spill(s);
+  return zsv_sort_status_ok;
+}
+
+enum zsv_sort_status zsv_sorter_add_row(zsv_sorter s, zsv_parser parser) {
+  size_t cell_count = zsv_cell_count(parser);
+  size_t payload_len = 4;
+  for (size_t i = 0; i < cell_count; i++)
+    payload_len += 5 + zsv_get_cell(parser, i).len;
+  enum zsv_sort_status stat;
+  unsigned char *p = zsv_sort_add_rec(s, parser, cell_count, payload_len, &stat);
+  if (!p)
+    return stat;
+  zsv_sort_put_u32(p, (uint32_t)cell_count);
+  p += 4;
+  for (size_t i = 0; i < cell_count; i++) {
+    struct zsv_cell c = zsv_get_cell(parser, i);
+    zsv_sort_put_u32(p, (uint32_t)c.len);
+    p[4] = (unsigned char)c.quoted;
+    p += 5;
+    if (c.len)
+      memcpy(p, c.str, c.len);
+    p += c.len;
+  }
+  return zsv_sort_added(s);
+}
+
+enum zsv_sort_status zsv_sorter_add_data(zsv_sorter s, zsv_parser parser, const void *data, size_t len) {
+  enum zsv_sort_status stat;
+  unsigned char *p = zsv_sort_add_rec(s, parser, zsv_cell_count(parser), len, &stat);
+  if (!p)
+    return stat;
+  if (len)
+    memcpy(p, data, len);
+  return zsv_sort_added(s);
+}
+
+enum zsv_sort_status zsv_sorter_finish(zsv_sorter s) {
+  // merge runs until there are few enough to merge together with the in-memory slices
+  while (s->run_count > 1 && s->run_count + s->threads > ZSV_SORT_MAX_FANIN) {
+    size_t count = s->run_count < ZSV_SORT_MAX_FANIN ? s->run_count : ZSV_SORT_MAX_FANIN;
+    struct zsv_sort_source *sources = calloc(count, sizeof(*sources));
+    struct zsv_sort_merge m = {0};
+    if (!sources)
+      return zsv_sort_status_memory;
+    for (size_t i = 0; i < count; i++)
+      sources[i].f = s->runs[i].f;
+    struct zsv_sort_run *run = zsv_sort_new_run(s);
+    int err = !run || zsv_sort_merge_init(&m, sources, count) || zsv_sort_merge_to_run(&m, run);
+    if (!m.sources)
+      free(sources);
+    zsv_sort_merge_free(&m);
+    if (err)
+      return zsv_sort_status_error;
+    for (size_t i = 0; i < count; i++)
+      zsv_sort_close_run(&s->runs[i]);
+    memmove(s->runs, s->runs + count, (s->run_count - count) * sizeof(*s->runs));
+    s->run_count -= count;
+  }
+
+  struct zsv_sort_slice *slices = calloc(s->threads, sizeof(*slices));
+  struct zsv_sort_source *sources = calloc(s->run_count + s->threads, sizeof(*sources));
+  size_t slice_count = 0;
+  if (!slices || !sources || (s->entry_count && !(slice_count = zsv_sort_slices(s, slices)))) {
+    free(slices);
+    free(sources);
+    return zsv_sort_status_memory;
+  }
+  for (size_t i = 0; i < s->run_count; i++)
+    sources[i].f = s->runs[i].f;
+  size_t count = s->run_count + zsv_sort_add_slice_sources(sources + s->run_count, slices, slice_count);
+  free(slices);
+  if (zsv_sort_merge_init(&s->merge, sources, count))
+    return zsv_sort_status_error;
+  return zsv_sort_status_ok;
+}
+
+int zsv_sorter_next(zsv_sorter s, struct zsv_cell **cells, size_t *cell_count) {
+  if (s->advance_winner && zsv_sort_merge_pop(&s->merge))
+    return -1;
+  const unsigned char *rec = zsv_sort_merge_peek(&s->merge);
+  if (!rec)
+    return 0;
+  s->advance_winner = 1;
+
+  const unsigned char *p = rec + ZSV_SORT_REC_HEADER_LEN + zsv_sort_get_u32(rec);
+  size_t count = zsv_sort_get_u32(p);
+  p += 4;
+  if (count > s->cells_capacity) {
+    struct zsv_cell *c = realloc(s->cells, count * sizeof(*c));
+    if (!c)
+      return -1;
+    s->cells = c;
+    s->cells_capacity = count;
+  }
+  for (size_t i = 0; i < count; i++) {
+    s->cells[i].len = zsv_sort_get_u32(p);
+    s->cells[i].quoted = (char)p[4];
+    s->cells[i].str = (unsigned char *)p + 5;
+    p += 5 + s->cells[i].len;
+  }
+  *cells = s->cells;
+  *cell_count = count;
+  return 1;
+}
+
+int zsv_sorter_next_data(zsv_sorter s, const unsigned char **data, size_t *len) {
+  if (s->advance_winner && zsv_sort_merge_pop(&s->merge))
+    return -1;
+  const unsigned char *rec = zsv_sort_merge_peek(&s->merge);
+  if (!rec)
+    return 0;
+  s->advance_winner = 1;
+  *data = rec + ZSV_SORT_REC_HEADER_LEN + zsv_sort_get_u32(rec);
+  *len = zsv_sort_get_u32(rec + 4);
+  return 1;
+}
+
+uint64_t zsv_sorter_row_count(zsv_sorter s) {
+  return s->row_count;
+}
+
+void zsv_sorter_delete(zsv_sorter s) {
+  if (s) {
+    zsv_sort_merge_free(&s->merge);
+    for (size_t i = 0; i < s->run_count; i++)
+      zsv_sort_close_run(&s->runs[i]);
+    free(s->runs);
+    zsv_sort_arena_clear(s);
+    free(s->entries);
+    free(s->key);
+    free(s->fold);
+    free(s->cells);
+    free(s);
+  }
+}
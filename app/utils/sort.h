@@ -0,0 +1,93 @@
+#ifndef ZSV_UTILS_SORT_H
+#define ZSV_UTILS_SORT_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "zsv/common.h"
+
+/**
+ * External merge sort of CSV rows
+ *
+ * Rows are added one at a time from a parser. Each row is stored in a memory arena
+ * together with a normalized key, whose bytes compare with memcmp() in the requested
+ * order. When the arena reaches the memory budget, its rows are sorted (split into
+ * slices that are radix-sorted in parallel on the first 8 key bytes) and spilled to a
+ * temporary run file. Sorted rows are then returned by merging all runs through a
+ * loser tree.
+ *
+ * Sorting is stable: rows with equal keys are returned in input order.
+ */
+
+#define ZSV_SORT_DEFAULT_MAX_MEMORY_MB 1024
+
+struct zsv_sort_key {
+  size_t col; // 0-based column index
+  // if set, cells that are numbers sort numerically before all other cells, which
+  // sort as text
+  unsigned char numeric : 1;
+  unsigned char desc : 1;
+  // if set, leading and trailing whitespace is ignored
+  unsigned char trim : 1;
+  // if set, text is compared case-insensitively, in the same order as zsv_strincmp()
+  unsigned char fold_case : 1;
+  unsigned char _ : 4;
+};
+
+struct zsv_sort_opts {
+  struct zsv_sort_key *keys; // if no keys, sort by all columns as text
+  size_t key_count;
+  size_t max_memory;    // bytes; 0 = ZSV_SORT_DEFAULT_MAX_MEMORY_MB
+  unsigned int threads; // number of threads used to sort each run; 0 or 1 = no threads
+  char verbose;
+};
+
+enum zsv_sort_status {
+  zsv_sort_status_ok = 0,
+  zsv_sort_status_memory,
+  zsv_sort_status_error
+};
+
+typedef struct zsv_sorter *zsv_sorter;
+
+zsv_sorter zsv_sorter_new(const struct zsv_sort_opts *opts);
+
+/**
+ * Add the current row of the given parser
+ */
+enum zsv_sort_status zsv_sorter_add_row(zsv_sorter s, zsv_parser parser);
+
+/**
+ * Add the key of the current row of the given parser, with the given data in place of the
+ * row's cells, e.g. the row's offset in its file. Rows added this way are returned by
+ * zsv_sorter_next_data(), and must not be mixed with rows added by zsv_sorter_add_row()
+ */
+enum zsv_sort_status zsv_sorter_add_data(zsv_sorter s, zsv_parser parser, const void *data, size_t len);
+
+/**
+ * Finish adding rows and prepare to return them in sorted order
+ */
+enum zsv_sort_status zsv_sorter_finish(zsv_sorter s);
+
+/**
+ * Get the next sorted row. Returns 0 when there are no more rows, or -1 on error;
+ * otherwise, returns 1 and sets *cells to an array of *cell_count cells that remains
+ * valid until the next call. A cell's `quoted` flag is copied from the input, so that a
+ * writer only needs to check for characters requiring quotes when it is set
+ */
+int zsv_sorter_next(zsv_sorter s, struct zsv_cell **cells, size_t *cell_count);
+
+/**
+ * Get the data of the next sorted row that was added with zsv_sorter_add_data(). Returns as
+ * zsv_sorter_next() does, and sets *data to *len bytes that remain valid until the next call
+ */
+int zsv_sorter_next_data(zsv_sorter s, const unsigned char **data, size_t *len);
+
+/**
+ * Number of rows added
+ */
+uint64_t zsv_sorter_row_count(zsv_sorter s);
+
+void zsv_sorter_delete(zsv_sorter s);
+
+#endif
@@ -0,0 +1,3 @@
+cd src
+copy config.h.win32 config.h
+nmake -f Makefile.windows
@@ -0,0 +1,3 @@
+cd src
+copy config.h.win64 config.h
+nmake -f Makefile.windows